@@ -2,6 +2,8 @@
 
 #include "simd/api/detail.h"
 
+#include <limits>
+
 namespace simd {
 DEFINE_API_BINARY_OP(max);
 DEFINE_API_BINARY_OP(min);
@@ -15,53 +17,184 @@ DEFINE_API_BINARY_OP(copysign);
 DEFINE_API_UNARY_OP(sign);
 DEFINE_API_UNARY_OP(bitofsign);
 
+/// padded vectors (Vec<T, W>::padded(), e.g. Vec<float, 3>): mask queries
+/// read the W lane bits of padded_mask, which leaves the padding lanes out,
+/// and reductions run over x with the padding lanes set to the neutral value
+namespace detail {
+/// lane bits of x, 64 lanes per word, padding lanes clear; built register
+/// by register, the lanes of one register (at most 64) never straddle words
+template <typename T, size_t W>
+struct padded_mask
+{
+    static constexpr size_t n_words = (W + 63) / 64;
+    uint64_t words[n_words] = {};
+
+    explicit padded_mask(const VecBool<T, W>& x) noexcept
+    {
+        constexpr size_t L = Vec<T, W>::reg_lanes();
+        constexpr size_t nregs = Vec<T, W>::n_regs();
+        SIMD_UNROLL
+        for (size_t idx = 0; idx < nregs; idx++) {
+            const size_t lane = idx * L;
+            uint64_t m = VecBool<T, L>(x.reg(idx)).to_mask();
+            if (W - lane < L) {
+                m &= (1ull << (W - lane)) - 1;
+            }
+            words[lane / 64] |= m << (lane % 64);
+        }
+    }
+
+    /// the bits of the W lanes in word i
+    static constexpr uint64_t full(size_t i) noexcept
+    {
+        return W - 64 * i >= 64 ? ~0ull : (1ull << (W - 64 * i)) - 1;
+    }
+
+    bool all() const noexcept
+    {
+        bool ret = true;
+        for (size_t i = 0; i < n_words; i++) {
+            ret = ret && words[i] == full(i);
+        }
+        return ret;
+    }
+    bool any() const noexcept
+    {
+        uint64_t ret = 0;
+        for (size_t i = 0; i < n_words; i++) {
+            ret |= words[i];
+        }
+        return ret != 0;
+    }
+    int count() const noexcept
+    {
+        int ret = 0;
+        for (size_t i = 0; i < n_words; i++) {
+            ret += bits::count1(words[i]);
+        }
+        return ret;
+    }
+    int first() const noexcept
+    {
+        for (size_t i = 0; i < n_words; i++) {
+            if (words[i]) {
+                return int(64 * i) + __builtin_ctzll(words[i]);
+            }
+        }
+        return -1;
+    }
+    int last() const noexcept
+    {
+        for (size_t i = n_words; i-- > 0;) {
+            if (words[i]) {
+                return int(64 * i) + 63 - __builtin_clzll(words[i]);
+            }
+        }
+        return -1;
+    }
+};
+
+/// in registers, lane < W picks x; writing the lanes through memory would
+/// stall on store forwarding. The lane index counts from the start of the
+/// last register (every other lane reads 0), so it fits 8-bit lanes for
+/// any W
+template <typename T, size_t W>
+Vec<T, W> fill_padding(const Vec<T, W>& x, T val) noexcept
+{
+    using A = typename Vec<T, W>::arch_t;
+    constexpr size_t last = Vec<T, W>::padded_lanes() - Vec<T, W>::reg_lanes();
+    struct lane_index
+    {
+        alignas(64) T value[Vec<T, W>::padded_lanes()];
+        lane_index() noexcept
+        {
+            for (size_t i = 0; i < Vec<T, W>::padded_lanes(); i++) {
+                value[i] = T(i < last ? 0 : i - last);
+            }
+        }
+    };
+    static const lane_index index;
+    const auto idx = kernel::load_aligned<T, W>(index.value, A{});
+    return select(Vec<T, W>(T(W - last)) > idx, x, Vec<T, W>(val));
+}
+}  // namespace detail
+
 template <typename T, size_t W>
 bool all_of(const VecBool<T, W>& x) noexcept
 {
     using A = typename VecBool<T, W>::arch_t;
-    return kernel::all_of<T, W>(x, A{});
+    SIMD_IF_CONSTEXPR(Vec<T, W>::padded()) {
+        return detail::padded_mask<T, W>(x).all();
+    } else {
+        return kernel::all_of<T, W>(x, A{});
+    }
 }
 
 template <typename T, size_t W>
 bool any_of(const VecBool<T, W>& x) noexcept
 {
     using A = typename VecBool<T, W>::arch_t;
-    return kernel::any_of<T, W>(x, A{});
+    SIMD_IF_CONSTEXPR(Vec<T, W>::padded()) {
+        return detail::padded_mask<T, W>(x).any();
+    } else {
+        return kernel::any_of<T, W>(x, A{});
+    }
 }
 
 template <typename T, size_t W>
 bool none_of(const VecBool<T, W>& x) noexcept
 {
     using A = typename VecBool<T, W>::arch_t;
-    return kernel::none_of<T, W>(x, A{});
+    SIMD_IF_CONSTEXPR(Vec<T, W>::padded()) {
+        return !detail::padded_mask<T, W>(x).any();
+    } else {
+        return kernel::none_of<T, W>(x, A{});
+    }
 }
 
 template <typename T, size_t W>
 bool some_of(const VecBool<T, W>& x) noexcept
 {
     using A = typename VecBool<T, W>::arch_t;
-    return kernel::some_of<T, W>(x, A{});
+    SIMD_IF_CONSTEXPR(Vec<T, W>::padded()) {
+        const detail::padded_mask<T, W> m(x);
+        return m.any() && !m.all();
+    } else {
+        return kernel::some_of<T, W>(x, A{});
+    }
 }
 
 template <typename T, size_t W>
 int popcount(const VecBool<T, W>& x) noexcept
 {
     using A = typename VecBool<T, W>::arch_t;
-    return kernel::popcount<T, W>(x, A{});
+    SIMD_IF_CONSTEXPR(Vec<T, W>::padded()) {
+        return detail::padded_mask<T, W>(x).count();
+    } else {
+        return kernel::popcount<T, W>(x, A{});
+    }
 }
 
 template <typename T, size_t W>
 int find_first_set(const VecBool<T, W>& x) noexcept
 {
     using A = typename VecBool<T, W>::arch_t;
-    return kernel::find_first_set<T, W>(x, A{});
+    SIMD_IF_CONSTEXPR(Vec<T, W>::padded()) {
+        return detail::padded_mask<T, W>(x).first();
+    } else {
+        return kernel::find_first_set<T, W>(x, A{});
+    }
 }
 
 template <typename T, size_t W>
 int find_last_set(const VecBool<T, W>& x) noexcept
 {
     using A = typename VecBool<T, W>::arch_t;
-    return kernel::find_last_set<T, W>(x, A{});
+    SIMD_IF_CONSTEXPR(Vec<T, W>::padded()) {
+        return detail::padded_mask<T, W>(x).last();
+    } else {
+        return kernel::find_last_set<T, W>(x, A{});
+    }
 }
 
 template <typename T, size_t W>
@@ -76,28 +209,49 @@ template <typename T, size_t W, typename F>
 T reduce(F&& f, const Vec<T, W>& x) noexcept
 {
     using A = typename Vec<T, W>::arch_t;
-    return kernel::reduce<T, W, F>(std::forward<F>(f), x, A{});
+    SIMD_IF_CONSTEXPR(Vec<T, W>::padded()) {
+        /// no neutral value known for f, fold the W lanes
+        T ret = x[0];
+        for (auto i = 1u; i < W; i++) {
+            ret = f(ret, x[i]);
+        }
+        return ret;
+    } else {
+        return kernel::reduce<T, W, F>(std::forward<F>(f), x, A{});
+    }
 }
 
 template <typename T, size_t W>
 T reduce_sum(const Vec<T, W>& x) noexcept
 {
     using A = typename Vec<T, W>::arch_t;
-    return kernel::reduce_sum<T, W>(x, A{});
+    SIMD_IF_CONSTEXPR(Vec<T, W>::padded()) {
+        return kernel::reduce_sum<T, W>(detail::fill_padding(x, T(0)), A{});
+    } else {
+        return kernel::reduce_sum<T, W>(x, A{});
+    }
 }
 
 template <typename T, size_t W>
 T reduce_max(const Vec<T, W>& x) noexcept
 {
     using A = typename Vec<T, W>::arch_t;
-    return kernel::reduce_max<T, W>(x, A{});
+    SIMD_IF_CONSTEXPR(Vec<T, W>::padded()) {
+        return kernel::reduce_max<T, W>(detail::fill_padding(x, std::numeric_limits<T>::lowest()), A{});
+    } else {
+        return kernel::reduce_max<T, W>(x, A{});
+    }
 }
 
 template <typename T, size_t W>
 T reduce_min(const Vec<T, W>& x) noexcept
 {
     using A = typename Vec<T, W>::arch_t;
-    return kernel::reduce_min<T, W>(x, A{});
+    SIMD_IF_CONSTEXPR(Vec<T, W>::padded()) {
+        return kernel::reduce_min<T, W>(detail::fill_padding(x, std::numeric_limits<T>::max()), A{});
+    } else {
+        return kernel::reduce_min<T, W>(x, A{});
+    }
 }
 
 /// permute
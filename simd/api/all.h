@@ -14,6 +14,8 @@
 #include "simd/api/math.h"
 #include "simd/api/memory.h"
 #include "simd/api/print.h"
+#include "simd/api/shuffle.h"
+#include "simd/api/transpose.h"
 #include "simd/api/trigo.h"
 
 namespace simd {
@@ -12,6 +12,13 @@ DEFINE_API_BINARY_OP(mod);
 
 DEFINE_API_UNARY_OP(neg);
 
+/// saturating arithmetic for integral only: clamp to the range of T instead of wrapping around
+DEFINE_API_BINARY_OP(add_sat);
+DEFINE_API_BINARY_OP(sub_sat);
+/// rounded Q7/Q15/Q31/Q63 fixed-point multiply (signed integral only),
+/// `mul_sat(min, min)` is the one product out of range and gives max
+DEFINE_API_BINARY_OP(mul_sat);
+
 /// compute `(x * y) + z` in one instructon when possible
 template <typename T, size_t W,
     REQUIRES(std::is_floating_point<T>::value)
@@ -75,4 +82,48 @@ Vec<T, W> fmsubadd(const Vec<T, W>& x, const Vec<T, W>& y, const Vec<T, W>& z) n
     using A = typename Vec<T, W>::arch_t;
     return kernel::fmsubadd<T, W>(x, y, z, A{});
 }
+
+/// complex conjugate of the split layout vector, negates the imag part
+template <typename T, size_t W>
+Vec<std::complex<T>, W> conj(const Vec<std::complex<T>, W>& x) noexcept
+{
+    return Vec<std::complex<T>, W>(x.real(), -x.imag());
+}
+
+/// compute `x * conj(y)` without forming conj(y), two fused operations
+template <typename T, size_t W>
+Vec<std::complex<T>, W> mul_conj(const Vec<std::complex<T>, W>& x, const Vec<std::complex<T>, W>& y) noexcept
+{
+    using A = typename Vec<std::complex<T>, W>::arch_t;
+    return kernel::mul_conj<std::complex<T>, W>(x, y, A{});
+}
+
+/// compute complex `(x * y) + z` in four fused operations
+template <typename T, size_t W>
+Vec<std::complex<T>, W> fmadd(const Vec<std::complex<T>, W>& x, const Vec<std::complex<T>, W>& y,
+                              const Vec<std::complex<T>, W>& z) noexcept
+{
+    using A = typename Vec<std::complex<T>, W>::arch_t;
+    return kernel::fmadd<std::complex<T>, W>(x, y, z, A{});
+}
+
+/// acc[i] + a[2i] * b[2i] + a[2i+1] * b[2i+1], consuming 2W bfloat16 of each
+/// vdpbf16ps with SIMD_WITH_AVX512_BF16, shift and fmadd otherwise
+template <size_t W>
+Vec<float, W> dot_bf16(const Vec<float, W>& acc, const bfloat16* a, const bfloat16* b) noexcept
+{
+    using A = typename Vec<float, W>::arch_t;
+    return kernel::dot_bf16<float, W>(acc, a, b, A{});
+}
+
+/// acc[i] + sum(a[4i+j] * b[4i+j]) for j < 4, unsigned by signed bytes
+/// vpdpbusd with SIMD_WITH_AVX512_VNNI (exact); elsewhere (v)pmaddubsw +
+/// (v)pmaddwd, whose int16 sum of each byte pair saturates, exact when
+/// |b| <= 64 or a <= 127
+template <size_t W>
+Vec<int32_t, W> dot_u8i8(const Vec<int32_t, W>& acc, const Vec<uint8_t, 4 * W>& a, const Vec<int8_t, 4 * W>& b) noexcept
+{
+    using A = typename Vec<int32_t, W>::arch_t;
+    return kernel::dot_u8i8<int32_t, W>(acc, a, b, A{});
+}
 }  // namespace simd
@@ -7,7 +7,65 @@ namespace simd {
 template <typename U, typename T, size_t W>
 Vec<U, W> cast(const Vec<T, W>& x) noexcept
 {
-    using A = typename Vec<T, W>::arch_t;
+    /// widening runs on the destination arch and narrowing on the source arch,
+    /// so the kernel always sees the widest registers involved
+    using A = typename std::conditional<(sizeof(U) > sizeof(T)),
+                                        typename Vec<U, W>::arch_t,
+                                        typename Vec<T, W>::arch_t>::type;
     return kernel::cast<U>(x, A{});
 }
+
+/// narrow `lo` and `hi` into one vector of half-size lanes (`lo` lanes first),
+/// each lane clamped to the range of U
+template <typename U, typename T, size_t W>
+Vec<U, 2 * W> pack_sat(const Vec<T, W>& lo, const Vec<T, W>& hi) noexcept
+{
+    static_assert(std::is_integral<U>::value && std::is_integral<T>::value && sizeof(U) * 2 == sizeof(T),
+        "pack_sat narrows integral lanes to half their size");
+    using A = typename Vec<T, W>::arch_t;
+    return kernel::pack_sat<U>(lo, hi, A{});
+}
+
+/// convert to wider lanes, split over K = sizeof(U) / sizeof(T) vectors of
+/// the same byte size, e.g. Vec<uint8_t, 32> => 4 x Vec<float, 8>
+template <typename U, typename T, size_t W>
+std::array<Vec<U, W * sizeof(T) / sizeof(U)>, sizeof(U) / sizeof(T)> widen(const Vec<T, W>& x) noexcept
+{
+    static_assert(sizeof(U) > sizeof(T) && W * sizeof(T) % sizeof(U) == 0,
+        "widen needs wider lanes and enough of them to fill each output vector");
+    using A = typename Vec<T, W>::arch_t;
+    return kernel::widen<U>(x, A{});
+}
+
+/// convert K = sizeof(T) / sizeof(U) vectors to narrower lanes, packed into
+/// one vector in order, e.g. 4 x Vec<float, 8> => Vec<uint8_t, 32>;
+/// out of range lanes wrap around like `static_cast` (float truncated first)
+template <typename U, typename T, size_t W, size_t K>
+Vec<U, W * K> narrow(const std::array<Vec<T, W>, K>& x) noexcept
+{
+    static_assert(sizeof(T) == K * sizeof(U), "narrow takes sizeof(T) / sizeof(U) vectors");
+    using A = typename Vec<T, W>::arch_t;
+    return kernel::narrow<U, false>(x, A{});
+}
+
+/// same as `narrow`, with out of range lanes clamped to the range of integral U
+template <typename U, typename T, size_t W, size_t K>
+Vec<U, W * K> narrow_sat(const std::array<Vec<T, W>, K>& x) noexcept
+{
+    static_assert(sizeof(T) == K * sizeof(U), "narrow_sat takes sizeof(T) / sizeof(U) vectors");
+    using A = typename Vec<T, W>::arch_t;
+    return kernel::narrow<U, true>(x, A{});
+}
+
+/// `narrow` / `narrow_sat` taking the vectors as arguments
+template <typename U, typename T, size_t W, typename... Vs>
+Vec<U, W * (sizeof...(Vs) + 1)> narrow(const Vec<T, W>& x, const Vs&... xs) noexcept
+{
+    return narrow<U>(std::array<Vec<T, W>, sizeof...(Vs) + 1>{{ x, xs... }});
+}
+template <typename U, typename T, size_t W, typename... Vs>
+Vec<U, W * (sizeof...(Vs) + 1)> narrow_sat(const Vec<T, W>& x, const Vs&... xs) noexcept
+{
+    return narrow_sat<U>(std::array<Vec<T, W>, sizeof...(Vs) + 1>{{ x, xs... }});
+}
 }  // namespace simd
@@ -13,6 +13,16 @@ DEFINE_API_BINARY_OP(bitwise_rshift);
 
 DEFINE_API_UNARY_OP(bitwise_not);
 
+/// any bitwise function of a, b and c: bit (a << 2 | b << 1 | c) of IMM
+/// is the result bit, e.g. 0xE8 majority, 0x96 a ^ b ^ c, 0xCA a ? b : c;
+/// one vpternlog per register on AVX512
+template <uint8_t IMM, typename T, size_t W>
+Vec<T, W> bitwise_ternlog(const Vec<T, W>& a, const Vec<T, W>& b, const Vec<T, W>& c) noexcept
+{
+    using A = typename Vec<T, W>::arch_t;
+    return kernel::bitwise_ternlog<IMM, T, W>(a, b, c, A{});
+}
+
 template <typename T, size_t W>
 VecBool<T, W> bitwise_not(const VecBool<T, W>& x) noexcept
 {
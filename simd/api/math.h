@@ -3,6 +3,7 @@
 #include "simd/api/detail.h"
 
 #include <cmath>
+#include <complex>
 
 namespace simd {
 
@@ -14,10 +15,29 @@ DEFINE_API_UNARY_OP(sqrt);
 /// Computes the natural logarithm of the vector x
 DEFINE_API_UNARY_OP(log);
 
-#if 0
 /// Computes the natural exponential of the vector x
 DEFINE_API_UNARY_OP(exp);
 
+/// Computes the square root of the sum of the squares of the x and y,
+/// without intermediate overflow or underflow
+DEFINE_API_BINARY_OP(hypot);
+
+/// magnitude of every complex element, as std::abs: hypot(re, im)
+template <typename T, size_t W>
+Vec<T, W> abs(const Vec<std::complex<T>, W>& z) noexcept
+{
+    return hypot(z.real(), z.imag());
+}
+
+/// squared magnitude of every complex element, as std::norm
+template <typename T, size_t W>
+Vec<T, W> norm(const Vec<std::complex<T>, W>& z) noexcept
+{
+    return fmadd(z.real(), z.real(), z.imag() * z.imag());
+}
+
+#if 0
+
 /// Computes the base 10 exponential of the vector x
 DEFINE_API_UNARY_OP(exp10);
 
@@ -27,11 +47,6 @@ DEFINE_API_UNARY_OP(exp2);
 /// Computes the natural exponential of the vector x, minus one
 DEFINE_API_UNARY_OP(expm1);
 
-/// Computes the square root of the sum of the squares of the x and y
-DEFINE_API_BINARY_OP(hypot);
-
-
-
 /// Computes the base 2 logarithm of the vector x
 DEFINE_API_UNARY_OP(log2);
 
@@ -22,14 +22,22 @@ template <typename T, size_t W>
 Vec<T, W> load_aligned(const T* mem) noexcept
 {
     using A = typename Vec<T, W>::arch_t;
-    return kernel::load_aligned<T, W>(mem, A{});
+    SIMD_IF_CONSTEXPR(Vec<T, W>::padded()) {
+        return kernel::load_masked<T, W>(mem, A{});
+    } else {
+        return kernel::load_aligned<T, W>(mem, A{});
+    }
 }
 
 template <typename T, size_t W>
 Vec<T, W> load_unaligned(const T* mem) noexcept
 {
     using A = typename Vec<T, W>::arch_t;
-    return kernel::load_unaligned<T, W>(mem, A{});
+    SIMD_IF_CONSTEXPR(Vec<T, W>::padded()) {
+        return kernel::load_masked<T, W>(mem, A{});
+    } else {
+        return kernel::load_unaligned<T, W>(mem, A{});
+    }
 }
 
 template <typename T, size_t W>
@@ -60,14 +68,22 @@ template <typename T, size_t W>
 void store_aligned(T* mem, const Vec<T, W>& x) noexcept
 {
     using A = typename Vec<T, W>::arch_t;
-    kernel::store_aligned<T, W>(mem, x, A{});
+    SIMD_IF_CONSTEXPR(Vec<T, W>::padded()) {
+        kernel::store_masked<T, W>(mem, x, A{});
+    } else {
+        kernel::store_aligned<T, W>(mem, x, A{});
+    }
 }
 
 template <typename T, size_t W>
 void store_unaligned(T* mem, const Vec<T, W>& x) noexcept
 {
     using A = typename Vec<T, W>::arch_t;
-    kernel::store_unaligned<T, W>(mem, x, A{});
+    SIMD_IF_CONSTEXPR(Vec<T, W>::padded()) {
+        kernel::store_masked<T, W>(mem, x, A{});
+    } else {
+        kernel::store_unaligned<T, W>(mem, x, A{});
+    }
 }
 
 template <typename T, size_t W>
@@ -94,6 +110,43 @@ void storeu(T* mem, const Vec<T, W>& x) noexcept
     store_unaligned<T, W>(mem, x);
 }
 
+/// fp16 storage, fp32 compute: W halves widened to float lanes
+/// (F16C/AVX512F vcvtph2ps when available, software otherwise)
+template <size_t W>
+Vec<float, W> load_half(const half* mem) noexcept
+{
+    static_assert(!Vec<float, W>::padded(), "load_half needs W filling whole registers");
+    using A = typename Vec<float, W>::arch_t;
+    return kernel::load_half<float, W>(mem, A{});
+}
+
+/// float lanes rounded to nearest even half and stored unaligned
+template <size_t W>
+void store_half(half* mem, const Vec<float, W>& x) noexcept
+{
+    static_assert(!Vec<float, W>::padded(), "store_half needs W filling whole registers");
+    using A = typename Vec<float, W>::arch_t;
+    kernel::store_half<float, W>(mem, x, A{});
+}
+
+/// bfloat16 storage: W values shifted into the upper half of float lanes
+template <size_t W>
+Vec<float, W> load_bf16(const bfloat16* mem) noexcept
+{
+    static_assert(!Vec<float, W>::padded(), "load_bf16 needs W filling whole registers");
+    using A = typename Vec<float, W>::arch_t;
+    return kernel::load_bf16<float, W>(mem, A{});
+}
+
+/// float lanes rounded to nearest even bfloat16 and stored unaligned
+template <size_t W>
+void store_bf16(bfloat16* mem, const Vec<float, W>& x) noexcept
+{
+    static_assert(!Vec<float, W>::padded(), "store_bf16 needs W filling whole registers");
+    using A = typename Vec<float, W>::arch_t;
+    kernel::store_bf16<float, W>(mem, x, A{});
+}
+
 /// set values sequentially from lower to higher
 /// vec[0] = v0, vec[1] = v1, vec[2] = v2, ...
 /// NOTE: the order is opposite from sse/avx intrinsic: set
@@ -101,8 +154,7 @@ template <typename T, size_t W, typename... Ts>
 Vec<T, W> set(T v0, T v1, Ts... vals) noexcept
 {
     static_assert(sizeof...(Ts) + 2 == W);
-    using A = typename Vec<T, W>::arch_t;
-    return kernel::set<T, W>(A{}, v0, v1, static_cast<T>(vals)...);
+    return Vec<T, W>(v0, v1, static_cast<T>(vals)...);
 }
 
 template <typename T, size_t W, typename U, typename V>
@@ -129,8 +181,7 @@ void scatter(const Vec<T, W>& x, U* mem, const Vec<V, W>& index) noexcept
 template <typename T, size_t W>
 uint64_t to_mask(const VecBool<T, W>& x) noexcept
 {
-    using A = typename VecBool<T, W>::arch_t;
-    return kernel::to_mask(x, A{});
+    return x.to_mask();
 }
 
 template <typename T, size_t W>
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "simd/api/detail.h"
+
+namespace simd {
+/// compile-time lane selection, lane i of the result is x[I_i]:
+/// `shuffle<3, 2, 1, 0>(v)` reverses a Vec<float, 4>
+/// the index list is matched at compile time against the single
+/// instructions of the target (pshufd / vpermilps immediates, palignr
+/// rotations, vpermq, cross-lane vpermps / vpermw ...), with pshufb or
+/// vpermt2* sequences as the general fallback
+template <size_t... I, typename T, size_t W>
+Vec<T, W> shuffle(const Vec<T, W>& x) noexcept
+{
+    static_assert(sizeof...(I) == W, "shuffle needs one index per lane");
+    static_assert(kernel::ops::shuffle_pattern<I...>::in_range(W), "shuffle index out of range");
+    using A = typename Vec<T, W>::arch_t;
+    return kernel::shuffle<T, W>(x, x, kernel::ops::shuffle_pattern<I...>(), A{});
+}
+
+/// two-source form over the concatenation (a, b): I_i < W picks a[I_i],
+/// I_i >= W picks b[I_i - W]; blends, unpacks, palignr / valignd shifts,
+/// shufps and whole 128-bit lane moves are single instructions
+template <size_t... I, typename T, size_t W>
+Vec<T, W> shuffle(const Vec<T, W>& a, const Vec<T, W>& b) noexcept
+{
+    static_assert(sizeof...(I) == W, "shuffle needs one index per lane");
+    static_assert(kernel::ops::shuffle_pattern<I...>::in_range(2 * W), "shuffle index out of range");
+    using A = typename Vec<T, W>::arch_t;
+    return kernel::shuffle<T, W>(a, b, kernel::ops::shuffle_pattern<I...>(), A{});
+}
+
+namespace detail {
+template <size_t K, typename T, size_t W, size_t... I>
+SIMD_INLINE
+Vec<T, W> slide(const Vec<T, W>& a, const Vec<T, W>& b, index_sequence<I...>) noexcept
+{
+    return shuffle<(I + K)...>(a, b);
+}
+
+template <size_t K, typename T, size_t W, size_t... I>
+SIMD_INLINE
+Vec<T, W> rotate(const Vec<T, W>& x, index_sequence<I...>) noexcept
+{
+    return shuffle<((I + K) % W)...>(x);
+}
+}  // namespace detail
+
+/// lanes K .. K + W - 1 of the concatenation (a, b): a moved down by K
+/// lanes, the top K filled from the next vector b; the stencil / window
+/// step without an unaligned reload. palignr, vperm2i128 + vpalignr,
+/// valignd / valignq
+template <size_t K, typename T, size_t W>
+Vec<T, W> slide_left(const Vec<T, W>& a, const Vec<T, W>& b) noexcept
+{
+    static_assert(K <= W, "slide_left by more than the lane count");
+    return detail::slide<K>(a, b, detail::make_index_sequence<W>());
+}
+
+/// b moved up by K lanes, the bottom K filled from the top of the previous
+/// vector a: lanes W - K .. 2 W - K - 1 of (a, b)
+template <size_t K, typename T, size_t W>
+Vec<T, W> slide_right(const Vec<T, W>& a, const Vec<T, W>& b) noexcept
+{
+    static_assert(K <= W, "slide_right by more than the lane count");
+    return detail::slide<W - K>(a, b, detail::make_index_sequence<W>());
+}
+
+/// lane i of the result is x[(i + K) % W]
+template <size_t K, typename T, size_t W>
+Vec<T, W> rotate(const Vec<T, W>& x) noexcept
+{
+    return detail::rotate<K % W>(x, detail::make_index_sequence<W>());
+}
+
+/// runtime lane selection, lane i of the result is x[idx[i] % W]; idx holds
+/// integers of the lane size of T, e.g. Vec<int32_t, W> for float.
+/// one-register vectors are a vpermps / vpermd / vpermw / vpermb or a
+/// pshufb sequence, wider ones go through memory
+template <typename T, size_t W, typename I>
+Vec<T, W> permute(const Vec<T, W>& x, const Vec<I, W>& idx) noexcept
+{
+    static_assert(std::is_integral<I>::value && sizeof(I) == sizeof(T),
+                  "permute needs integer indices of the lane size");
+    using A = typename Vec<T, W>::arch_t;
+    return kernel::permute<T, W>(x, idx, A{});
+}
+
+/// byte table lookup, lane i of the result is table[idx[i] % 16]:
+/// one pshufb per register, e.g. nibble to hex digit or nibble classes
+template <size_t W>
+Vec<uint8_t, W> lookup16(const Vec<uint8_t, 16>& table, const Vec<uint8_t, W>& idx) noexcept
+{
+    using A = typename Vec<uint8_t, W>::arch_t;
+    return kernel::lookup(table, idx, A{});
+}
+
+/// 32-entry table, lane i of the result is table[idx[i] % 32]: vpermb with
+/// AVX512VBMI, two pshufb and a blend on index bit 4 otherwise
+template <size_t W>
+Vec<uint8_t, W> lookup32(const Vec<uint8_t, 32>& table, const Vec<uint8_t, W>& idx) noexcept
+{
+    using A = typename Vec<uint8_t, W>::arch_t;
+    return kernel::lookup(table, idx, A{});
+}
+
+/// 64-entry table, lane i of the result is table[idx[i] % 64]: vpermb with
+/// AVX512VBMI, four pshufb and three blends otherwise
+template <size_t W>
+Vec<uint8_t, W> lookup64(const Vec<uint8_t, 64>& table, const Vec<uint8_t, W>& idx) noexcept
+{
+    using A = typename Vec<uint8_t, W>::arch_t;
+    return kernel::lookup(table, idx, A{});
+}
+}  // namespace simd
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "simd/api/detail.h"
+
+#include <array>
+
+namespace simd {
+/// transpose the W x W matrix whose rows are `rows`, in place:
+/// afterwards rows[i][j] holds the former rows[j][i]
+/// lowers to unpack rounds within 128-bit lanes plus a cross-lane stage
+/// (vperm2f128 for AVX, vshuff32x4 for AVX-512)
+template <typename T, size_t W>
+void transpose(std::array<Vec<T, W>, W>& rows) noexcept
+{
+    using A = typename Vec<T, W>::arch_t;
+    kernel::transpose<T, W>(rows, A{});
+}
+}  // namespace simd
@@ -2,17 +2,45 @@
 
 #include "simd/api/detail.h"
 
+#include <complex>
+#include <utility>
+
 namespace simd {
-#if 0
 /// trigonometric functions
 DEFINE_API_UNARY_OP(sin);
 DEFINE_API_UNARY_OP(cos);
-DEFINE_API_UNARY_OP(sincos);
+
+/// {sin(x), cos(x)} from one argument reduction
+template <typename T, size_t W>
+std::pair<Vec<T, W>, Vec<T, W>> sincos(const Vec<T, W>& x) noexcept
+{
+    using A = typename Vec<T, W>::arch_t;
+    return kernel::sincos<T, W>(x, A{});
+}
+
+/// angle of (x, y) in [-pi, pi], as std::atan2(y, x)
+DEFINE_API_BINARY_OP(atan2);
+
+/// phase angle of every complex element in [-pi, pi], as std::arg
+template <typename T, size_t W>
+Vec<T, W> arg(const Vec<std::complex<T>, W>& z) noexcept
+{
+    return atan2(z.imag(), z.real());
+}
+
+/// rho * (cos(theta) + sin(theta)i), as std::polar
+template <typename T, size_t W>
+Vec<std::complex<T>, W> polar(const Vec<T, W>& rho, const Vec<T, W>& theta) noexcept
+{
+    const auto sc = sincos(theta);
+    return Vec<std::complex<T>, W>(rho * sc.second, rho * sc.first);
+}
+
+#if 0
 DEFINE_API_UNARY_OP(tan);
 DEFINE_API_UNARY_OP(asin);
 DEFINE_API_UNARY_OP(acos);
 DEFINE_API_UNARY_OP(atan);
-DEFINE_API_UNARY_OP(atan2);
 
 /// hyperbolic functions
 DEFINE_API_UNARY_OP(sinh);
@@ -15,6 +15,8 @@ namespace simd { namespace kernel { namespace avx {
 #include "simd/arch/avx/logical.h"
 #include "simd/arch/avx/math.h"
 #include "simd/arch/avx/memory.h"
+#include "simd/arch/avx/transpose.h"
+#include "simd/arch/avx/shuffle.h"
 #include "simd/arch/avx/trigo.h"
 
 namespace simd { namespace kernel {
@@ -174,6 +176,39 @@ void store_unaligned(T* mem, const Vec<T, W>& x, requires_arch<AVX>) noexcept
     avx::store_unaligned<T, W>::apply(mem, x);
 }
 
+/// vmaskmovps/pd, integers take the generic path (AVX2 vpmaskmov)
+template <typename T, size_t W,
+    REQUIRES((std::is_floating_point<T>::value))>
+SIMD_INLINE
+Vec<T, W> load_masked(const T* mem, requires_arch<AVX>) noexcept
+{
+    return avx::load_masked<T, W>::apply(mem);
+}
+
+template <typename T, size_t W,
+    REQUIRES((std::is_floating_point<T>::value))>
+SIMD_INLINE
+void store_masked(T* mem, const Vec<T, W>& x, requires_arch<AVX>) noexcept
+{
+    avx::store_masked<T, W>::apply(mem, x);
+}
+
+#if SIMD_WITH_F16C
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> load_half(const half* mem, requires_arch<AVX>) noexcept
+{
+    return avx::load_half<T, W>::apply(mem);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+void store_half(half* mem, const Vec<T, W>& x, requires_arch<AVX>) noexcept
+{
+    avx::store_half<T, W>::apply(mem, x);
+}
+#endif
+
 template <typename T, size_t W>
 SIMD_INLINE
 Vec<std::complex<T>, W> load_complex(const Vec<T, W>& vlo, const Vec<T, W>& vhi, requires_arch<AVX>) noexcept
@@ -223,6 +258,80 @@ VecBool<T, W> from_mask(uint64_t x, requires_arch<AVX>) noexcept
     return avx::from_mask<T, W>::apply(x);
 }
 
+DEFINE_AVX_BINARY_OP(max);
+DEFINE_AVX_BINARY_OP(min);
+
+DEFINE_AVX_UNARY_OP(abs);
+DEFINE_AVX_UNARY_OP(sqrt);
+DEFINE_AVX_UNARY_OP(ceil);
+DEFINE_AVX_UNARY_OP(floor);
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> select(const VecBool<T, W>& cond, const Vec<T, W>& lhs, const Vec<T, W>& rhs, requires_arch<AVX>) noexcept
+{
+    return avx::select<T, W>::apply(cond, lhs, rhs);
+}
+
+template <typename U, typename T, size_t W,
+    REQUIRES((std::is_floating_point<U>::value && std::is_floating_point<T>::value))>
+SIMD_INLINE
+Vec<U, W> cast(const Vec<T, W>& x, requires_arch<AVX>) noexcept
+{
+    return avx::cast<U, T, W>::apply(x);
+}
+
+/// reduction
+template <typename T, size_t W,
+    REQUIRES(std::is_floating_point<T>::value)>
+SIMD_INLINE
+T reduce_sum(const Vec<T, W>& x, requires_arch<AVX>) noexcept
+{
+    return avx::reduce_sum<T, W>::apply(x);
+}
+
+template <typename T, size_t W,
+    REQUIRES(std::is_floating_point<T>::value)>
+SIMD_INLINE
+T reduce_max(const Vec<T, W>& x, requires_arch<AVX>) noexcept
+{
+    return avx::reduce_max<T, W>::apply(x);
+}
+
+template <typename T, size_t W,
+    REQUIRES(std::is_floating_point<T>::value)>
+SIMD_INLINE
+T reduce_min(const Vec<T, W>& x, requires_arch<AVX>) noexcept
+{
+    return avx::reduce_min<T, W>::apply(x);
+}
+
+/// transpose
+template <typename T, size_t W,
+    REQUIRES((sizeof(T) >= 4))>
+SIMD_INLINE
+void transpose(std::array<Vec<T, W>, W>& rows, requires_arch<AVX>) noexcept
+{
+    avx::transpose<T, W>::apply(rows);
+}
+
+/// shuffle
+template <typename T, size_t W, size_t... I,
+    REQUIRES((sizeof(T) >= 4))>
+SIMD_INLINE
+Vec<T, W> shuffle(const Vec<T, W>& a, const Vec<T, W>& b, ops::shuffle_pattern<I...> p, requires_arch<AVX>) noexcept
+{
+    return avx::shuffle<T, W>::apply(a, b, p);
+}
+
+template <typename T, size_t W, typename I,
+    REQUIRES(std::is_floating_point<T>::value)>
+SIMD_INLINE
+Vec<T, W> permute(const Vec<T, W>& x, const Vec<I, W>& idx, requires_arch<AVX>) noexcept
+{
+    return avx::permute<T, W>::apply(x, idx);
+}
+
 #undef DEFINE_AVX_BINARY_OP
 #undef DEFINE_AVX_UNARY_OP
 #undef DEFINE_AVX_BINARY_CMP_OP
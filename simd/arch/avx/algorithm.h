@@ -19,7 +19,7 @@ struct min<T, W, REQUIRE_INTEGRAL(T)>
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
         using sse_vec_t = Vec<T, reg_lanes/2>;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::forward_sse_op<detail::sse_min, sse_vec_t>
                                 (lhs.reg(idx), rhs.reg(idx));
@@ -36,7 +36,7 @@ struct min<float, W>
     {
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_min_ps(lhs.reg(idx), rhs.reg(idx));
         }
@@ -52,7 +52,7 @@ struct min<double, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_min_pd(lhs.reg(idx), rhs.reg(idx));
         }
@@ -73,7 +73,7 @@ struct max<T, W, REQUIRE_INTEGRAL(T)>
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
         using sse_vec_t = Vec<T, reg_lanes/2>;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::forward_sse_op<detail::sse_min, sse_vec_t>
                                 (lhs.reg(idx), rhs.reg(idx));
@@ -90,7 +90,7 @@ struct max<float, W>
     {
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_max_ps(lhs.reg(idx), rhs.reg(idx));
         }
@@ -106,7 +106,7 @@ struct max<double, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_max_pd(lhs.reg(idx), rhs.reg(idx));
         }
@@ -123,7 +123,7 @@ struct all_of<float, W>
     {
         bool ret = true;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret = ret && (_mm256_movemask_ps(x.reg(idx)) == 0xFF);
         }
@@ -139,7 +139,7 @@ struct all_of<double, W>
     {
         bool ret = true;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret = ret && (_mm256_movemask_pd(x.reg(idx)) == 0x0F);
         }
@@ -167,7 +167,6 @@ struct all_of<T, W, REQUIRE_INTEGRAL(T)>
         constexpr auto nregs = VecBool<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
         using sse_vbool_t = VecBool<T, reg_lanes/2>;
-        #pragma unroll
         for (auto idx = 0; ret && idx < nregs; idx++) {
             auto result = detail::forward_sse_op0<detail::sse_all_of, bool, sse_vbool_t>
                                 (x.reg(idx));
@@ -186,7 +185,7 @@ struct any_of<float, W>
     {
         bool ret = false;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret = ret || (_mm256_movemask_ps(x.reg(idx)) != 0);
         }
@@ -202,7 +201,7 @@ struct any_of<double, W>
     {
         bool ret = false;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret = ret || (_mm256_movemask_pd(x.reg(idx)) != 0);
         }
@@ -220,7 +219,7 @@ struct any_of<T, W, REQUIRE_INTEGRAL(T)>
 
         bool ret = false;
         constexpr auto nregs = VecBool<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret = ret || (!_mm256_testz_si256(x.reg(idx), x.reg(idx)));
         }
@@ -239,7 +238,7 @@ struct select<T, W, REQUIRE_INTEGRAL(T)>
 
         Vec<T, W> ret;
         constexpr auto nregs = VecBool<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_or_si256(
                             _mm256_and_si256(cond.reg(idx), lhs.reg(idx)),
@@ -258,7 +257,7 @@ struct select<float, W>
     {
         Vec<float, W> ret;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_blendv_ps(rhs.reg(idx), lhs.reg(idx), cond.reg(idx));
         }
@@ -274,7 +273,7 @@ struct select<double, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_blendv_pd(rhs.reg(idx), lhs.reg(idx), cond.reg(idx));
         }
@@ -291,7 +290,7 @@ struct popcount<float, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret += bits::count1(_mm256_movemask_ps(x.reg(idx)));
         }
@@ -307,7 +306,7 @@ struct popcount<double, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret += bits::count1(_mm256_movemask_pd(x.reg(idx)));
         }
@@ -349,22 +348,22 @@ struct popcount<T, W, REQUIRE_INTEGRAL(T)>
         int ret = 0;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += bits::count1(_mm256_movemask_epi8(x.reg(idx)));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += detail::avx_count1_mask_epi16(x.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += detail::avx_count1_mask_epi32(x.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += detail::avx_count1_mask_epi64(x.reg(idx));
             }
@@ -382,7 +381,7 @@ struct find_first_set<float, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             // TODO:
         }
@@ -398,7 +397,7 @@ struct find_first_set<double, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             // TODO:
         }
@@ -417,19 +416,19 @@ struct find_first_set<T, W, REQUIRE_INTEGRAL(T)>
         int ret = 0;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         }
@@ -446,7 +445,7 @@ struct find_last_set<float, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
         }
         return ret;
@@ -461,7 +460,7 @@ struct find_last_set<double, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
         }
         return ret;
@@ -479,19 +478,19 @@ struct find_last_set<T, W, REQUIRE_INTEGRAL(T)>
         int ret = 0;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         }
@@ -553,6 +552,78 @@ double reduce_sum_f64(const __m128d& x) noexcept
     return _mm_cvtsd_f64(tmp);    /// latency=5
 #endif
 }
+
+/// fold upper 128bits onto lower 128bits, then reduce as sse register
+SIMD_INLINE
+float reduce_sum_f32(const __m256& x) noexcept
+{
+    return reduce_sum_f32(_mm_add_ps(_mm256_castps256_ps128(x),
+                                     _mm256_extractf128_ps(x, 1)));
+}
+
+SIMD_INLINE
+double reduce_sum_f64(const __m256d& x) noexcept
+{
+    return reduce_sum_f64(_mm_add_pd(_mm256_castpd256_pd128(x),
+                                     _mm256_extractf128_pd(x, 1)));
+}
+
+SIMD_INLINE
+float reduce_max_f32(const __m128& x) noexcept
+{
+    auto tmp1 = _mm_max_ps(x, _mm_movehl_ps(x, x));
+    auto tmp2 = _mm_max_ps(tmp1, _mm_shuffle_ps(tmp1, tmp1, 1));
+    return _mm_cvtss_f32(tmp2);
+}
+
+SIMD_INLINE
+float reduce_min_f32(const __m128& x) noexcept
+{
+    auto tmp1 = _mm_min_ps(x, _mm_movehl_ps(x, x));
+    auto tmp2 = _mm_min_ps(tmp1, _mm_shuffle_ps(tmp1, tmp1, 1));
+    return _mm_cvtss_f32(tmp2);
+}
+
+SIMD_INLINE
+double reduce_max_f64(const __m128d& x) noexcept
+{
+    return _mm_cvtsd_f64(_mm_max_pd(x, _mm_unpackhi_pd(x, x)));
+}
+
+SIMD_INLINE
+double reduce_min_f64(const __m128d& x) noexcept
+{
+    return _mm_cvtsd_f64(_mm_min_pd(x, _mm_unpackhi_pd(x, x)));
+}
+
+/// fold upper 128bits onto lower 128bits, then reduce as sse register
+SIMD_INLINE
+float reduce_max_f32(const __m256& x) noexcept
+{
+    return reduce_max_f32(_mm_max_ps(_mm256_castps256_ps128(x),
+                                     _mm256_extractf128_ps(x, 1)));
+}
+
+SIMD_INLINE
+float reduce_min_f32(const __m256& x) noexcept
+{
+    return reduce_min_f32(_mm_min_ps(_mm256_castps256_ps128(x),
+                                     _mm256_extractf128_ps(x, 1)));
+}
+
+SIMD_INLINE
+double reduce_max_f64(const __m256d& x) noexcept
+{
+    return reduce_max_f64(_mm_max_pd(_mm256_castpd256_pd128(x),
+                                     _mm256_extractf128_pd(x, 1)));
+}
+
+SIMD_INLINE
+double reduce_min_f64(const __m256d& x) noexcept
+{
+    return reduce_min_f64(_mm_min_pd(_mm256_castpd256_pd128(x),
+                                     _mm256_extractf128_pd(x, 1)));
+}
 }  // namespace detail
 template <typename T, size_t W>
 struct reduce_sum<T, W, REQUIRE_INTEGRAL(T)>
@@ -569,12 +640,12 @@ struct reduce_sum<T, W, REQUIRE_INTEGRAL(T)>
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
             ret = kernel::hadd<T, W>(x, Generic{});
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += detail::reduce_sum_i32<T>(x.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += detail::reduce_sum_i64<T>(x.reg(idx));
             }
@@ -589,13 +660,9 @@ struct reduce_sum<float, W>
     SIMD_INLINE
     static float apply(const Vec<float, W>& x) noexcept
     {
-        float ret{};
-        constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            ret += detail::reduce_sum_f32(x.reg(idx));
-        }
-        return ret;
+        return detail::reduce_sum_f32(ops::fold_regs(x, [](const avx_reg_f& a, const avx_reg_f& b) {
+            return _mm256_add_ps(a, b);
+        }));
     }
 };
 
@@ -605,13 +672,9 @@ struct reduce_sum<double, W>
     SIMD_INLINE
     static double apply(const Vec<double, W>& x) noexcept
     {
-        double ret{};
-        constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            ret += detail::reduce_sum_f64(x.reg(idx));
-        }
-        return ret;
+        return detail::reduce_sum_f64(ops::fold_regs(x, [](const avx_reg_d& a, const avx_reg_d& b) {
+            return _mm256_add_pd(a, b);
+        }));
     }
 };
 
@@ -631,12 +694,12 @@ struct reduce_max<T, W, REQUIRE_INTEGRAL(T)>
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
             // TODO
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO
             }
@@ -651,13 +714,9 @@ struct reduce_max<float, W>
     SIMD_INLINE
     static float apply(const Vec<float, W>& x) noexcept
     {
-        float ret{};
-        constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            // TODO
-        }
-        return ret;
+        return detail::reduce_max_f32(ops::fold_regs(x, [](const avx_reg_f& a, const avx_reg_f& b) {
+            return _mm256_max_ps(a, b);
+        }));
     }
 };
 
@@ -667,13 +726,9 @@ struct reduce_max<double, W>
     SIMD_INLINE
     static double apply(const Vec<double, W>& x) noexcept
     {
-        double ret{};
-        constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            // TODO
-        }
-        return ret;
+        return detail::reduce_max_f64(ops::fold_regs(x, [](const avx_reg_d& a, const avx_reg_d& b) {
+            return _mm256_max_pd(a, b);
+        }));
     }
 };
 
@@ -693,12 +748,12 @@ struct reduce_min<T, W, REQUIRE_INTEGRAL(T)>
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
             // TODO
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO
             }
@@ -713,13 +768,9 @@ struct reduce_min<float, W>
     SIMD_INLINE
     static float apply(const Vec<float, W>& x) noexcept
     {
-        float ret{};
-        constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            // TODO
-        }
-        return ret;
+        return detail::reduce_min_f32(ops::fold_regs(x, [](const avx_reg_f& a, const avx_reg_f& b) {
+            return _mm256_min_ps(a, b);
+        }));
     }
 };
 
@@ -729,13 +780,9 @@ struct reduce_min<double, W>
     SIMD_INLINE
     static double apply(const Vec<double, W>& x) noexcept
     {
-        double ret{};
-        constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            // TODO
-        }
-        return ret;
+        return detail::reduce_min_f64(ops::fold_regs(x, [](const avx_reg_d& a, const avx_reg_d& b) {
+            return _mm256_min_pd(a, b);
+        }));
     }
 };
 
@@ -755,12 +802,12 @@ struct reduce<T, W, F, REQUIRE_INTEGRAL(T)>
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
             // TODO
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO
             }
@@ -777,7 +824,7 @@ struct reduce<float, W, F>
     {
         float ret{};
         constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             // TODO
         }
@@ -793,7 +840,7 @@ struct reduce<double, W, F>
     {
         double ret{};
         constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             // TODO
         }
@@ -3,4 +3,100 @@
 namespace simd { namespace kernel { namespace avx {
 using namespace types;
 
+/// cast
+template <size_t W>
+struct cast<float, float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const Vec<float, W>& x) noexcept
+    {
+        return x;
+    }
+};
+
+template <size_t W>
+struct cast<double, double, W>
+{
+    SIMD_INLINE
+    static Vec<double, W> apply(const Vec<double, W>& x) noexcept
+    {
+        return x;
+    }
+};
+
+template <size_t W>
+struct cast<double, float, W,
+    traits::enable_if_t<std::is_same<typename Vec<float, W>::register_t, sse_reg_f>::value>>
+{
+    /// float => double
+    /// one SSE float register widens into one AVX double register
+    SIMD_INLINE
+    static Vec<double, W> apply(const Vec<float, W>& x) noexcept
+    {
+        Vec<double, W> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            ret.reg(idx) = _mm256_cvtps_pd(x.reg(idx));
+        }
+        return ret;
+    }
+};
+template <size_t W>
+struct cast<double, float, W,
+    traits::enable_if_t<std::is_same<typename Vec<float, W>::register_t, avx_reg_f>::value>>
+{
+    /// float => double
+    /// one float register widens into two double registers
+    SIMD_INLINE
+    static Vec<double, W> apply(const Vec<float, W>& x) noexcept
+    {
+        Vec<double, W> ret;
+        constexpr auto src_nregs = Vec<float, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < src_nregs; idx++) {
+            ret.reg(2 * idx + 0) = _mm256_cvtps_pd(_mm256_castps256_ps128(x.reg(idx)));
+            ret.reg(2 * idx + 1) = _mm256_cvtps_pd(_mm256_extractf128_ps(x.reg(idx), 1));
+        }
+        return ret;
+    }
+};
+
+template <size_t W>
+struct cast<float, double, W,
+    traits::enable_if_t<std::is_same<typename Vec<float, W>::register_t, sse_reg_f>::value>>
+{
+    /// double => float
+    /// one AVX double register narrows into one SSE float register
+    SIMD_INLINE
+    static Vec<float, W> apply(const Vec<double, W>& x) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr auto nregs = Vec<double, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            ret.reg(idx) = _mm256_cvtpd_ps(x.reg(idx));
+        }
+        return ret;
+    }
+};
+template <size_t W>
+struct cast<float, double, W,
+    traits::enable_if_t<std::is_same<typename Vec<float, W>::register_t, avx_reg_f>::value>>
+{
+    /// double => float
+    /// two double registers narrow into one float register
+    SIMD_INLINE
+    static Vec<float, W> apply(const Vec<double, W>& x) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr auto dst_nregs = Vec<float, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < dst_nregs; idx++) {
+            ret.reg(idx) = _mm256_set_m128(_mm256_cvtpd_ps(x.reg(2 * idx + 1)),
+                                           _mm256_cvtpd_ps(x.reg(2 * idx + 0)));
+        }
+        return ret;
+    }
+};
 } } } // namespace simd::kernel::avx
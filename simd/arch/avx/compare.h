@@ -204,7 +204,7 @@ struct lt<T, W, REQUIRE_INTEGRAL(T)>
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
         using sse_vec_t = Vec<T, reg_lanes/2>;
         using sse_vbool_t = VecBool<T, reg_lanes/2>;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::forward_sse_op<detail::sse_cmp_lt, sse_vbool_t, sse_vec_t>
                                 (lhs.reg(idx), rhs.reg(idx));
@@ -5,51 +5,8 @@
 namespace simd { namespace kernel { namespace avx {
 using namespace types;
 
-namespace detail {
-template <typename T>
-struct cf_mul_functor {
-    SIMD_INLINE
-    avx_reg_f operator ()(const avx_reg_f& x, const avx_reg_f& y) noexcept {
-        return _mm256_mul_ps(x, y);
-    }
-    SIMD_INLINE
-    avx_reg_d operator ()(const avx_reg_d& x, const avx_reg_d& y) noexcept {
-        return _mm256_mul_pd(x, y);
-    }
-};
-
-template <typename T>
-struct cf_div_functor {
-    SIMD_INLINE
-    avx_reg_f operator ()(const avx_reg_f& x, const avx_reg_f& y) noexcept {
-        return _mm256_div_ps(x, y);
-    }
-    SIMD_INLINE
-    avx_reg_d operator ()(const avx_reg_d& x, const avx_reg_d& y) noexcept {
-        return _mm256_div_pd(x, y);
-    }
-};
-
-}  // namespace detail
-
-/// add/sub share same code as float/double, per element slot
-
-/// mul
-template <typename T, size_t W>
-struct mul<std::complex<T>, W>
-    : ops::arith_binary_op<std::complex<T>, W, detail::cf_mul_functor<std::complex<T>>>
-{};
-
-/// div
-template <typename T, size_t W>
-struct div<std::complex<T>, W>
-    : ops::arith_binary_op<std::complex<T>, W, detail::cf_div_functor<std::complex<T>>>
-{};
-
-template <typename T, size_t W>
-struct neg<std::complex<T>, W, REQUIRE_FLOATING(T)>
-    : ops::arith_unary_op<std::complex<T>, W, detail::neg_functor<std::complex<T>>>
-{};
+/// mul / div / neg of Vec<std::complex<T>, W> are the generic split
+/// layout kernels (arch/generic/complex.h) over AVX real / imag vectors
 
 template <size_t W>
 struct broadcast<cf32_t, W>
@@ -59,7 +16,7 @@ struct broadcast<cf32_t, W>
     {
         Vec<cf32_t, W> ret;
         constexpr int nregs = Vec<cf32_t, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_set1_ps(val.real());
         }
@@ -75,7 +32,7 @@ struct broadcast<cf64_t, W>
     {
         Vec<cf64_t, W> ret;
         constexpr int nregs = Vec<cf64_t, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_set1_pd(val.real());
         }
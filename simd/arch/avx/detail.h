@@ -159,5 +159,16 @@ static std::pair<VO, VO> forward_sse_op0(const avx_reg_i& lhs) noexcept
     return std::make_pair(low_result, high_result);
 }
 
+/// the first n lanes of T (4 or 8 bytes) all ones, the rest 0,
+/// the vmaskmov mask of a partially used last register
+template <typename T>
+SIMD_INLINE
+avx_reg_i tail_mask(size_t n) noexcept
+{
+    static_assert(sizeof(T) >= 4, "vmaskmov masks 32 or 64 bits lanes");
+    static const int32_t bits[16] = {-1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0};
+    return _mm256_loadu_si256((const avx_reg_i*)(bits + 8 - n * sizeof(T) / 4));
+}
+
 }  // namespace detail
 } } }  // namespace simd::kernel::avx
@@ -69,7 +69,7 @@ struct bitwise_op
     {
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = F()(lhs.reg(idx), rhs.reg(idx));
         }
@@ -132,7 +132,7 @@ struct bitwise_lshift<T, W, REQUIRE_INTEGRAL(T)>
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
         using sse_vec_t = Vec<T, reg_lanes/2>;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::forward_sse_op<detail::sse_bitwise_lshift, sse_vec_t>
                                 (lhs.reg(idx), rhs);
@@ -148,7 +148,7 @@ struct bitwise_lshift<T, W, REQUIRE_INTEGRAL(T)>
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
         using sse_vec_t = Vec<T, reg_lanes/2>;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::forward_sse_op<detail::sse_bitwise_lshift, sse_vec_t>
                                 (lhs.reg(idx), rhs.reg(idx));
@@ -168,7 +168,7 @@ struct bitwise_rshift<T, W, REQUIRE_INTEGRAL(T)>
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
         using sse_vec_t = Vec<T, reg_lanes/2>;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::forward_sse_op<detail::sse_bitwise_rshift, sse_vec_t>
                                 (lhs.reg(idx), rhs);
@@ -184,7 +184,7 @@ struct bitwise_rshift<T, W, REQUIRE_INTEGRAL(T)>
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
         using sse_vec_t = Vec<T, reg_lanes/2>;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::forward_sse_op<detail::sse_bitwise_rshift, sse_vec_t>
                                 (lhs.reg(idx), rhs.reg(idx));
@@ -215,7 +215,7 @@ struct bitwise_not<T, W, REQUIRE_INTEGRAL(T)>
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
         using sse_vec_t = Vec<T, reg_lanes/2>;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::forward_sse_op<detail::sse_bitwise_not, sse_vec_t>
                                 (x.reg(idx));
@@ -231,7 +231,7 @@ struct bitwise_not<T, W, REQUIRE_INTEGRAL(T)>
         constexpr auto nregs = VecBool<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
         using sse_vbool_t = VecBool<T, reg_lanes/2>;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::forward_sse_op<detail::sse_bitwise_not, sse_vbool_t>
                                 (x.reg(idx));
@@ -249,7 +249,7 @@ struct bitwise_not<float, W>
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
         auto mask = detail::make_mask<float>();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_xor_ps(x.reg(idx), mask);
         }
@@ -261,7 +261,7 @@ struct bitwise_not<float, W>
         VecBool<float, W> ret;
         constexpr auto nregs = VecBool<float, W>::n_regs();
         auto mask = detail::make_mask<float>();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_xor_ps(x.reg(idx), mask);
         }
@@ -278,7 +278,7 @@ struct bitwise_not<double, W>
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
         auto mask = detail::make_mask<double>();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_xor_pd(x.reg(idx), mask);
         }
@@ -290,7 +290,7 @@ struct bitwise_not<double, W>
         VecBool<double, W> ret;
         constexpr auto nregs = VecBool<double, W>::n_regs();
         auto mask = detail::make_mask<double>();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_xor_pd(x.reg(idx), mask);
         }
@@ -320,7 +320,7 @@ struct bitwise_andnot<T, W, REQUIRE_INTEGRAL(T)>
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
         using sse_vec_t = Vec<T, reg_lanes/2>;
         using sse_vbool_t = VecBool<T, reg_lanes/2>;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::forward_sse_op2<detail::sse_bitwise_andnot, sse_vec_t, sse_vbool_t, sse_vec_t>
                                 (lhs.reg(idx), rhs.reg(idx));
@@ -337,7 +337,7 @@ struct bitwise_andnot<float, W>
     {
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_andnot_ps(lhs.reg(idx), rhs.reg(idx));
         }
@@ -353,7 +353,7 @@ struct bitwise_andnot<double, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_andnot_pd(lhs.reg(idx), rhs.reg(idx));
         }
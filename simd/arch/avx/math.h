@@ -25,7 +25,7 @@ struct abs<T, W, REQUIRE_INTEGRAL(T)>
         constexpr int nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
         using sse_vec_t = Vec<T, reg_lanes/2>;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::forward_sse_op<detail::sse_abs, sse_vec_t>(x.reg(idx));
         }
@@ -42,7 +42,7 @@ struct abs<float, W>
         Vec<float, W> ret;
         auto sign_mask = detail::make_signmask<float>();
         constexpr int nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_andnot_ps(sign_mask, x.reg(idx));
         }
@@ -59,7 +59,7 @@ struct abs<double, W>
         Vec<double, W> ret;
         auto sign_mask = detail::make_signmask<double>();
         constexpr int nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_andnot_pd(sign_mask, x.reg(idx));
         }
@@ -84,7 +84,7 @@ struct sqrt<float, W>
     {
         Vec<float, W> ret;
         constexpr int nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_sqrt_ps(x.reg(idx));
         }
@@ -100,7 +100,7 @@ struct sqrt<double, W>
     {
         Vec<double, W> ret;
         constexpr int nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_sqrt_pd(x.reg(idx));
         }
@@ -127,7 +127,7 @@ struct ceil<float, W>
     {
         Vec<float, W> ret;
         constexpr int nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_ceil_ps(x.reg(idx));
         }
@@ -143,7 +143,7 @@ struct ceil<double, W>
     {
         Vec<double, W> ret;
         constexpr int nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_ceil_pd(x.reg(idx));
         }
@@ -170,7 +170,7 @@ struct floor<float, W>
     {
         Vec<float, W> ret;
         constexpr int nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_floor_ps(x.reg(idx));
         }
@@ -186,7 +186,7 @@ struct floor<double, W>
     {
         Vec<double, W> ret;
         constexpr int nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_floor_pd(x.reg(idx));
         }
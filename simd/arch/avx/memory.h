@@ -16,22 +16,22 @@ struct broadcast<T, W, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_set1_epi8(val);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_set1_epi16(val);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_set1_epi32(val);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_set1_epi64x(val);
             }
@@ -48,7 +48,7 @@ struct broadcast<float, W>
     {
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_set1_ps(val);
         }
@@ -64,7 +64,7 @@ struct broadcast<double, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_set1_pd(val);
         }
@@ -83,7 +83,7 @@ struct setzero<T, W, REQUIRE_INTEGRAL(T)>
 
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_setzero_si256();
         }
@@ -99,7 +99,7 @@ struct setzero<float, W>
     {
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_setzero_ps();
         }
@@ -115,7 +115,7 @@ struct setzero<double, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_setzero_pd();
         }
@@ -275,7 +275,7 @@ struct load_aligned<T, W, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_load_si256((const avx_reg_i*)(mem + idx * reg_lanes));
         }
@@ -292,7 +292,7 @@ struct load_aligned<float, W>
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_load_ps(mem + idx * reg_lanes);
         }
@@ -309,7 +309,7 @@ struct load_aligned<double, W>
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_load_pd(mem + idx * reg_lanes);
         }
@@ -329,7 +329,7 @@ struct load_unaligned<T, W, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_loadu_si256((const avx_reg_i*)(mem + idx * reg_lanes));
         }
@@ -346,7 +346,7 @@ struct load_unaligned<float, W>
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_loadu_ps(mem + idx * reg_lanes);
         }
@@ -363,7 +363,7 @@ struct load_unaligned<double, W>
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_loadu_pd(mem + idx * reg_lanes);
         }
@@ -382,7 +382,7 @@ struct store_aligned<T, W, REQUIRE_INTEGRAL(T)>
 
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm256_store_si256((avx_reg_i*)(mem + idx * reg_lanes), x.reg(idx));
         }
@@ -397,7 +397,7 @@ struct store_aligned<float, W>
     {
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm256_store_ps(mem + idx * reg_lanes, x.reg(idx));
         }
@@ -413,7 +413,7 @@ struct store_aligned<double, W>
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
 
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm256_store_pd(mem + idx * reg_lanes, x.reg(idx));
         }
@@ -431,7 +431,7 @@ struct store_unaligned<T, W, REQUIRE_INTEGRAL(T)>
 
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm256_storeu_si256((avx_reg_i*)(mem + idx * reg_lanes), x.reg(idx));
         }
@@ -446,7 +446,7 @@ struct store_unaligned<float, W>
     {
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm256_storeu_ps(mem + idx * reg_lanes, x.reg(idx));
         }
@@ -461,13 +461,87 @@ struct store_unaligned<double, W>
     {
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm256_storeu_pd(mem + idx * reg_lanes, x.reg(idx));
         }
     }
 };
 
+/// load_masked/store_masked: whole registers, then vmaskmov on the last
+/// one, which W lanes only partially fill; memory past W is never touched
+template <size_t W>
+struct load_masked<float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const float* mem) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            ret.reg(idx) = _mm256_loadu_ps(mem + idx * reg_lanes);
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        ret.reg(nregs - 1) = _mm256_maskload_ps(mem + last, detail::tail_mask<float>(W - last));
+        return ret;
+    }
+};
+
+template <size_t W>
+struct load_masked<double, W>
+{
+    SIMD_INLINE
+    static Vec<double, W> apply(const double* mem) noexcept
+    {
+        Vec<double, W> ret;
+        constexpr auto nregs = Vec<double, W>::n_regs();
+        constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            ret.reg(idx) = _mm256_loadu_pd(mem + idx * reg_lanes);
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        ret.reg(nregs - 1) = _mm256_maskload_pd(mem + last, detail::tail_mask<double>(W - last));
+        return ret;
+    }
+};
+
+template <size_t W>
+struct store_masked<float, W>
+{
+    SIMD_INLINE
+    static void apply(float* mem, const Vec<float, W>& x) noexcept
+    {
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            _mm256_storeu_ps(mem + idx * reg_lanes, x.reg(idx));
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        _mm256_maskstore_ps(mem + last, detail::tail_mask<float>(W - last), x.reg(nregs - 1));
+    }
+};
+
+template <size_t W>
+struct store_masked<double, W>
+{
+    SIMD_INLINE
+    static void apply(double* mem, const Vec<double, W>& x) noexcept
+    {
+        constexpr auto nregs = Vec<double, W>::n_regs();
+        constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            _mm256_storeu_pd(mem + idx * reg_lanes, x.reg(idx));
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        _mm256_maskstore_pd(mem + last, detail::tail_mask<double>(W - last), x.reg(nregs - 1));
+    }
+};
+
 namespace detail {
 struct load_complex {
     SIMD_INLINE
@@ -565,7 +639,7 @@ struct load_complex<T, W>
     {
         Vec<value_type, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             std::tie(ret.real(), ret.imag()) = detail::load_complex()(vlo.reg(idx), vhi.reg(idx));
         }
@@ -617,7 +691,7 @@ struct complex_packlo<T, W>
     {
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::complex_packlo()(vreal.reg(idx), vimag.reg(idx));
         }
@@ -633,7 +707,7 @@ struct complex_packhi<T, W>
     {
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::complex_packhi()(vreal.reg(idx), vimag.reg(idx));
         }
@@ -701,25 +775,25 @@ struct to_mask<T, W, REQUIRE_INTEGRAL(T)>
         uint64_t ret = 0;
         constexpr auto nregs = VecBool<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (int idx = (int)nregs - 1; idx >= 0; idx--) {
                 ret <<= 32;  /// 32 * elements for 32 bits
-                ret |= _mm256_movemask_epi8(x.reg(idx));
+                ret |= uint32_t(_mm256_movemask_epi8(x.reg(idx)));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (int idx = (int)nregs - 1; idx >= 0; idx--) {
-                ret <= 16;  // 16 * elements for 16 bits
+                ret <<= 16;  // 16 * elements for 16 bits
                 ret |= detail::movemask_epi16(x.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (int idx = (int)nregs - 1; idx >= 0; idx--) {
                 ret <<= 8;  // 8 * elements for 8 bits
                 ret |= detail::movemask_epi32(x.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (int idx = (int)nregs - 1; idx >= 0; idx--) {
                 ret <<= 4;  // 4 * elements for 4 bits
                 ret |= detail::movemask_epi64(x.reg(idx));
@@ -737,7 +811,7 @@ struct to_mask<float, W>
     {
         uint64_t ret = 0;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (int idx = (int)nregs - 1; idx >= 0; idx--) {
             ret <<= 8;  // 8 * elements for 8 bits
             ret |= _mm256_movemask_ps(x.reg(idx));
@@ -754,10 +828,10 @@ struct to_mask<double, W>
     {
         uint64_t ret = 0;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (int idx = (int)nregs - 1; idx >= 0; idx--) {
             ret <<= 4;  // 4 * elements for 4 bits
-            ret |= _mm_movemask_pd(x.reg(idx));
+            ret |= _mm256_movemask_pd(x.reg(idx));
         }
         return ret;
     }
@@ -802,7 +876,7 @@ struct from_mask<float, W>
         constexpr auto nregs = VecBool<float, W>::n_regs();
         constexpr auto reg_lanes = VecBool<float, W>::reg_lanes();
         constexpr auto lanes_mask = (1ull << reg_lanes) - 1;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_castsi256_ps(mask_lut(x & lanes_mask));
             x >>= reg_lanes;
@@ -836,7 +910,7 @@ struct from_mask<double, W>
         constexpr auto nregs = VecBool<double, W>::n_regs();
         constexpr auto reg_lanes = VecBool<double, W>::reg_lanes();
         constexpr auto lanes_mask = (1ull << reg_lanes) - 1;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_castsi256_pd(mask_lut(x & lanes_mask));
             x >>= reg_lanes;
@@ -911,7 +985,7 @@ struct from_mask<T, W, REQUIRE_INTEGRAL(T)>
             constexpr auto nregs = VecBool<T, W>::n_regs();
             constexpr auto reg_lanes = VecBool<T, W>::reg_lanes();
             constexpr auto lanes_mask = (1ull << reg_lanes) - 1;
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 auto mask = x & lanes_mask;
                 ret.reg(idx) = _mm256_setr_epi32(  // each one gen 4 bytes (32bits)
@@ -932,7 +1006,7 @@ struct from_mask<T, W, REQUIRE_INTEGRAL(T)>
             constexpr auto nregs = VecBool<T, W>::n_regs();
             constexpr auto reg_lanes = VecBool<T, W>::reg_lanes();
             constexpr auto lanes_mask = (1ull << reg_lanes) - 1;
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 auto mask = x & lanes_mask;
                 ret.reg(idx) = _mm256_setr_epi64x(  // each one gen 8 bytes (64bits)
@@ -948,7 +1022,7 @@ struct from_mask<T, W, REQUIRE_INTEGRAL(T)>
             VecBool<T, W> ret;
             constexpr auto nregs = VecBool<T, W>::n_regs();
             auto float_mask = avx::from_mask<float, W>::apply(x);
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_castps_si256(float_mask.reg(idx));
             }
@@ -957,7 +1031,7 @@ struct from_mask<T, W, REQUIRE_INTEGRAL(T)>
             VecBool<T, W> ret;
             constexpr auto nregs = VecBool<T, W>::n_regs();
             auto float_mask = avx::from_mask<double, W>::apply(x);
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_castpd_si256(float_mask.reg(idx));
             }
@@ -978,7 +1052,7 @@ struct gather<T, W, U, V, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             // TODO
         }
@@ -995,7 +1069,7 @@ struct gather<float, W, U, V>
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
         }
         return ret;
@@ -1011,7 +1085,7 @@ struct gather<double, W, U, V>
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
         }
         return ret;
@@ -1029,7 +1103,7 @@ struct scatter<T, W, U, V, REQUIRE_INTEGRAL(T)>
 
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
         }
     }
@@ -1043,7 +1117,7 @@ struct scatter<float, W, U, V>
     {
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
         }
     }
@@ -1057,10 +1131,45 @@ struct scatter<double, W, U, V>
     {
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+        }
+    }
+};
+
+#if SIMD_WITH_F16C
+/// load_half/store_half: fp16 <-> fp32 via F16C, round to nearest even
+template <size_t W>
+struct load_half<float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const half* mem) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            ret.reg(idx) = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(mem + idx * reg_lanes)));
+        }
+        return ret;
+    }
+};
+
+template <size_t W>
+struct store_half<float, W>
+{
+    SIMD_INLINE
+    static void apply(half* mem, const Vec<float, W>& x) noexcept
+    {
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
+            _mm_storeu_si128((__m128i*)(mem + idx * reg_lanes), _mm256_cvtps_ph(x.reg(idx), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
         }
     }
 };
+#endif
 
 } } } // namespace simd::kernel::avx
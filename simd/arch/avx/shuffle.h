@@ -0,0 +1,317 @@
+#pragma once
+
+namespace simd { namespace kernel { namespace avx {
+using namespace types;
+
+namespace detail {
+/// one register shuffles, P an ops::shuffle_pattern over the register lanes
+/// Cross: vpermps / vpermpd are available (AVX2); without them a pattern
+/// crossing the 128-bit lanes is two in-lane permutes of x and of x with
+/// its lanes swapped, then a blend
+template <typename T, bool Cross, typename Enable = void>
+struct shuffle_regs;
+
+/// double: vpermilpd / vperm2f128 / vshufpd / vblendpd / vunpcklpd
+template <bool Cross>
+struct shuffle_regs<double, Cross>
+{
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_d permute(const avx_reg_d& x) noexcept
+    {
+        SIMD_IF_CONSTEXPR(P::identity()) {
+            return x;
+        } else SIMD_IF_CONSTEXPR(P::in_blocks(2)) {
+            constexpr int imm = P::imm_bits();
+            return _mm256_permute_pd(x, imm);
+        } else SIMD_IF_CONSTEXPR(P::whole_blocks(2)) {
+            constexpr int imm = P::block_source(2, 0) | P::block_source(2, 1) << 4;
+            return _mm256_permute2f128_pd(x, x, imm);
+        } else SIMD_IF_CONSTEXPR(!Cross && P::rotate() != 0) {
+            return concat_shift<P::rotate()>(x, x);
+        } else {
+            return cross<P>(x, std::integral_constant<bool, Cross>());
+        }
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_d shuffle(const avx_reg_d& a, const avx_reg_d& b) noexcept
+    {
+        using X = ops::swap_sources_t<P>;
+        SIMD_IF_CONSTEXPR(P::from_a()) {
+            return permute<P>(a);
+        } else SIMD_IF_CONSTEXPR(P::from_b()) {
+            return permute<X>(b);
+        } else SIMD_IF_CONSTEXPR(P::blend()) {
+            constexpr int mask = int(P::b_mask());
+            return _mm256_blend_pd(a, b, mask);
+        } else SIMD_IF_CONSTEXPR(P::unpack(2, false)) {
+            return _mm256_unpacklo_pd(a, b);
+        } else SIMD_IF_CONSTEXPR(P::unpack(2, true)) {
+            return _mm256_unpackhi_pd(a, b);
+        } else SIMD_IF_CONSTEXPR(X::unpack(2, false)) {
+            return _mm256_unpacklo_pd(b, a);
+        } else SIMD_IF_CONSTEXPR(X::unpack(2, true)) {
+            return _mm256_unpackhi_pd(b, a);
+        } else SIMD_IF_CONSTEXPR(P::halves_ab(2)) {
+            constexpr int imm = P::imm_bits();
+            return _mm256_shuffle_pd(a, b, imm);
+        } else SIMD_IF_CONSTEXPR(X::halves_ab(2)) {
+            constexpr int imm = X::imm_bits();
+            return _mm256_shuffle_pd(b, a, imm);
+        } else SIMD_IF_CONSTEXPR(P::whole_blocks(2)) {
+            constexpr int imm = P::block_source(2, 0) | P::block_source(2, 1) << 4;
+            return _mm256_permute2f128_pd(a, b, imm);
+        } else SIMD_IF_CONSTEXPR(P::shift() != 0) {
+            return concat_shift<P::shift()>(a, b);
+        } else SIMD_IF_CONSTEXPR(X::shift() != 0) {
+            return concat_shift<X::shift()>(b, a);
+        } else {
+            using Q = ops::local_pattern_t<P>;
+            constexpr int mask = int(P::b_mask());
+            return _mm256_blend_pd(permute<Q>(a), permute<Q>(b), mask);
+        }
+    }
+
+private:
+    /// lanes K .. K + 3 of (a, b), K odd: vshufpd across the middle 128 bits
+    template <size_t K>
+    SIMD_INLINE
+    static avx_reg_d concat_shift(const avx_reg_d& a, const avx_reg_d& b) noexcept
+    {
+        const avx_reg_d t = _mm256_permute2f128_pd(a, b, 0x21);
+        return K == 1 ? _mm256_shuffle_pd(a, t, 0x05) : _mm256_shuffle_pd(t, b, 0x05);
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_d cross(const avx_reg_d& x, std::true_type) noexcept
+    {
+        constexpr int imm = P::imm(4, 2);
+        return _mm256_permute4x64_pd(x, imm);
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_d cross(const avx_reg_d& x, std::false_type) noexcept
+    {
+        avx_reg_d s = _mm256_permute2f128_pd(x, x, 0x01);
+        constexpr int imm = P::imm_bits();
+        constexpr int mask = int(P::cross_mask(2));
+        return _mm256_blend_pd(_mm256_permute_pd(x, imm), _mm256_permute_pd(s, imm), mask);
+    }
+};
+
+/// float: vpermilps / vshufps / vblendps / vunpcklps, pairs through the
+/// pd forms (whole 128-bit lanes, 64-bit moves)
+template <bool Cross>
+struct shuffle_regs<float, Cross>
+{
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_f permute(const avx_reg_f& x) noexcept
+    {
+        SIMD_IF_CONSTEXPR(P::identity()) {
+            return x;
+        } else SIMD_IF_CONSTEXPR(P::same_blocks(4)) {
+            constexpr int imm = P::imm(4, 2);
+            return _mm256_permute_ps(x, imm);
+        } else SIMD_IF_CONSTEXPR(!Cross && P::rotate() % 2 == 1) {
+            return concat_shift<P::rotate()>(x, x);
+        } else {
+            return permute<P>(x, std::integral_constant<bool, P::pairs()>());
+        }
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_f shuffle(const avx_reg_f& a, const avx_reg_f& b) noexcept
+    {
+        using X = ops::swap_sources_t<P>;
+        SIMD_IF_CONSTEXPR(P::from_a()) {
+            return permute<P>(a);
+        } else SIMD_IF_CONSTEXPR(P::from_b()) {
+            return permute<X>(b);
+        } else SIMD_IF_CONSTEXPR(P::blend()) {
+            constexpr int mask = int(P::b_mask());
+            return _mm256_blend_ps(a, b, mask);
+        } else SIMD_IF_CONSTEXPR(P::unpack(4, false)) {
+            return _mm256_unpacklo_ps(a, b);
+        } else SIMD_IF_CONSTEXPR(P::unpack(4, true)) {
+            return _mm256_unpackhi_ps(a, b);
+        } else SIMD_IF_CONSTEXPR(X::unpack(4, false)) {
+            return _mm256_unpacklo_ps(b, a);
+        } else SIMD_IF_CONSTEXPR(X::unpack(4, true)) {
+            return _mm256_unpackhi_ps(b, a);
+        } else SIMD_IF_CONSTEXPR(P::halves_ab(4) && P::same_blocks(4)) {
+            constexpr int imm = P::imm(4, 2);
+            return _mm256_shuffle_ps(a, b, imm);
+        } else SIMD_IF_CONSTEXPR(X::halves_ab(4) && X::same_blocks(4)) {
+            constexpr int imm = X::imm(4, 2);
+            return _mm256_shuffle_ps(b, a, imm);
+        } else SIMD_IF_CONSTEXPR(P::shift() % 2 == 1) {
+            return concat_shift<P::shift()>(a, b);
+        } else SIMD_IF_CONSTEXPR(X::shift() % 2 == 1) {
+            return concat_shift<X::shift()>(b, a);
+        } else {
+            return shuffle<P>(a, b, std::integral_constant<bool, P::pairs()>());
+        }
+    }
+
+private:
+    /// lanes K .. K + 7 of (a, b), K odd (even K are the pd shifts):
+    /// vperm2f128 brings the middle 128 bits, then an in-lane shift
+    template <size_t K>
+    SIMD_INLINE
+    static avx_reg_f concat_shift(const avx_reg_f& a, const avx_reg_f& b) noexcept
+    {
+        const avx_reg_f t = _mm256_permute2f128_ps(a, b, 0x21);
+        return K < 4 ? lane_shift<K % 4>(a, t, std::integral_constant<bool, Cross>())
+                     : lane_shift<K % 4>(t, b, std::integral_constant<bool, Cross>());
+    }
+
+    /// lanes R .. R + 3 of every 128-bit lane pair of (x, y): one vpalignr
+    template <size_t R>
+    SIMD_INLINE
+    static avx_reg_f lane_shift(const avx_reg_f& x, const avx_reg_f& y, std::true_type) noexcept
+    {
+        return _mm256_castsi256_ps(_mm256_alignr_epi8(_mm256_castps_si256(y), _mm256_castps_si256(x), R * 4));
+    }
+
+    /// without AVX2, R odd: two vshufps through (x2, x3, y0, y1)
+    template <size_t R>
+    SIMD_INLINE
+    static avx_reg_f lane_shift(const avx_reg_f& x, const avx_reg_f& y, std::false_type) noexcept
+    {
+        const avx_reg_f u = _mm256_shuffle_ps(x, y, 0x4E);
+        return R == 1 ? _mm256_shuffle_ps(x, u, 0x99) : _mm256_shuffle_ps(u, y, 0x99);
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_f permute(const avx_reg_f& x, std::true_type) noexcept
+    {
+        return _mm256_castpd_ps(shuffle_regs<double, Cross>::template permute<ops::widen_pattern_t<P>>(
+            _mm256_castps_pd(x)));
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_f permute(const avx_reg_f& x, std::false_type) noexcept
+    {
+        const avx_reg_i idx = _mm256_load_si256(reinterpret_cast<const avx_reg_i*>(
+            ops::shuffle_indices<int32_t, P>()));
+        SIMD_IF_CONSTEXPR(P::in_blocks(4)) {
+            return _mm256_permutevar_ps(x, idx);
+        } else {
+            return cross<P>(x, idx, std::integral_constant<bool, Cross>());
+        }
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_f cross(const avx_reg_f& x, const avx_reg_i& idx, std::true_type) noexcept
+    {
+        return _mm256_permutevar8x32_ps(x, idx);
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_f cross(const avx_reg_f& x, const avx_reg_i& idx, std::false_type) noexcept
+    {
+        avx_reg_f s = _mm256_permute2f128_ps(x, x, 0x01);
+        constexpr int mask = int(P::cross_mask(4));
+        return _mm256_blend_ps(_mm256_permutevar_ps(x, idx), _mm256_permutevar_ps(s, idx), mask);
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_f shuffle(const avx_reg_f& a, const avx_reg_f& b, std::true_type) noexcept
+    {
+        return _mm256_castpd_ps(shuffle_regs<double, Cross>::template shuffle<ops::widen_pattern_t<P>>(
+            _mm256_castps_pd(a), _mm256_castps_pd(b)));
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_f shuffle(const avx_reg_f& a, const avx_reg_f& b, std::false_type) noexcept
+    {
+        using Q = ops::local_pattern_t<P>;
+        constexpr int mask = int(P::b_mask());
+        return _mm256_blend_ps(permute<Q>(a), permute<Q>(b), mask);
+    }
+};
+
+/// 32-bit integers: the float forms on the same bits
+template <typename T, bool Cross>
+struct shuffle_regs<T, Cross, REQUIRE_INTEGRAL_SIZE_4(T)>
+{
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_i shuffle(const avx_reg_i& a, const avx_reg_i& b) noexcept
+    {
+        return _mm256_castps_si256(shuffle_regs<float, Cross>::template shuffle<P>(
+            _mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+    }
+};
+
+/// 64-bit integers: the double forms on the same bits
+template <typename T, bool Cross>
+struct shuffle_regs<T, Cross, REQUIRE_INTEGRAL_SIZE_8(T)>
+{
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_i shuffle(const avx_reg_i& a, const avx_reg_i& b) noexcept
+    {
+        return _mm256_castpd_si256(shuffle_regs<double, Cross>::template shuffle<P>(
+            _mm256_castsi256_pd(a), _mm256_castsi256_pd(b)));
+    }
+};
+
+/// runtime permute, float / double: vpermilps / vpermilpd of x and of x
+/// with its lanes swapped, blended where the index names the other lane;
+/// the blend mask is built on the 128-bit halves, AVX has no 256-bit
+/// integer shifts
+struct permute_regs
+{
+    SIMD_INLINE
+    static avx_reg_f permute(const avx_reg_f& x, const avx_reg_i& idx) noexcept
+    {
+        const sse_reg_i lo = _mm256_castsi256_si128(idx);
+        const sse_reg_i hi = _mm_xor_si128(_mm256_extractf128_si256(idx, 1), _mm_set1_epi32(4));
+        const avx_reg_f other = _mm256_castsi256_ps(_mm256_insertf128_si256(
+            _mm256_castsi128_si256(_mm_slli_epi32(lo, 29)), _mm_slli_epi32(hi, 29), 1));
+        const avx_reg_f s = _mm256_permute2f128_ps(x, x, 0x01);
+        return _mm256_blendv_ps(_mm256_permutevar_ps(x, idx), _mm256_permutevar_ps(s, idx), other);
+    }
+
+    SIMD_INLINE
+    static avx_reg_d permute(const avx_reg_d& x, const avx_reg_i& idx) noexcept
+    {
+        /// vpermilpd reads bit 1 of each index
+        const sse_reg_i lo = _mm256_castsi256_si128(idx);
+        const sse_reg_i hi = _mm256_extractf128_si256(idx, 1);
+        const avx_reg_i ctrl = _mm256_insertf128_si256(
+            _mm256_castsi128_si256(_mm_slli_epi64(lo, 1)), _mm_slli_epi64(hi, 1), 1);
+        const avx_reg_d other = _mm256_castsi256_pd(_mm256_insertf128_si256(
+            _mm256_castsi128_si256(_mm_slli_epi64(lo, 62)),
+            _mm_slli_epi64(_mm_xor_si128(hi, _mm_set1_epi64x(2)), 62), 1));
+        const avx_reg_d s = _mm256_permute2f128_pd(x, x, 0x01);
+        return _mm256_blendv_pd(_mm256_permutevar_pd(x, ctrl), _mm256_permutevar_pd(s, ctrl), other);
+    }
+};
+}  // namespace detail
+
+/// shuffle
+template <typename T, size_t W>
+struct shuffle<T, W> : ops::shuffle_op<T, W, detail::shuffle_regs<T, false>>
+{
+};
+
+/// permute
+template <typename T, size_t W>
+struct permute<T, W, REQUIRE_FLOATING(T)> : ops::permute_op<T, W, detail::permute_regs>
+{
+};
+} } } // namespace simd::kernel::avx
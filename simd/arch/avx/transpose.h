@@ -0,0 +1,127 @@
+#pragma once
+
+namespace simd { namespace kernel { namespace avx {
+using namespace types;
+
+namespace detail {
+/// interleave the low / high halves of each 128-bit lane, T-sized elements
+/// AVX has no 256-bit integer unpacks, 32/64-bit integers go through ps/pd
+template <typename T, typename Enable = void>
+struct unpack;
+
+template <>
+struct unpack<float>
+{
+    SIMD_INLINE
+    static avx_reg_f lo(const avx_reg_f& a, const avx_reg_f& b) noexcept
+    {
+        return _mm256_unpacklo_ps(a, b);
+    }
+    SIMD_INLINE
+    static avx_reg_f hi(const avx_reg_f& a, const avx_reg_f& b) noexcept
+    {
+        return _mm256_unpackhi_ps(a, b);
+    }
+};
+
+template <>
+struct unpack<double>
+{
+    SIMD_INLINE
+    static avx_reg_d lo(const avx_reg_d& a, const avx_reg_d& b) noexcept
+    {
+        return _mm256_unpacklo_pd(a, b);
+    }
+    SIMD_INLINE
+    static avx_reg_d hi(const avx_reg_d& a, const avx_reg_d& b) noexcept
+    {
+        return _mm256_unpackhi_pd(a, b);
+    }
+};
+
+template <typename T>
+struct unpack<T, REQUIRE_INTEGRAL_SIZE_4(T)>
+{
+    SIMD_INLINE
+    static avx_reg_i lo(const avx_reg_i& a, const avx_reg_i& b) noexcept
+    {
+        return _mm256_castps_si256(_mm256_unpacklo_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+    }
+    SIMD_INLINE
+    static avx_reg_i hi(const avx_reg_i& a, const avx_reg_i& b) noexcept
+    {
+        return _mm256_castps_si256(_mm256_unpackhi_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+    }
+};
+
+template <typename T>
+struct unpack<T, REQUIRE_INTEGRAL_SIZE_8(T)>
+{
+    SIMD_INLINE
+    static avx_reg_i lo(const avx_reg_i& a, const avx_reg_i& b) noexcept
+    {
+        return _mm256_castpd_si256(_mm256_unpacklo_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b)));
+    }
+    SIMD_INLINE
+    static avx_reg_i hi(const avx_reg_i& a, const avx_reg_i& b) noexcept
+    {
+        return _mm256_castpd_si256(_mm256_unpackhi_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b)));
+    }
+};
+
+/// swap the high lane of a with the low lane of b
+SIMD_INLINE
+void swap_lanes(avx_reg_f& a, avx_reg_f& b) noexcept
+{
+    avx_reg_f lo = _mm256_permute2f128_ps(a, b, 0x20);
+    b = _mm256_permute2f128_ps(a, b, 0x31);
+    a = lo;
+}
+SIMD_INLINE
+void swap_lanes(avx_reg_d& a, avx_reg_d& b) noexcept
+{
+    avx_reg_d lo = _mm256_permute2f128_pd(a, b, 0x20);
+    b = _mm256_permute2f128_pd(a, b, 0x31);
+    a = lo;
+}
+SIMD_INLINE
+void swap_lanes(avx_reg_i& a, avx_reg_i& b) noexcept
+{
+    avx_reg_i lo = _mm256_permute2f128_si256(a, b, 0x20);
+    b = _mm256_permute2f128_si256(a, b, 0x31);
+    a = lo;
+}
+
+/// swap_lanes(r[k], r[Q + k]) for every k in [0, Q)
+template <size_t Q, typename R, size_t... Ks>
+SIMD_INLINE
+void swap_halves(R* r, simd::detail::index_sequence<Ks...>) noexcept
+{
+    int expand[] = {0, (swap_lanes(r[Ks], r[Q + Ks]), 0)...};
+    (void)expand;
+}
+
+/// L x L block in L registers: each half of the rows is transposed inside
+/// its 128-bit lanes, then vperm2f128 exchanges the off-diagonal lanes
+/// 8x8 float = 24 unpck + 8 vperm2f128
+template <typename T, template <typename...> class U>
+struct transpose_regs
+{
+    template <typename R, size_t L>
+    SIMD_INLINE
+    void operator ()(R (&r)[L]) const noexcept
+    {
+        constexpr size_t Q = L / 2;
+        ops::unpack_transpose<U<T>, Q>(r);
+        ops::unpack_transpose<U<T>, Q>(r + Q);
+        swap_halves<Q>(r, simd::detail::make_index_sequence<Q>());
+    }
+};
+}  // namespace detail
+
+/// transpose
+template <typename T, size_t W>
+struct transpose<T, W> : ops::transpose_op<T, W, detail::transpose_regs<T, detail::unpack>>
+{
+};
+} } } // namespace simd::kernel::avx
@@ -15,6 +15,8 @@ namespace simd { namespace kernel { namespace avx2 {
 #include "simd/arch/avx2/logical.h"
 #include "simd/arch/avx2/math.h"
 #include "simd/arch/avx2/memory.h"
+#include "simd/arch/avx2/transpose.h"
+#include "simd/arch/avx2/shuffle.h"
 #include "simd/arch/avx2/trigo.h"
 
 namespace simd { namespace kernel {
@@ -34,6 +36,23 @@ DEFINE_AVX2_BINARY_OP(sub);
 DEFINE_AVX2_BINARY_OP(mul);
 DEFINE_AVX2_BINARY_OP(div);
 DEFINE_AVX2_BINARY_OP(mod);
+DEFINE_AVX2_BINARY_OP(add_sat);
+DEFINE_AVX2_BINARY_OP(sub_sat);
+
+template <typename T, size_t W,
+  REQUIRES((std::is_integral<T>::value && sizeof(T) <= 4))>
+SIMD_INLINE
+Vec<T, W> mul_sat(const Vec<T, W>& lhs, const Vec<T, W>& rhs, requires_arch<AVX2>) noexcept
+{
+    return avx2::mul_sat<T, W>::apply(lhs, rhs);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> dot_u8i8(const Vec<T, W>& acc, const Vec<uint8_t, 4 * W>& a, const Vec<int8_t, 4 * W>& b, requires_arch<AVX2>) noexcept
+{
+    return avx2::dot_u8i8<T, W>::apply(acc, a, b);
+}
 
 DEFINE_AVX2_BINARY_OP(min);
 DEFINE_AVX2_BINARY_OP(max);
@@ -77,6 +96,105 @@ bool all_of(const VecBool<T, W>& x, requires_arch<AVX2>) noexcept
     return avx2::all_of<T, W>::apply(x);
 }
 
+template <typename U, typename T, size_t W,
+  REQUIRES(((std::is_same<U, float>::value && std::is_same<T, uint8_t>::value)
+         || (std::is_same<U, uint8_t>::value && std::is_same<T, float>::value)))>
+SIMD_INLINE
+Vec<U, W> cast(const Vec<T, W>& x, requires_arch<AVX2>) noexcept
+{
+    return avx2::cast<U, T, W>::apply(x);
+}
+
+template <typename U, typename T, size_t W>
+SIMD_INLINE
+Vec<U, 2 * W> pack_sat(const Vec<T, W>& lo, const Vec<T, W>& hi, requires_arch<AVX2>) noexcept
+{
+    return avx2::pack_sat<U, T, W>::apply(lo, hi);
+}
+
+template <typename U, typename T, size_t W,
+  REQUIRES((ops::native_widen<U, T>::value))>
+SIMD_INLINE
+std::array<Vec<U, W * sizeof(T) / sizeof(U)>, sizeof(U) / sizeof(T)> widen(const Vec<T, W>& x, requires_arch<AVX2>) noexcept
+{
+    return avx2::widen<U, T, W>::apply(x);
+}
+
+template <typename U, bool S, typename T, size_t W, size_t K,
+  REQUIRES((ops::native_narrow<U, T>::value))>
+SIMD_INLINE
+Vec<U, W * K> narrow(const std::array<Vec<T, W>, K>& x, requires_arch<AVX2>) noexcept
+{
+    return avx2::narrow<U, T, W, S>::apply(x);
+}
+
+template <typename T, size_t W,
+  REQUIRES((std::is_integral<T>::value && sizeof(T) >= 4))>
+SIMD_INLINE
+Vec<T, W> load_masked(const T* mem, requires_arch<AVX2>) noexcept
+{
+    return avx2::load_masked<T, W>::apply(mem);
+}
+
+template <typename T, size_t W,
+  REQUIRES((std::is_integral<T>::value && sizeof(T) >= 4))>
+SIMD_INLINE
+void store_masked(T* mem, const Vec<T, W>& x, requires_arch<AVX2>) noexcept
+{
+    avx2::store_masked<T, W>::apply(mem, x);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> load_bf16(const bfloat16* mem, requires_arch<AVX2>) noexcept
+{
+    return avx2::load_bf16<T, W>::apply(mem);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+void store_bf16(bfloat16* mem, const Vec<T, W>& x, requires_arch<AVX2>) noexcept
+{
+    avx2::store_bf16<T, W>::apply(mem, x);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+std::array<Vec<T, W>, 2> unpack_bf16(const bfloat16* mem, requires_arch<AVX2>) noexcept
+{
+    return avx2::unpack_bf16<T, W>::apply(mem);
+}
+
+/// shuffle
+template <typename T, size_t W,
+  REQUIRES(std::is_integral<T>::value)>
+SIMD_INLINE
+void transpose(std::array<Vec<T, W>, W>& rows, requires_arch<AVX2>) noexcept
+{
+    avx2::transpose<T, W>::apply(rows);
+}
+
+template <typename T, size_t W, size_t... I>
+SIMD_INLINE
+Vec<T, W> shuffle(const Vec<T, W>& a, const Vec<T, W>& b, ops::shuffle_pattern<I...> p, requires_arch<AVX2>) noexcept
+{
+    return avx2::shuffle<T, W>::apply(a, b, p);
+}
+
+template <typename T, size_t W, typename I>
+SIMD_INLINE
+Vec<T, W> permute(const Vec<T, W>& x, const Vec<I, W>& idx, requires_arch<AVX2>) noexcept
+{
+    return avx2::permute<T, W>::apply(x, idx);
+}
+
+template <size_t N, size_t W>
+SIMD_INLINE
+Vec<uint8_t, W> lookup(const Vec<uint8_t, N>& table, const Vec<uint8_t, W>& idx, requires_arch<AVX2>) noexcept
+{
+    return avx2::lookup<uint8_t, W>::template apply<N>(table, idx);
+}
+
 #undef DEFINE_AVX2_UNARY_OP
 #undef DEFINE_AVX2_BINARY_OP
 #undef DEFINE_AVX2_BINARY_CMP_OP
@@ -33,28 +33,28 @@ struct min<T, W, REQUIRE_INTEGRAL(T)>
         constexpr int nregs = Vec<T, W>::n_regs();
         constexpr bool is_signed = std::is_signed<T>::value;
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm256_min_epi8(lhs.reg(idx), rhs.reg(idx))
                                 : _mm256_min_epu8(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm256_min_epi16(lhs.reg(idx), rhs.reg(idx))
                                 : _mm256_min_epu16(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm256_min_epi32(lhs.reg(idx), rhs.reg(idx))
                                 : _mm256_min_epu32(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? detail::algo_min_epi64(lhs.reg(idx), rhs.reg(idx))
@@ -94,28 +94,28 @@ struct max<T, W, REQUIRE_INTEGRAL(T)>
         constexpr int nregs = Vec<T, W>::n_regs();
         constexpr bool is_signed = std::is_signed<T>::value;
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm256_max_epi8(lhs.reg(idx), rhs.reg(idx))
                                 : _mm256_max_epu8(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm256_max_epi16(lhs.reg(idx), rhs.reg(idx))
                                 : _mm256_max_epu16(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm256_max_epi32(lhs.reg(idx), rhs.reg(idx))
                                 : _mm256_max_epu32(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? detail::algo_max_epi64(lhs.reg(idx), rhs.reg(idx))
@@ -136,7 +136,7 @@ struct all_of<T, W, REQUIRE_INTEGRAL(T)>
 
         bool ret = true;
         constexpr auto nregs = VecBool<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret = ret && (_mm256_movemask_epi8(x.reg(idx)) == 0xFFFFFFFF);
         }
@@ -68,6 +68,151 @@ struct mod_functor {
         return x;
     }
 };
+
+/// saturating add, native for 8/16-bit lanes, 32/64-bit lanes detect the overflow
+template <typename T>
+struct add_sat_functor {
+    template <typename U = T, REQUIRES(IS_INT_SIZE_1(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        return _mm256_adds_epi8(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_1(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        return _mm256_adds_epu8(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_2(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        return _mm256_adds_epi16(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_2(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        return _mm256_adds_epu16(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_4(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        /// overflow when the sign of the result differs from both operands
+        __m256i r = _mm256_add_epi32(x, y);
+        __m256i o = _mm256_and_si256(_mm256_xor_si256(x, r), _mm256_xor_si256(y, r));
+        __m256i s = _mm256_xor_si256(_mm256_srai_epi32(x, 31), _mm256_set1_epi32(INT32_MAX));
+        return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(r), _mm256_castsi256_ps(s), _mm256_castsi256_ps(o)));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_4(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        /// y is clamped to `~x`, the room left before wrapping around
+        return _mm256_add_epi32(x, _mm256_min_epu32(y, _mm256_xor_si256(x, _mm256_set1_epi32(-1))));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_8(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        __m256i r = _mm256_add_epi64(x, y);
+        __m256i o = _mm256_and_si256(_mm256_xor_si256(x, r), _mm256_xor_si256(y, r));
+        __m256i s = _mm256_xor_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), x), _mm256_set1_epi64x(INT64_MAX));
+        return _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(r), _mm256_castsi256_pd(s), _mm256_castsi256_pd(o)));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_8(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        /// wrapped around when the result is below x, compared as signed after flipping the sign bit
+        __m256i r = _mm256_add_epi64(x, y);
+        __m256i b = _mm256_set1_epi64x(INT64_MIN);
+        __m256i o = _mm256_cmpgt_epi64(_mm256_xor_si256(x, b), _mm256_xor_si256(r, b));
+        return _mm256_or_si256(r, o);
+    }
+};
+
+/// saturating sub, native for 8/16-bit lanes, 32/64-bit lanes detect the overflow
+template <typename T>
+struct sub_sat_functor {
+    template <typename U = T, REQUIRES(IS_INT_SIZE_1(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        return _mm256_subs_epi8(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_1(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        return _mm256_subs_epu8(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_2(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        return _mm256_subs_epi16(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_2(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        return _mm256_subs_epu16(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_4(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        /// overflow when x and y differ in sign and the result takes the sign of y
+        __m256i r = _mm256_sub_epi32(x, y);
+        __m256i o = _mm256_and_si256(_mm256_xor_si256(x, y), _mm256_xor_si256(x, r));
+        __m256i s = _mm256_xor_si256(_mm256_srai_epi32(x, 31), _mm256_set1_epi32(INT32_MAX));
+        return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(r), _mm256_castsi256_ps(s), _mm256_castsi256_ps(o)));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_4(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        return _mm256_sub_epi32(_mm256_max_epu32(x, y), y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_8(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        __m256i r = _mm256_sub_epi64(x, y);
+        __m256i o = _mm256_and_si256(_mm256_xor_si256(x, y), _mm256_xor_si256(x, r));
+        __m256i s = _mm256_xor_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), x), _mm256_set1_epi64x(INT64_MAX));
+        return _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(r), _mm256_castsi256_pd(s), _mm256_castsi256_pd(o)));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_8(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        __m256i b = _mm256_set1_epi64x(INT64_MIN);
+        __m256i o = _mm256_cmpgt_epi64(_mm256_xor_si256(y, b), _mm256_xor_si256(x, b));
+        return _mm256_andnot_si256(o, _mm256_sub_epi64(x, y));
+    }
+};
+
+/// Q7/Q15/Q31 fixed-point multiply, rounded, -1 * -1 clamped to the max value
+template <typename T>
+struct mul_sat_functor {
+    template <typename U = T, REQUIRES(IS_INT_SIZE_1(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        /// sign extend into 16-bit lanes, the final pack does the clamping
+        __m256i r = _mm256_set1_epi16(1 << 6);
+        __m256i lo = _mm256_mullo_epi16(_mm256_srai_epi16(_mm256_unpacklo_epi8(x, x), 8),
+                                     _mm256_srai_epi16(_mm256_unpacklo_epi8(y, y), 8));
+        __m256i hi = _mm256_mullo_epi16(_mm256_srai_epi16(_mm256_unpackhi_epi8(x, x), 8),
+                                     _mm256_srai_epi16(_mm256_unpackhi_epi8(y, y), 8));
+        return _mm256_packs_epi16(_mm256_srai_epi16(_mm256_add_epi16(lo, r), 7),
+                               _mm256_srai_epi16(_mm256_add_epi16(hi, r), 7));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_2(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        /// pmulhrsw only wraps for -1 * -1, the sole way to get INT16_MIN back
+        __m256i r = _mm256_mulhrs_epi16(x, y);
+        return _mm256_xor_si256(r, _mm256_cmpeq_epi16(r, _mm256_set1_epi16(INT16_MIN)));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_4(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        /// 64-bit products of the even and odd lanes, bits [31, 62] are the result
+        __m256i r = _mm256_set1_epi64x(int64_t(1) << 30);
+        __m256i even = _mm256_add_epi64(_mm256_mul_epi32(x, y), r);
+        __m256i odd = _mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(y, 32)), r);
+        __m256i ret = _mm256_blend_epi16(_mm256_srli_epi64(even, 31), _mm256_slli_epi64(odd, 1), 0xCC);
+        return _mm256_xor_si256(ret, _mm256_cmpeq_epi32(ret, _mm256_set1_epi32(INT32_MIN)));
+    }
+};
 }  // namespace detail
 
 /// add
@@ -100,6 +245,24 @@ struct mod<T, W>
     : ops::arith_binary_op<T, W, detail::mod_functor<T>>
 {};
 
+/// add_sat
+template <typename T, size_t W>
+struct add_sat<T, W>
+    : ops::arith_binary_op<T, W, detail::add_sat_functor<T>>
+{};
+
+/// sub_sat
+template <typename T, size_t W>
+struct sub_sat<T, W>
+    : ops::arith_binary_op<T, W, detail::sub_sat_functor<T>>
+{};
+
+/// mul_sat for int8/int16/int32, int64 falls back to generic
+template <typename T, size_t W>
+struct mul_sat<T, W>
+    : ops::arith_binary_op<T, W, detail::mul_sat_functor<T>>
+{};
+
 template <typename T, size_t W>
 struct neg<T, W, REQUIRE_INTEGRAL(T)>
 {
@@ -110,6 +273,28 @@ struct neg<T, W, REQUIRE_INTEGRAL(T)>
     }
 };
 
+
+/// dot_u8i8: acc[i] += sum(a[4i+j] * b[4i+j]), j < 4
+/// vpmaddubsw + vpmaddwd: the int16 sum of each byte pair saturates,
+/// exact while |a[2k] * b[2k] + a[2k+1] * b[2k+1]| <= 32767 (e.g. |b| <= 64)
+template <size_t W>
+struct dot_u8i8<int32_t, W>
+{
+    SIMD_INLINE
+    static Vec<int32_t, W> apply(const Vec<int32_t, W>& acc, const Vec<uint8_t, 4 * W>& a, const Vec<int8_t, 4 * W>& b) noexcept
+    {
+        Vec<int32_t, W> ret;
+        constexpr auto nregs = Vec<int32_t, W>::n_regs();
+        const __m256i ones = _mm256_set1_epi16(1);
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            __m256i t = _mm256_madd_epi16(_mm256_maddubs_epi16(a.reg(idx), b.reg(idx)), ones);
+            ret.reg(idx) = _mm256_add_epi32(acc.reg(idx), t);
+        }
+        return ret;
+    }
+};
+
 } } } // namespace simd::kernel::avx2
 
 #if 0
@@ -135,56 +320,4 @@ Vec<T, Arch> mul(const Vec<T, Arch>& self, const Vec<T, Arch>& other, requires_a
         assert(0);
     }
 }
-
-/// sadd
-template <typename Arch, typename T,
-    typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
-Vec<T, Arch> sadd(const Vec<T, Arch>& self, const Vec<T, Arch>& other, requires_arch<AVX2>) noexcept
-{
-    if (std::is_signed<T>::value) {
-        if (sizeof(T) == 1) {
-            return _mm256_adds_epi8(self, other);
-        } else if (sizeof(T) == 2) {
-            return _mm256_adds_epi16(self, other);
-        } else {
-            // TODO
-            return sadd(self, other, AVX{});
-        }
-    } else {
-        if (sizeof(T) == 1) {
-            return _m256_adds_epu8(self, other);
-        } else if (sizeof(T) == 2) {
-            return _mm256_adds_epu16(self, other);
-        } else {
-            // TODO
-            return sadd(self, other, AVX{});
-        }
-    }
-}
-
-/// ssub
-template <typename Arch, typename T,
-    typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
-Vec<T, Arch> ssub(const Vec<T, Arch>& self, const Vec<T, Arch>& other, requires_arch<AVX2>) noexcept
-{
-    if (std::is_signed<T>::value) {
-        if (sizeof(T) == 1) {
-            return _mm256_subs_epi8(self, other);
-        } else if (sizeof(T) == 2) {
-            return _mm256_subs_epi16(self, other);
-        } else {
-            // TODO
-            return ssub(self, other, AVX{});
-        }
-    } else {
-        if (sizeof(T) == 1) {
-            return _m256_ssub_epu8(self, other);
-        } else if (sizeof(T) == 2) {
-            return _mm256_ssub_epu16(self, other);
-        } else {
-            // TODO
-            return ssub(self, other, AVX{});
-        }
-    }
-}
 #endif
@@ -1,6 +1,253 @@
 #pragma once
 
+#include <cstring>
+#include <limits>
+
 namespace simd { namespace kernel { namespace avx2 {
 using namespace types;
 
+/// cast
+template <size_t W>
+struct cast<float, uint8_t, W>
+{
+    /// uint8 => float
+    /// 8 bytes zero-extend into each float register
+    SIMD_INLINE
+    static Vec<float, W> apply(const Vec<uint8_t, W>& x) noexcept
+    {
+        alignas(32) uint8_t buf[W < 32 ? 32 : W];
+        x.store_unaligned(buf);
+        Vec<float, W> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            __m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(buf + 8 * idx));
+            ret.reg(idx) = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(b));
+        }
+        return ret;
+    }
+};
+
+template <size_t W>
+struct cast<uint8_t, float, W>
+{
+    /// float => uint8
+    /// truncated, out of range values saturate to [0, 255];
+    /// the packs work per 128-bit lane, the low dword of each lane holds 4 bytes
+    SIMD_INLINE
+    static Vec<uint8_t, W> apply(const Vec<float, W>& x) noexcept
+    {
+        alignas(32) uint8_t buf[W < 32 ? 32 : W];
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            __m256i i = _mm256_cvttps_epi32(x.reg(idx));
+            i = _mm256_packus_epi16(_mm256_packs_epi32(i, i), i);
+            __m128i b = _mm_unpacklo_epi32(_mm256_castsi256_si128(i), _mm256_extracti128_si256(i, 1));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(buf + 8 * idx), b);
+        }
+        return Vec<uint8_t, W>::load_unaligned(buf);
+    }
+};
+namespace detail {
+/// narrow two registers into one, clamping each lane to the range of U:
+/// packs/packus only read signed sources, so unsigned ones are clamped first,
+/// and they work per 128-bit lane, so the qwords are put back in order afterwards
+template <typename U, typename T>
+struct pack_sat_functor {
+    template <typename V = T, REQUIRES(IS_INT_SIZE_2(V))>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        SIMD_IF_CONSTEXPR(std::is_unsigned<T>::value) {
+            __m256i m = _mm256_set1_epi16(int16_t(std::numeric_limits<U>::max()));
+            return pack(_mm256_min_epu16(x, m), _mm256_min_epu16(y, m));
+        }
+        return pack(x, y);
+    }
+    template <typename V = T, REQUIRES(IS_INT_SIZE_4(V))>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        SIMD_IF_CONSTEXPR(std::is_unsigned<T>::value) {
+            __m256i m = _mm256_set1_epi32(int32_t(std::numeric_limits<U>::max()));
+            return pack(_mm256_min_epu32(x, m), _mm256_min_epu32(y, m));
+        }
+        return pack(x, y);
+    }
+    template <typename V = T, REQUIRES(IS_INT_SIZE_8(V))>
+    SIMD_INLINE
+    avx_reg_i operator ()(const avx_reg_i& x, const avx_reg_i& y) noexcept {
+        /// no 64-bit pack, clamp in place then gather the low dwords
+        __m256i r = _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(clamp64(x)), _mm256_castsi256_ps(clamp64(y)), 0x88));
+        return _mm256_permute4x64_epi64(r, 0xD8);
+    }
+
+private:
+    SIMD_INLINE
+    static __m256i pack(const __m256i& x, const __m256i& y) noexcept {
+        __m256i r;
+        SIMD_IF_CONSTEXPR(sizeof(T) == 2 && std::is_signed<U>::value) {
+            r = _mm256_packs_epi16(x, y);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+            r = _mm256_packus_epi16(x, y);
+        } else SIMD_IF_CONSTEXPR(std::is_signed<U>::value) {
+            r = _mm256_packs_epi32(x, y);
+        } else {
+            r = _mm256_packus_epi32(x, y);
+        }
+        return _mm256_permute4x64_epi64(r, 0xD8);
+    }
+    SIMD_INLINE
+    static __m256i clamp64(const __m256i& x) noexcept {
+        __m256i hi = _mm256_set1_epi64x(int64_t(std::numeric_limits<U>::max()));
+        SIMD_IF_CONSTEXPR(std::is_signed<T>::value) {
+            __m256i lo = _mm256_set1_epi64x(int64_t(std::numeric_limits<U>::min()));
+            __m256i r = _mm256_blendv_epi8(x, lo, _mm256_cmpgt_epi64(lo, x));
+            return _mm256_blendv_epi8(r, hi, _mm256_cmpgt_epi64(r, hi));
+        } else {
+            __m256i b = _mm256_set1_epi64x(INT64_MIN);
+            return _mm256_blendv_epi8(x, hi, _mm256_cmpgt_epi64(_mm256_xor_si256(x, b), _mm256_xor_si256(hi, b)));
+        }
+    }
+};
+}  // namespace detail
+
+/// pack_sat
+template <typename U, typename T, size_t W>
+struct pack_sat<U, T, W>
+    : ops::pack_binary_op<U, T, W, detail::pack_sat_functor<U, T>>
+{};
+
+namespace detail {
+/// sign or zero extend (by the signedness of T) the lanes of x from T to E
+template <typename E, typename T>
+SIMD_INLINE
+__m256i extend(const __m128i& x) noexcept
+{
+    constexpr bool s = std::is_signed<T>::value;
+    SIMD_IF_CONSTEXPR(sizeof(T) == 1 && sizeof(E) == 2) {
+        return s ? _mm256_cvtepi8_epi16(x) : _mm256_cvtepu8_epi16(x);
+    } else SIMD_IF_CONSTEXPR(sizeof(T) == 1 && sizeof(E) == 4) {
+        return s ? _mm256_cvtepi8_epi32(x) : _mm256_cvtepu8_epi32(x);
+    } else SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
+        return s ? _mm256_cvtepi8_epi64(x) : _mm256_cvtepu8_epi64(x);
+    } else SIMD_IF_CONSTEXPR(sizeof(T) == 2 && sizeof(E) == 4) {
+        return s ? _mm256_cvtepi16_epi32(x) : _mm256_cvtepu16_epi32(x);
+    } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+        return s ? _mm256_cvtepi16_epi64(x) : _mm256_cvtepu16_epi64(x);
+    } else {
+        return s ? _mm256_cvtepi32_epi64(x) : _mm256_cvtepu32_epi64(x);
+    }
+}
+
+/// one register into K: the J-th 32 / K bytes are taken from their 128-bit
+/// half, then extended (vpmovzx / vpmovsx) and converted (vcvtdq2ps / vcvtdq2pd)
+template <typename U, typename T>
+struct widen_functor {
+    static constexpr size_t K = sizeof(U) / sizeof(T);
+    using reg_t = typename Vec<U, 32 / sizeof(U)>::register_t;
+
+    SIMD_INLINE
+    std::array<reg_t, K> operator ()(const avx_reg_i& x) noexcept {
+        return parts(x, simd::detail::make_index_sequence<K>());
+    }
+    SIMD_INLINE
+    std::array<reg_t, K> operator ()(const avx_reg_f& x) noexcept {
+        return {{ _mm256_cvtps_pd(_mm256_castps256_ps128(x)), _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)) }};
+    }
+
+private:
+    template <size_t... J>
+    SIMD_INLINE
+    static std::array<reg_t, K> parts(const __m256i& x, simd::detail::index_sequence<J...>) noexcept {
+        return {{ convert(part<J>(x))... }};
+    }
+    template <size_t J>
+    SIMD_INLINE
+    static __m128i part(const __m256i& x) noexcept {
+        constexpr int half = J * 32 / K / 16;
+        constexpr int imm = J * 32 / K % 16;
+        return _mm_srli_si128(_mm256_extracti128_si256(x, half), imm);
+    }
+    template <typename V = U, REQUIRES(std::is_integral<V>::value)>
+    SIMD_INLINE
+    static reg_t convert(const __m128i& x) noexcept {
+        return extend<U, T>(x);
+    }
+    template <typename V = U, REQUIRES((std::is_same<V, float>::value))>
+    SIMD_INLINE
+    static reg_t convert(const __m128i& x) noexcept {
+        return _mm256_cvtepi32_ps(extend<int32_t, T>(x));
+    }
+    template <typename V = U, REQUIRES((std::is_same<V, double>::value))>
+    SIMD_INLINE
+    static reg_t convert(const __m128i& x) noexcept {
+        return _mm256_cvtepi32_pd(sse::detail::extend<int32_t, T>(x));
+    }
+};
+
+/// halving steps of the narrow chain
+struct narrow_policy {
+    template <typename H, typename V>
+    SIMD_INLINE
+    static __m256i pack(const __m256i& a, const __m256i& b) noexcept {
+        return pack_sat_functor<H, V>()(a, b);
+    }
+    /// keep the low bits: once masked, every lane is in range of the unsigned pack
+    template <typename H, typename V>
+    SIMD_INLINE
+    static __m256i wrap(const __m256i& a, const __m256i& b) noexcept {
+        SIMD_IF_CONSTEXPR(sizeof(V) == 8) {
+            __m256i r = _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), 0x88));
+            return _mm256_permute4x64_epi64(r, 0xD8);
+        }
+        using uh_t = typename std::make_unsigned<H>::type;
+        using uv_t = typename std::make_unsigned<V>::type;
+        __m256i m = sizeof(H) == 1 ? _mm256_set1_epi16(0xFF) : _mm256_set1_epi32(0xFFFF);
+        return pack_sat_functor<uh_t, uv_t>()(_mm256_and_si256(a, m), _mm256_and_si256(b, m));
+    }
+};
+
+/// K registers into one: integral lanes through the pack chain, float lanes
+/// truncated to int32 first (clamped to the range of U when saturating),
+/// double pairs through vcvtpd2ps
+template <typename U, typename T, bool S>
+struct narrow_functor {
+    static constexpr size_t K = sizeof(T) / sizeof(U);
+
+    SIMD_INLINE
+    avx_reg_i operator ()(const std::array<avx_reg_i, K>& x) noexcept {
+        return ops::narrow_chain<U, S, narrow_policy>::template apply<T>(x.data());
+    }
+    SIMD_INLINE
+    avx_reg_i operator ()(const std::array<avx_reg_f, K>& x) noexcept {
+        __m256i i[K];
+        SIMD_UNROLL
+        for (size_t j = 0; j < K; j++) {
+            __m256 v = x[j];
+            SIMD_IF_CONSTEXPR(S) {
+                v = _mm256_min_ps(_mm256_max_ps(v, _mm256_set1_ps(float(std::numeric_limits<U>::min()))),
+                                  _mm256_set1_ps(float(std::numeric_limits<U>::max())));
+            }
+            i[j] = _mm256_cvttps_epi32(v);
+        }
+        return ops::narrow_chain<U, S, narrow_policy>::template apply<int32_t>(i);
+    }
+    SIMD_INLINE
+    avx_reg_f operator ()(const std::array<avx_reg_d, K>& x) noexcept {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(x[0])), _mm256_cvtpd_ps(x[1]), 1);
+    }
+};
+}  // namespace detail
+
+/// widen
+template <typename U, typename T, size_t W>
+struct widen<U, T, W>
+    : ops::widen_op<U, T, W, detail::widen_functor<U, T>>
+{};
+
+/// narrow, wrapping (S = false) or saturating (S = true)
+template <typename U, typename T, size_t W, bool S>
+struct narrow<U, T, W, S>
+    : ops::narrow_op<U, T, W, detail::narrow_functor<U, T, S>>
+{};
 } } } // namespace simd::kernel::avx2
@@ -14,22 +14,22 @@ struct eq<T, W, REQUIRE_INTEGRAL(T)>
         VecBool<T, W> ret;
         constexpr auto nregs = VecBool<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_cmpeq_epi8(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_cmpeq_epi16(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_cmpeq_epi32(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_cmpeq_epi64(lhs.reg(idx), rhs.reg(idx));
             }
@@ -43,22 +43,22 @@ struct eq<T, W, REQUIRE_INTEGRAL(T)>
         VecBool<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_cmpeq_epi8(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_cmpeq_epi16(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_cmpeq_epi32(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_cmpeq_epi64(lhs.reg(idx), rhs.reg(idx));
             }
@@ -84,7 +84,7 @@ struct ne<T, W, REQUIRE_INTEGRAL(T)>
 
         VecBool<T, W> ret;
         constexpr auto nregs = VecBool<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_xor_si256(lhs.reg(idx), rhs.reg(idx));
         }
@@ -105,7 +105,7 @@ struct gt<T, W, REQUIRE_INTEGRAL(T)>
         constexpr bool is_signed = std::is_signed<T>::value;
         constexpr auto nregs = VecBool<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? _mm256_cmpgt_epi8(lhs.reg(idx), rhs.reg(idx))
@@ -115,7 +115,7 @@ struct gt<T, W, REQUIRE_INTEGRAL(T)>
                     );
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? _mm256_cmpgt_epi16(lhs.reg(idx), rhs.reg(idx))
@@ -125,7 +125,7 @@ struct gt<T, W, REQUIRE_INTEGRAL(T)>
                     );
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? _mm256_cmpgt_epi32(lhs.reg(idx), rhs.reg(idx))
@@ -135,7 +135,7 @@ struct gt<T, W, REQUIRE_INTEGRAL(T)>
                     );
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? _mm256_cmpgt_epi64(lhs.reg(idx), rhs.reg(idx))
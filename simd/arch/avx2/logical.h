@@ -42,22 +42,22 @@ struct bitwise_lshift<T, W, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = detail::bitwise_slli_epi8(lhs.reg(idx), rhs);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_slli_epi16(lhs.reg(idx), rhs);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_slli_epi32(lhs.reg(idx), rhs);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_slli_epi64(lhs.reg(idx), rhs);
             }
@@ -72,22 +72,22 @@ struct bitwise_lshift<T, W, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = detail::bitwise_sllv_epi8(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = detail::bitwise_sllv_epi16(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_sllv_epi32(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_sllv_epi64(lhs.reg(idx), rhs.reg(idx));
             }
@@ -134,28 +134,28 @@ struct bitwise_rshift<T, W, REQUIRE_INTEGRAL(T)>
         constexpr bool is_signed = std::is_signed<T>::value;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? detail::bitwise_sra_epi8(lhs.reg(idx), rhs)
                     : detail::bitwise_srl_epi8(lhs.reg(idx), rhs);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? _mm256_sra_epi16(lhs.reg(idx), _mm256_set1_epi64x(rhs))
                     : _mm256_srl_epi16(lhs.reg(idx), _mm256_set1_epi64x(rhs));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? _mm256_sra_epi32(lhs.reg(idx), _mm256_set1_epi64x(rhs))
                     : _mm256_srl_epi32(lhs.reg(idx), _mm256_set1_epi64x(rhs));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? detail::bitwise_sra_epi64(lhs.reg(idx), rhs)
@@ -184,7 +184,7 @@ struct bitwise_not<T, W, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         auto mask = avx::detail::make_mask<T>();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_xor_si256(x.reg(idx), mask);
         }
@@ -198,7 +198,7 @@ struct bitwise_not<T, W, REQUIRE_INTEGRAL(T)>
         VecBool<T, W> ret;
         constexpr auto nregs = VecBool<T, W>::n_regs();
         auto mask = avx::detail::make_mask<T>();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm256_xor_si256(x.reg(idx), mask);
         }
@@ -25,17 +25,17 @@ struct abs<T, W, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr int nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_abs_epi8(x.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_abs_epi16(x.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm256_abs_epi32(x.reg(idx));
             }
@@ -43,7 +43,7 @@ struct abs<T, W, REQUIRE_INTEGRAL(T)>
             // _mm256_abs_epi64 is provided in AVX512F + AVX512VL
             constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
             using sse_vec_t = Vec<T, reg_lanes/2>;
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = detail::forward_sse_op<detail::sse_abs, sse_vec_t>(x.reg(idx));
             }
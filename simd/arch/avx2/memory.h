@@ -3,4 +3,125 @@
 namespace simd { namespace kernel { namespace avx2 {
 using namespace types;
 
+namespace detail {
+/// float lanes -> bfloat16 bits in the low half of each 32-bit lane,
+/// round to nearest even, NaN made quiet
+SIMD_INLINE
+__m256i round_bf16(__m256 x) noexcept
+{
+    const __m256i xi = _mm256_castps_si256(x);
+    const __m256i hi = _mm256_srli_epi32(xi, 16);
+    const __m256i lsb = _mm256_and_si256(hi, _mm256_set1_epi32(1));
+    const __m256i r = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(xi, _mm256_set1_epi32(0x7FFF)), lsb), 16);
+    const __m256i nan = _mm256_castps_si256(_mm256_cmp_ps(x, x, _CMP_UNORD_Q));
+    return _mm256_blendv_epi8(r, _mm256_or_si256(hi, _mm256_set1_epi32(0x40)), nan);
+}
+}  // namespace detail
+
+/// load_masked/store_masked: 32 and 64 bits integers through vpmaskmov on
+/// the partially used last register, as avx does for float/double
+template <typename T, size_t W>
+struct load_masked<T, W, ENABLE_IF((std::is_integral<T>::value && sizeof(T) >= 4))>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const T* mem) noexcept
+    {
+        Vec<T, W> ret;
+        constexpr auto nregs = Vec<T, W>::n_regs();
+        constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            ret.reg(idx) = _mm256_loadu_si256((const avx_reg_i*)(mem + idx * reg_lanes));
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        const auto mask = avx::detail::tail_mask<T>(W - last);
+        SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
+            ret.reg(nregs - 1) = _mm256_maskload_epi32((const int*)(mem + last), mask);
+        } else {
+            ret.reg(nregs - 1) = _mm256_maskload_epi64((const long long*)(mem + last), mask);
+        }
+        return ret;
+    }
+};
+
+template <typename T, size_t W>
+struct store_masked<T, W, ENABLE_IF((std::is_integral<T>::value && sizeof(T) >= 4))>
+{
+    SIMD_INLINE
+    static void apply(T* mem, const Vec<T, W>& x) noexcept
+    {
+        constexpr auto nregs = Vec<T, W>::n_regs();
+        constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            _mm256_storeu_si256((avx_reg_i*)(mem + idx * reg_lanes), x.reg(idx));
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        const auto mask = avx::detail::tail_mask<T>(W - last);
+        SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
+            _mm256_maskstore_epi32((int*)(mem + last), mask, x.reg(nregs - 1));
+        } else {
+            _mm256_maskstore_epi64((long long*)(mem + last), mask, x.reg(nregs - 1));
+        }
+    }
+};
+
+/// load_bf16/store_bf16: bfloat16 is the upper half of a float, so
+/// loading is a 16 bit shift and storing a rounding add plus a pack
+template <size_t W>
+struct load_bf16<float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const bfloat16* mem) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            __m128i x = _mm_loadu_si128((const __m128i*)(mem + idx * reg_lanes));
+            ret.reg(idx) = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(x), 16));
+        }
+        return ret;
+    }
+};
+
+template <size_t W>
+struct store_bf16<float, W>
+{
+    SIMD_INLINE
+    static void apply(bfloat16* mem, const Vec<float, W>& x) noexcept
+    {
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            __m256i r = detail::round_bf16(x.reg(idx));
+            r = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0x08);
+            _mm_storeu_si128((__m128i*)(mem + idx * reg_lanes), _mm256_castsi256_si128(r));
+        }
+    }
+};
+
+/// unpack_bf16: 2W bfloat16 as W pairs, {even elements, odd elements} as float
+template <size_t W>
+struct unpack_bf16<float, W>
+{
+    SIMD_INLINE
+    static std::array<Vec<float, W>, 2> apply(const bfloat16* mem) noexcept
+    {
+        std::array<Vec<float, W>, 2> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        const __m256i odd_mask = _mm256_set1_epi32(0xFFFF0000);
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            __m256i x = _mm256_loadu_si256((const __m256i*)(mem + 2 * idx * reg_lanes));
+            ret[0].reg(idx) = _mm256_castsi256_ps(_mm256_slli_epi32(x, 16));
+            ret[1].reg(idx) = _mm256_castsi256_ps(_mm256_and_si256(x, odd_mask));
+        }
+        return ret;
+    }
+};
+
 } } } // namespace simd::kernel::avx2
@@ -0,0 +1,286 @@
+#pragma once
+
+namespace simd { namespace kernel { namespace avx2 {
+using namespace types;
+
+namespace detail {
+/// one register shuffles, P an ops::shuffle_pattern over the register lanes
+/// float / double: the AVX forms, with vpermps / vpermpd for lane crossings
+template <typename T, typename Enable = void>
+struct shuffle_regs : avx::detail::shuffle_regs<T, true>
+{
+};
+
+/// integers: vpshufd / vpshuflw / vpermq immediates, vpermd, in-lane
+/// vpshufb; vpblendd / vpunpck / vpalignr / vperm2i128 for two sources
+template <typename T>
+struct shuffle_regs<T, REQUIRE_INTEGRAL(T)>
+{
+    static constexpr size_t S = sizeof(T);
+    static constexpr size_t G = 16 / S;
+    using wide_t = typename std::conditional<S == 1, int16_t,
+                   typename std::conditional<S == 2, int32_t, int64_t>::type>::type;
+
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_i permute(const avx_reg_i& x) noexcept
+    {
+        SIMD_IF_CONSTEXPR(P::identity()) {
+            return x;
+        } else SIMD_IF_CONSTEXPR(S == 4 && P::same_blocks(4)) {
+            constexpr int imm = P::imm(4, 2);
+            return _mm256_shuffle_epi32(x, imm);
+        } else SIMD_IF_CONSTEXPR(S == 2 && P::same_blocks(8) && P::fixed(4, 4)) {
+            constexpr int imm = P::imm(4, 2);
+            return _mm256_shufflelo_epi16(x, imm);
+        } else SIMD_IF_CONSTEXPR(S == 2 && P::same_blocks(8) && P::fixed(0, 4)) {
+            constexpr int imm = P::imm(4, 2, 4);
+            return _mm256_shufflehi_epi16(x, imm);
+        } else SIMD_IF_CONSTEXPR(S < 4 && P::rotate() != 0) {
+            return concat_shift<P::rotate() * S>(x, x);
+        } else {
+            return permute<P>(x, std::integral_constant<bool, (S < 8 && P::pairs())>());
+        }
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_i shuffle(const avx_reg_i& a, const avx_reg_i& b) noexcept
+    {
+        using X = ops::swap_sources_t<P>;
+        SIMD_IF_CONSTEXPR(P::from_a()) {
+            return permute<P>(a);
+        } else SIMD_IF_CONSTEXPR(P::from_b()) {
+            return permute<X>(b);
+        } else SIMD_IF_CONSTEXPR(P::blend()) {
+            return blend<P>(a, b);
+        } else SIMD_IF_CONSTEXPR(P::unpack(G, false)) {
+            return unpack<T>::lo(a, b);
+        } else SIMD_IF_CONSTEXPR(P::unpack(G, true)) {
+            return unpack<T>::hi(a, b);
+        } else SIMD_IF_CONSTEXPR(X::unpack(G, false)) {
+            return unpack<T>::lo(b, a);
+        } else SIMD_IF_CONSTEXPR(X::unpack(G, true)) {
+            return unpack<T>::hi(b, a);
+        } else SIMD_IF_CONSTEXPR(P::block_shift(G) != 0) {
+            constexpr int imm = P::block_shift(G) * S;
+            return _mm256_alignr_epi8(b, a, imm);
+        } else SIMD_IF_CONSTEXPR(X::block_shift(G) != 0) {
+            constexpr int imm = X::block_shift(G) * S;
+            return _mm256_alignr_epi8(a, b, imm);
+        } else SIMD_IF_CONSTEXPR(P::whole_blocks(G)) {
+            constexpr int imm = P::block_source(G, 0) | P::block_source(G, 1) << 4;
+            return _mm256_permute2x128_si256(a, b, imm);
+        } else SIMD_IF_CONSTEXPR(P::shift() != 0) {
+            return concat_shift<P::shift() * S>(a, b);
+        } else SIMD_IF_CONSTEXPR(X::shift() != 0) {
+            return concat_shift<X::shift() * S>(b, a);
+        } else SIMD_IF_CONSTEXPR(S == 4 && ((P::halves_ab(4) && P::same_blocks(4))
+                                         || (X::halves_ab(4) && X::same_blocks(4)))) {
+            return _mm256_castps_si256(avx::detail::shuffle_regs<float, true>::template shuffle<P>(
+                _mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+        } else {
+            return shuffle<P>(a, b, std::integral_constant<bool, (S < 8 && P::pairs())>());
+        }
+    }
+
+private:
+    /// bytes B .. B + 31 of (a, b): vperm2i128 brings the middle 128 bits,
+    /// vpalignr the rest
+    template <size_t B>
+    SIMD_INLINE
+    static avx_reg_i concat_shift(const avx_reg_i& a, const avx_reg_i& b) noexcept
+    {
+        const avx_reg_i t = _mm256_permute2x128_si256(a, b, 0x21);
+        SIMD_IF_CONSTEXPR(B == 16) {
+            return t;
+        } else SIMD_IF_CONSTEXPR(B < 16) {
+            return _mm256_alignr_epi8(t, a, B % 16);
+        } else {
+            return _mm256_alignr_epi8(b, t, B % 16);
+        }
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_i permute(const avx_reg_i& x, std::true_type) noexcept
+    {
+        return shuffle_regs<wide_t>::template permute<ops::widen_pattern_t<P>>(x);
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_i permute(const avx_reg_i& x, std::false_type) noexcept
+    {
+        SIMD_IF_CONSTEXPR(S == 8) {
+            constexpr int imm = P::imm(4, 2);
+            return _mm256_permute4x64_epi64(x, imm);
+        } else SIMD_IF_CONSTEXPR(S == 4) {
+            return _mm256_permutevar8x32_epi32(x, _mm256_load_si256(reinterpret_cast<const avx_reg_i*>(
+                ops::shuffle_indices<int32_t, P>())));
+        } else SIMD_IF_CONSTEXPR(P::in_blocks(G)) {
+            return _mm256_shuffle_epi8(x, bytes<P, 0>());
+        } else {
+            /// bytes from the own lane, or from the swapped lanes
+            avx_reg_i s = _mm256_permute4x64_epi64(x, 0x4E);
+            return _mm256_or_si256(_mm256_shuffle_epi8(x, bytes<P, 1>()), _mm256_shuffle_epi8(s, bytes<P, 2>()));
+        }
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_i shuffle(const avx_reg_i& a, const avx_reg_i& b, std::true_type) noexcept
+    {
+        return shuffle_regs<wide_t>::template shuffle<ops::widen_pattern_t<P>>(a, b);
+    }
+
+    /// both sources permuted into place, then blended
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_i shuffle(const avx_reg_i& a, const avx_reg_i& b, std::false_type) noexcept
+    {
+        using Q = ops::local_pattern_t<P>;
+        return blend<P>(permute<Q>(a), permute<Q>(b));
+    }
+
+    template <typename P, int Keep>
+    SIMD_INLINE
+    static avx_reg_i bytes() noexcept
+    {
+        return _mm256_load_si256(reinterpret_cast<const avx_reg_i*>(ops::shuffle_bytes<P, S, G, Keep>()));
+    }
+
+    /// lane i from b where P reads b; vpblendw when both lanes use one imm8
+    template <typename P>
+    SIMD_INLINE
+    static avx_reg_i blend(const avx_reg_i& a, const avx_reg_i& b) noexcept
+    {
+        SIMD_IF_CONSTEXPR(S >= 4) {
+            constexpr int mask = int(P::b_mask(S / 4));
+            return _mm256_blend_epi32(a, b, mask);
+        } else SIMD_IF_CONSTEXPR(S == 2 && (P::b_mask() & 0xFF) == (P::b_mask() >> 8)) {
+            constexpr int mask = int(P::b_mask() & 0xFF);
+            return _mm256_blend_epi16(a, b, mask);
+        } else {
+            return _mm256_blendv_epi8(a, b, _mm256_load_si256(reinterpret_cast<const avx_reg_i*>(
+                ops::blend_bytes<P, S>())));
+        }
+    }
+};
+
+/// runtime permute: vpermd / vpermps for 32-bit lanes, 64-bit lanes as
+/// dword pairs; 8 / 16-bit lanes as pshufb byte indices on x and on x with
+/// its 128-bit lanes swapped, blended where the byte comes from the other lane
+template <typename T>
+struct permute_regs
+{
+    static constexpr size_t S = sizeof(T);
+    static constexpr size_t L = 32 / S;
+
+    SIMD_INLINE
+    static avx_reg_i permute(const avx_reg_i& x, const avx_reg_i& idx) noexcept
+    {
+        SIMD_IF_CONSTEXPR(S >= 4) {
+            return _mm256_permutevar8x32_epi32(x, dwords(idx));
+        } else {
+            const avx_reg_i b = bytes(idx);
+            const avx_reg_i lane = _mm256_setr_m128i(_mm_setzero_si128(), _mm_set1_epi8(16));
+            const avx_reg_i other = _mm256_slli_epi16(_mm256_xor_si256(b, lane), 3);
+            const avx_reg_i s = _mm256_permute4x64_epi64(x, 0x4E);
+            return _mm256_blendv_epi8(_mm256_shuffle_epi8(x, b), _mm256_shuffle_epi8(s, b), other);
+        }
+    }
+
+    SIMD_INLINE
+    static avx_reg_f permute(const avx_reg_f& x, const avx_reg_i& idx) noexcept
+    {
+        return _mm256_permutevar8x32_ps(x, idx);
+    }
+
+    SIMD_INLINE
+    static avx_reg_d permute(const avx_reg_d& x, const avx_reg_i& idx) noexcept
+    {
+        return _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(x), dwords(idx)));
+    }
+
+private:
+    /// vpermd indices: the lane itself, or dwords 2 k and 2 k + 1 of 64-bit lane k
+    SIMD_INLINE
+    static avx_reg_i dwords(const avx_reg_i& idx) noexcept
+    {
+        SIMD_IF_CONSTEXPR(S == 4) {
+            return idx;
+        } else {
+            const avx_reg_i k = _mm256_slli_epi64(_mm256_and_si256(idx, _mm256_set1_epi64x(3)), 1);
+            return _mm256_or_si256(k, _mm256_slli_epi64(_mm256_add_epi64(k, _mm256_set1_epi64x(1)), 32));
+        }
+    }
+
+    /// byte indices 0 .. 31 of the whole register
+    SIMD_INLINE
+    static avx_reg_i bytes(const avx_reg_i& idx) noexcept
+    {
+        SIMD_IF_CONSTEXPR(S == 1) {
+            return _mm256_and_si256(idx, _mm256_set1_epi8(L - 1));
+        } else {
+            avx_reg_i k = _mm256_shuffle_epi8(idx, _mm256_load_si256(reinterpret_cast<const avx_reg_i*>(
+                ops::lane_low_bytes<S, 32>())));
+            k = _mm256_slli_epi16(_mm256_and_si256(k, _mm256_set1_epi8(L - 1)), 1);
+            return _mm256_add_epi8(k, _mm256_load_si256(reinterpret_cast<const avx_reg_i*>(
+                ops::lane_byte_offsets<S, 32>())));
+        }
+    }
+};
+
+/// byte table lookup: the SSE scheme on 256-bit registers, every 16-entry
+/// slice broadcast to both lanes
+struct lookup_regs
+{
+    template <size_t N>
+    SIMD_INLINE
+    static avx_reg_i lookup(const uint8_t* table, const avx_reg_i& idx) noexcept
+    {
+        const avx_reg_i lo = _mm256_and_si256(idx, _mm256_set1_epi8(0x0F));
+        const avx_reg_i r0 = _mm256_shuffle_epi8(slice(table, 0), lo);
+        SIMD_IF_CONSTEXPR(N == 16) {
+            return r0;
+        } else {
+            const avx_reg_i b4 = _mm256_slli_epi16(idx, 3);
+            const avx_reg_i r01 = _mm256_blendv_epi8(r0, _mm256_shuffle_epi8(slice(table, 1), lo), b4);
+            SIMD_IF_CONSTEXPR(N == 32) {
+                return r01;
+            } else {
+                const avx_reg_i r23 = _mm256_blendv_epi8(_mm256_shuffle_epi8(slice(table, 2), lo),
+                                                         _mm256_shuffle_epi8(slice(table, 3), lo), b4);
+                return _mm256_blendv_epi8(r01, r23, _mm256_slli_epi16(idx, 2));
+            }
+        }
+    }
+
+private:
+    SIMD_INLINE
+    static avx_reg_i slice(const uint8_t* table, size_t k) noexcept
+    {
+        return _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const sse_reg_i*>(table + 16 * k)));
+    }
+};
+}  // namespace detail
+
+/// shuffle
+template <typename T, size_t W>
+struct shuffle<T, W> : ops::shuffle_op<T, W, detail::shuffle_regs<T>>
+{
+};
+
+/// permute
+template <typename T, size_t W>
+struct permute<T, W> : ops::permute_op<T, W, detail::permute_regs<T>>
+{
+};
+
+/// lookup
+template <size_t W>
+struct lookup<uint8_t, W> : ops::lookup_op<W, detail::lookup_regs>
+{
+};
+} } } // namespace simd::kernel::avx2
@@ -0,0 +1,47 @@
+#pragma once
+
+namespace simd { namespace kernel { namespace avx2 {
+using namespace types;
+
+namespace detail {
+/// interleave the low / high halves of each 128-bit lane, T-sized integers
+template <typename T>
+struct unpack
+{
+    SIMD_INLINE
+    static avx_reg_i lo(const avx_reg_i& a, const avx_reg_i& b) noexcept
+    {
+        SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
+            return _mm256_unpacklo_epi8(a, b);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+            return _mm256_unpacklo_epi16(a, b);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
+            return _mm256_unpacklo_epi32(a, b);
+        } else {
+            return _mm256_unpacklo_epi64(a, b);
+        }
+    }
+    SIMD_INLINE
+    static avx_reg_i hi(const avx_reg_i& a, const avx_reg_i& b) noexcept
+    {
+        SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
+            return _mm256_unpackhi_epi8(a, b);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+            return _mm256_unpackhi_epi16(a, b);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
+            return _mm256_unpackhi_epi32(a, b);
+        } else {
+            return _mm256_unpackhi_epi64(a, b);
+        }
+    }
+};
+}  // namespace detail
+
+/// transpose
+/// same lane-local unpack + vperm2i128 scheme as AVX, for all integer sizes
+template <typename T, size_t W>
+struct transpose<T, W, REQUIRE_INTEGRAL(T)>
+    : ops::transpose_op<T, W, avx::detail::transpose_regs<T, detail::unpack>>
+{
+};
+} } } // namespace simd::kernel::avx2
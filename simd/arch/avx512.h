@@ -16,6 +16,8 @@ namespace simd { namespace kernel { namespace avx512 {
 #include "simd/arch/avx512/logical.h"
 #include "simd/arch/avx512/math.h"
 #include "simd/arch/avx512/memory.h"
+#include "simd/arch/avx512/transpose.h"
+#include "simd/arch/avx512/shuffle.h"
 #include "simd/arch/avx512/trigo.h"
 
 namespace simd { namespace kernel {
@@ -34,6 +36,23 @@ DEFINE_AVX512_BINARY_OP(sub);
 DEFINE_AVX512_BINARY_OP(mul);
 DEFINE_AVX512_BINARY_OP(div);
 DEFINE_AVX512_BINARY_OP(mod);
+DEFINE_AVX512_BINARY_OP(add_sat);
+DEFINE_AVX512_BINARY_OP(sub_sat);
+
+template <typename T, size_t W,
+    REQUIRES((sizeof(T) <= 4))>
+SIMD_INLINE
+Vec<T, W> mul_sat(const Vec<T, W>& lhs, const Vec<T, W>& rhs, requires_arch<AVX512>) noexcept
+{
+    return avx512::mul_sat<T, W>::apply(lhs, rhs);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> dot_u8i8(const Vec<T, W>& acc, const Vec<uint8_t, 4 * W>& a, const Vec<int8_t, 4 * W>& b, requires_arch<AVX512>) noexcept
+{
+    return avx512::dot_u8i8<T, W>::apply(acc, a, b);
+}
 
 DEFINE_AVX512_BINARY_OP(bitwise_and);
 DEFINE_AVX512_BINARY_OP(bitwise_or);
@@ -41,6 +60,13 @@ DEFINE_AVX512_BINARY_OP(bitwise_xor);
 DEFINE_AVX512_BINARY_OP(bitwise_lshift);
 DEFINE_AVX512_BINARY_OP(bitwise_rshift);
 
+template <uint8_t IMM, typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> bitwise_ternlog(const Vec<T, W>& a, const Vec<T, W>& b, const Vec<T, W>& c, requires_arch<AVX512>) noexcept
+{
+    return avx512::bitwise_ternlog<T, W>::template apply<IMM>(a, b, c);
+}
+
 template <typename T, size_t W>
 SIMD_INLINE
 Vec<T, W> bitwise_andnot(const VecBool<T, W>& lhs, const Vec<T, W>& rhs, requires_arch<AVX512>) noexcept
@@ -175,6 +201,85 @@ void store_unaligned(T* mem, const Vec<T, W>& x, requires_arch<AVX512>) noexcept
     avx512::store_unaligned<T, W>::apply(mem, x);
 }
 
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<std::complex<T>, W> load_complex(const Vec<T, W>& vlo, const Vec<T, W>& vhi, requires_arch<AVX512>) noexcept
+{
+    return avx512::load_complex<T, W>::apply(vlo, vhi);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> complex_packlo(const Vec<T, W>& vreal, const Vec<T, W>& vimag, requires_arch<AVX512>) noexcept
+{
+    return avx512::complex_packlo<T, W>::apply(vreal, vimag);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> complex_packhi(const Vec<T, W>& vreal, const Vec<T, W>& vimag, requires_arch<AVX512>) noexcept
+{
+    return avx512::complex_packhi<T, W>::apply(vreal, vimag);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> load_bf16(const bfloat16* mem, requires_arch<AVX512>) noexcept
+{
+    return avx512::load_bf16<T, W>::apply(mem);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+void store_bf16(bfloat16* mem, const Vec<T, W>& x, requires_arch<AVX512>) noexcept
+{
+    avx512::store_bf16<T, W>::apply(mem, x);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> load_masked(const T* mem, requires_arch<AVX512>) noexcept
+{
+    return avx512::load_masked<T, W>::apply(mem);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+void store_masked(T* mem, const Vec<T, W>& x, requires_arch<AVX512>) noexcept
+{
+    avx512::store_masked<T, W>::apply(mem, x);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+std::array<Vec<T, W>, 2> unpack_bf16(const bfloat16* mem, requires_arch<AVX512>) noexcept
+{
+    return avx512::unpack_bf16<T, W>::apply(mem);
+}
+
+#if SIMD_WITH_AVX512_BF16
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> dot_bf16(const Vec<T, W>& acc, const bfloat16* a, const bfloat16* b, requires_arch<AVX512>) noexcept
+{
+    return avx512::dot_bf16<T, W>::apply(acc, a, b);
+}
+#endif
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> load_half(const half* mem, requires_arch<AVX512>) noexcept
+{
+    return avx512::load_half<T, W>::apply(mem);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+void store_half(half* mem, const Vec<T, W>& x, requires_arch<AVX512>) noexcept
+{
+    avx512::store_half<T, W>::apply(mem, x);
+}
+
 template <typename T, size_t W, typename U, typename V>
 SIMD_INLINE
 Vec<T, W> gather(const U* mem, const Vec<V, W>& index, requires_arch<AVX512>) noexcept
@@ -239,6 +344,116 @@ Vec<T, W> fmsubadd(const Vec<T, W>& x, const Vec<T, W>& y, const Vec<T, W>& z, r
     return avx512::fmsubadd<T, W>::apply(x, y, z);
 }
 
+DEFINE_AVX512_BINARY_OP(max);
+DEFINE_AVX512_BINARY_OP(min);
+
+DEFINE_AVX512_UNARY_OP(abs);
+DEFINE_AVX512_UNARY_OP(sqrt);
+DEFINE_AVX512_UNARY_OP(ceil);
+DEFINE_AVX512_UNARY_OP(floor);
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> select(const VecBool<T, W>& cond, const Vec<T, W>& lhs, const Vec<T, W>& rhs, requires_arch<AVX512>) noexcept
+{
+    return avx512::select<T, W>::apply(cond, lhs, rhs);
+}
+
+template <typename U, typename T, size_t W,
+    REQUIRES((std::is_floating_point<U>::value && std::is_floating_point<T>::value))>
+SIMD_INLINE
+Vec<U, W> cast(const Vec<T, W>& x, requires_arch<AVX512>) noexcept
+{
+    return avx512::cast<U, T, W>::apply(x);
+}
+
+template <typename U, typename T, size_t W,
+    REQUIRES(((std::is_same<U, float>::value && std::is_same<T, uint8_t>::value)
+           || (std::is_same<U, uint8_t>::value && std::is_same<T, float>::value)))>
+SIMD_INLINE
+Vec<U, W> cast(const Vec<T, W>& x, requires_arch<AVX512>) noexcept
+{
+    return avx512::cast<U, T, W>::apply(x);
+}
+
+template <typename U, typename T, size_t W>
+SIMD_INLINE
+Vec<U, 2 * W> pack_sat(const Vec<T, W>& lo, const Vec<T, W>& hi, requires_arch<AVX512>) noexcept
+{
+    return avx512::pack_sat<U, T, W>::apply(lo, hi);
+}
+
+template <typename U, typename T, size_t W,
+    REQUIRES((ops::native_widen<U, T>::value))>
+SIMD_INLINE
+std::array<Vec<U, W * sizeof(T) / sizeof(U)>, sizeof(U) / sizeof(T)> widen(const Vec<T, W>& x, requires_arch<AVX512>) noexcept
+{
+    return avx512::widen<U, T, W>::apply(x);
+}
+
+template <typename U, bool S, typename T, size_t W, size_t K,
+    REQUIRES((ops::native_narrow<U, T>::value))>
+SIMD_INLINE
+Vec<U, W * K> narrow(const std::array<Vec<T, W>, K>& x, requires_arch<AVX512>) noexcept
+{
+    return avx512::narrow<U, T, W, S>::apply(x);
+}
+
+/// reduction
+template <typename T, size_t W,
+    REQUIRES(std::is_floating_point<T>::value)>
+SIMD_INLINE
+T reduce_sum(const Vec<T, W>& x, requires_arch<AVX512>) noexcept
+{
+    return avx512::reduce_sum<T, W>::apply(x);
+}
+
+template <typename T, size_t W,
+    REQUIRES(std::is_floating_point<T>::value)>
+SIMD_INLINE
+T reduce_max(const Vec<T, W>& x, requires_arch<AVX512>) noexcept
+{
+    return avx512::reduce_max<T, W>::apply(x);
+}
+
+template <typename T, size_t W,
+    REQUIRES(std::is_floating_point<T>::value)>
+SIMD_INLINE
+T reduce_min(const Vec<T, W>& x, requires_arch<AVX512>) noexcept
+{
+    return avx512::reduce_min<T, W>::apply(x);
+}
+
+/// transpose
+template <typename T, size_t W>
+SIMD_INLINE
+void transpose(std::array<Vec<T, W>, W>& rows, requires_arch<AVX512>) noexcept
+{
+    avx512::transpose<T, W>::apply(rows);
+}
+
+/// shuffle
+template <typename T, size_t W, size_t... I>
+SIMD_INLINE
+Vec<T, W> shuffle(const Vec<T, W>& a, const Vec<T, W>& b, ops::shuffle_pattern<I...> p, requires_arch<AVX512>) noexcept
+{
+    return avx512::shuffle<T, W>::apply(a, b, p);
+}
+
+template <typename T, size_t W, typename I>
+SIMD_INLINE
+Vec<T, W> permute(const Vec<T, W>& x, const Vec<I, W>& idx, requires_arch<AVX512>) noexcept
+{
+    return avx512::permute<T, W>::apply(x, idx);
+}
+
+template <size_t N, size_t W>
+SIMD_INLINE
+Vec<uint8_t, W> lookup(const Vec<uint8_t, N>& table, const Vec<uint8_t, W>& idx, requires_arch<AVX512>) noexcept
+{
+    return avx512::lookup<uint8_t, W>::template apply<N>(table, idx);
+}
+
 #undef DEFINE_AVX512_BINARY_OP
 #undef DEFINE_AVX512_UNARY_OP
 #undef DEFINE_AVX512_BINARY_CMP_OP
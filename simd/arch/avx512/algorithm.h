@@ -20,28 +20,28 @@ struct min<T, W, REQUIRE_INTEGRAL(T)>
         constexpr int nregs = Vec<T, W>::n_regs();
         constexpr bool is_signed = std::is_signed<T>::value;
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm512_min_epi8(lhs.reg(idx), rhs.reg(idx))
                                 : _mm512_min_epu8(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm512_min_epi16(lhs.reg(idx), rhs.reg(idx))
                                 : _mm512_min_epu16(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm512_min_epi32(lhs.reg(idx), rhs.reg(idx))
                                 : _mm512_min_epu32(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm512_min_epi64(lhs.reg(idx), rhs.reg(idx))
@@ -60,7 +60,7 @@ struct min<float, W>
     {
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm512_min_ps(lhs.reg(idx), rhs.reg(idx));
         }
@@ -76,7 +76,7 @@ struct min<double, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm512_min_pd(lhs.reg(idx), rhs.reg(idx));
         }
@@ -97,28 +97,28 @@ struct max<T, W, REQUIRE_INTEGRAL(T)>
         constexpr int nregs = Vec<T, W>::n_regs();
         constexpr bool is_signed = std::is_signed<T>::value;
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm512_max_epi8(lhs.reg(idx), rhs.reg(idx))
                                 : _mm512_max_epu8(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm512_max_epi16(lhs.reg(idx), rhs.reg(idx))
                                 : _mm512_max_epu16(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm512_max_epi32(lhs.reg(idx), rhs.reg(idx))
                                 : _mm512_max_epu32(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm512_max_epi64(lhs.reg(idx), rhs.reg(idx))
@@ -137,7 +137,7 @@ struct max<float, W>
     {
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm512_max_ps(lhs.reg(idx), rhs.reg(idx));
         }
@@ -153,7 +153,7 @@ struct max<double, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm512_max_pd(lhs.reg(idx), rhs.reg(idx));
         }
@@ -170,9 +170,9 @@ struct all_of<float, W>
     {
         bool ret = true;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            // TODO:
+        constexpr auto full = detail::full_mask<Vec<float, W>::reg_lanes()>();
+        for (auto idx = 0; ret && idx < nregs; idx++) {
+            ret = x.reg(idx) == full;
         }
         return ret;
     }
@@ -186,9 +186,9 @@ struct all_of<double, W>
     {
         bool ret = true;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            // TODO:
+        constexpr auto full = detail::full_mask<Vec<double, W>::reg_lanes()>();
+        for (auto idx = 0; ret && idx < nregs; idx++) {
+            ret = x.reg(idx) == full;
         }
         return ret;
     }
@@ -204,11 +204,9 @@ struct all_of<T, W, REQUIRE_INTEGRAL(T)>
 
         bool ret = true;
         constexpr auto nregs = VecBool<T, W>::n_regs();
-        constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        using sse_vbool_t = VecBool<T, reg_lanes/2>;
-        #pragma unroll
+        constexpr auto full = detail::full_mask<Vec<T, W>::reg_lanes()>();
         for (auto idx = 0; ret && idx < nregs; idx++) {
-            // TODO:
+            ret = x.reg(idx) == full;
         }
         return ret;
     }
@@ -223,9 +221,8 @@ struct any_of<float, W>
     {
         bool ret = false;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            // TODO:
+        for (auto idx = 0; !ret && idx < nregs; idx++) {
+            ret = x.reg(idx) != 0;
         }
         return ret;
     }
@@ -239,9 +236,8 @@ struct any_of<double, W>
     {
         bool ret = false;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            // TODO:
+        for (auto idx = 0; !ret && idx < nregs; idx++) {
+            ret = x.reg(idx) != 0;
         }
         return ret;
     }
@@ -257,9 +253,8 @@ struct any_of<T, W, REQUIRE_INTEGRAL(T)>
 
         bool ret = false;
         constexpr auto nregs = VecBool<T, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            // TODO:
+        for (auto idx = 0; !ret && idx < nregs; idx++) {
+            ret = x.reg(idx) != 0;
         }
         return ret;
     }
@@ -277,28 +272,24 @@ struct select<T, W, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = VecBool<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
-                // TODO:
-                //ret.reg(idx) = _mm512_mask_blend_epi8(cond.reg(idx), lhs.reg(idx), rhs.reg(idx));
+                ret.reg(idx) = _mm512_mask_blend_epi8(cond.reg(idx), rhs.reg(idx), lhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
-                // TODO:
-                //ret.reg(idx) = _mm512_mask_blend_epi16(cond.reg(idx), lhs.reg(idx), rhs.reg(idx));
+                ret.reg(idx) = _mm512_mask_blend_epi16(cond.reg(idx), rhs.reg(idx), lhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
-                // TODO:
-                //ret.reg(idx) = _mm512_mask_blend_epi32(cond.reg(idx), lhs.reg(idx), rhs.reg(idx));
+                ret.reg(idx) = _mm512_mask_blend_epi32(cond.reg(idx), rhs.reg(idx), lhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
-                // TODO:
-                //ret.reg(idx) = _mm512_mask_blend_epi64(cond.reg(idx), lhs.reg(idx), rhs.reg(idx));
+                ret.reg(idx) = _mm512_mask_blend_epi64(cond.reg(idx), rhs.reg(idx), lhs.reg(idx));
             }
         }
         return ret;
@@ -313,10 +304,9 @@ struct select<float, W>
     {
         Vec<float, W> ret;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
-            // TODO: _mm512_mask_blend_ps
-            // ret.reg(idx) = _mm512_mask_blend_ps(cond.reg(idx), rhs.reg(idx), lhs.reg(idx));
+            ret.reg(idx) = _mm512_mask_blend_ps(cond.reg(idx), rhs.reg(idx), lhs.reg(idx));
         }
         return ret;
     }
@@ -330,10 +320,9 @@ struct select<double, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
-            // TODO: _mm512_mask_blend_pd
-            // ret.reg(idx) = _mm512_mask_blend_pd(cond.reg(idx), rhs.reg(idx), lhs.reg(idx));
+            ret.reg(idx) = _mm512_mask_blend_pd(cond.reg(idx), rhs.reg(idx), lhs.reg(idx));
         }
         return ret;
     }
@@ -348,7 +337,7 @@ struct popcount<float, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             // TODO: to_mask extend to support idx
             // ret += bits::count1(x.reg(idx));
@@ -365,7 +354,7 @@ struct popcount<double, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             // TODO: to_mask extend to support idx
             // ret += bits::count1(x.reg(idx));
@@ -384,7 +373,7 @@ struct popcount<T, W, REQUIRE_INTEGRAL(T)>
 
         int ret = 0;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             // TODO: to_mask extend to support idx
             // ret += bits::count1(x.reg(idx));
@@ -402,7 +391,7 @@ struct find_first_set<float, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             // TODO:
         }
@@ -418,7 +407,7 @@ struct find_first_set<double, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             // TODO:
         }
@@ -437,19 +426,19 @@ struct find_first_set<T, W, REQUIRE_INTEGRAL(T)>
         int ret = 0;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         }
@@ -466,7 +455,7 @@ struct find_last_set<float, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
         }
         return ret;
@@ -481,7 +470,7 @@ struct find_last_set<double, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
         }
         return ret;
@@ -499,19 +488,19 @@ struct find_last_set<T, W, REQUIRE_INTEGRAL(T)>
         int ret = 0;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         }
@@ -587,11 +576,11 @@ struct reduce_sum<T, W, REQUIRE_INTEGRAL(T)>
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
             }
         }
@@ -605,13 +594,9 @@ struct reduce_sum<float, W>
     SIMD_INLINE
     static float apply(const Vec<float, W>& x) noexcept
     {
-        float ret{};
-        constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            ret += _mm512_reduce_add_ps(x.reg(idx));
-        }
-        return ret;
+        return _mm512_reduce_add_ps(ops::fold_regs(x, [](const avx512_reg_f& a, const avx512_reg_f& b) {
+            return _mm512_add_ps(a, b);
+        }));
     }
 };
 
@@ -621,13 +606,9 @@ struct reduce_sum<double, W>
     SIMD_INLINE
     static double apply(const Vec<double, W>& x) noexcept
     {
-        double ret{};
-        constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            ret += _mm512_reduce_add_pd(x.reg(idx));
-        }
-        return ret;
+        return _mm512_reduce_add_pd(ops::fold_regs(x, [](const avx512_reg_d& a, const avx512_reg_d& b) {
+            return _mm512_add_pd(a, b);
+        }));
     }
 };
 
@@ -644,21 +625,21 @@ struct reduce_max<T, W, REQUIRE_INTEGRAL(T)>
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr bool is_signed = std::is_signed<T>::value;
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
 
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
             // TODO
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // ret = is_signed
                 //     ? _mm512_reduce_max_epi32(x.reg(idx))
                 //     : _mm512_reduce_max_epu32(x.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // ret = is_signed
                 //     ? _mm512_reduce_max_epi64(x.reg(idx))
@@ -675,13 +656,9 @@ struct reduce_max<float, W>
     SIMD_INLINE
     static float apply(const Vec<float, W>& x) noexcept
     {
-        float ret{std::numeric_limits<float>::lowest};
-        constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            ret = std::max(ret, _mm512_reduce_max_ps(x.reg(idx)));
-        }
-        return ret;
+        return _mm512_reduce_max_ps(ops::fold_regs(x, [](const avx512_reg_f& a, const avx512_reg_f& b) {
+            return _mm512_max_ps(a, b);
+        }));
     }
 };
 
@@ -691,13 +668,9 @@ struct reduce_max<double, W>
     SIMD_INLINE
     static double apply(const Vec<double, W>& x) noexcept
     {
-        double ret{std::numeric_limits<double>::lowest};
-        constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            ret = std::max(ret, _mm512_reduce_max_pd(x.reg(idx)));
-        }
-        return ret;
+        return _mm512_reduce_max_pd(ops::fold_regs(x, [](const avx512_reg_d& a, const avx512_reg_d& b) {
+            return _mm512_max_pd(a, b);
+        }));
     }
 };
 
@@ -717,12 +690,12 @@ struct reduce_min<T, W, REQUIRE_INTEGRAL(T)>
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
             // TODO
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO
             }
@@ -737,13 +710,9 @@ struct reduce_min<float, W>
     SIMD_INLINE
     static float apply(const Vec<float, W>& x) noexcept
     {
-        float ret{std::numeric_limits<float>::max};
-        constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            ret = std::min(ret, _mm512_reduce_min_ps(x.reg(idx)));
-        }
-        return ret;
+        return _mm512_reduce_min_ps(ops::fold_regs(x, [](const avx512_reg_f& a, const avx512_reg_f& b) {
+            return _mm512_min_ps(a, b);
+        }));
     }
 };
 
@@ -753,13 +722,9 @@ struct reduce_min<double, W>
     SIMD_INLINE
     static double apply(const Vec<double, W>& x) noexcept
     {
-        double ret{std::numeric_limits<double>::max};
-        constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            ret = std::min(ret, _mm512_reduce_min_ps(x.reg(idx)));
-        }
-        return ret;
+        return _mm512_reduce_min_pd(ops::fold_regs(x, [](const avx512_reg_d& a, const avx512_reg_d& b) {
+            return _mm512_min_pd(a, b);
+        }));
     }
 };
 
@@ -779,12 +744,12 @@ struct reduce<T, W, F, REQUIRE_INTEGRAL(T)>
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
             // TODO
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO
             }
@@ -801,7 +766,7 @@ struct reduce<float, W, F>
     {
         float ret{};
         constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             // TODO
         }
@@ -817,7 +782,7 @@ struct reduce<double, W, F>
     {
         double ret{};
         constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             // TODO
         }
@@ -123,6 +123,146 @@ struct neg_functor {
     }
 };
 
+/// saturating add, native for 8/16-bit lanes, 32/64-bit lanes detect the overflow into a mask
+template <typename T>
+struct add_sat_functor {
+    template <typename U = T, REQUIRES(IS_INT_SIZE_1(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        return _mm512_adds_epi8(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_1(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        return _mm512_adds_epu8(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_2(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        return _mm512_adds_epi16(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_2(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        return _mm512_adds_epu16(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_4(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        /// overflow when the sign of the result differs from both operands
+        __m512i r = _mm512_add_epi32(x, y);
+        __m512i o = _mm512_and_si512(_mm512_xor_si512(x, r), _mm512_xor_si512(y, r));
+        __m512i s = _mm512_xor_si512(_mm512_srai_epi32(x, 31), _mm512_set1_epi32(INT32_MAX));
+        return _mm512_mask_mov_epi32(r, _mm512_cmplt_epi32_mask(o, _mm512_setzero_si512()), s);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_4(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        /// y is clamped to `~x`, the room left before wrapping around
+        return _mm512_add_epi32(x, _mm512_min_epu32(y, _mm512_xor_si512(x, _mm512_set1_epi32(-1))));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_8(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        __m512i r = _mm512_add_epi64(x, y);
+        __m512i o = _mm512_and_si512(_mm512_xor_si512(x, r), _mm512_xor_si512(y, r));
+        __m512i s = _mm512_xor_si512(_mm512_srai_epi64(x, 63), _mm512_set1_epi64(INT64_MAX));
+        return _mm512_mask_mov_epi64(r, _mm512_cmplt_epi64_mask(o, _mm512_setzero_si512()), s);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_8(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        return _mm512_add_epi64(x, _mm512_min_epu64(y, _mm512_xor_si512(x, _mm512_set1_epi64(-1))));
+    }
+};
+
+/// saturating sub, native for 8/16-bit lanes, 32/64-bit lanes detect the overflow into a mask
+template <typename T>
+struct sub_sat_functor {
+    template <typename U = T, REQUIRES(IS_INT_SIZE_1(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        return _mm512_subs_epi8(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_1(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        return _mm512_subs_epu8(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_2(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        return _mm512_subs_epi16(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_2(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        return _mm512_subs_epu16(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_4(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        /// overflow when x and y differ in sign and the result takes the sign of y
+        __m512i r = _mm512_sub_epi32(x, y);
+        __m512i o = _mm512_and_si512(_mm512_xor_si512(x, y), _mm512_xor_si512(x, r));
+        __m512i s = _mm512_xor_si512(_mm512_srai_epi32(x, 31), _mm512_set1_epi32(INT32_MAX));
+        return _mm512_mask_mov_epi32(r, _mm512_cmplt_epi32_mask(o, _mm512_setzero_si512()), s);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_4(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        return _mm512_sub_epi32(_mm512_max_epu32(x, y), y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_8(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        __m512i r = _mm512_sub_epi64(x, y);
+        __m512i o = _mm512_and_si512(_mm512_xor_si512(x, y), _mm512_xor_si512(x, r));
+        __m512i s = _mm512_xor_si512(_mm512_srai_epi64(x, 63), _mm512_set1_epi64(INT64_MAX));
+        return _mm512_mask_mov_epi64(r, _mm512_cmplt_epi64_mask(o, _mm512_setzero_si512()), s);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_8(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        return _mm512_sub_epi64(_mm512_max_epu64(x, y), y);
+    }
+};
+
+/// Q7/Q15/Q31 fixed-point multiply, rounded, -1 * -1 clamped to the max value
+template <typename T>
+struct mul_sat_functor {
+    template <typename U = T, REQUIRES(IS_INT_SIZE_1(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        /// sign extend into 16-bit lanes, the final in-lane pack does the clamping
+        __m512i r = _mm512_set1_epi16(1 << 6);
+        __m512i lo = _mm512_mullo_epi16(_mm512_srai_epi16(_mm512_unpacklo_epi8(x, x), 8),
+                                        _mm512_srai_epi16(_mm512_unpacklo_epi8(y, y), 8));
+        __m512i hi = _mm512_mullo_epi16(_mm512_srai_epi16(_mm512_unpackhi_epi8(x, x), 8),
+                                        _mm512_srai_epi16(_mm512_unpackhi_epi8(y, y), 8));
+        return _mm512_packs_epi16(_mm512_srai_epi16(_mm512_add_epi16(lo, r), 7),
+                                  _mm512_srai_epi16(_mm512_add_epi16(hi, r), 7));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_2(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        /// pmulhrsw only wraps for -1 * -1, the sole way to get INT16_MIN back
+        __m512i r = _mm512_mulhrs_epi16(x, y);
+        return _mm512_mask_mov_epi16(r, _mm512_cmpeq_epi16_mask(r, _mm512_set1_epi16(INT16_MIN)),
+                                     _mm512_set1_epi16(INT16_MAX));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_4(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        /// 64-bit products of the even and odd lanes, bits [31, 62] are the result
+        __m512i r = _mm512_set1_epi64(int64_t(1) << 30);
+        __m512i even = _mm512_add_epi64(_mm512_mul_epi32(x, y), r);
+        __m512i odd = _mm512_add_epi64(_mm512_mul_epi32(_mm512_srli_epi64(x, 32), _mm512_srli_epi64(y, 32)), r);
+        __m512i ret = _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(even, 31), _mm512_slli_epi64(odd, 1));
+        return _mm512_mask_mov_epi32(ret, _mm512_cmpeq_epi32_mask(ret, _mm512_set1_epi32(INT32_MIN)),
+                                     _mm512_set1_epi32(INT32_MAX));
+    }
+};
 }  // namespace detail
 
 /// add
@@ -149,4 +289,62 @@ struct div<T, W>
     : ops::arith_binary_op<T, W, detail::div_functor<T>>
 {};
 
+template <typename T, size_t W>
+struct neg<T, W, REQUIRE_INTEGRAL(T)>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& x) noexcept
+    {
+        return avx512::sub<T, W>::apply(Vec<T, W>(0), x);
+    }
+};
+
+template <typename T, size_t W>
+struct neg<T, W, REQUIRE_FLOATING(T)>
+    : ops::arith_unary_op<T, W, detail::neg_functor<T>>
+{};
+
+/// add_sat
+template <typename T, size_t W>
+struct add_sat<T, W>
+    : ops::arith_binary_op<T, W, detail::add_sat_functor<T>>
+{};
+
+/// sub_sat
+template <typename T, size_t W>
+struct sub_sat<T, W>
+    : ops::arith_binary_op<T, W, detail::sub_sat_functor<T>>
+{};
+
+/// mul_sat for int8/int16/int32, int64 falls back to generic
+template <typename T, size_t W>
+struct mul_sat<T, W>
+    : ops::arith_binary_op<T, W, detail::mul_sat_functor<T>>
+{};
+
+
+/// dot_u8i8: acc[i] += sum(a[4i+j] * b[4i+j]), j < 4
+/// vpdpbusd with SIMD_WITH_AVX512_VNNI, exact; vpmaddubsw + vpmaddwd
+/// otherwise, where the int16 sum of each byte pair saturates
+template <size_t W>
+struct dot_u8i8<int32_t, W>
+{
+    SIMD_INLINE
+    static Vec<int32_t, W> apply(const Vec<int32_t, W>& acc, const Vec<uint8_t, 4 * W>& a, const Vec<int8_t, 4 * W>& b) noexcept
+    {
+        Vec<int32_t, W> ret;
+        constexpr auto nregs = Vec<int32_t, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+#if SIMD_WITH_AVX512_VNNI
+            ret.reg(idx) = _mm512_dpbusd_epi32(acc.reg(idx), a.reg(idx), b.reg(idx));
+#else
+            __m512i t = _mm512_madd_epi16(_mm512_maddubs_epi16(a.reg(idx), b.reg(idx)), _mm512_set1_epi16(1));
+            ret.reg(idx) = _mm512_add_epi32(acc.reg(idx), t);
+#endif
+        }
+        return ret;
+    }
+};
+
 } } } // namespace simd::kernel::avx512
@@ -1,6 +1,374 @@
 #pragma once
 
+#include <limits>
+
 namespace simd { namespace kernel { namespace avx512 {
 using namespace types;
 
+/// cast
+template <size_t W>
+struct cast<float, float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const Vec<float, W>& x) noexcept
+    {
+        return x;
+    }
+};
+
+template <size_t W>
+struct cast<double, double, W>
+{
+    SIMD_INLINE
+    static Vec<double, W> apply(const Vec<double, W>& x) noexcept
+    {
+        return x;
+    }
+};
+
+template <size_t W>
+struct cast<double, float, W,
+    traits::enable_if_t<std::is_same<typename Vec<float, W>::register_t, avx_reg_f>::value>>
+{
+    /// float => double
+    /// one AVX float register widens into one AVX512 double register
+    SIMD_INLINE
+    static Vec<double, W> apply(const Vec<float, W>& x) noexcept
+    {
+        Vec<double, W> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            ret.reg(idx) = _mm512_cvtps_pd(x.reg(idx));
+        }
+        return ret;
+    }
+};
+template <size_t W>
+struct cast<double, float, W,
+    traits::enable_if_t<std::is_same<typename Vec<float, W>::register_t, avx512_reg_f>::value>>
+{
+    /// float => double
+    /// one float register widens into two double registers
+    SIMD_INLINE
+    static Vec<double, W> apply(const Vec<float, W>& x) noexcept
+    {
+        Vec<double, W> ret;
+        constexpr auto src_nregs = Vec<float, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < src_nregs; idx++) {
+            ret.reg(2 * idx + 0) = _mm512_cvtps_pd(_mm512_castps512_ps256(x.reg(idx)));
+            ret.reg(2 * idx + 1) = _mm512_cvtps_pd(
+                _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(x.reg(idx)), 1)));
+        }
+        return ret;
+    }
+};
+
+template <size_t W>
+struct cast<float, double, W,
+    traits::enable_if_t<std::is_same<typename Vec<float, W>::register_t, avx_reg_f>::value>>
+{
+    /// double => float
+    /// one AVX512 double register narrows into one AVX float register
+    SIMD_INLINE
+    static Vec<float, W> apply(const Vec<double, W>& x) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr auto nregs = Vec<double, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            ret.reg(idx) = _mm512_cvtpd_ps(x.reg(idx));
+        }
+        return ret;
+    }
+};
+template <size_t W>
+struct cast<float, double, W,
+    traits::enable_if_t<std::is_same<typename Vec<float, W>::register_t, avx512_reg_f>::value>>
+{
+    /// double => float
+    /// two double registers narrow into one float register
+    SIMD_INLINE
+    static Vec<float, W> apply(const Vec<double, W>& x) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr auto dst_nregs = Vec<float, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < dst_nregs; idx++) {
+            __m256 lo = _mm512_cvtpd_ps(x.reg(2 * idx + 0));
+            __m256 hi = _mm512_cvtpd_ps(x.reg(2 * idx + 1));
+            ret.reg(idx) = _mm512_castpd_ps(_mm512_insertf64x4(
+                _mm512_castpd256_pd512(_mm256_castps_pd(lo)), _mm256_castps_pd(hi), 1));
+        }
+        return ret;
+    }
+};
+template <size_t W>
+struct cast<float, uint8_t, W>
+{
+    /// uint8 => float
+    /// 16 bytes zero-extend into each float register
+    SIMD_INLINE
+    static Vec<float, W> apply(const Vec<uint8_t, W>& x) noexcept
+    {
+        alignas(64) uint8_t buf[W < 64 ? 64 : W];
+        x.store_unaligned(buf);
+        Vec<float, W> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 16 * idx));
+            ret.reg(idx) = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(b));
+        }
+        return ret;
+    }
+};
+
+template <size_t W>
+struct cast<uint8_t, float, W>
+{
+    /// float => uint8
+    /// truncated, out of range values saturate to [0, 255]
+    SIMD_INLINE
+    static Vec<uint8_t, W> apply(const Vec<float, W>& x) noexcept
+    {
+        alignas(64) uint8_t buf[W < 64 ? 64 : W];
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            __m512i i = _mm512_max_epi32(_mm512_cvttps_epi32(x.reg(idx)), _mm512_setzero_si512());
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(buf + 16 * idx), _mm512_cvtusepi32_epi8(i));
+        }
+        return Vec<uint8_t, W>::load_unaligned(buf);
+    }
+};
+
+namespace detail {
+/// narrow two registers into one, clamping each lane to the range of U:
+/// vpmov(s|us) saturate by the source sign, so sources crossing the sign are clamped first
+template <typename U, typename T>
+struct pack_sat_functor {
+    template <typename V = T, REQUIRES(IS_INT_SIZE_2(V))>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        return concat(narrow16(x), narrow16(y));
+    }
+    template <typename V = T, REQUIRES(IS_INT_SIZE_4(V))>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        return concat(narrow32(x), narrow32(y));
+    }
+    template <typename V = T, REQUIRES(IS_INT_SIZE_8(V))>
+    SIMD_INLINE
+    avx512_reg_i operator ()(const avx512_reg_i& x, const avx512_reg_i& y) noexcept {
+        return concat(narrow64(x), narrow64(y));
+    }
+
+private:
+    SIMD_INLINE
+    static __m512i concat(const __m256i& lo, const __m256i& hi) noexcept {
+        return _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+    }
+    SIMD_INLINE
+    static __m256i narrow16(const __m512i& x) noexcept {
+        SIMD_IF_CONSTEXPR(std::is_signed<T>::value && std::is_signed<U>::value) {
+            return _mm512_cvtsepi16_epi8(x);
+        } else SIMD_IF_CONSTEXPR(std::is_signed<T>::value) {
+            return _mm512_cvtusepi16_epi8(_mm512_max_epi16(x, _mm512_setzero_si512()));
+        } else {
+            return _mm512_cvtusepi16_epi8(_mm512_min_epu16(x, _mm512_set1_epi16(int16_t(std::numeric_limits<U>::max()))));
+        }
+    }
+    SIMD_INLINE
+    static __m256i narrow32(const __m512i& x) noexcept {
+        SIMD_IF_CONSTEXPR(std::is_signed<T>::value && std::is_signed<U>::value) {
+            return _mm512_cvtsepi32_epi16(x);
+        } else SIMD_IF_CONSTEXPR(std::is_signed<T>::value) {
+            return _mm512_cvtusepi32_epi16(_mm512_max_epi32(x, _mm512_setzero_si512()));
+        } else {
+            return _mm512_cvtusepi32_epi16(_mm512_min_epu32(x, _mm512_set1_epi32(int32_t(std::numeric_limits<U>::max()))));
+        }
+    }
+    SIMD_INLINE
+    static __m256i narrow64(const __m512i& x) noexcept {
+        SIMD_IF_CONSTEXPR(std::is_signed<T>::value && std::is_signed<U>::value) {
+            return _mm512_cvtsepi64_epi32(x);
+        } else SIMD_IF_CONSTEXPR(std::is_signed<T>::value) {
+            return _mm512_cvtusepi64_epi32(_mm512_max_epi64(x, _mm512_setzero_si512()));
+        } else {
+            return _mm512_cvtusepi64_epi32(_mm512_min_epu64(x, _mm512_set1_epi64(int64_t(std::numeric_limits<U>::max()))));
+        }
+    }
+};
+}  // namespace detail
+
+/// pack_sat
+template <typename U, typename T, size_t W>
+struct pack_sat<U, T, W>
+    : ops::pack_binary_op<U, T, W, detail::pack_sat_functor<U, T>>
+{};
+
+namespace detail {
+/// sign or zero extend (by the signedness of T) 2x from a 256-bit half
+template <typename E, typename T>
+SIMD_INLINE
+__m512i extend(const __m256i& x) noexcept
+{
+    constexpr bool s = std::is_signed<T>::value;
+    SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
+        return s ? _mm512_cvtepi8_epi16(x) : _mm512_cvtepu8_epi16(x);
+    } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+        return s ? _mm512_cvtepi16_epi32(x) : _mm512_cvtepu16_epi32(x);
+    } else {
+        return s ? _mm512_cvtepi32_epi64(x) : _mm512_cvtepu32_epi64(x);
+    }
+}
+
+/// sign or zero extend (by the signedness of T) 4x / 8x from a 128-bit part
+template <typename E, typename T>
+SIMD_INLINE
+__m512i extend(const __m128i& x) noexcept
+{
+    constexpr bool s = std::is_signed<T>::value;
+    SIMD_IF_CONSTEXPR(sizeof(T) == 1 && sizeof(E) == 4) {
+        return s ? _mm512_cvtepi8_epi32(x) : _mm512_cvtepu8_epi32(x);
+    } else SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
+        return s ? _mm512_cvtepi8_epi64(x) : _mm512_cvtepu8_epi64(x);
+    } else {
+        return s ? _mm512_cvtepi16_epi64(x) : _mm512_cvtepu16_epi64(x);
+    }
+}
+
+/// one register into K: the J-th 64 / K bytes are extracted (a 256-bit half
+/// for K = 2, a 128-bit part otherwise), then extended and converted
+template <typename U, typename T>
+struct widen_functor {
+    static constexpr size_t K = sizeof(U) / sizeof(T);
+    using reg_t = typename Vec<U, 64 / sizeof(U)>::register_t;
+
+    SIMD_INLINE
+    std::array<reg_t, K> operator ()(const avx512_reg_i& x) noexcept {
+        return parts(x, simd::detail::make_index_sequence<K>());
+    }
+    SIMD_INLINE
+    std::array<reg_t, K> operator ()(const avx512_reg_f& x) noexcept {
+        __m256 hi = _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(x), 1));
+        return {{ _mm512_cvtps_pd(_mm512_castps512_ps256(x)), _mm512_cvtps_pd(hi) }};
+    }
+
+private:
+    template <size_t... J>
+    SIMD_INLINE
+    static std::array<reg_t, K> parts(const __m512i& x, simd::detail::index_sequence<J...>) noexcept {
+        return {{ convert(part<J>(x, std::integral_constant<bool, K == 2>()))... }};
+    }
+    template <size_t J>
+    SIMD_INLINE
+    static __m256i part(const __m512i& x, std::true_type) noexcept {
+        constexpr int imm = J;
+        return _mm512_extracti64x4_epi64(x, imm);
+    }
+    template <size_t J>
+    SIMD_INLINE
+    static __m128i part(const __m512i& x, std::false_type) noexcept {
+        constexpr int imm = J * 64 / K / 16;
+        constexpr int shift = J * 64 / K % 16;
+        return _mm_srli_si128(_mm512_extracti32x4_epi32(x, imm), shift);
+    }
+    template <typename P, typename V = U, REQUIRES(std::is_integral<V>::value)>
+    SIMD_INLINE
+    static reg_t convert(const P& x) noexcept {
+        return extend<U, T>(x);
+    }
+    template <typename P, typename V = U, REQUIRES((std::is_same<V, float>::value))>
+    SIMD_INLINE
+    static reg_t convert(const P& x) noexcept {
+        return _mm512_cvtepi32_ps(extend<int32_t, T>(x));
+    }
+    template <typename V = U, REQUIRES((std::is_same<V, double>::value))>
+    SIMD_INLINE
+    static reg_t convert(const __m256i& x) noexcept {
+        return _mm512_cvtepi32_pd(x);
+    }
+    template <typename V = U, REQUIRES((std::is_same<V, double>::value))>
+    SIMD_INLINE
+    static reg_t convert(const __m128i& x) noexcept {
+        return _mm512_cvtepi32_pd(avx2::detail::extend<int32_t, T>(x));
+    }
+};
+
+/// halving steps of the narrow chain
+struct narrow_policy {
+    template <typename H, typename V>
+    SIMD_INLINE
+    static __m512i pack(const __m512i& a, const __m512i& b) noexcept {
+        return pack_sat_functor<H, V>()(a, b);
+    }
+    /// keep the low bits: vpmov truncates
+    template <typename H, typename V>
+    SIMD_INLINE
+    static __m512i wrap(const __m512i& a, const __m512i& b) noexcept {
+        return _mm512_inserti64x4(_mm512_castsi256_si512(truncate<V>(a)), truncate<V>(b), 1);
+    }
+
+private:
+    template <typename V>
+    SIMD_INLINE
+    static __m256i truncate(const __m512i& x) noexcept {
+        SIMD_IF_CONSTEXPR(sizeof(V) == 2) {
+            return _mm512_cvtepi16_epi8(x);
+        } else SIMD_IF_CONSTEXPR(sizeof(V) == 4) {
+            return _mm512_cvtepi32_epi16(x);
+        } else {
+            return _mm512_cvtepi64_epi32(x);
+        }
+    }
+};
+
+/// K registers into one: integral lanes through the pack chain, float lanes
+/// truncated to int32 first (clamped to the range of U when saturating),
+/// double pairs through vcvtpd2ps
+template <typename U, typename T, bool S>
+struct narrow_functor {
+    static constexpr size_t K = sizeof(T) / sizeof(U);
+
+    SIMD_INLINE
+    avx512_reg_i operator ()(const std::array<avx512_reg_i, K>& x) noexcept {
+        return ops::narrow_chain<U, S, narrow_policy>::template apply<T>(x.data());
+    }
+    SIMD_INLINE
+    avx512_reg_i operator ()(const std::array<avx512_reg_f, K>& x) noexcept {
+        __m512i i[K];
+        SIMD_UNROLL
+        for (size_t j = 0; j < K; j++) {
+            __m512 v = x[j];
+            SIMD_IF_CONSTEXPR(S) {
+                v = _mm512_min_ps(_mm512_max_ps(v, _mm512_set1_ps(float(std::numeric_limits<U>::min()))),
+                                  _mm512_set1_ps(float(std::numeric_limits<U>::max())));
+            }
+            i[j] = _mm512_cvttps_epi32(v);
+        }
+        return ops::narrow_chain<U, S, narrow_policy>::template apply<int32_t>(i);
+    }
+    SIMD_INLINE
+    avx512_reg_f operator ()(const std::array<avx512_reg_d, K>& x) noexcept {
+        __m256d lo = _mm256_castps_pd(_mm512_cvtpd_ps(x[0]));
+        __m256d hi = _mm256_castps_pd(_mm512_cvtpd_ps(x[1]));
+        return _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(lo), hi, 1));
+    }
+};
+}  // namespace detail
+
+/// widen
+template <typename U, typename T, size_t W>
+struct widen<U, T, W>
+    : ops::widen_op<U, T, W, detail::widen_functor<U, T>>
+{};
+
+/// narrow, wrapping (S = false) or saturating (S = true)
+template <typename U, typename T, size_t W, bool S>
+struct narrow<U, T, W, S>
+    : ops::narrow_op<U, T, W, detail::narrow_functor<U, T, S>>
+{};
 } } } // namespace simd::kernel::avx512
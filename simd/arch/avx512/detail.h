@@ -146,5 +146,13 @@ static std::pair<VO, VO> forward_avx_op0(const avx512_reg_i& lhs) noexcept
     return std::make_pair(low_result, high_result);
 }
 
+/// __mmask value with the low `LANES` bits set, one per lane of a register
+template <size_t LANES>
+SIMD_INLINE
+constexpr uint64_t full_mask() noexcept
+{
+    return LANES >= 64 ? ~uint64_t(0) : (uint64_t(1) << LANES) - 1;
+}
+
 }  // namespace detail
 } } }  // namespace simd::kernel::avx
@@ -99,6 +99,24 @@ struct xor_functor {
     }
 };
 
+/// vpternlogd / vpternlogq, lane size does not matter to a bitwise op
+template <int IMM>
+SIMD_INLINE
+avx512_reg_i ternlog(const avx512_reg_i& a, const avx512_reg_i& b, const avx512_reg_i& c) noexcept {
+    return _mm512_ternarylogic_epi32(a, b, c, IMM);
+}
+template <int IMM>
+SIMD_INLINE
+avx512_reg_f ternlog(const avx512_reg_f& a, const avx512_reg_f& b, const avx512_reg_f& c) noexcept {
+    return _mm512_castsi512_ps(_mm512_ternarylogic_epi32(_mm512_castps_si512(a), _mm512_castps_si512(b),
+                                                         _mm512_castps_si512(c), IMM));
+}
+template <int IMM>
+SIMD_INLINE
+avx512_reg_d ternlog(const avx512_reg_d& a, const avx512_reg_d& b, const avx512_reg_d& c) noexcept {
+    return _mm512_castsi512_pd(_mm512_ternarylogic_epi64(_mm512_castpd_si512(a), _mm512_castpd_si512(b),
+                                                         _mm512_castpd_si512(c), IMM));
+}
 }  // namespace detail
 
 template <typename T, size_t W>
@@ -118,4 +136,149 @@ struct bitwise_xor<T, W>
     : ops::bitwise_binary_op<T, W, detail::xor_functor<T>>
 {
 };
+/// shifts by a common count: 16/32/64-bit lanes map to vpsllw/d/q and
+/// vpsrlw/d/q (vpsraw/d/q for signed), 8-bit lanes shift as 16-bit and
+/// mask off the bits crossing in from the neighbour byte
+template <typename T, size_t W>
+struct bitwise_lshift<T, W, REQUIRE_INTEGRAL(T)>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& x, int32_t y) noexcept
+    {
+        Vec<T, W> ret;
+        constexpr auto nregs = Vec<T, W>::n_regs();
+        const __m128i count = _mm_set1_epi64x(y);
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
+                ret.reg(idx) = _mm512_and_si512(_mm512_set1_epi8(char(0xFF << y)),
+                                                _mm512_sll_epi16(x.reg(idx), count));
+            } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+                ret.reg(idx) = _mm512_sll_epi16(x.reg(idx), count);
+            } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
+                ret.reg(idx) = _mm512_sll_epi32(x.reg(idx), count);
+            } else {
+                ret.reg(idx) = _mm512_sll_epi64(x.reg(idx), count);
+            }
+        }
+        return ret;
+    }
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& x, const Vec<T, W>& y) noexcept
+    {
+        Vec<T, W> ret;
+        constexpr auto nregs = Vec<T, W>::n_regs();
+        SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
+            for (auto i = 0u; i < W; i++) {
+                ret[i] = T(x[i] << y[i]);
+            }
+            return ret;
+        }
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+                ret.reg(idx) = _mm512_sllv_epi16(x.reg(idx), y.reg(idx));
+            } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
+                ret.reg(idx) = _mm512_sllv_epi32(x.reg(idx), y.reg(idx));
+            } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
+                ret.reg(idx) = _mm512_sllv_epi64(x.reg(idx), y.reg(idx));
+            }
+        }
+        return ret;
+    }
+};
+
+template <typename T, size_t W>
+struct bitwise_rshift<T, W, REQUIRE_INTEGRAL(T)>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& x, int32_t y) noexcept
+    {
+        Vec<T, W> ret;
+        constexpr bool is_signed = std::is_signed<T>::value;
+        constexpr auto nregs = Vec<T, W>::n_regs();
+        const __m128i count = _mm_set1_epi64x(y);
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
+                if (is_signed) {
+                    /// odd bytes shift in place, even bytes inside the high half of their 16-bit lane
+                    const avx512_reg_i even = _mm512_srli_epi16(_mm512_sra_epi16(_mm512_slli_epi16(x.reg(idx), 8), count), 8);
+                    ret.reg(idx) = _mm512_mask_blend_epi8(__mmask64(0xAAAAAAAAAAAAAAAAull), even,
+                                                          _mm512_sra_epi16(x.reg(idx), count));
+                } else {
+                    ret.reg(idx) = _mm512_and_si512(_mm512_set1_epi8(char(0xFF >> y)),
+                                                    _mm512_srl_epi16(x.reg(idx), count));
+                }
+            } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+                ret.reg(idx) = is_signed ? _mm512_sra_epi16(x.reg(idx), count)
+                                         : _mm512_srl_epi16(x.reg(idx), count);
+            } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
+                ret.reg(idx) = is_signed ? _mm512_sra_epi32(x.reg(idx), count)
+                                         : _mm512_srl_epi32(x.reg(idx), count);
+            } else {
+                ret.reg(idx) = is_signed ? _mm512_sra_epi64(x.reg(idx), count)
+                                         : _mm512_srl_epi64(x.reg(idx), count);
+            }
+        }
+        return ret;
+    }
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& x, const Vec<T, W>& y) noexcept
+    {
+        Vec<T, W> ret;
+        constexpr bool is_signed = std::is_signed<T>::value;
+        constexpr auto nregs = Vec<T, W>::n_regs();
+        SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
+            for (auto i = 0u; i < W; i++) {
+                ret[i] = T(x[i] >> y[i]);
+            }
+            return ret;
+        }
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+                ret.reg(idx) = is_signed ? _mm512_srav_epi16(x.reg(idx), y.reg(idx))
+                                         : _mm512_srlv_epi16(x.reg(idx), y.reg(idx));
+            } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
+                ret.reg(idx) = is_signed ? _mm512_srav_epi32(x.reg(idx), y.reg(idx))
+                                         : _mm512_srlv_epi32(x.reg(idx), y.reg(idx));
+            } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
+                ret.reg(idx) = is_signed ? _mm512_srav_epi64(x.reg(idx), y.reg(idx))
+                                         : _mm512_srlv_epi64(x.reg(idx), y.reg(idx));
+            }
+        }
+        return ret;
+    }
+};
+
+/// bitwise_ternlog: one vpternlog per register, bit (a << 2 | b << 1 | c)
+/// of IMM is the result bit
+template <typename T, size_t W>
+struct bitwise_ternlog<T, W>
+{
+    template <uint8_t IMM>
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& a, const Vec<T, W>& b, const Vec<T, W>& c) noexcept
+    {
+        Vec<T, W> ret;
+        constexpr auto nregs = Vec<T, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            ret.reg(idx) = detail::ternlog<IMM>(a.reg(idx), b.reg(idx), c.reg(idx));
+        }
+        return ret;
+    }
+};
+
+/// bitwise_not: AVX512 has no vector not, ternlog with the table of ~a
+template <typename T, size_t W>
+struct bitwise_not<T, W>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& x) noexcept
+    {
+        return bitwise_ternlog<T, W>::template apply<0x0F>(x, x, x);
+    }
+};
 } } } // namespace simd::kernel::avx512
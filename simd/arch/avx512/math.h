@@ -39,4 +39,130 @@ struct abs<T, W>
 {
 };
 
+/// sqrt
+template <typename T, size_t W>
+struct sqrt<T, W, REQUIRE_INTEGRAL(T)>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& x) noexcept = delete;
+};
+
+template <size_t W>
+struct sqrt<float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const Vec<float, W>& x) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr int nregs = Vec<float, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            ret.reg(idx) = _mm512_sqrt_ps(x.reg(idx));
+        }
+        return ret;
+    }
+};
+
+template <size_t W>
+struct sqrt<double, W>
+{
+    SIMD_INLINE
+    static Vec<double, W> apply(const Vec<double, W>& x) noexcept
+    {
+        Vec<double, W> ret;
+        constexpr int nregs = Vec<double, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            ret.reg(idx) = _mm512_sqrt_pd(x.reg(idx));
+        }
+        return ret;
+    }
+};
+
+/// ceil
+template <typename T, size_t W>
+struct ceil<T, W, REQUIRE_INTEGRAL(T)>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& x) noexcept
+    {
+        return x;
+    }
+};
+
+template <size_t W>
+struct ceil<float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const Vec<float, W>& x) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr int nregs = Vec<float, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            ret.reg(idx) = _mm512_roundscale_ps(x.reg(idx), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+        }
+        return ret;
+    }
+};
+
+template <size_t W>
+struct ceil<double, W>
+{
+    SIMD_INLINE
+    static Vec<double, W> apply(const Vec<double, W>& x) noexcept
+    {
+        Vec<double, W> ret;
+        constexpr int nregs = Vec<double, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            ret.reg(idx) = _mm512_roundscale_pd(x.reg(idx), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+        }
+        return ret;
+    }
+};
+
+/// floor
+template <typename T, size_t W>
+struct floor<T, W, REQUIRE_INTEGRAL(T)>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& x) noexcept
+    {
+        return x;
+    }
+};
+
+template <size_t W>
+struct floor<float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const Vec<float, W>& x) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr int nregs = Vec<float, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            ret.reg(idx) = _mm512_roundscale_ps(x.reg(idx), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        }
+        return ret;
+    }
+};
+
+template <size_t W>
+struct floor<double, W>
+{
+    SIMD_INLINE
+    static Vec<double, W> apply(const Vec<double, W>& x) noexcept
+    {
+        Vec<double, W> ret;
+        constexpr int nregs = Vec<double, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            ret.reg(idx) = _mm512_roundscale_pd(x.reg(idx), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        }
+        return ret;
+    }
+};
+
 } } } // namespace simd::kernel::avx512
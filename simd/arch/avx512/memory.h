@@ -1,5 +1,7 @@
 #pragma once
 
+#include <tuple>
+
 namespace simd { namespace kernel { namespace avx512 {
 using namespace types;
 
@@ -15,22 +17,22 @@ struct broadcast<T, W, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm512_set1_epi8(val);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm512_set1_epi16(val);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm512_set1_epi32(val);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm512_set1_epi64(val);
             }
@@ -47,7 +49,7 @@ struct broadcast<float, W>
     {
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm512_set1_ps(val);
         }
@@ -63,7 +65,7 @@ struct broadcast<double, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm512_set1_pd(val);
         }
@@ -82,7 +84,7 @@ struct setzero<T, W, REQUIRE_INTEGRAL(T)>
 
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm512_setzero_si512();
         }
@@ -98,9 +100,9 @@ struct setzero<float, W>
     {
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
-            ret.reg(idx) = _mm512_setzero_pd();
+            ret.reg(idx) = _mm512_setzero_ps();
         }
         return ret;
     }
@@ -114,7 +116,7 @@ struct setzero<double, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm512_setzero_pd();
         }
@@ -239,7 +241,7 @@ struct load_aligned<T, W, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm512_load_si512((const avx_reg_i*)(mem + idx * reg_lanes));
         }
@@ -256,7 +258,7 @@ struct load_aligned<float, W>
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm512_load_ps(mem + idx * reg_lanes);
         }
@@ -273,7 +275,7 @@ struct load_aligned<double, W>
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm512_load_pd(mem + idx * reg_lanes);
         }
@@ -293,7 +295,7 @@ struct load_unaligned<T, W, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm512_loadu_si512((const avx_reg_i*)(mem + idx * reg_lanes));
         }
@@ -310,7 +312,7 @@ struct load_unaligned<float, W>
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm512_loadu_ps(mem + idx * reg_lanes);
         }
@@ -327,7 +329,7 @@ struct load_unaligned<double, W>
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm512_loadu_pd(mem + idx * reg_lanes);
         }
@@ -346,7 +348,7 @@ struct store_aligned<T, W, REQUIRE_INTEGRAL(T)>
 
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm512_store_si512((avx_reg_i*)(mem + idx * reg_lanes), x.reg(idx));
         }
@@ -361,7 +363,7 @@ struct store_aligned<float, W>
     {
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm512_store_ps(mem + idx * reg_lanes, x.reg(idx));
         }
@@ -377,7 +379,7 @@ struct store_aligned<double, W>
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
 
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm512_store_pd(mem + idx * reg_lanes, x.reg(idx));
         }
@@ -395,7 +397,7 @@ struct store_unaligned<T, W, REQUIRE_INTEGRAL(T)>
 
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm512_storeu_si512((avx_reg_i*)(mem + idx * reg_lanes), x.reg(idx));
         }
@@ -410,7 +412,7 @@ struct store_unaligned<float, W>
     {
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm512_storeu_ps(mem + idx * reg_lanes, x.reg(idx));
         }
@@ -425,82 +427,28 @@ struct store_unaligned<double, W>
     {
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm512_storeu_pd(mem + idx * reg_lanes, x.reg(idx));
         }
     }
 };
 
-/// to_mask
+/// to_mask: the bool registers are __mmask already, concatenated from the
+/// last one down; only the low 64 lanes fit, as for the other archs
 template <typename T, size_t W>
-struct to_mask<T, W, REQUIRE_INTEGRAL(T)>
+struct to_mask<T, W>
 {
     SIMD_INLINE
     static uint64_t apply(const VecBool<T, W>& x) noexcept
     {
-        static_check_supported_type<T, 8>();
-
         uint64_t ret = 0;
         constexpr auto nregs = VecBool<T, W>::n_regs();
-        SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
-            for (int idx = (int)nregs - 1; idx >= 0; idx--) {
-                //ret <<= 64;  /// 64 * elements for 64 bits
-                //ret |= _mm512_movemask_epi8(x.reg(idx));
-            }
-        } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
-            for (int idx = (int)nregs - 1; idx >= 0; idx--) {
-                ret <= 32;  // 32 * elements for 32 bits
-                //ret |= detail::movemask_epi16(x.reg(idx));
-            }
-        } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
-            for (int idx = (int)nregs - 1; idx >= 0; idx--) {
-                ret <<= 16;  // 16 * elements for 16 bits
-                //ret |= detail::movemask_epi32(x.reg(idx));
-            }
-        } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
-            for (int idx = (int)nregs - 1; idx >= 0; idx--) {
-                ret <<= 8;  // 8 * elements for 8 bits
-                //ret |= detail::movemask_epi64(x.reg(idx));
-            }
-        }
-        return ret;
-    }
-};
-
-template <size_t W>
-struct to_mask<float, W>
-{
-    SIMD_INLINE
-    static uint64_t apply(const VecBool<float, W>& x) noexcept
-    {
-        uint64_t ret = 0;
-        constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
-        for (int idx = (int)nregs - 1; idx >= 0; idx--) {
-            ret <<= 16;  // 16 * elements for 16 bits
-            //ret |= _mm512_movemask_ps(x.reg(idx));
-        }
-        return ret;
-    }
-};
-
-template <size_t W>
-struct to_mask<double, W>
-{
-    SIMD_INLINE
-    static uint64_t apply(const VecBool<double, W>& x) noexcept
-    {
-        uint64_t ret = 0;
-        constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        constexpr auto reg_lanes = VecBool<T, W>::reg_lanes();
+        SIMD_UNROLL
         for (int idx = (int)nregs - 1; idx >= 0; idx--) {
-            ret <<= 8;  // 8 * elements for 8 bits
-            //ret |= _mm_movemask_pd(x.reg(idx));
+            ret <<= reg_lanes % 64;  // reg_lanes * elements for reg_lanes bits
+            ret |= (uint64_t)x.reg(idx);
         }
         return ret;
     }
@@ -517,7 +465,7 @@ struct from_mask<float, W>
         constexpr auto nregs = VecBool<float, W>::n_regs();
         constexpr auto reg_lanes = VecBool<float, W>::reg_lanes();
         constexpr auto lanes_mask = (1ull << reg_lanes) - 1;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             //ret.reg(idx) = _mm512_castsi512_ps(mask_lut(x & lanes_mask));
             x >>= reg_lanes;
@@ -536,7 +484,7 @@ struct from_mask<double, W>
         constexpr auto nregs = VecBool<double, W>::n_regs();
         constexpr auto reg_lanes = VecBool<double, W>::reg_lanes();
         constexpr auto lanes_mask = (1ull << reg_lanes) - 1;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             //ret.reg(idx) = _mm512_castsi512_pd(mask_lut(x & lanes_mask));
             x >>= reg_lanes;
@@ -560,7 +508,7 @@ struct from_mask<T, W, REQUIRE_INTEGRAL(T)>
             constexpr auto nregs = VecBool<T, W>::n_regs();
             constexpr auto reg_lanes = VecBool<T, W>::reg_lanes();
             constexpr auto lanes_mask = (1ull << reg_lanes) - 1;
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 auto mask = x & lanes_mask;
                 // TODO:
@@ -572,7 +520,7 @@ struct from_mask<T, W, REQUIRE_INTEGRAL(T)>
             constexpr auto nregs = VecBool<T, W>::n_regs();
             constexpr auto reg_lanes = VecBool<T, W>::reg_lanes();
             constexpr auto lanes_mask = (1ull << reg_lanes) - 1;
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 auto mask = x & lanes_mask;
                 // TODO:
@@ -583,7 +531,7 @@ struct from_mask<T, W, REQUIRE_INTEGRAL(T)>
             VecBool<T, W> ret;
             constexpr auto nregs = VecBool<T, W>::n_regs();
             auto float_mask = avx::from_mask<float, W>::apply(x);
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO:
             }
@@ -592,7 +540,7 @@ struct from_mask<T, W, REQUIRE_INTEGRAL(T)>
             VecBool<T, W> ret;
             constexpr auto nregs = VecBool<T, W>::n_regs();
             auto float_mask = avx::from_mask<double, W>::apply(x);
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO:
             }
@@ -613,7 +561,7 @@ struct gather<T, W, U, V, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             // TODO
         }
@@ -630,7 +578,7 @@ struct gather<float, W, U, V>
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
         }
         return ret;
@@ -646,7 +594,7 @@ struct gather<double, W, U, V>
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
         }
         return ret;
@@ -664,7 +612,7 @@ struct scatter<T, W, U, V, REQUIRE_INTEGRAL(T)>
 
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
         }
     }
@@ -678,7 +626,7 @@ struct scatter<float, W, U, V>
     {
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
         }
     }
@@ -692,9 +640,363 @@ struct scatter<double, W, U, V>
     {
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+        }
+    }
+};
+
+/// load_half/store_half: fp16 <-> fp32 via AVX512F, round to nearest even
+template <size_t W>
+struct load_half<float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const half* mem) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
+            ret.reg(idx) = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)(mem + idx * reg_lanes)));
+        }
+        return ret;
+    }
+};
+
+template <size_t W>
+struct store_half<float, W>
+{
+    SIMD_INLINE
+    static void apply(half* mem, const Vec<float, W>& x) noexcept
+    {
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            _mm256_storeu_si256((__m256i*)(mem + idx * reg_lanes), _mm512_cvtps_ph(x.reg(idx), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        }
+    }
+};
+
+namespace detail {
+/// float lanes -> bfloat16 bits in the low half of each 32-bit lane,
+/// round to nearest even, NaN made quiet
+SIMD_INLINE
+__m512i round_bf16(__m512 x) noexcept
+{
+    const __m512i xi = _mm512_castps_si512(x);
+    const __m512i hi = _mm512_srli_epi32(xi, 16);
+    const __m512i lsb = _mm512_and_si512(hi, _mm512_set1_epi32(1));
+    const __m512i r = _mm512_srli_epi32(_mm512_add_epi32(_mm512_add_epi32(xi, _mm512_set1_epi32(0x7FFF)), lsb), 16);
+    const __mmask16 nan = _mm512_cmp_ps_mask(x, x, _CMP_UNORD_Q);
+    return _mm512_mask_or_epi32(r, nan, hi, _mm512_set1_epi32(0x40));
+}
+}  // namespace detail
+
+/// load_bf16/store_bf16: bfloat16 is the upper half of a float, so
+/// loading is a 16 bit shift and storing a rounding add plus a vpmovdw;
+/// with AVX512_BF16 storing is a single vcvtneps2bf16, which like every
+/// BF16 instruction treats denormal inputs as zero
+template <size_t W>
+struct load_bf16<float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const bfloat16* mem) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            __m256i x = _mm256_loadu_si256((const __m256i*)(mem + idx * reg_lanes));
+            ret.reg(idx) = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(x), 16));
+        }
+        return ret;
+    }
+};
+
+template <size_t W>
+struct store_bf16<float, W>
+{
+    SIMD_INLINE
+    static void apply(bfloat16* mem, const Vec<float, W>& x) noexcept
+    {
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+#if SIMD_WITH_AVX512_BF16
+            __m256i r = (__m256i)_mm512_cvtneps_pbh(x.reg(idx));
+#else
+            __m256i r = _mm512_cvtepi32_epi16(detail::round_bf16(x.reg(idx)));
+#endif
+            _mm256_storeu_si256((__m256i*)(mem + idx * reg_lanes), r);
+        }
+    }
+};
+
+/// unpack_bf16: 2W bfloat16 as W pairs, {even elements, odd elements} as float
+template <size_t W>
+struct unpack_bf16<float, W>
+{
+    SIMD_INLINE
+    static std::array<Vec<float, W>, 2> apply(const bfloat16* mem) noexcept
+    {
+        std::array<Vec<float, W>, 2> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        const __m512i odd_mask = _mm512_set1_epi32(0xFFFF0000);
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            __m512i x = _mm512_loadu_si512(mem + 2 * idx * reg_lanes);
+            ret[0].reg(idx) = _mm512_castsi512_ps(_mm512_slli_epi32(x, 16));
+            ret[1].reg(idx) = _mm512_castsi512_ps(_mm512_and_si512(x, odd_mask));
+        }
+        return ret;
+    }
+};
+
+#if SIMD_WITH_AVX512_BF16
+/// dot_bf16: vdpbf16ps, acc[i] += a[2i] * b[2i] + a[2i+1] * b[2i+1]
+template <size_t W>
+struct dot_bf16<float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const Vec<float, W>& acc, const bfloat16* a, const bfloat16* b) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            __m512i va = _mm512_loadu_si512(a + 2 * idx * reg_lanes);
+            __m512i vb = _mm512_loadu_si512(b + 2 * idx * reg_lanes);
+            ret.reg(idx) = _mm512_dpbf16_ps(acc.reg(idx), (__m512bh)va, (__m512bh)vb);
+        }
+        return ret;
+    }
+};
+#endif
+
+namespace detail {
+/// interleaved complex <-> split real / imag through vpermt2ps / vpermt2pd:
+/// lo, hi hold complex 0 .. L/2-1 and L/2 .. L-1 (L lanes per register),
+/// packlo / packhi give them back
+struct load_complex {
+    SIMD_INLINE
+    std::pair<avx512_reg_f, avx512_reg_f> operator ()(const avx512_reg_f& lo, const avx512_reg_f& hi) noexcept
+    {
+        const __m512i even = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+        const __m512i odd = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+        return {_mm512_permutex2var_ps(lo, even, hi), _mm512_permutex2var_ps(lo, odd, hi)};
+    }
+
+    SIMD_INLINE
+    std::pair<avx512_reg_d, avx512_reg_d> operator ()(const avx512_reg_d& lo, const avx512_reg_d& hi) noexcept
+    {
+        const __m512i even = _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14);
+        const __m512i odd = _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15);
+        return {_mm512_permutex2var_pd(lo, even, hi), _mm512_permutex2var_pd(lo, odd, hi)};
+    }
+};
+
+/// index = 0: (r0, i0, r1, i1, ...) from the low halves, 1: the high halves
+template <int index>
+struct complex_pack {
+    SIMD_INLINE
+    avx512_reg_f operator ()(const avx512_reg_f& real, const avx512_reg_f& imag) noexcept
+    {
+        constexpr int o = index * 8;
+        const __m512i idx = _mm512_setr_epi32(o + 0, o + 16, o + 1, o + 17, o + 2, o + 18, o + 3, o + 19,
+                                              o + 4, o + 20, o + 5, o + 21, o + 6, o + 22, o + 7, o + 23);
+        return _mm512_permutex2var_ps(real, idx, imag);
+    }
+
+    SIMD_INLINE
+    avx512_reg_d operator ()(const avx512_reg_d& real, const avx512_reg_d& imag) noexcept
+    {
+        constexpr int o = index * 4;
+        const __m512i idx = _mm512_setr_epi64(o + 0, o + 8, o + 1, o + 9, o + 2, o + 10, o + 3, o + 11);
+        return _mm512_permutex2var_pd(real, idx, imag);
+    }
+};
+
+using complex_packlo = complex_pack<0>;
+using complex_packhi = complex_pack<1>;
+}  // namespace detail
+
+/// load_masked/store_masked: whole registers, then a mask of the W lanes
+/// left on the last one, which the padding only partially fills; memory
+/// past W is never touched, padding lanes load as 0
+template <typename T, size_t W>
+struct load_masked<T, W, REQUIRE_INTEGRAL(T)>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const T* mem) noexcept
+    {
+        static_check_supported_type<T, 8>();
+
+        Vec<T, W> ret;
+        constexpr auto nregs = Vec<T, W>::n_regs();
+        constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            ret.reg(idx) = _mm512_loadu_si512(mem + idx * reg_lanes);
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        const auto k = (avx512_mask_traits_t<T>)((1ull << (W - last)) - 1);
+        SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
+            ret.reg(nregs - 1) = _mm512_maskz_loadu_epi8(k, mem + last);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+            ret.reg(nregs - 1) = _mm512_maskz_loadu_epi16(k, mem + last);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
+            ret.reg(nregs - 1) = _mm512_maskz_loadu_epi32(k, mem + last);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
+            ret.reg(nregs - 1) = _mm512_maskz_loadu_epi64(k, mem + last);
+        }
+        return ret;
+    }
+};
+
+template <size_t W>
+struct load_masked<float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const float* mem) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            ret.reg(idx) = _mm512_loadu_ps(mem + idx * reg_lanes);
         }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        ret.reg(nregs - 1) = _mm512_maskz_loadu_ps((__mmask16)((1u << (W - last)) - 1), mem + last);
+        return ret;
+    }
+};
+
+template <size_t W>
+struct load_masked<double, W>
+{
+    SIMD_INLINE
+    static Vec<double, W> apply(const double* mem) noexcept
+    {
+        Vec<double, W> ret;
+        constexpr auto nregs = Vec<double, W>::n_regs();
+        constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            ret.reg(idx) = _mm512_loadu_pd(mem + idx * reg_lanes);
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        ret.reg(nregs - 1) = _mm512_maskz_loadu_pd((__mmask8)((1u << (W - last)) - 1), mem + last);
+        return ret;
+    }
+};
+
+template <typename T, size_t W>
+struct store_masked<T, W, REQUIRE_INTEGRAL(T)>
+{
+    SIMD_INLINE
+    static void apply(T* mem, const Vec<T, W>& x) noexcept
+    {
+        static_check_supported_type<T, 8>();
+
+        constexpr auto nregs = Vec<T, W>::n_regs();
+        constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            _mm512_storeu_si512(mem + idx * reg_lanes, x.reg(idx));
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        const auto k = (avx512_mask_traits_t<T>)((1ull << (W - last)) - 1);
+        SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
+            _mm512_mask_storeu_epi8(mem + last, k, x.reg(nregs - 1));
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+            _mm512_mask_storeu_epi16(mem + last, k, x.reg(nregs - 1));
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
+            _mm512_mask_storeu_epi32(mem + last, k, x.reg(nregs - 1));
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
+            _mm512_mask_storeu_epi64(mem + last, k, x.reg(nregs - 1));
+        }
+    }
+};
+
+template <size_t W>
+struct store_masked<float, W>
+{
+    SIMD_INLINE
+    static void apply(float* mem, const Vec<float, W>& x) noexcept
+    {
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            _mm512_storeu_ps(mem + idx * reg_lanes, x.reg(idx));
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        _mm512_mask_storeu_ps(mem + last, (__mmask16)((1u << (W - last)) - 1), x.reg(nregs - 1));
+    }
+};
+
+template <size_t W>
+struct store_masked<double, W>
+{
+    SIMD_INLINE
+    static void apply(double* mem, const Vec<double, W>& x) noexcept
+    {
+        constexpr auto nregs = Vec<double, W>::n_regs();
+        constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            _mm512_storeu_pd(mem + idx * reg_lanes, x.reg(idx));
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        _mm512_mask_storeu_pd(mem + last, (__mmask8)((1u << (W - last)) - 1), x.reg(nregs - 1));
+    }
+};
+
+template <typename T, size_t W>
+struct load_complex<T, W>
+{
+    using value_type = std::complex<T>;
+
+    SIMD_INLINE
+    static Vec<value_type, W> apply(const Vec<T, W>& vlo, const Vec<T, W>& vhi) noexcept
+    {
+        static_assert(Vec<T, W>::n_regs() == 1, "one register of complex per load");
+        Vec<value_type, W> ret;
+        std::tie(ret.real().reg(0), ret.imag().reg(0)) = detail::load_complex()(vlo.reg(0), vhi.reg(0));
+        return ret;
+    }
+};
+
+template <typename T, size_t W>
+struct complex_packlo<T, W>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& vreal, const Vec<T, W>& vimag) noexcept
+    {
+        static_assert(Vec<T, W>::n_regs() == 1, "one register of complex per store");
+        Vec<T, W> ret;
+        ret.reg(0) = detail::complex_packlo()(vreal.reg(0), vimag.reg(0));
+        return ret;
+    }
+};
+
+template <typename T, size_t W>
+struct complex_packhi<T, W>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& vreal, const Vec<T, W>& vimag) noexcept
+    {
+        static_assert(Vec<T, W>::n_regs() == 1, "one register of complex per store");
+        Vec<T, W> ret;
+        ret.reg(0) = detail::complex_packhi()(vreal.reg(0), vimag.reg(0));
+        return ret;
     }
 };
 
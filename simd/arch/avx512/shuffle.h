@@ -0,0 +1,450 @@
+#pragma once
+
+namespace simd { namespace kernel { namespace avx512 {
+using namespace types;
+
+namespace detail {
+/// one register shuffles, P an ops::shuffle_pattern over the register lanes
+template <typename T, typename Enable = void>
+struct shuffle_regs;
+
+template <typename E, typename P>
+SIMD_INLINE
+avx512_reg_i indices() noexcept
+{
+    return _mm512_load_si512(ops::shuffle_indices<E, P>());
+}
+
+/// double: vpermilpd / vshuff64x2 / vshufpd / valignq immediates, vpermpd
+/// and vpermt2pd for the rest
+template <>
+struct shuffle_regs<double>
+{
+    template <typename P>
+    SIMD_INLINE
+    static avx512_reg_d permute(const avx512_reg_d& x) noexcept
+    {
+        SIMD_IF_CONSTEXPR(P::identity()) {
+            return x;
+        } else SIMD_IF_CONSTEXPR(P::in_blocks(2)) {
+            constexpr int imm = P::imm_bits();
+            return _mm512_permute_pd(x, imm);
+        } else SIMD_IF_CONSTEXPR(P::whole_blocks(2)) {
+            constexpr int imm = blocks<P>();
+            return _mm512_shuffle_f64x2(x, x, imm);
+        } else SIMD_IF_CONSTEXPR(P::rotate() != 0) {
+            constexpr int imm = P::rotate();
+            return _mm512_castsi512_pd(_mm512_alignr_epi64(_mm512_castpd_si512(x), _mm512_castpd_si512(x), imm));
+        } else {
+            return _mm512_permutexvar_pd(indices<int64_t, P>(), x);
+        }
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx512_reg_d shuffle(const avx512_reg_d& a, const avx512_reg_d& b) noexcept
+    {
+        using X = ops::swap_sources_t<P>;
+        SIMD_IF_CONSTEXPR(P::from_a()) {
+            return permute<P>(a);
+        } else SIMD_IF_CONSTEXPR(P::from_b()) {
+            return permute<X>(b);
+        } else SIMD_IF_CONSTEXPR(P::blend()) {
+            constexpr __mmask8 mask = P::b_mask();
+            return _mm512_mask_blend_pd(mask, a, b);
+        } else SIMD_IF_CONSTEXPR(P::unpack(2, false)) {
+            return _mm512_unpacklo_pd(a, b);
+        } else SIMD_IF_CONSTEXPR(P::unpack(2, true)) {
+            return _mm512_unpackhi_pd(a, b);
+        } else SIMD_IF_CONSTEXPR(X::unpack(2, false)) {
+            return _mm512_unpacklo_pd(b, a);
+        } else SIMD_IF_CONSTEXPR(X::unpack(2, true)) {
+            return _mm512_unpackhi_pd(b, a);
+        } else SIMD_IF_CONSTEXPR(P::halves_ab(2)) {
+            constexpr int imm = P::imm_bits();
+            return _mm512_shuffle_pd(a, b, imm);
+        } else SIMD_IF_CONSTEXPR(X::halves_ab(2)) {
+            constexpr int imm = X::imm_bits();
+            return _mm512_shuffle_pd(b, a, imm);
+        } else SIMD_IF_CONSTEXPR(P::whole_blocks(2) && P::b_mask() == 0xF0) {
+            constexpr int imm = blocks<P>();
+            return _mm512_shuffle_f64x2(a, b, imm);
+        } else SIMD_IF_CONSTEXPR(X::whole_blocks(2) && X::b_mask() == 0xF0) {
+            constexpr int imm = blocks<X>();
+            return _mm512_shuffle_f64x2(b, a, imm);
+        } else SIMD_IF_CONSTEXPR(P::shift() != 0) {
+            constexpr int imm = P::shift();
+            return _mm512_castsi512_pd(_mm512_alignr_epi64(_mm512_castpd_si512(b), _mm512_castpd_si512(a), imm));
+        } else SIMD_IF_CONSTEXPR(X::shift() != 0) {
+            constexpr int imm = X::shift();
+            return _mm512_castsi512_pd(_mm512_alignr_epi64(_mm512_castpd_si512(a), _mm512_castpd_si512(b), imm));
+        } else {
+            return _mm512_permutex2var_pd(a, indices<int64_t, P>(), b);
+        }
+    }
+
+private:
+    /// vshuff64x2 imm, 2 bits of source block per output block
+    template <typename P>
+    static constexpr int blocks() noexcept
+    {
+        return P::block_source(2, 0) % 4 | P::block_source(2, 1) % 4 << 2
+             | P::block_source(2, 2) % 4 << 4 | P::block_source(2, 3) % 4 << 6;
+    }
+};
+
+/// float: vpermilps / vshufps / valignd immediates, pairs through the pd
+/// forms, vpermps and vpermt2ps for the rest
+template <>
+struct shuffle_regs<float>
+{
+    template <typename P>
+    SIMD_INLINE
+    static avx512_reg_f permute(const avx512_reg_f& x) noexcept
+    {
+        SIMD_IF_CONSTEXPR(P::identity()) {
+            return x;
+        } else SIMD_IF_CONSTEXPR(P::same_blocks(4)) {
+            constexpr int imm = P::imm(4, 2);
+            return _mm512_permute_ps(x, imm);
+        } else SIMD_IF_CONSTEXPR(P::pairs()) {
+            return _mm512_castpd_ps(shuffle_regs<double>::template permute<ops::widen_pattern_t<P>>(
+                _mm512_castps_pd(x)));
+        } else SIMD_IF_CONSTEXPR(P::rotate() != 0) {
+            constexpr int imm = P::rotate();
+            return _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), _mm512_castps_si512(x), imm));
+        } else {
+            return _mm512_permutexvar_ps(indices<int32_t, P>(), x);
+        }
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx512_reg_f shuffle(const avx512_reg_f& a, const avx512_reg_f& b) noexcept
+    {
+        using X = ops::swap_sources_t<P>;
+        SIMD_IF_CONSTEXPR(P::from_a()) {
+            return permute<P>(a);
+        } else SIMD_IF_CONSTEXPR(P::from_b()) {
+            return permute<X>(b);
+        } else SIMD_IF_CONSTEXPR(P::blend()) {
+            constexpr __mmask16 mask = P::b_mask();
+            return _mm512_mask_blend_ps(mask, a, b);
+        } else SIMD_IF_CONSTEXPR(P::unpack(4, false)) {
+            return _mm512_unpacklo_ps(a, b);
+        } else SIMD_IF_CONSTEXPR(P::unpack(4, true)) {
+            return _mm512_unpackhi_ps(a, b);
+        } else SIMD_IF_CONSTEXPR(X::unpack(4, false)) {
+            return _mm512_unpacklo_ps(b, a);
+        } else SIMD_IF_CONSTEXPR(X::unpack(4, true)) {
+            return _mm512_unpackhi_ps(b, a);
+        } else SIMD_IF_CONSTEXPR(P::halves_ab(4) && P::same_blocks(4)) {
+            constexpr int imm = P::imm(4, 2);
+            return _mm512_shuffle_ps(a, b, imm);
+        } else SIMD_IF_CONSTEXPR(X::halves_ab(4) && X::same_blocks(4)) {
+            constexpr int imm = X::imm(4, 2);
+            return _mm512_shuffle_ps(b, a, imm);
+        } else SIMD_IF_CONSTEXPR(P::pairs()) {
+            return _mm512_castpd_ps(shuffle_regs<double>::template shuffle<ops::widen_pattern_t<P>>(
+                _mm512_castps_pd(a), _mm512_castps_pd(b)));
+        } else SIMD_IF_CONSTEXPR(P::shift() != 0) {
+            constexpr int imm = P::shift();
+            return _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(b), _mm512_castps_si512(a), imm));
+        } else SIMD_IF_CONSTEXPR(X::shift() != 0) {
+            constexpr int imm = X::shift();
+            return _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(a), _mm512_castps_si512(b), imm));
+        } else {
+            return _mm512_permutex2var_ps(a, indices<int32_t, P>(), b);
+        }
+    }
+};
+
+/// 32-bit integers: the float forms on the same bits
+template <typename T>
+struct shuffle_regs<T, REQUIRE_INTEGRAL_SIZE_4(T)>
+{
+    template <typename P>
+    SIMD_INLINE
+    static avx512_reg_i permute(const avx512_reg_i& x) noexcept
+    {
+        return _mm512_castps_si512(shuffle_regs<float>::template permute<P>(_mm512_castsi512_ps(x)));
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx512_reg_i shuffle(const avx512_reg_i& a, const avx512_reg_i& b) noexcept
+    {
+        return _mm512_castps_si512(shuffle_regs<float>::template shuffle<P>(
+            _mm512_castsi512_ps(a), _mm512_castsi512_ps(b)));
+    }
+};
+
+/// 64-bit integers: the double forms on the same bits
+template <typename T>
+struct shuffle_regs<T, REQUIRE_INTEGRAL_SIZE_8(T)>
+{
+    template <typename P>
+    SIMD_INLINE
+    static avx512_reg_i shuffle(const avx512_reg_i& a, const avx512_reg_i& b) noexcept
+    {
+        return _mm512_castpd_si512(shuffle_regs<double>::template shuffle<P>(
+            _mm512_castsi512_pd(a), _mm512_castsi512_pd(b)));
+    }
+};
+
+/// 16-bit integers: vpshuflw / vpshufhw immediates, in-lane vpshufb,
+/// vpermw and vpermt2w for the rest
+template <typename T>
+struct shuffle_regs<T, REQUIRE_INTEGRAL_SIZE_2(T)>
+{
+    template <typename P>
+    SIMD_INLINE
+    static avx512_reg_i permute(const avx512_reg_i& x) noexcept
+    {
+        SIMD_IF_CONSTEXPR(P::identity()) {
+            return x;
+        } else SIMD_IF_CONSTEXPR(P::same_blocks(8) && P::fixed(4, 4)) {
+            constexpr int imm = P::imm(4, 2);
+            return _mm512_shufflelo_epi16(x, imm);
+        } else SIMD_IF_CONSTEXPR(P::same_blocks(8) && P::fixed(0, 4)) {
+            constexpr int imm = P::imm(4, 2, 4);
+            return _mm512_shufflehi_epi16(x, imm);
+        } else SIMD_IF_CONSTEXPR(P::pairs()) {
+            return shuffle_regs<int32_t>::template permute<ops::widen_pattern_t<P>>(x);
+        } else SIMD_IF_CONSTEXPR(P::in_blocks(8)) {
+            return _mm512_shuffle_epi8(x, _mm512_load_si512(ops::shuffle_bytes<P, 2, 8>()));
+        } else {
+            return _mm512_permutexvar_epi16(indices<int16_t, P>(), x);
+        }
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx512_reg_i shuffle(const avx512_reg_i& a, const avx512_reg_i& b) noexcept
+    {
+        using X = ops::swap_sources_t<P>;
+        SIMD_IF_CONSTEXPR(P::from_a()) {
+            return permute<P>(a);
+        } else SIMD_IF_CONSTEXPR(P::from_b()) {
+            return permute<X>(b);
+        } else SIMD_IF_CONSTEXPR(P::blend()) {
+            constexpr __mmask32 mask = P::b_mask();
+            return _mm512_mask_blend_epi16(mask, a, b);
+        } else SIMD_IF_CONSTEXPR(P::unpack(8, false)) {
+            return unpack<T>::lo(a, b);
+        } else SIMD_IF_CONSTEXPR(P::unpack(8, true)) {
+            return unpack<T>::hi(a, b);
+        } else SIMD_IF_CONSTEXPR(X::unpack(8, false)) {
+            return unpack<T>::lo(b, a);
+        } else SIMD_IF_CONSTEXPR(X::unpack(8, true)) {
+            return unpack<T>::hi(b, a);
+        } else SIMD_IF_CONSTEXPR(P::block_shift(8) != 0) {
+            constexpr int imm = P::block_shift(8) * 2;
+            return _mm512_alignr_epi8(b, a, imm);
+        } else SIMD_IF_CONSTEXPR(X::block_shift(8) != 0) {
+            constexpr int imm = X::block_shift(8) * 2;
+            return _mm512_alignr_epi8(a, b, imm);
+        } else SIMD_IF_CONSTEXPR(P::pairs()) {
+            return shuffle_regs<int32_t>::template shuffle<ops::widen_pattern_t<P>>(a, b);
+        } else {
+            return _mm512_permutex2var_epi16(a, indices<int16_t, P>(), b);
+        }
+    }
+};
+
+/// 8-bit integers: in-lane vpshufb; without AVX512VBMI a byte crossing the
+/// 128-bit lanes takes one masked vpshufb per source lane, that lane
+/// broadcast by vshufi32x4
+template <typename T>
+struct shuffle_regs<T, REQUIRE_INTEGRAL_SIZE_1(T)>
+{
+    template <typename P>
+    SIMD_INLINE
+    static avx512_reg_i permute(const avx512_reg_i& x) noexcept
+    {
+        SIMD_IF_CONSTEXPR(P::identity()) {
+            return x;
+        } else SIMD_IF_CONSTEXPR(P::pairs()) {
+            return shuffle_regs<int16_t>::template permute<ops::widen_pattern_t<P>>(x);
+        } else SIMD_IF_CONSTEXPR(P::in_blocks(16)) {
+            return _mm512_shuffle_epi8(x, _mm512_load_si512(ops::shuffle_bytes<P, 1, 16>()));
+        } else SIMD_IF_CONSTEXPR(P::rotate() != 0) {
+            return concat_shift<P::rotate()>(x, x);
+        } else {
+            const avx512_reg_i ctrl = _mm512_load_si512(ops::shuffle_bytes<P, 1, 16>());
+            avx512_reg_i r = _mm512_shuffle_epi8(_mm512_shuffle_i32x4(x, x, 0x00), ctrl);
+            r = _mm512_mask_shuffle_epi8(r, __mmask64(P::block_mask(16, 1)), _mm512_shuffle_i32x4(x, x, 0x55), ctrl);
+            r = _mm512_mask_shuffle_epi8(r, __mmask64(P::block_mask(16, 2)), _mm512_shuffle_i32x4(x, x, 0xAA), ctrl);
+            r = _mm512_mask_shuffle_epi8(r, __mmask64(P::block_mask(16, 3)), _mm512_shuffle_i32x4(x, x, 0xFF), ctrl);
+            return r;
+        }
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static avx512_reg_i shuffle(const avx512_reg_i& a, const avx512_reg_i& b) noexcept
+    {
+        using X = ops::swap_sources_t<P>;
+        SIMD_IF_CONSTEXPR(P::from_a()) {
+            return permute<P>(a);
+        } else SIMD_IF_CONSTEXPR(P::from_b()) {
+            return permute<X>(b);
+        } else SIMD_IF_CONSTEXPR(P::blend()) {
+            constexpr __mmask64 mask = P::b_mask();
+            return _mm512_mask_blend_epi8(mask, a, b);
+        } else SIMD_IF_CONSTEXPR(P::unpack(16, false)) {
+            return unpack<T>::lo(a, b);
+        } else SIMD_IF_CONSTEXPR(P::unpack(16, true)) {
+            return unpack<T>::hi(a, b);
+        } else SIMD_IF_CONSTEXPR(X::unpack(16, false)) {
+            return unpack<T>::lo(b, a);
+        } else SIMD_IF_CONSTEXPR(X::unpack(16, true)) {
+            return unpack<T>::hi(b, a);
+        } else SIMD_IF_CONSTEXPR(P::block_shift(16) != 0) {
+            constexpr int imm = P::block_shift(16);
+            return _mm512_alignr_epi8(b, a, imm);
+        } else SIMD_IF_CONSTEXPR(X::block_shift(16) != 0) {
+            constexpr int imm = X::block_shift(16);
+            return _mm512_alignr_epi8(a, b, imm);
+        } else SIMD_IF_CONSTEXPR(P::pairs()) {
+            return shuffle_regs<int16_t>::template shuffle<ops::widen_pattern_t<P>>(a, b);
+        } else SIMD_IF_CONSTEXPR(P::shift() != 0) {
+            return concat_shift<P::shift()>(a, b);
+        } else SIMD_IF_CONSTEXPR(X::shift() != 0) {
+            return concat_shift<X::shift()>(b, a);
+        } else {
+            using Q = ops::local_pattern_t<P>;
+            constexpr __mmask64 mask = P::b_mask();
+            return _mm512_mask_blend_epi8(mask, permute<Q>(a), permute<Q>(b));
+        }
+    }
+
+private:
+    /// bytes B .. B + 63 of (a, b): valignd by whole dwords to lo and to hi
+    /// 16 bytes further, vpalignr for the remaining B % 4 bytes
+    template <size_t B>
+    SIMD_INLINE
+    static avx512_reg_i concat_shift(const avx512_reg_i& a, const avx512_reg_i& b) noexcept
+    {
+        constexpr int q = B / 4;
+        const avx512_reg_i lo = _mm512_alignr_epi32(b, a, q);
+        SIMD_IF_CONSTEXPR(B % 4 == 0) {
+            return lo;
+        } else SIMD_IF_CONSTEXPR(q < 12) {
+            return _mm512_alignr_epi8(_mm512_alignr_epi32(b, a, (q + 4) % 16), lo, B % 4);
+        } else SIMD_IF_CONSTEXPR(q == 12) {
+            return _mm512_alignr_epi8(b, lo, B % 4);
+        } else {
+            return _mm512_alignr_epi8(_mm512_alignr_epi32(b, b, (q + 4) % 16), lo, B % 4);
+        }
+    }
+};
+
+/// runtime permute: vpermps / vpermpd / vpermd / vpermq / vpermw; bytes
+/// with vpermb under AVX512VBMI, otherwise one masked vpshufb per source
+/// 128-bit lane, that lane broadcast by vshufi32x4
+template <typename T>
+struct permute_regs
+{
+    SIMD_INLINE
+    static avx512_reg_i permute(const avx512_reg_i& x, const avx512_reg_i& idx) noexcept
+    {
+        SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
+            return _mm512_permutexvar_epi64(idx, x);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
+            return _mm512_permutexvar_epi32(idx, x);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+            return _mm512_permutexvar_epi16(idx, x);
+        } else {
+#if SIMD_WITH_AVX512_VBMI
+            return _mm512_permutexvar_epi8(idx, x);
+#else
+            const avx512_reg_i lo = _mm512_and_si512(idx, _mm512_set1_epi8(0x0F));
+            const avx512_reg_i q = _mm512_and_si512(idx, _mm512_set1_epi8(0x30));
+            avx512_reg_i r = _mm512_shuffle_epi8(_mm512_shuffle_i32x4(x, x, 0x00), lo);
+            r = _mm512_mask_shuffle_epi8(r, _mm512_cmpeq_epi8_mask(q, _mm512_set1_epi8(0x10)),
+                                         _mm512_shuffle_i32x4(x, x, 0x55), lo);
+            r = _mm512_mask_shuffle_epi8(r, _mm512_cmpeq_epi8_mask(q, _mm512_set1_epi8(0x20)),
+                                         _mm512_shuffle_i32x4(x, x, 0xAA), lo);
+            r = _mm512_mask_shuffle_epi8(r, _mm512_cmpeq_epi8_mask(q, _mm512_set1_epi8(0x30)),
+                                         _mm512_shuffle_i32x4(x, x, 0xFF), lo);
+            return r;
+#endif
+        }
+    }
+
+    SIMD_INLINE
+    static avx512_reg_f permute(const avx512_reg_f& x, const avx512_reg_i& idx) noexcept
+    {
+        return _mm512_permutexvar_ps(idx, x);
+    }
+
+    SIMD_INLINE
+    static avx512_reg_d permute(const avx512_reg_d& x, const avx512_reg_i& idx) noexcept
+    {
+        return _mm512_permutexvar_pd(idx, x);
+    }
+};
+
+/// byte table lookup: vpshufb for 16 entries; vpermb over the table (the
+/// 32-entry one repeated) under AVX512VBMI, otherwise vpshufb per 16-entry
+/// slice merged under the masks of index bits 4 and 5
+struct lookup_regs
+{
+    template <size_t N>
+    SIMD_INLINE
+    static avx512_reg_i lookup(const uint8_t* table, const avx512_reg_i& idx) noexcept
+    {
+        SIMD_IF_CONSTEXPR(N == 16) {
+            return _mm512_shuffle_epi8(slice(table, 0), _mm512_and_si512(idx, _mm512_set1_epi8(0x0F)));
+        } else {
+#if SIMD_WITH_AVX512_VBMI
+            SIMD_IF_CONSTEXPR(N == 32) {
+                return _mm512_permutexvar_epi8(idx, _mm512_broadcast_i64x4(
+                    _mm256_load_si256(reinterpret_cast<const avx_reg_i*>(table))));
+            } else {
+                return _mm512_permutexvar_epi8(idx, _mm512_load_si512(table));
+            }
+#else
+            const avx512_reg_i lo = _mm512_and_si512(idx, _mm512_set1_epi8(0x0F));
+            const __mmask64 b4 = _mm512_test_epi8_mask(idx, _mm512_set1_epi8(0x10));
+            const avx512_reg_i r01 = _mm512_mask_shuffle_epi8(_mm512_shuffle_epi8(slice(table, 0), lo), b4,
+                                                              slice(table, 1), lo);
+            SIMD_IF_CONSTEXPR(N == 32) {
+                return r01;
+            } else {
+                const avx512_reg_i r23 = _mm512_mask_shuffle_epi8(_mm512_shuffle_epi8(slice(table, 2), lo), b4,
+                                                                  slice(table, 3), lo);
+                return _mm512_mask_blend_epi8(_mm512_test_epi8_mask(idx, _mm512_set1_epi8(0x20)), r01, r23);
+            }
+#endif
+        }
+    }
+
+private:
+    SIMD_INLINE
+    static avx512_reg_i slice(const uint8_t* table, size_t k) noexcept
+    {
+        return _mm512_broadcast_i32x4(_mm_load_si128(reinterpret_cast<const sse_reg_i*>(table + 16 * k)));
+    }
+};
+}  // namespace detail
+
+/// shuffle
+template <typename T, size_t W>
+struct shuffle<T, W> : ops::shuffle_op<T, W, detail::shuffle_regs<T>>
+{
+};
+
+/// permute
+template <typename T, size_t W>
+struct permute<T, W> : ops::permute_op<T, W, detail::permute_regs<T>>
+{
+};
+
+/// lookup
+template <size_t W>
+struct lookup<uint8_t, W> : ops::lookup_op<W, detail::lookup_regs>
+{
+};
+} } } // namespace simd::kernel::avx512
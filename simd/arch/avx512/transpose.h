@@ -0,0 +1,141 @@
+#pragma once
+
+namespace simd { namespace kernel { namespace avx512 {
+using namespace types;
+
+namespace detail {
+/// interleave the low / high halves of each 128-bit lane, T-sized elements
+template <typename T, typename Enable = void>
+struct unpack;
+
+template <typename T>
+struct unpack<T, REQUIRE_INTEGRAL(T)>
+{
+    SIMD_INLINE
+    static avx512_reg_i lo(const avx512_reg_i& a, const avx512_reg_i& b) noexcept
+    {
+        SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
+            return _mm512_unpacklo_epi8(a, b);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+            return _mm512_unpacklo_epi16(a, b);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
+            return _mm512_unpacklo_epi32(a, b);
+        } else {
+            return _mm512_unpacklo_epi64(a, b);
+        }
+    }
+    SIMD_INLINE
+    static avx512_reg_i hi(const avx512_reg_i& a, const avx512_reg_i& b) noexcept
+    {
+        SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
+            return _mm512_unpackhi_epi8(a, b);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+            return _mm512_unpackhi_epi16(a, b);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
+            return _mm512_unpackhi_epi32(a, b);
+        } else {
+            return _mm512_unpackhi_epi64(a, b);
+        }
+    }
+};
+
+template <>
+struct unpack<float>
+{
+    SIMD_INLINE
+    static avx512_reg_f lo(const avx512_reg_f& a, const avx512_reg_f& b) noexcept
+    {
+        return _mm512_unpacklo_ps(a, b);
+    }
+    SIMD_INLINE
+    static avx512_reg_f hi(const avx512_reg_f& a, const avx512_reg_f& b) noexcept
+    {
+        return _mm512_unpackhi_ps(a, b);
+    }
+};
+
+template <>
+struct unpack<double>
+{
+    SIMD_INLINE
+    static avx512_reg_d lo(const avx512_reg_d& a, const avx512_reg_d& b) noexcept
+    {
+        return _mm512_unpacklo_pd(a, b);
+    }
+    SIMD_INLINE
+    static avx512_reg_d hi(const avx512_reg_d& a, const avx512_reg_d& b) noexcept
+    {
+        return _mm512_unpackhi_pd(a, b);
+    }
+};
+
+/// 128-bit lane select, imm as for vshuff32x4
+template <int imm>
+SIMD_INLINE
+avx512_reg_f shuffle_lanes(const avx512_reg_f& a, const avx512_reg_f& b) noexcept
+{
+    return _mm512_shuffle_f32x4(a, b, imm);
+}
+template <int imm>
+SIMD_INLINE
+avx512_reg_d shuffle_lanes(const avx512_reg_d& a, const avx512_reg_d& b) noexcept
+{
+    return _mm512_shuffle_f64x2(a, b, imm);
+}
+template <int imm>
+SIMD_INLINE
+avx512_reg_i shuffle_lanes(const avx512_reg_i& a, const avx512_reg_i& b) noexcept
+{
+    return _mm512_shuffle_i32x4(a, b, imm);
+}
+
+/// transpose the 4x4 matrix of 128-bit lanes held in x0..x3
+template <typename R>
+SIMD_INLINE
+void transpose_lanes(R& x0, R& x1, R& x2, R& x3) noexcept
+{
+    R s0 = shuffle_lanes<0x44>(x0, x1);
+    R s1 = shuffle_lanes<0xEE>(x0, x1);
+    R s2 = shuffle_lanes<0x44>(x2, x3);
+    R s3 = shuffle_lanes<0xEE>(x2, x3);
+    x0 = shuffle_lanes<0x88>(s0, s2);
+    x1 = shuffle_lanes<0xDD>(s0, s2);
+    x2 = shuffle_lanes<0x88>(s1, s3);
+    x3 = shuffle_lanes<0xDD>(s1, s3);
+}
+
+/// transpose_lanes over the k-th register of each quarter, for every k in [0, Q)
+template <size_t Q, typename R, size_t... Ks>
+SIMD_INLINE
+void transpose_quarters(R* r, simd::detail::index_sequence<Ks...>) noexcept
+{
+    int expand[] = {0, (transpose_lanes(r[Ks], r[Q + Ks], r[2 * Q + Ks], r[3 * Q + Ks]), 0)...};
+    (void)expand;
+}
+
+/// L x L block in L registers: each quarter of the rows is transposed inside
+/// its 128-bit lanes, then vshuff32x4 transposes the 4x4 grid of lanes
+/// 16x16 float = 64 unpck + 32 vshuff32x4
+template <typename T>
+struct transpose_regs
+{
+    template <typename R, size_t L>
+    SIMD_INLINE
+    void operator ()(R (&r)[L]) const noexcept
+    {
+        constexpr size_t Q = L / 4;
+        ops::unpack_transpose<unpack<T>, Q>(r);
+        ops::unpack_transpose<unpack<T>, Q>(r + Q);
+        ops::unpack_transpose<unpack<T>, Q>(r + 2 * Q);
+        ops::unpack_transpose<unpack<T>, Q>(r + 3 * Q);
+        transpose_quarters<Q>(r, simd::detail::make_index_sequence<Q>());
+    }
+};
+}  // namespace detail
+
+/// transpose
+template <typename T, size_t W>
+struct transpose<T, W> : ops::transpose_op<T, W, detail::transpose_regs<T>>
+{
+};
+} } } // namespace simd::kernel::avx512
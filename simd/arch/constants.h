@@ -54,6 +54,13 @@ SIMD_DEFINE_CONSTANT(infinity, (std::numeric_limits<float>::infinity()), (std::n
 SIMD_DEFINE_CONSTANT_HEX(nan, 0xffffffff, 0xffffffffffffffff);
 SIMD_DEFINE_CONSTANT(log_2, 0.6931471805599453094172321214581765680755001343602553f, 0.6931471805599453094172321214581765680755001343602553);
 SIMD_DEFINE_CONSTANT_HEX(signmask, 0x80000000, 0x8000000000000000);
+SIMD_DEFINE_CONSTANT_HEX(mantissamask, 0x007fffff, 0x000fffffffffffff);
+SIMD_DEFINE_CONSTANT(log2e, 1.4426950408889634073599246810018921374266459541529859f, 1.4426950408889634073599246810018921374266459541529859);
+SIMD_DEFINE_CONSTANT(sqrt_2, 1.4142135623730950488016887242096980785696718753769481f, 1.4142135623730950488016887242096980785696718753769481);
+SIMD_DEFINE_CONSTANT(pi, 3.1415926535897932384626433832795028841971693993751058f, 3.1415926535897932384626433832795028841971693993751058);
+SIMD_DEFINE_CONSTANT(pi_2, 1.5707963267948966192313216916397514420985846996875529f, 1.5707963267948966192313216916397514420985846996875529);
+SIMD_DEFINE_CONSTANT(pi_4, 0.7853981633974483096156608458198757210492923498437764f, 0.7853981633974483096156608458198757210492923498437764);
+SIMD_DEFINE_CONSTANT(two_over_pi, 0.6366197723675813430755350534900574481378385829618257f, 0.6366197723675813430755350534900574481378385829618257);
 
 #undef SIMD_DEFINE_CONSTANT
 #undef SIMD_DEFINE_CONSTANT_HEX
@@ -1,8 +1,123 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
 namespace simd { namespace kernel {
 namespace ops {
 
+/// W x W transpose through a register kernel `F()(r)` that transposes the
+/// L x L block held in `register_t r[L]` in place, L lanes per register;
+/// rows of several registers are transposed block by block, with block
+/// (i, j) written to (j, i)
+template <typename T, size_t W, typename F>
+struct transpose_op {
+    using reg_t = typename Vec<T, W>::register_t;
+
+    SIMD_INLINE
+    static void apply(std::array<Vec<T, W>, W>& rows) noexcept
+    {
+        constexpr size_t R = Vec<T, W>::n_regs();
+        for (size_t bi = 0; bi < R; bi++) {
+            diagonal(rows, bi, simd::detail::make_index_sequence<Vec<T, W>::reg_lanes()>());
+            for (size_t bj = bi + 1; bj < R; bj++) {
+                off_diagonal(rows, bi, bj, simd::detail::make_index_sequence<Vec<T, W>::reg_lanes()>());
+            }
+        }
+    }
+
+private:
+    template <size_t... Is>
+    SIMD_INLINE
+    static void diagonal(std::array<Vec<T, W>, W>& rows, size_t b,
+                         simd::detail::index_sequence<Is...>) noexcept
+    {
+        constexpr size_t L = sizeof...(Is);
+        reg_t x[] = {rows[b * L + Is].reg(b)...};
+        F()(x);
+        int expand[] = {0, (rows[b * L + Is].reg(b) = x[Is], 0)...};
+        (void)expand;
+    }
+
+    /// blocks (i, j) and (j, i) are both read before either is written back
+    template <size_t... Is>
+    SIMD_INLINE
+    static void off_diagonal(std::array<Vec<T, W>, W>& rows, size_t bi, size_t bj,
+                             simd::detail::index_sequence<Is...>) noexcept
+    {
+        constexpr size_t L = sizeof...(Is);
+        reg_t x[] = {rows[bi * L + Is].reg(bj)...};
+        reg_t y[] = {rows[bj * L + Is].reg(bi)...};
+        F()(x);
+        F()(y);
+        int expand[] = {0, (rows[bj * L + Is].reg(bi) = x[Is], rows[bi * L + Is].reg(bj) = y[Is], 0)...};
+        (void)expand;
+    }
+};
+
+/// one round of element interleaves: r[2j], r[2j+1] = lo / hi(r[j], r[j+Q/2]),
+/// unrolled so every register index is a constant
+template <typename U, size_t Q, typename R, size_t... Js>
+SIMD_INLINE
+void unpack_round(R* r, simd::detail::index_sequence<Js...>) noexcept
+{
+    R lo[] = {U::lo(r[Js], r[Js + Q / 2])...};
+    R hi[] = {U::hi(r[Js], r[Js + Q / 2])...};
+    int expand[] = {0, (r[2 * Js] = lo[Js], r[2 * Js + 1] = hi[Js], 0)...};
+    (void)expand;
+}
+
+template <typename U, size_t Q, size_t S = 1, bool = (S < Q)>
+struct unpack_rounds {
+    template <typename R>
+    SIMD_INLINE
+    static void apply(R* r) noexcept
+    {
+        unpack_round<U, Q>(r, simd::detail::make_index_sequence<Q / 2>());
+        unpack_rounds<U, Q, S * 2>::apply(r);
+    }
+};
+
+template <typename U, size_t Q, size_t S>
+struct unpack_rounds<U, Q, S, false> {
+    template <typename R>
+    SIMD_INLINE
+    static void apply(R*) noexcept {}
+};
+
+/// transposes the Q x Q block held in each 128-bit lane of r[0, Q) through
+/// log2(Q) rounds of element interleaves, U::lo / U::hi unpack the low / high
+/// halves of each 128-bit lane
+template <typename U, size_t Q, typename R>
+SIMD_INLINE
+void unpack_transpose(R* r) noexcept
+{
+    unpack_rounds<U, Q>::apply(r);
+}
+
+/// reg(0) f reg(1) f ... reg(n_regs - 1) as a balanced tree: log2(n_regs)
+/// dependent steps instead of n_regs - 1, so a reduction of a wide vector
+/// folds its registers vertically and reduces lanes once
+template <typename T, size_t W, typename F>
+SIMD_INLINE
+typename Vec<T, W>::register_t fold_regs(const Vec<T, W>& x, F&& f) noexcept
+{
+    constexpr size_t nregs = Vec<T, W>::n_regs();
+    typename Vec<T, W>::register_t r[nregs];
+    SIMD_UNROLL
+    for (size_t idx = 0; idx < nregs; idx++) {
+        r[idx] = x.reg(idx);
+    }
+    SIMD_UNROLL
+    for (size_t s = 1; s < nregs; s *= 2) {
+        for (size_t idx = 0; idx + s < nregs; idx += 2 * s) {
+            r[idx] = f(r[idx], r[idx + s]);
+        }
+    }
+    return r[0];
+}
+
 template <typename T, size_t W, typename F>
 struct arith_unary_op {
     SIMD_INLINE
@@ -10,7 +125,7 @@ struct arith_unary_op {
     {
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = F()(lhs.reg(idx));
         }
@@ -25,7 +140,7 @@ struct bitwise_unary_op {
     {
         VecBool<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = F()(lhs.reg(idx));
         }
@@ -40,7 +155,7 @@ struct arith_binary_op {
     {
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = F()(lhs.reg(idx), rhs.reg(idx));
         }
@@ -55,7 +170,7 @@ struct arith_ternary_op {
     {
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = F()(x.reg(idx), y.reg(idx), z.reg(idx));
         }
@@ -70,7 +185,7 @@ struct cmp_binary_op {
     {
         VecBool<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = F()(lhs.reg(idx), rhs.reg(idx));
         }
@@ -81,7 +196,7 @@ struct cmp_binary_op {
     {
         VecBool<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = F()(lhs.reg(idx), rhs.reg(idx), 1);
         }
@@ -96,7 +211,7 @@ struct bitwise_binary_op {
     {
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = F()(lhs.reg(idx), rhs.reg(idx));
         }
@@ -104,5 +219,156 @@ struct bitwise_binary_op {
     }
 };
 
+/// narrow two vectors into one with half-size lanes, `lo` lanes first:
+/// output register r packs source registers 2r and 2r + 1 of (lo, hi)
+template <typename U, typename T, size_t W, typename F>
+struct pack_binary_op {
+    SIMD_INLINE
+    static Vec<U, 2 * W> apply(const Vec<T, W>& lo, const Vec<T, W>& hi) noexcept
+    {
+        static_assert(sizeof(U) * 2 == sizeof(T), "pack only narrows to half-size lanes");
+        Vec<U, 2 * W> ret;
+        constexpr auto nregs = Vec<T, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            const auto& x = 2 * idx < nregs ? lo.reg(2 * idx) : hi.reg(2 * idx - nregs);
+            const auto& y = 2 * idx + 1 < nregs ? lo.reg(2 * idx + 1) : hi.reg(2 * idx + 1 - nregs);
+            ret.reg(idx) = F()(x, y);
+        }
+        return ret;
+    }
+};
+
+/// integral type of N bytes, signed or not
+template <size_t N, bool Signed>
+struct sized_int;
+template <> struct sized_int<1, true> { using type = int8_t; };
+template <> struct sized_int<2, true> { using type = int16_t; };
+template <> struct sized_int<4, true> { using type = int32_t; };
+template <> struct sized_int<8, true> { using type = int64_t; };
+template <> struct sized_int<1, false> { using type = uint8_t; };
+template <> struct sized_int<2, false> { using type = uint16_t; };
+template <> struct sized_int<4, false> { using type = uint32_t; };
+template <> struct sized_int<8, false> { using type = uint64_t; };
+template <size_t N, bool Signed>
+using sized_int_t = typename sized_int<N, Signed>::type;
+
+/// widen conversions done in registers: integral extension, small integral
+/// to float (through int32), int8/16/32 and float to double;
+/// anything else (uint32 / int64 sources to double) falls back to generic
+template <typename U, typename T>
+struct native_widen : std::integral_constant<bool, (sizeof(U) > sizeof(T)) && std::is_arithmetic<T>::value && (
+    (std::is_integral<U>::value && std::is_integral<T>::value)
+    || (std::is_same<U, float>::value && std::is_integral<T>::value)
+    || (std::is_same<U, double>::value && std::is_same<T, float>::value)
+    || (std::is_same<U, double>::value && std::is_integral<T>::value
+        && !(std::is_unsigned<T>::value && sizeof(T) == 4)))>
+{};
+
+/// narrow conversions done in registers: integral to integral,
+/// float to int8/16 (through int32) and double to float
+template <typename U, typename T>
+struct native_narrow : std::integral_constant<bool, (sizeof(U) < sizeof(T)) && (
+    (std::is_integral<U>::value && std::is_integral<T>::value)
+    || (std::is_integral<U>::value && std::is_same<T, float>::value)
+    || (std::is_same<U, float>::value && std::is_same<T, double>::value))>
+{};
+
+/// one vector into K = sizeof(U) / sizeof(T) vectors of the same byte size:
+/// `F()(reg)` converts one register into K registers, output registers
+/// are numbered across the K vectors in lane order
+template <typename U, typename T, size_t W, typename F>
+struct widen_op {
+    static constexpr size_t K = sizeof(U) / sizeof(T);
+
+    SIMD_INLINE
+    static std::array<Vec<U, W / K>, K> apply(const Vec<T, W>& x) noexcept
+    {
+        std::array<Vec<U, W / K>, K> ret;
+        constexpr size_t nregs = Vec<T, W>::n_regs();
+        SIMD_UNROLL
+        for (size_t idx = 0; idx < nregs; idx++) {
+            auto parts = F()(x.reg(idx));
+            for (size_t j = 0; j < K; j++) {
+                size_t g = idx * K + j;
+                ret[g / nregs].reg(g % nregs) = parts[j];
+            }
+        }
+        return ret;
+    }
+};
+
+/// K = sizeof(T) / sizeof(U) vectors into one of the same byte size:
+/// `F()(regs)` converts K consecutive registers into one
+template <typename U, typename T, size_t W, typename F>
+struct narrow_op {
+    static constexpr size_t K = sizeof(T) / sizeof(U);
+
+    SIMD_INLINE
+    static Vec<U, W * K> apply(const std::array<Vec<T, W>, K>& x) noexcept
+    {
+        Vec<U, W * K> ret;
+        constexpr size_t nregs = Vec<T, W>::n_regs();
+        SIMD_UNROLL
+        for (size_t idx = 0; idx < nregs; idx++) {
+            std::array<typename Vec<T, W>::register_t, K> parts;
+            for (size_t j = 0; j < K; j++) {
+                size_t g = idx * K + j;
+                parts[j] = x[g / nregs].reg(g % nregs);
+            }
+            ret.reg(idx) = F()(parts);
+        }
+        return ret;
+    }
+};
+
+/// halve integral lanes pairwise, V -> H -> ... -> U, through `P::pack<H, V>`
+/// (clamping, S) or `P::wrap<H, V>` (keeping the low bits); intermediate
+/// types keep the signedness of the source and hold the range of U,
+/// so the clamps compose (e.g. int32 -> int16 -> uint8, packssdw + packuswb)
+template <typename U, bool S, typename P>
+struct narrow_chain {
+    template <typename V, typename R>
+    SIMD_INLINE
+    static R apply(const R* in) noexcept
+    {
+        return apply<V>(in, std::integral_constant<bool, sizeof(V) == sizeof(U)>());
+    }
+
+private:
+    template <typename V, typename R>
+    SIMD_INLINE
+    static R apply(const R* in, std::true_type) noexcept
+    {
+        return in[0];
+    }
+    template <typename V, typename R>
+    SIMD_INLINE
+    static R apply(const R* in, std::false_type) noexcept
+    {
+        using H = typename std::conditional<sizeof(V) / 2 == sizeof(U), U,
+                  sized_int_t<sizeof(V) / 2, std::is_signed<V>::value>>::type;
+        constexpr size_t N = sizeof(V) / sizeof(U);
+        R mid[N / 2];
+        SIMD_UNROLL
+        for (size_t i = 0; i < N / 2; i++) {
+            mid[i] = step<H, V>(in[2 * i], in[2 * i + 1], std::integral_constant<bool, S>());
+        }
+        return apply<H>(mid, std::integral_constant<bool, sizeof(H) == sizeof(U)>());
+    }
+    template <typename H, typename V, typename R>
+    SIMD_INLINE
+    static R step(const R& a, const R& b, std::true_type) noexcept
+    {
+        return P::template pack<H, V>(a, b);
+    }
+    template <typename H, typename V, typename R>
+    SIMD_INLINE
+    static R step(const R& a, const R& b, std::false_type) noexcept
+    {
+        return P::template wrap<H, V>(a, b);
+    }
+};
+
 }  // namespace ops
 } }  // namespace simd::kernel
@@ -15,6 +15,8 @@ namespace simd { namespace kernel { namespace generic {
 #include "simd/arch/generic/logical.h"
 #include "simd/arch/generic/math.h"
 #include "simd/arch/generic/memory.h"
+#include "simd/arch/generic/transpose.h"
+#include "simd/arch/generic/shuffle.h"
 #include "simd/arch/generic/trigo.h"
 #include "simd/arch/generic/complex.h"
 
@@ -68,13 +70,37 @@ DEFINE_GENERIC_UNARY_OP(bitwise_not);
 DEFINE_GENERIC_MATH_UNARY_OP(abs);
 DEFINE_GENERIC_MATH_UNARY_OP(sqrt);
 DEFINE_GENERIC_MATH_UNARY_OP(log);
+DEFINE_GENERIC_MATH_UNARY_OP(exp);
+DEFINE_GENERIC_MATH_UNARY_OP(sin);
+DEFINE_GENERIC_MATH_UNARY_OP(cos);
+
+template <typename T, size_t W>
+SIMD_INLINE
+std::pair<Vec<T, W>, Vec<T, W>> sincos(const Vec<T, W>& x, requires_arch<Generic>) noexcept
+{
+    return generic::sincos<T, W>::apply(x);
+}
 
 DEFINE_GENERIC_BINARY_OP(add);
 DEFINE_GENERIC_BINARY_OP(sub);
 DEFINE_GENERIC_BINARY_OP(mul);
 DEFINE_GENERIC_BINARY_OP(div);
 
+DEFINE_GENERIC_BINARY_OP(add_sat);
+DEFINE_GENERIC_BINARY_OP(sub_sat);
+DEFINE_GENERIC_BINARY_OP(mul_sat);
+DEFINE_GENERIC_BINARY_OP(mul_conj);
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> dot_u8i8(const Vec<T, W>& acc, const Vec<uint8_t, 4 * W>& a, const Vec<int8_t, 4 * W>& b, requires_arch<Generic>) noexcept
+{
+    return generic::dot_u8i8<T, W>::apply(acc, a, b);
+}
+
 DEFINE_GENERIC_BINARY_OP(copysign);
+DEFINE_GENERIC_BINARY_OP(hypot);
+DEFINE_GENERIC_BINARY_OP(atan2);
 
 DEFINE_GENERIC_BINARY_OP(bitwise_and);
 DEFINE_GENERIC_BINARY_OP(bitwise_or);
@@ -89,6 +115,13 @@ DEFINE_GENERIC_BINARY_CMP_OP(ge);
 DEFINE_GENERIC_BINARY_CMP_OP(lt);
 DEFINE_GENERIC_BINARY_CMP_OP(le);
 
+template <uint8_t IMM, typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> bitwise_ternlog(const Vec<T, W>& a, const Vec<T, W>& b, const Vec<T, W>& c, requires_arch<Generic>) noexcept
+{
+    return generic::bitwise_ternlog<T, W>::template apply<IMM>(a, b, c);
+}
+
 template <typename T, size_t W>
 SIMD_INLINE
 Vec<T, W> bitwise_andnot(const VecBool<T, W>& lhs, const Vec<T, W>& rhs, requires_arch<Generic>) noexcept
@@ -181,6 +214,41 @@ Vec<T, W> fmsubadd(const Vec<T, W>& x, const Vec<T, W>& y, const Vec<T, W>& z, r
     return generic::fmsubadd<T, W>::apply(x, y, z);
 }
 
+template <typename T, size_t W>
+SIMD_INLINE
+T reduce_sum(const Vec<T, W>& x, requires_arch<Generic>) noexcept
+{
+    return generic::hadd<T, W>::apply(x);
+}
+
+template <typename U, typename T, size_t W>
+SIMD_INLINE
+Vec<U, W> cast(const Vec<T, W>& x, requires_arch<Generic>) noexcept
+{
+    return generic::cast<U, T, W>::apply(x);
+}
+
+template <typename U, typename T, size_t W>
+SIMD_INLINE
+Vec<U, 2 * W> pack_sat(const Vec<T, W>& lo, const Vec<T, W>& hi, requires_arch<Generic>) noexcept
+{
+    return generic::pack_sat<U, T, W>::apply(lo, hi);
+}
+
+template <typename U, typename T, size_t W>
+SIMD_INLINE
+std::array<Vec<U, W * sizeof(T) / sizeof(U)>, sizeof(U) / sizeof(T)> widen(const Vec<T, W>& x, requires_arch<Generic>) noexcept
+{
+    return generic::widen<U, T, W>::apply(x);
+}
+
+template <typename U, bool S, typename T, size_t W, size_t K>
+SIMD_INLINE
+Vec<U, W * K> narrow(const std::array<Vec<T, W>, K>& x, requires_arch<Generic>) noexcept
+{
+    return generic::narrow<U, T, W, S>::apply(x);
+}
+
 template <typename T, size_t W>
 SIMD_INLINE
 Vec<T, W> load_aligned(const T* mem, requires_arch<Generic>) noexcept
@@ -209,6 +277,92 @@ void store_unaligned(T* mem, const Vec<T, W>& x, requires_arch<Generic>) noexcep
     generic::store_unaligned<T, W>::apply(mem, x);
 }
 
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> load_masked(const T* mem, requires_arch<Generic>) noexcept
+{
+    return generic::load_masked<T, W>::apply(mem);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+void store_masked(T* mem, const Vec<T, W>& x, requires_arch<Generic>) noexcept
+{
+    generic::store_masked<T, W>::apply(mem, x);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> load_bf16(const bfloat16* mem, requires_arch<Generic>) noexcept
+{
+    return generic::load_bf16<T, W>::apply(mem);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+void store_bf16(bfloat16* mem, const Vec<T, W>& x, requires_arch<Generic>) noexcept
+{
+    generic::store_bf16<T, W>::apply(mem, x);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+std::array<Vec<T, W>, 2> unpack_bf16(const bfloat16* mem, requires_arch<Generic>) noexcept
+{
+    return generic::unpack_bf16<T, W>::apply(mem);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> dot_bf16(const Vec<T, W>& acc, const bfloat16* a, const bfloat16* b, requires_arch<Generic>) noexcept
+{
+    return generic::dot_bf16<T, W>::apply(acc, a, b);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> load_half(const half* mem, requires_arch<Generic>) noexcept
+{
+    return generic::load_half<T, W>::apply(mem);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+void store_half(half* mem, const Vec<T, W>& x, requires_arch<Generic>) noexcept
+{
+    generic::store_half<T, W>::apply(mem, x);
+}
+
+/// transpose
+template <typename T, size_t W>
+SIMD_INLINE
+void transpose(std::array<Vec<T, W>, W>& rows, requires_arch<Generic>) noexcept
+{
+    generic::transpose<T, W>::apply(rows);
+}
+
+/// shuffle
+template <typename T, size_t W, size_t... I>
+SIMD_INLINE
+Vec<T, W> shuffle(const Vec<T, W>& a, const Vec<T, W>& b, ops::shuffle_pattern<I...> p, requires_arch<Generic>) noexcept
+{
+    return generic::shuffle<T, W>::apply(a, b, p);
+}
+
+template <typename T, size_t W, typename I>
+SIMD_INLINE
+Vec<T, W> permute(const Vec<T, W>& x, const Vec<I, W>& idx, requires_arch<Generic>) noexcept
+{
+    return generic::permute<T, W>::apply(x, idx);
+}
+
+template <size_t N, size_t W>
+SIMD_INLINE
+Vec<uint8_t, W> lookup(const Vec<uint8_t, N>& table, const Vec<uint8_t, W>& idx, requires_arch<Generic>) noexcept
+{
+    return generic::lookup<uint8_t, W>::template apply<N>(table, idx);
+}
+
 #undef DEFINE_GENERIC_UNARY_OP
 #undef DEFINE_GENERIC_BINARY_OP
 #undef DEFINE_GENERIC_BINARY_CMP_OP
@@ -14,7 +14,7 @@ struct all_of<T, W>
     {
         bool ret = true;
         constexpr auto nregs = VecBool<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto i = 0; i < W; i++) {
             ret = ret && (true == bits::at_msb(x[i]));
         }
@@ -30,7 +30,7 @@ struct any_of<T, W>
     {
         bool ret = false;
         constexpr auto nregs = VecBool<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto i = 0; i < W; i++) {
             ret = ret || (true == bits::at_msb(x[i]));
         }
@@ -73,7 +73,7 @@ struct hadd<T, W>
     {
         T ret{};
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto i = 0u; i < W; i++) {
             ret += x[i];
         }
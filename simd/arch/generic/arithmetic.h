@@ -100,5 +100,70 @@ struct neg<T, W>
     }
 };
 
+/// add_sat: clamp to the integral range instead of wrapping around
+template <typename T, size_t W>
+struct add_sat<T, W, REQUIRE_INTEGRAL(T)>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& lhs, const Vec<T, W>& rhs) noexcept
+    {
+        Vec<T, W> ret;
+        detail::apply(ret, lhs, rhs, [](T x, T y) {
+            return detail::add_sat(x, y);
+        });
+        return ret;
+    }
+};
+
+/// sub_sat: clamp to the integral range instead of wrapping around
+template <typename T, size_t W>
+struct sub_sat<T, W, REQUIRE_INTEGRAL(T)>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& lhs, const Vec<T, W>& rhs) noexcept
+    {
+        Vec<T, W> ret;
+        detail::apply(ret, lhs, rhs, [](T x, T y) {
+            return detail::sub_sat(x, y);
+        });
+        return ret;
+    }
+};
+
+/// mul_sat: Q7/Q15/Q31/Q63 fixed-point multiply for signed integral only
+template <typename T, size_t W>
+struct mul_sat<T, W, REQUIRE_SIGNED_INTEGRAL(T)>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& lhs, const Vec<T, W>& rhs) noexcept
+    {
+        Vec<T, W> ret;
+        detail::apply(ret, lhs, rhs, [](T x, T y) {
+            return detail::mul_sat(x, y);
+        });
+        return ret;
+    }
+};
+
+/// dot_u8i8: acc[i] += sum(a[4i+j] * b[4i+j]), j < 4
+/// exact, in 32-bit arithmetic like vpdpbusd
+template <size_t W>
+struct dot_u8i8<int32_t, W>
+{
+    SIMD_INLINE
+    static Vec<int32_t, W> apply(const Vec<int32_t, W>& acc, const Vec<uint8_t, 4 * W>& a, const Vec<int8_t, 4 * W>& b) noexcept
+    {
+        Vec<int32_t, W> ret;
+        SIMD_UNROLL
+        for (auto i = 0u; i < W; i++) {
+            int32_t s = acc[i];
+            for (auto j = 0u; j < 4; j++) {
+                s += int32_t(a[4 * i + j]) * int32_t(b[4 * i + j]);
+            }
+            ret[i] = s;
+        }
+        return ret;
+    }
+};
 
 } } } // namespace simd::kernel::generic
@@ -3,4 +3,73 @@
 namespace simd { namespace kernel { namespace generic {
 using namespace types;
 
+/// cast: element by element `static_cast`, fallback when no native conversion
+template <typename U, typename T, size_t W>
+struct cast<U, T, W>
+{
+    SIMD_INLINE
+    static Vec<U, W> apply(const Vec<T, W>& x) noexcept
+    {
+        Vec<U, W> ret;
+        SIMD_UNROLL
+        for (auto i = 0u; i < W; i++) {
+            ret[i] = static_cast<U>(x[i]);
+        }
+        return ret;
+    }
+};
+
+/// pack_sat: narrow `lo` then `hi` into one vector of half-size lanes, clamping to the range of U
+template <typename U, typename T, size_t W>
+struct pack_sat<U, T, W>
+{
+    SIMD_INLINE
+    static Vec<U, 2 * W> apply(const Vec<T, W>& lo, const Vec<T, W>& hi) noexcept
+    {
+        Vec<U, 2 * W> ret;
+        SIMD_UNROLL
+        for (auto i = 0u; i < W; i++) {
+            ret[i] = detail::saturate<U>(lo[i]);
+            ret[W + i] = detail::saturate<U>(hi[i]);
+        }
+        return ret;
+    }
+};
+
+/// widen: one vector into K = sizeof(U) / sizeof(T) vectors, element by element `static_cast`
+template <typename U, typename T, size_t W>
+struct widen<U, T, W>
+{
+    static constexpr size_t K = sizeof(U) / sizeof(T);
+
+    SIMD_INLINE
+    static std::array<Vec<U, W / K>, K> apply(const Vec<T, W>& x) noexcept
+    {
+        std::array<Vec<U, W / K>, K> ret;
+        SIMD_UNROLL
+        for (auto i = 0u; i < W; i++) {
+            ret[i / (W / K)][i % (W / K)] = static_cast<U>(x[i]);
+        }
+        return ret;
+    }
+};
+
+/// narrow: K = sizeof(T) / sizeof(U) vectors into one, `static_cast` or clamped to the range of U
+template <typename U, typename T, size_t W, bool S>
+struct narrow<U, T, W, S>
+{
+    static constexpr size_t K = sizeof(T) / sizeof(U);
+
+    SIMD_INLINE
+    static Vec<U, W * K> apply(const std::array<Vec<T, W>, K>& x) noexcept
+    {
+        Vec<U, W * K> ret;
+        SIMD_UNROLL
+        for (auto i = 0u; i < W * K; i++) {
+            T v = x[i / W][i % W];
+            ret[i] = S ? detail::saturate<U>(v) : static_cast<U>(v);
+        }
+        return ret;
+    }
+};
 } } } // namespace simd::kernel::generic
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <complex>
+#include <limits>
 
 namespace simd { namespace kernel { namespace generic {
 using namespace types;
@@ -37,6 +38,10 @@ struct sub<std::complex<T>, W>
     }
 };
 
+/// split layout complex arithmetic: every kernel works on the real / imag
+/// Vec<T, W> pairs through the kernels of their own arch (SSE, AVX,
+/// AVX512), so the FMA3 / AVX512 fused forms come with the real vector type
+
 /// mul
 template <typename T, size_t W>
 struct mul<std::complex<T>, W>
@@ -47,13 +52,36 @@ struct mul<std::complex<T>, W>
     static Vec<value_type, W> apply(const Vec<value_type, W>& lhs, const Vec<value_type, W>& rhs) noexcept
     {
         // (a + bi) * (c + di) = (ac - bd) + (ad + bc)i
+        using A = typename Vec<T, W>::arch_t;
+        auto&& a = lhs.real();
+        auto&& b = lhs.imag();
+        auto&& c = rhs.real();
+        auto&& d = rhs.imag();
+        Vec<value_type, W> ret(
+                kernel::fmsub<T, W>(a, c, b * d, A{}),
+                kernel::fmadd<T, W>(a, d, b * c, A{}));
+        return ret;
+    }
+};
+
+/// mul_conj, lhs * conj(rhs)
+template <typename T, size_t W>
+struct mul_conj<std::complex<T>, W>
+{
+    using value_type = std::complex<T>;
+
+    SIMD_INLINE
+    static Vec<value_type, W> apply(const Vec<value_type, W>& lhs, const Vec<value_type, W>& rhs) noexcept
+    {
+        // (a + bi) * (c - di) = (ac + bd) + (bc - ad)i
+        using A = typename Vec<T, W>::arch_t;
         auto&& a = lhs.real();
         auto&& b = lhs.imag();
         auto&& c = rhs.real();
         auto&& d = rhs.imag();
         Vec<value_type, W> ret(
-                (a * c - b * d),
-                (a * d + b * c));
+                kernel::fmadd<T, W>(a, c, b * d, A{}),
+                kernel::fmsub<T, W>(b, c, a * d, A{}));
         return ret;
     }
 };
@@ -68,18 +96,166 @@ struct div<std::complex<T>, W>
     static Vec<value_type, W> apply(const Vec<value_type, W>& lhs, const Vec<value_type, W>& rhs) noexcept
     {
         /*
-            (a + bi)   (a + bi) * (c - di)   (ac + bd) + (bc - ad)i
-            -------- = ------------------- = ----------------------
-            (c + di)   (c + di) * (c - di)         (cc + dd)
+            Smith's algorithm, no cc + dd that overflows / underflows long
+            before the quotient does:
+            |c| >= |d|: r = d / c, den = c + d * r
+                        ((a + b * r) + (b - a * r)i) / den
+            |c| <  |d|: r = c / d, den = c * r + d
+                        ((a * r + b) + (b * r - a)i) / den
+            both branches as one: p / q the larger / smaller of c, d and
+            x / y the matching a, b; the imaginary part flips sign in the
+            second branch
         */
+        using A = typename Vec<T, W>::arch_t;
+        using vec_t = Vec<T, W>;
         auto&& a = lhs.real();
         auto&& b = lhs.imag();
         auto&& c = rhs.real();
         auto&& d = rhs.imag();
-        auto&& cc_dd = (c * c + d * d);
+        auto ge = kernel::ge<T, W>(kernel::abs<T, W>(c, A{}), kernel::abs<T, W>(d, A{}), A{});
+        vec_t p = kernel::select<T, W>(ge, c, d, A{});
+        vec_t q = kernel::select<T, W>(ge, d, c, A{});
+        vec_t x = kernel::select<T, W>(ge, a, b, A{});
+        vec_t y = kernel::select<T, W>(ge, b, a, A{});
+        vec_t r = q / p;
+        vec_t inv = vec_t(T(1)) / kernel::fmadd<T, W>(q, r, p, A{});
+        vec_t im = kernel::fnmadd<T, W>(x, r, y, A{}) * inv;
+        Vec<value_type, W> ret(
+            kernel::fmadd<T, W>(y, r, x, A{}) * inv,
+            kernel::select<T, W>(ge, im, -im, A{}));
+        return ret;
+    }
+};
+
+/// fmadd, x * y + z in four fused operations
+template <typename T, size_t W>
+struct fmadd<std::complex<T>, W>
+{
+    using value_type = std::complex<T>;
+
+    SIMD_INLINE
+    static Vec<value_type, W> apply(const Vec<value_type, W>& x, const Vec<value_type, W>& y,
+                                    const Vec<value_type, W>& z) noexcept
+    {
+        using A = typename Vec<T, W>::arch_t;
+        auto&& a = x.real();
+        auto&& b = x.imag();
+        auto&& c = y.real();
+        auto&& d = y.imag();
+        Vec<value_type, W> ret(
+                kernel::fnmadd<T, W>(b, d, kernel::fmadd<T, W>(a, c, z.real(), A{}), A{}),
+                kernel::fmadd<T, W>(b, c, kernel::fmadd<T, W>(a, d, z.imag(), A{}), A{}));
+        return ret;
+    }
+};
+namespace detail {
+/// true when every real and imaginary part is finite
+template <typename T, size_t W>
+SIMD_INLINE
+bool all_finite(const Vec<std::complex<T>, W>& z) noexcept
+{
+    using A = typename Vec<T, W>::arch_t;
+    const Vec<T, W> big(std::numeric_limits<T>::max());
+    return kernel::all_of<T, W>(kernel::abs<T, W>(z.real(), A{}) <= big, A{})
+        && kernel::all_of<T, W>(kernel::abs<T, W>(z.imag(), A{}) <= big, A{});
+}
+
+/// `f` on every element through std::complex, for the lanes the vector
+/// formulas leave to the C++ special value rules (inf / nan)
+template <typename T, size_t W, typename F>
+SIMD_INLINE
+Vec<std::complex<T>, W> complex_apply(const Vec<std::complex<T>, W>& z, F&& f) noexcept
+{
+    Vec<std::complex<T>, W> ret;
+    for (auto i = 0u; i < W; i++) {
+        const std::complex<T> v = f(std::complex<T>(z.real()[i], z.imag()[i]));
+        ret.real()[i] = v.real();
+        ret.imag()[i] = v.imag();
+    }
+    return ret;
+}
+}  // namespace detail
+
+/// exp, exp(a) * (cos(b) + sin(b)i); a zero imaginary part stays exact
+/// so real arguments past the float range give (inf, 0) as std::exp
+template <typename T, size_t W>
+struct exp<std::complex<T>, W>
+{
+    using value_type = std::complex<T>;
+
+    SIMD_INLINE
+    static Vec<value_type, W> apply(const Vec<value_type, W>& z) noexcept
+    {
+        if (!detail::all_finite(z)) {
+            return detail::complex_apply(z, [](const value_type& v) {
+                return std::exp(v);
+            });
+        }
+        using A = typename Vec<T, W>::arch_t;
+        using vec_t = Vec<T, W>;
+        const vec_t e = kernel::exp<T, W>(z.real(), A{});
+        const auto sc = detail::sincos(z.imag());
+        Vec<value_type, W> ret(
+                e * sc.second,
+                kernel::select(z.imag() == vec_t(T(0)), z.imag(), e * sc.first, A{}));
+        return ret;
+    }
+};
+
+/// log, log|z| + arg(z)i with |z| from the overflow free hypot; the real
+/// part is accurate relative to |log z|, not near |z| = 1 on its own
+template <typename T, size_t W>
+struct log<std::complex<T>, W>
+{
+    using value_type = std::complex<T>;
+
+    SIMD_INLINE
+    static Vec<value_type, W> apply(const Vec<value_type, W>& z) noexcept
+    {
+        if (!detail::all_finite(z)) {
+            return detail::complex_apply(z, [](const value_type& v) {
+                return std::log(v);
+            });
+        }
+        using A = typename Vec<T, W>::arch_t;
+        Vec<value_type, W> ret(
+                kernel::log<T, W>(kernel::hypot<T, W>(z.real(), z.imag(), A{}), A{}),
+                kernel::atan2<T, W>(z.imag(), z.real(), A{}));
+        return ret;
+    }
+};
+
+/// sqrt, principal root: t = sqrt((|a| + |z|) / 2), then
+/// a >= 0: t + (b / 2t)i, a < 0: |b| / 2t + copysign(t, b)i
+template <typename T, size_t W>
+struct sqrt<std::complex<T>, W>
+{
+    using value_type = std::complex<T>;
+
+    SIMD_INLINE
+    static Vec<value_type, W> apply(const Vec<value_type, W>& z) noexcept
+    {
+        if (!detail::all_finite(z)) {
+            return detail::complex_apply(z, [](const value_type& v) {
+                return std::sqrt(v);
+            });
+        }
+        using A = typename Vec<T, W>::arch_t;
+        using vec_t = Vec<T, W>;
+        auto&& a = z.real();
+        auto&& b = z.imag();
+        const vec_t zero(T(0));
+        const vec_t half(T(0.5));
+        const vec_t aa = kernel::abs<T, W>(a, A{});
+        /// halves first: |a| + |z| may overflow
+        const vec_t t = kernel::sqrt<T, W>(kernel::fmadd<T, W>(aa, half,
+                            kernel::hypot<T, W>(a, b, A{}) * half, A{}), A{});
+        /// t = 0 only for z = 0: (0, b)
+        const vec_t u = kernel::select(t == zero, zero, (kernel::abs<T, W>(b, A{}) * half) / t, A{});
+        const auto neg = a < zero;
         Vec<value_type, W> ret(
-            (a * c + b * d) / cc_dd,
-            (b * c - a * d) / cc_dd);
+                kernel::select(neg, u, t, A{}),
+                kernel::copysign<T, W>(kernel::select(neg, t, u, A{}), b, A{}));
         return ret;
     }
 };
@@ -4,6 +4,8 @@
 #include <numeric>
 #include <type_traits>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 
 namespace simd { namespace kernel { namespace generic {
 namespace detail {
@@ -19,5 +21,72 @@ void apply(UT& z, const VT& x, const VT& y, F&& f) noexcept
     std::transform(std::begin(x), std::end(x), std::begin(y), std::begin(z), f);
 }
 
+/// clamp `x` into the range of `U`, comparing without any implicit conversion
+/// (floating `x` is truncated once in range, floating `U` just converts)
+template <typename U, typename T>
+SIMD_INLINE
+U saturate(T x) noexcept
+{
+    using L = std::numeric_limits<U>;
+    SIMD_IF_CONSTEXPR(std::is_floating_point<U>::value) {
+        return static_cast<U>(x);
+    }
+    SIMD_IF_CONSTEXPR(std::is_floating_point<T>::value) {
+        return x < T(L::min()) ? L::min() : x > T(L::max()) ? L::max() : static_cast<U>(x);
+    }
+    if (std::is_signed<T>::value && x < T(0)) {
+        if (std::is_signed<U>::value && int64_t(x) >= int64_t(L::min())) {
+            return static_cast<U>(x);
+        }
+        return L::min();
+    }
+    return uint64_t(x) > uint64_t(L::max()) ? L::max() : static_cast<U>(x);
+}
+
+template <typename T>
+SIMD_INLINE
+T add_sat(T x, T y) noexcept
+{
+    T r;
+    if (!__builtin_add_overflow(x, y, &r)) {
+        return r;
+    }
+    /// signed overflow only happens when x and y share the sign
+    return (!std::is_signed<T>::value || x >= T(0)) ? std::numeric_limits<T>::max()
+                                                    : std::numeric_limits<T>::min();
+}
+
+template <typename T>
+SIMD_INLINE
+T sub_sat(T x, T y) noexcept
+{
+    T r;
+    if (!__builtin_sub_overflow(x, y, &r)) {
+        return r;
+    }
+    /// unsigned underflows to 0, signed overflows towards the sign of x
+    return (std::is_signed<T>::value && x >= T(0)) ? std::numeric_limits<T>::max()
+                                                   : std::numeric_limits<T>::min();
+}
+
+template <typename T>
+struct mul_sat_wide;
+template <> struct mul_sat_wide<int8_t> { using type = int16_t; };
+template <> struct mul_sat_wide<int16_t> { using type = int32_t; };
+template <> struct mul_sat_wide<int32_t> { using type = int64_t; };
+template <> struct mul_sat_wide<int64_t> { using type = __int128; };
+
+/// Q(N-1) fixed-point multiply, rounded to nearest,
+/// only -1 * -1 overflows and is clamped to the max value
+template <typename T>
+SIMD_INLINE
+T mul_sat(T x, T y) noexcept
+{
+    using wide_t = typename mul_sat_wide<T>::type;
+    constexpr int Q = sizeof(T) * 8 - 1;
+    wide_t p = (wide_t(x) * wide_t(y) + (wide_t(1) << (Q - 1))) >> Q;
+    return p > wide_t(std::numeric_limits<T>::max()) ? std::numeric_limits<T>::max() : static_cast<T>(p);
+}
+
 }  // namespace detail
 } } } // namespace simd::kernel::generic
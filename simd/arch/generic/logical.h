@@ -94,6 +94,27 @@ struct bitwise_rshift<T, W, REQUIRE_INTEGRAL(T)>
     }
 };
 
+/// bitwise_ternlog: any function of 3 operands, bit (a << 2 | b << 1 | c)
+/// of IMM is the result bit (the vpternlog truth table); OR of the set
+/// minterms where the ISA has no ternary logic instruction
+template <typename T, size_t W>
+struct bitwise_ternlog<T, W>
+{
+    template <uint8_t IMM>
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& a, const Vec<T, W>& b, const Vec<T, W>& c) noexcept
+    {
+        const Vec<T, W> na = ~a, nb = ~b, nc = ~c;
+        Vec<T, W> ret = a ^ a;
+        for (int k = 0; k < 8; k++) {
+            if ((IMM >> k) & 1) {
+                ret = ret | ((k & 4 ? a : na) & (k & 2 ? b : nb) & (k & 1 ? c : nc));
+            }
+        }
+        return ret;
+    }
+};
+
 /// bitwise_not
 template <typename T, size_t W>
 struct bitwise_not<T, W>
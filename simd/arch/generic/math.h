@@ -2,6 +2,7 @@
 
 #include <limits>
 #include <cmath>
+#include <cstring>
 
 namespace simd { namespace kernel { namespace generic {
 using namespace types;
@@ -132,17 +133,6 @@ struct sqrt_functor {
     }
 };
 
-template <typename T, size_t W>
-struct log_functor {
-    SIMD_INLINE
-    Vec<T, W> operator ()(const Vec<T, W>& x) const noexcept {
-        Vec<T, W> ret;
-        detail::apply(ret, x, [](T a) {
-            return std::log(a);
-        });
-        return ret;
-    }
-};
 template <typename T, size_t W, typename F>
 struct math_unary_op {
     SIMD_INLINE
@@ -152,6 +142,141 @@ struct math_unary_op {
     }
 };
 
+/// IEEE-754 layout of T and the unsigned integer of the same size
+template <typename T>
+struct float_bits;
+
+template <>
+struct float_bits<float>
+{
+    using uint_t = uint32_t;
+    static constexpr int mantissa = 23;
+    static constexpr int bias = 127;
+};
+
+template <>
+struct float_bits<double>
+{
+    using uint_t = uint64_t;
+    static constexpr int mantissa = 52;
+    static constexpr int bias = 1023;
+};
+
+/// reinterpret the lanes of `x` as U
+template <typename U, typename T, size_t W>
+SIMD_INLINE
+Vec<U, W * sizeof(T) / sizeof(U)> bitcast(const Vec<T, W>& x) noexcept
+{
+    Vec<U, W * sizeof(T) / sizeof(U)> ret;
+    static_assert(sizeof(ret) == sizeof(x), "bitcast between different sizes");
+    std::memcpy(static_cast<void*>(&ret), &x, sizeof(ret));
+    return ret;
+}
+
+/// round to nearest integer (ties to even) for |x| < 2^(mantissa - 1)
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> round_int(const Vec<T, W>& x) noexcept
+{
+    const Vec<T, W> shifter(T(1.5) * T(uint64_t(1) << float_bits<T>::mantissa));
+    return (x + shifter) - shifter;
+}
+
+/// 2^n for integral `n` in the normal exponent range
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> pow2n(const Vec<T, W>& n) noexcept
+{
+    using fb = float_bits<T>;
+    /// n + bias lands in the low mantissa bits, shifted into the exponent
+    const Vec<T, W> t = n + Vec<T, W>(T(uint64_t(1) << fb::mantissa) + T(fb::bias));
+    return bitcast<T>(bitcast<typename fb::uint_t>(t) << fb::mantissa);
+}
+
+/// unbiased exponent of positive normal `x`, as T
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> exponent(const Vec<T, W>& x) noexcept
+{
+    using fb = float_bits<T>;
+    const Vec<T, W> two_m(T(uint64_t(1) << fb::mantissa));
+    const Vec<T, W> e = bitcast<T>(bitcast<typename fb::uint_t>(x) >> fb::mantissa);
+    return (e | two_m) - (two_m + Vec<T, W>(T(fb::bias)));
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> horner_step(const Vec<T, W>&, const Vec<T, W>& p) noexcept
+{
+    return p;
+}
+
+template <typename T, size_t W, typename... Ts>
+SIMD_INLINE
+Vec<T, W> horner_step(const Vec<T, W>& x, const Vec<T, W>& p, T c, Ts... cs) noexcept
+{
+    using A = typename Vec<T, W>::arch_t;
+    return horner_step(x, kernel::fmadd<T, W>(p, x, Vec<T, W>(c), A{}), cs...);
+}
+
+/// c0 * x^(n-1) + c1 * x^(n-2) + ... + c(n-1), by Horner's rule
+template <typename T, size_t W, typename... Ts>
+SIMD_INLINE
+Vec<T, W> horner(const Vec<T, W>& x, T c0, Ts... cs) noexcept
+{
+    return horner_step(x, Vec<T, W>(c0), cs...);
+}
+
+/// exp(r) for |r| <= ln(2) / 2, Taylor series to below half an ulp
+template <size_t W>
+SIMD_INLINE
+Vec<float, W> exp_reduced(const Vec<float, W>& r) noexcept
+{
+    return horner(r, 1.f / 5040, 1.f / 720, 1.f / 120, 1.f / 24, 1.f / 6, 1.f / 2, 1.f, 1.f);
+}
+
+template <size_t W>
+SIMD_INLINE
+Vec<double, W> exp_reduced(const Vec<double, W>& r) noexcept
+{
+    return horner(r, 1. / 6227020800, 1. / 479001600, 1. / 39916800, 1. / 3628800, 1. / 362880,
+                  1. / 40320, 1. / 5040, 1. / 720, 1. / 120, 1. / 24, 1. / 6, 1. / 2, 1., 1.);
+}
+
+/// (log(m) / 2s - 1) / s^2 with s = (m - 1) / (m + 1), |s| <= 0.1716:
+/// the atanh series 1/3 + z/5 + z^2/7 + ... in z = s^2
+template <size_t W>
+SIMD_INLINE
+Vec<float, W> log_series(const Vec<float, W>& z) noexcept
+{
+    return horner(z, 1.f / 9, 1.f / 7, 1.f / 5, 1.f / 3);
+}
+
+template <size_t W>
+SIMD_INLINE
+Vec<double, W> log_series(const Vec<double, W>& z) noexcept
+{
+    return horner(z, 1. / 21, 1. / 19, 1. / 17, 1. / 15, 1. / 13, 1. / 11, 1. / 9, 1. / 7, 1. / 5, 1. / 3);
+}
+
+/// ln(2) split so that n * hi is exact for every exponent n
+template <typename T>
+struct ln2_parts;
+
+template <>
+struct ln2_parts<float>
+{
+    static constexpr float hi() { return 0.693115234375f; }
+    static constexpr float lo() { return 3.194618329871446e-05f; }
+};
+
+template <>
+struct ln2_parts<double>
+{
+    static constexpr double hi() { return 0.6931471824645996; }
+    static constexpr double lo() { return -1.904654299957768e-09; }
+};
+
 }  // namespace detail
 template <typename T, size_t W>
 struct abs<T, W>
@@ -159,13 +284,96 @@ struct abs<T, W>
 {};
 
 template <typename T, size_t W>
-struct sqrt<T, W>
+struct sqrt<T, W, ENABLE_IF(std::is_arithmetic<T>::value)>
     : detail::math_unary_op<T, W, detail::sqrt_functor<T, W>>
 {};
 
+/// log: x = 2^n * m with m in [sqrt(2) / 2, sqrt(2)],
+/// log(x) = n * ln(2) + 2 atanh((m - 1) / (m + 1)); within 2 ulp.
+/// lanes that are not positive normal numbers go through std::log
 template <typename T, size_t W>
-struct log<T, W>
-    : detail::math_unary_op<T, W, detail::log_functor<T, W>>
-{};
+struct log<T, W, REQUIRE_FLOATING(T)>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& x) noexcept
+    {
+        using A = typename Vec<T, W>::arch_t;
+        using vec_t = Vec<T, W>;
+        using L = std::numeric_limits<T>;
+        if (!kernel::all_of<T, W>(x >= vec_t(L::min()), A{}) || !kernel::all_of<T, W>(x <= vec_t(L::max()), A{})) {
+            vec_t ret;
+            detail::apply(ret, x, [](T a) {
+                return std::log(a);
+            });
+            return ret;
+        }
+        const vec_t one(T(1));
+        vec_t n = detail::exponent(x);
+        vec_t m = (x & constants::mantissamask<vec_t>()) | one;
+        const auto big = m > constants::sqrt_2<vec_t>();
+        m = kernel::select(big, m * vec_t(T(0.5)), m, A{});
+        n = kernel::select(big, n + one, n, A{});
+        const vec_t s = (m - one) / (m + one);
+        const vec_t s2 = s + s;
+        const vec_t z = s * s;
+        vec_t ret = kernel::fmadd<T, W>(s2 * z, detail::log_series(z), s2, A{});
+        ret = kernel::fmadd<T, W>(n, vec_t(detail::ln2_parts<T>::lo()), ret, A{});
+        return kernel::fmadd<T, W>(n, vec_t(detail::ln2_parts<T>::hi()), ret, A{});
+    }
+};
+
+/// exp: x = n * ln(2) + r, exp(x) = 2^n * exp(r); within 1 ulp.
+/// lanes with 2^n outside the normal range (|x| > 87 for float,
+/// > 708 for double) or nan go through std::exp
+template <typename T, size_t W>
+struct exp<T, W, REQUIRE_FLOATING(T)>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& x) noexcept
+    {
+        using A = typename Vec<T, W>::arch_t;
+        using vec_t = Vec<T, W>;
+        const vec_t limit(std::is_same<T, float>::value ? T(87) : T(708));
+        if (!kernel::all_of<T, W>(kernel::abs<T, W>(x, A{}) <= limit, A{})) {
+            vec_t ret;
+            detail::apply(ret, x, [](T a) {
+                return std::exp(a);
+            });
+            return ret;
+        }
+        const vec_t n = detail::round_int(x * constants::log2e<vec_t>());
+        vec_t r = kernel::fnmadd<T, W>(n, vec_t(detail::ln2_parts<T>::hi()), x, A{});
+        r = kernel::fnmadd<T, W>(n, vec_t(detail::ln2_parts<T>::lo()), r, A{});
+        return detail::exp_reduced(r) * detail::pow2n(n);
+    }
+};
+
+/// hypot: max * sqrt(1 + (min / max)^2), no intermediate overflow or
+/// underflow; within 2 ulp. non-finite lanes go through std::hypot
+template <typename T, size_t W>
+struct hypot<T, W, REQUIRE_FLOATING(T)>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& x, const Vec<T, W>& y) noexcept
+    {
+        using A = typename Vec<T, W>::arch_t;
+        using vec_t = Vec<T, W>;
+        const vec_t ax = kernel::abs<T, W>(x, A{});
+        const vec_t ay = kernel::abs<T, W>(y, A{});
+        const vec_t big(std::numeric_limits<T>::max());
+        if (!kernel::all_of<T, W>(ax <= big, A{}) || !kernel::all_of<T, W>(ay <= big, A{})) {
+            vec_t ret;
+            detail::apply(ret, x, y, [](T a, T b) {
+                return std::hypot(a, b);
+            });
+            return ret;
+        }
+        const vec_t hi = kernel::max<T, W>(ax, ay, A{});
+        const vec_t lo = kernel::min<T, W>(ax, ay, A{});
+        const vec_t zero(T(0));
+        const vec_t r = kernel::select(hi == zero, zero, lo / hi, A{});
+        return hi * kernel::sqrt<T, W>(kernel::fmadd<T, W>(r, r, vec_t(T(1)), A{}), A{});
+    }
+};
 
 } } } // namespace simd::kernel::generic
@@ -69,4 +69,125 @@ struct store_unaligned<std::complex<T>, W>
         vhi.storeu((T*)mem + W);
     }
 };
+
+/// load_half/store_half: fp16 <-> fp32 lane by lane
+template <size_t W>
+struct load_half<float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const half* mem) noexcept
+    {
+        Vec<float, W> ret;
+        SIMD_UNROLL
+        for (auto i = 0u; i < W; i++) {
+            ret[i] = static_cast<float>(mem[i]);
+        }
+        return ret;
+    }
+};
+
+template <size_t W>
+struct store_half<float, W>
+{
+    SIMD_INLINE
+    static void apply(half* mem, const Vec<float, W>& x) noexcept
+    {
+        SIMD_UNROLL
+        for (auto i = 0u; i < W; i++) {
+            mem[i] = half(x[i]);
+        }
+    }
+};
+
+/// load_bf16/store_bf16: bfloat16 <-> fp32 lane by lane
+template <size_t W>
+struct load_bf16<float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const bfloat16* mem) noexcept
+    {
+        Vec<float, W> ret;
+        SIMD_UNROLL
+        for (auto i = 0u; i < W; i++) {
+            ret[i] = static_cast<float>(mem[i]);
+        }
+        return ret;
+    }
+};
+
+template <size_t W>
+struct store_bf16<float, W>
+{
+    SIMD_INLINE
+    static void apply(bfloat16* mem, const Vec<float, W>& x) noexcept
+    {
+        SIMD_UNROLL
+        for (auto i = 0u; i < W; i++) {
+            mem[i] = bfloat16(x[i]);
+        }
+    }
+};
+
+/// unpack_bf16: 2W bfloat16 as W pairs, {even elements, odd elements} as float
+template <size_t W>
+struct unpack_bf16<float, W>
+{
+    SIMD_INLINE
+    static std::array<Vec<float, W>, 2> apply(const bfloat16* mem) noexcept
+    {
+        std::array<Vec<float, W>, 2> ret;
+        SIMD_UNROLL
+        for (auto i = 0u; i < W; i++) {
+            ret[0][i] = static_cast<float>(mem[2 * i]);
+            ret[1][i] = static_cast<float>(mem[2 * i + 1]);
+        }
+        return ret;
+    }
+};
+
+/// dot_bf16: emulated with the arch's unpack_bf16 (a shift and a mask)
+/// and two fmadd, acc[i] += a[2i] * b[2i] + a[2i+1] * b[2i+1]
+template <size_t W>
+struct dot_bf16<float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const Vec<float, W>& acc, const bfloat16* a, const bfloat16* b) noexcept
+    {
+        using A = typename Vec<float, W>::arch_t;
+        auto va = kernel::unpack_bf16<float, W>(a, A{});
+        auto vb = kernel::unpack_bf16<float, W>(b, A{});
+        auto r = kernel::fmadd<float, W>(va[0], vb[0], acc, A{});
+        return kernel::fmadd<float, W>(va[1], vb[1], r, A{});
+    }
+};
+/// load_masked/store_masked: a Vec<T, W> whose W lanes do not fill its
+/// registers (Vec<float, 3>) touches mem[0, W) only, padding lanes load as 0
+template <typename T, size_t W>
+struct load_masked<T, W>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const T* mem) noexcept
+    {
+        Vec<T, W> ret;
+        constexpr auto lanes = Vec<T, W>::padded_lanes();
+        SIMD_UNROLL
+        for (auto i = 0u; i < lanes; i++) {
+            ret[i] = i < W ? mem[i] : T(0);
+        }
+        return ret;
+    }
+};
+
+template <typename T, size_t W>
+struct store_masked<T, W>
+{
+    SIMD_INLINE
+    static void apply(T* mem, const Vec<T, W>& x) noexcept
+    {
+        SIMD_UNROLL
+        for (auto i = 0u; i < W; i++) {
+            mem[i] = x[i];
+        }
+    }
+};
 } } } // namespace simd::kernel::generic
@@ -0,0 +1,41 @@
+#pragma once
+
+namespace simd { namespace kernel { namespace generic {
+using namespace types;
+
+/// shuffle: element copies through memory, fallback when no register kernel
+template <typename T, size_t W>
+struct shuffle<T, W>
+{
+    template <size_t... I>
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& a, const Vec<T, W>& b, ops::shuffle_pattern<I...> p) noexcept
+    {
+        return ops::shuffle_memory(a, b, p);
+    }
+};
+
+/// permute: runtime lane indices, through memory
+template <typename T, size_t W>
+struct permute<T, W>
+{
+    template <typename I>
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& x, const Vec<I, W>& idx) noexcept
+    {
+        return ops::permute_memory(x, idx);
+    }
+};
+
+/// lookup: byte table lookup, through memory
+template <size_t W>
+struct lookup<uint8_t, W>
+{
+    template <size_t N>
+    SIMD_INLINE
+    static Vec<uint8_t, W> apply(const Vec<uint8_t, N>& table, const Vec<uint8_t, W>& idx) noexcept
+    {
+        return ops::lookup_memory(table, idx);
+    }
+};
+} } } // namespace simd::kernel::generic
@@ -0,0 +1,22 @@
+#pragma once
+
+namespace simd { namespace kernel { namespace generic {
+using namespace types;
+
+/// transpose: element swaps, fallback when no register kernel
+template <typename T, size_t W>
+struct transpose<T, W>
+{
+    SIMD_INLINE
+    static void apply(std::array<Vec<T, W>, W>& rows) noexcept
+    {
+        for (auto i = 0u; i < W; i++) {
+            for (auto j = i + 1; j < W; j++) {
+                T t = rows[i][j];
+                rows[i][j] = rows[j][i];
+                rows[j][i] = t;
+            }
+        }
+    }
+};
+} } } // namespace simd::kernel::generic
@@ -1,6 +1,197 @@
 #pragma once
 
+#include <cmath>
+#include <limits>
+#include <utility>
+
 namespace simd { namespace kernel { namespace generic {
 using namespace types;
 
+namespace detail {
+/// pi / 2 split so that j * p1, j * p2 and j * p3 are exact for every
+/// quadrant index j of the vector path (|x| <= limit)
+template <typename T>
+struct pio2_parts;
+
+template <>
+struct pio2_parts<float>
+{
+    static constexpr float p1() { return 1.5703125f; }
+    static constexpr float p2() { return 4.837512969970703e-04f; }
+    static constexpr float p3() { return 7.549533620476723e-08f; }
+    static constexpr float p4() { return 2.5633440682570896e-12f; }
+    static constexpr float limit() { return 8192.f; }
+};
+
+template <>
+struct pio2_parts<double>
+{
+    static constexpr double p1() { return 1.570796325802803; }
+    static constexpr double p2() { return 9.920935739593517e-10; }
+    static constexpr double p3() { return 5.721188709663575e-18; }
+    static constexpr double p4() { return 1.6446256936324258e-26; }
+    static constexpr double limit() { return 33554432.; }
+};
+
+/// (sin(r) - r) / r^3 and (cos(r) - 1 + r^2 / 2) / r^4 for |r| <= pi / 4,
+/// Taylor series in z = r^2
+template <size_t W>
+SIMD_INLINE
+Vec<float, W> sin_series(const Vec<float, W>& z) noexcept
+{
+    return horner(z, 1.f / 362880, -1.f / 5040, 1.f / 120, -1.f / 6);
+}
+
+template <size_t W>
+SIMD_INLINE
+Vec<double, W> sin_series(const Vec<double, W>& z) noexcept
+{
+    return horner(z, 1. / 355687428096000, -1. / 1307674368000, 1. / 6227020800, -1. / 39916800,
+                  1. / 362880, -1. / 5040, 1. / 120, -1. / 6);
+}
+
+template <size_t W>
+SIMD_INLINE
+Vec<float, W> cos_series(const Vec<float, W>& z) noexcept
+{
+    return horner(z, -1.f / 3628800, 1.f / 40320, -1.f / 720, 1.f / 24);
+}
+
+template <size_t W>
+SIMD_INLINE
+Vec<double, W> cos_series(const Vec<double, W>& z) noexcept
+{
+    return horner(z, -1. / 6402373705728000, 1. / 20922789888000, -1. / 87178291200, 1. / 479001600,
+                  -1. / 3628800, 1. / 40320, -1. / 720, 1. / 24);
+}
+
+/// (atan(u) - u) / u^3 for |u| <= tan(pi / 16), Taylor series in z = u^2
+template <size_t W>
+SIMD_INLINE
+Vec<float, W> atan_series(const Vec<float, W>& z) noexcept
+{
+    return horner(z, 1.f / 9, -1.f / 7, 1.f / 5, -1.f / 3);
+}
+
+template <size_t W>
+SIMD_INLINE
+Vec<double, W> atan_series(const Vec<double, W>& z) noexcept
+{
+    return horner(z, -1. / 23, 1. / 21, -1. / 19, 1. / 17, -1. / 15, 1. / 13, -1. / 11,
+                  1. / 9, -1. / 7, 1. / 5, -1. / 3);
+}
+
+/// sin and cos sharing one reduction: x = j * pi / 2 + r, |r| <= pi / 4,
+/// then the quadrant j mod 4 picks and signs the two series; within 1 ulp.
+/// lanes beyond the exact reduction range or not finite go through std
+template <typename T, size_t W>
+SIMD_INLINE
+std::pair<Vec<T, W>, Vec<T, W>> sincos(const Vec<T, W>& x) noexcept
+{
+    using A = typename Vec<T, W>::arch_t;
+    using vec_t = Vec<T, W>;
+    using P = pio2_parts<T>;
+    if (!kernel::all_of<T, W>(kernel::abs<T, W>(x, A{}) <= vec_t(P::limit()), A{})) {
+        vec_t s, c;
+        detail::apply(s, x, [](T a) {
+            return std::sin(a);
+        });
+        detail::apply(c, x, [](T a) {
+            return std::cos(a);
+        });
+        return {s, c};
+    }
+    const vec_t j = round_int(x * constants::two_over_pi<vec_t>());
+    vec_t r = kernel::fnmadd<T, W>(j, vec_t(P::p1()), x, A{});
+    r = kernel::fnmadd<T, W>(j, vec_t(P::p2()), r, A{});
+    r = kernel::fnmadd<T, W>(j, vec_t(P::p3()), r, A{});
+    r = kernel::fnmadd<T, W>(j, vec_t(P::p4()), r, A{});
+    const vec_t z = r * r;
+    const vec_t sr = kernel::fmadd<T, W>(r * z, sin_series(z), r, A{});
+    const vec_t cr = kernel::fmadd<T, W>(z * z, cos_series(z),
+                                         kernel::fnmadd<T, W>(z, vec_t(T(0.5)), vec_t(T(1)), A{}), A{});
+    /// q = j mod 4 in {0, 1, 2, 3}: odd q swaps sin / cos, q in {2, 3}
+    /// negates sin, q in {1, 2} negates cos
+    const vec_t q = j - vec_t(T(4)) * kernel::floor<T, W>(j * vec_t(T(0.25)), A{});
+    const auto odd = kernel::abs<T, W>(q - vec_t(T(2)), A{}) == vec_t(T(1));
+    const vec_t s = kernel::select(odd, cr, sr, A{});
+    const vec_t c = kernel::select(odd, sr, cr, A{});
+    return {kernel::select(q >= vec_t(T(2)), -s, s, A{}),
+            kernel::select(kernel::abs<T, W>(q - vec_t(T(1.5)), A{}) < vec_t(T(1)), -c, c, A{})};
+}
+}  // namespace detail
+
+/// sin
+template <typename T, size_t W>
+struct sin<T, W, REQUIRE_FLOATING(T)>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& x) noexcept
+    {
+        return detail::sincos(x).first;
+    }
+};
+
+/// cos
+template <typename T, size_t W>
+struct cos<T, W, REQUIRE_FLOATING(T)>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& x) noexcept
+    {
+        return detail::sincos(x).second;
+    }
+};
+
+/// sincos: {sin(x), cos(x)} for the cost of one
+template <typename T, size_t W>
+struct sincos<T, W, REQUIRE_FLOATING(T)>
+{
+    SIMD_INLINE
+    static std::pair<Vec<T, W>, Vec<T, W>> apply(const Vec<T, W>& x) noexcept
+    {
+        return detail::sincos(x);
+    }
+};
+
+/// atan2(y, x): t = min(|x|, |y|) / max(|x|, |y|) in [0, 1], reduced by
+/// atan(t) = pi / 4 + atan((t - 1) / (t + 1)) above tan(pi / 8) and by
+/// atan(t) = 2 atan(t / (1 + sqrt(1 + t^2))), then unfolded into the
+/// octant of (x, y); within 4 ulp. non-finite lanes go through std::atan2
+template <typename T, size_t W>
+struct atan2<T, W, REQUIRE_FLOATING(T)>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const Vec<T, W>& y, const Vec<T, W>& x) noexcept
+    {
+        using A = typename Vec<T, W>::arch_t;
+        using vec_t = Vec<T, W>;
+        const vec_t ax = kernel::abs<T, W>(x, A{});
+        const vec_t ay = kernel::abs<T, W>(y, A{});
+        const vec_t big(std::numeric_limits<T>::max());
+        if (!kernel::all_of<T, W>(ax <= big, A{}) || !kernel::all_of<T, W>(ay <= big, A{})) {
+            vec_t ret;
+            detail::apply(ret, y, x, [](T a, T b) {
+                return std::atan2(a, b);
+            });
+            return ret;
+        }
+        const vec_t zero(T(0));
+        const vec_t one(T(1));
+        const vec_t hi = kernel::max<T, W>(ax, ay, A{});
+        const vec_t lo = kernel::min<T, W>(ax, ay, A{});
+        vec_t t = kernel::select(hi == zero, zero, lo / hi, A{});
+        const auto octant = t > vec_t(T(0.41421356237309504880));
+        t = kernel::select(octant, (t - one) / (t + one), t, A{});
+        const vec_t u = t / (one + kernel::sqrt<T, W>(kernel::fmadd<T, W>(t, t, one, A{}), A{}));
+        const vec_t u2 = u + u;
+        vec_t ret = kernel::fmadd<T, W>(u2 * (u * u), detail::atan_series(u * u), u2, A{});
+        ret = ret + kernel::select(octant, constants::pi_4<vec_t>(), zero, A{});
+        ret = kernel::select(ay > ax, constants::pi_2<vec_t>() - ret, ret, A{});
+        /// -0 counts as negative x: atan2(+-0, -0) = +-pi
+        ret = kernel::select(kernel::copysign<T, W>(one, x, A{}) < zero, constants::pi<vec_t>() - ret, ret, A{});
+        return kernel::copysign<T, W>(ret, y, A{});
+    }
+};
+
 } } } // namespace simd::kernel::generic
@@ -35,12 +35,18 @@ DECLARE_GENERIC_UNARY_OP(bitofsign);
 DECLARE_GENERIC_MATH_UNARY_OP(abs);
 DECLARE_GENERIC_MATH_UNARY_OP(sqrt);
 DECLARE_GENERIC_MATH_UNARY_OP(log);
+DECLARE_GENERIC_MATH_UNARY_OP(exp);
+DECLARE_GENERIC_MATH_UNARY_OP(sin);
+DECLARE_GENERIC_MATH_UNARY_OP(cos);
 
 DECLARE_GENERIC_BINARY_OP(add);
 DECLARE_GENERIC_BINARY_OP(sub);
 DECLARE_GENERIC_BINARY_OP(mul);
 DECLARE_GENERIC_BINARY_OP(div);
 DECLARE_GENERIC_BINARY_OP(mod);
+DECLARE_GENERIC_BINARY_OP(hypot);
+DECLARE_GENERIC_BINARY_OP(atan2);
+DECLARE_GENERIC_BINARY_OP(copysign);
 
 DECLARE_GENERIC_BINARY_OP(bitwise_and);
 DECLARE_GENERIC_BINARY_OP(bitwise_or);
@@ -71,6 +77,10 @@ template <typename T, size_t W>
 SIMD_INLINE
 void store_unaligned(T* mem, const Vec<T, W>& x, requires_arch<Generic>) noexcept;
 
+template <typename T, size_t W>
+SIMD_INLINE
+std::array<Vec<T, W>, 2> unpack_bf16(const bfloat16* mem, requires_arch<Generic>) noexcept;
+
 template <typename T, size_t W>
 Vec<T, W> fmadd(const Vec<T, W>& x, const Vec<T, W>& y, const Vec<T, W>& z, requires_arch<Generic>) noexcept;
 
@@ -3,6 +3,7 @@
 #include "simd/arch/constants.h"
 #include "simd/arch/generic_fwd.h"
 #include "simd/arch/detail.h"
+#include "simd/arch/shuffle.h"
 
 #if SIMD_WITH_SSE
 #include "simd/arch/sse.h"
@@ -10,6 +10,11 @@ DECLARE_OP_KERNEL(mul);
 DECLARE_OP_KERNEL(div);
 DECLARE_OP_KERNEL(mod);
 DECLARE_OP_KERNEL(neg);
+DECLARE_OP_KERNEL(add_sat);
+DECLARE_OP_KERNEL(sub_sat);
+DECLARE_OP_KERNEL(mul_sat);
+DECLARE_OP_KERNEL(dot_u8i8);
+DECLARE_OP_KERNEL(mul_conj);
 
 /// FMA kernels
 DECLARE_OP_KERNEL(fmadd);
@@ -28,6 +33,14 @@ DECLARE_OP_KERNEL(load_aligned);
 DECLARE_OP_KERNEL(load_unaligned);
 DECLARE_OP_KERNEL(store_aligned);
 DECLARE_OP_KERNEL(store_unaligned);
+DECLARE_OP_KERNEL(load_masked);
+DECLARE_OP_KERNEL(store_masked);
+DECLARE_OP_KERNEL(load_half);
+DECLARE_OP_KERNEL(store_half);
+DECLARE_OP_KERNEL(load_bf16);
+DECLARE_OP_KERNEL(store_bf16);
+DECLARE_OP_KERNEL(unpack_bf16);
+DECLARE_OP_KERNEL(dot_bf16);
 DECLARE_OP_KERNEL(broadcast);
 DECLARE_OP_KERNEL(load_complex);
 DECLARE_OP_KERNEL(complex_packlo);
@@ -41,6 +54,7 @@ DECLARE_OP_KERNEL(bitwise_andnot);
 DECLARE_OP_KERNEL(bitwise_not);
 DECLARE_OP_KERNEL(bitwise_lshift);
 DECLARE_OP_KERNEL(bitwise_rshift);
+DECLARE_OP_KERNEL(bitwise_ternlog);
 
 /// comparison op kernels
 DECLARE_OP_KERNEL(eq);
@@ -104,11 +118,23 @@ DECLARE_OP_KERNEL(reduce_sum);
 DECLARE_OP_KERNEL(reduce_max);
 DECLARE_OP_KERNEL(reduce_min);
 
+/// shuffle kernels
+DECLARE_OP_KERNEL(transpose);
+DECLARE_OP_KERNEL(shuffle);
+DECLARE_OP_KERNEL(permute);
+DECLARE_OP_KERNEL(lookup);
+
 template <typename T, size_t W, typename F, typename Enable = void>
 struct reduce;
 
 template <typename U, typename T, size_t W, typename Enable = void>
 struct cast;
+template <typename U, typename T, size_t W, typename Enable = void>
+struct pack_sat;
+template <typename U, typename T, size_t W, typename Enable = void>
+struct widen;
+template <typename U, typename T, size_t W, bool S, typename Enable = void>
+struct narrow;
 
 template <typename T, size_t W, typename U, typename V, typename Enable = void>
 struct gather;
@@ -0,0 +1,594 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace simd { namespace kernel {
+namespace ops {
+/// compile-time lane selection over registers of size() lanes: lane i of the
+/// result is lane I_i of the concatenation (a, b), indices below size() pick
+/// from a, the rest from b; a one-source shuffle only uses indices of a.
+/// the queries below classify the pattern, each ISA kernel maps them to the
+/// cheapest instruction it has (G is the lanes per 128-bit block, the unit
+/// most x86 shuffles work in)
+template <size_t... I>
+struct shuffle_pattern {
+    static constexpr size_t size() noexcept
+    {
+        return sizeof...(I);
+    }
+
+    static constexpr size_t at(size_t i) noexcept
+    {
+        constexpr size_t idx[] = {I...};
+        return idx[i];
+    }
+
+    static constexpr bool identity() noexcept
+    {
+        for (size_t i = 0; i < size(); i++) {
+            if (at(i) != i) return false;
+        }
+        return true;
+    }
+
+    /// every index below n
+    static constexpr bool in_range(size_t n) noexcept
+    {
+        for (size_t i = 0; i < size(); i++) {
+            if (at(i) >= n) return false;
+        }
+        return true;
+    }
+
+    /// every lane from a
+    static constexpr bool from_a() noexcept
+    {
+        for (size_t i = 0; i < size(); i++) {
+            if (at(i) >= size()) return false;
+        }
+        return true;
+    }
+
+    /// every lane from b
+    static constexpr bool from_b() noexcept
+    {
+        for (size_t i = 0; i < size(); i++) {
+            if (at(i) < size()) return false;
+        }
+        return true;
+    }
+
+    /// bit i set where lane i comes from b
+    static constexpr uint64_t b_mask() noexcept
+    {
+        uint64_t m = 0;
+        for (size_t i = 0; i < size(); i++) {
+            m |= uint64_t(at(i) >= size()) << i;
+        }
+        return m;
+    }
+
+    /// b_mask with every bit repeated n times, for blends over narrower
+    /// lanes (pblendw, vpblendd)
+    static constexpr uint64_t b_mask(size_t n) noexcept
+    {
+        uint64_t m = 0;
+        for (size_t i = 0; i < size() * n; i++) {
+            m |= uint64_t(at(i / n) >= size()) << i;
+        }
+        return m;
+    }
+
+    /// lane i is lane i of a or of b
+    static constexpr bool blend() noexcept
+    {
+        for (size_t i = 0; i < size(); i++) {
+            if (at(i) % size() != i) return false;
+        }
+        return true;
+    }
+
+    /// lanes 2j, 2j + 1 move together, a shuffle of twice as wide elements
+    static constexpr bool pairs() noexcept
+    {
+        if (size() % 2 != 0) return false;
+        for (size_t j = 0; j < size(); j += 2) {
+            if (at(j) % 2 != 0 || at(j + 1) != at(j) + 1) return false;
+        }
+        return true;
+    }
+
+    /// every lane reads from its own G-lane block (of a or b)
+    static constexpr bool in_blocks(size_t G) noexcept
+    {
+        for (size_t i = 0; i < size(); i++) {
+            if (at(i) % size() / G != i / G) return false;
+        }
+        return true;
+    }
+
+    /// in_blocks, and every block repeats the sources and in-block
+    /// indices of the first one, so one imm8 describes the pattern
+    static constexpr bool same_blocks(size_t G) noexcept
+    {
+        if (!in_blocks(G)) return false;
+        for (size_t i = G; i < size(); i++) {
+            if (at(i) - i / G * G != at(i % G)) return false;
+        }
+        return true;
+    }
+
+    /// in-block indices of the G lanes from `first`, B bits each
+    static constexpr int imm(size_t G, size_t B, size_t first = 0) noexcept
+    {
+        int m = 0;
+        for (size_t t = 0; t < G && first + t < size(); t++) {
+            m |= int(at(first + t) % G) << (B * t);
+        }
+        return m;
+    }
+
+    /// lanes [first, first + n) stay in place
+    static constexpr bool fixed(size_t first, size_t n) noexcept
+    {
+        for (size_t i = first; i < first + n && i < size(); i++) {
+            if (at(i) != i) return false;
+        }
+        return true;
+    }
+
+    /// bit i = index parity of lane i, vpermilpd / shufpd immediates
+    static constexpr int imm_bits() noexcept
+    {
+        int m = 0;
+        for (size_t i = 0; i < size(); i++) {
+            m |= int(at(i) % 2) << i;
+        }
+        return m;
+    }
+
+    /// unpcklps-like interleave of the low (or high) halves of the G-lane
+    /// blocks of a and b
+    static constexpr bool unpack(size_t G, bool hi) noexcept
+    {
+        for (size_t i = 0; i < size(); i++) {
+            size_t t = i % G;
+            size_t k = i / G * G + t / 2 + (hi ? G / 2 : 0) + (t % 2 ? size() : 0);
+            if (at(i) != k) return false;
+        }
+        return true;
+    }
+
+    /// every G-lane block is a whole block of a or b
+    static constexpr bool whole_blocks(size_t G) noexcept
+    {
+        for (size_t i = 0; i < size(); i++) {
+            size_t first = at(i / G * G);
+            if (first % G != 0 || at(i) != first + i % G) return false;
+        }
+        return true;
+    }
+
+    /// whole_blocks: index of the source block of block j in (a, b)
+    static constexpr int block_source(size_t G, size_t j) noexcept
+    {
+        return j * G < size() ? int(at(j * G) / G) : 0;
+    }
+
+    /// shufps-like: the low half of each G-lane block from the same block
+    /// of a, the high half from the same block of b
+    static constexpr bool halves_ab(size_t G) noexcept
+    {
+        if (!in_blocks(G)) return false;
+        for (size_t i = 0; i < size(); i++) {
+            if ((at(i) >= size()) != (i % G >= G / 2)) return false;
+        }
+        return true;
+    }
+
+    /// (a, b) shifted down by k lanes (palignr, valignd), 0 if not a shift
+    static constexpr size_t shift() noexcept
+    {
+        const size_t k = at(0);
+        if (k == 0 || k >= size()) return 0;
+        for (size_t i = 0; i < size(); i++) {
+            if (at(i) != i + k) return 0;
+        }
+        return k;
+    }
+
+    /// every G-lane block of (a, b) shifted down by k lanes (in-lane
+    /// palignr), 0 if not a block shift
+    static constexpr size_t block_shift(size_t G) noexcept
+    {
+        const size_t k = at(0);
+        if (k == 0 || k >= G) return 0;
+        for (size_t i = 0; i < size(); i++) {
+            size_t t = i % G + k;
+            size_t want = i / G * G + (t < G ? t : t - G + size());
+            if (at(i) != want) return 0;
+        }
+        return k;
+    }
+
+    /// one-source rotation down by k lanes, 0 if not a rotation
+    static constexpr size_t rotate() noexcept
+    {
+        const size_t k = at(0);
+        if (k == 0 || k >= size()) return 0;
+        for (size_t i = 0; i < size(); i++) {
+            if (at(i) != (i + k) % size()) return 0;
+        }
+        return k;
+    }
+
+    /// a with a single lane replaced by a lane of b (insertps):
+    /// that lane, or size() if the pattern is not one
+    static constexpr size_t single_b() noexcept
+    {
+        size_t lane = size();
+        for (size_t i = 0; i < size(); i++) {
+            if (at(i) >= size()) {
+                if (lane != size()) return size();
+                lane = i;
+            } else if (at(i) != i) {
+                return size();
+            }
+        }
+        return lane;
+    }
+
+    /// bit i set where lane i reads from block q of its source
+    static constexpr uint64_t block_mask(size_t G, size_t q) noexcept
+    {
+        uint64_t m = 0;
+        for (size_t i = 0; i < size(); i++) {
+            m |= uint64_t(at(i) % size() / G == q) << i;
+        }
+        return m;
+    }
+
+    /// bit i set where lane i reads from the other block of a two-block register
+    static constexpr uint64_t cross_mask(size_t G) noexcept
+    {
+        uint64_t m = 0;
+        for (size_t i = 0; i < size(); i++) {
+            m |= uint64_t(at(i) % size() / G != i / G) << i;
+        }
+        return m;
+    }
+
+    /// pshufb control of output byte x for S-byte lanes, the source byte
+    /// within its 128-bit block; keep 1 zeroes bytes read from another
+    /// block, keep 2 zeroes bytes read from the lane's own block
+    static constexpr int pshufb(size_t x, size_t S, size_t G, int keep) noexcept
+    {
+        const size_t i = x / S;
+        const size_t k = at(i) % size();
+        const bool own = k / G == i / G;
+        if ((keep == 1 && !own) || (keep == 2 && own)) {
+            return -128;
+        }
+        return int(k % G * S + x % S);
+    }
+};
+
+/// the pattern of shuffle(b, a)
+template <typename P>
+struct swap_sources;
+
+template <size_t... I>
+struct swap_sources<shuffle_pattern<I...>> {
+    using type = shuffle_pattern<(I < sizeof...(I) ? I + sizeof...(I) : I - sizeof...(I))...>;
+};
+
+/// sources dropped, every index taken within its register: permutes a or b
+/// alone into place, for a blend to combine
+template <typename P>
+struct local_pattern;
+
+template <size_t... I>
+struct local_pattern<shuffle_pattern<I...>> {
+    using type = shuffle_pattern<(I % sizeof...(I))...>;
+};
+
+/// pairs() pattern over elements twice as wide
+template <typename P, typename Seq = simd::detail::make_index_sequence<P::size() / 2>>
+struct widen_pattern;
+
+template <typename P, size_t... Js>
+struct widen_pattern<P, simd::detail::index_sequence<Js...>> {
+    using type = shuffle_pattern<P::at(2 * Js) / 2 ...>;
+};
+
+template <typename P>
+using swap_sources_t = typename swap_sources<P>::type;
+template <typename P>
+using local_pattern_t = typename local_pattern<P>::type;
+template <typename P>
+using widen_pattern_t = typename widen_pattern<P>::type;
+
+/// constant table in .rodata, for index / control / mask registers
+template <typename E, E... V>
+struct constant_array {
+    alignas(64) static constexpr E value[sizeof...(V)] = {V...};
+};
+
+template <typename E, E... V>
+constexpr E constant_array<E, V...>::value[sizeof...(V)];
+
+template <typename E, typename P, size_t... Is>
+SIMD_INLINE
+const E* shuffle_indices(simd::detail::index_sequence<Is...>) noexcept
+{
+    return constant_array<E, E(P::at(Is))...>::value;
+}
+
+/// P::at(i) for every lane as E, e.g. the index register of vpermps / vpermt2ps
+template <typename E, typename P>
+SIMD_INLINE
+const E* shuffle_indices() noexcept
+{
+    return shuffle_indices<E, P>(simd::detail::make_index_sequence<P::size()>());
+}
+
+template <typename P, size_t S, size_t G, int Keep, size_t... Xs>
+SIMD_INLINE
+const int8_t* shuffle_bytes(simd::detail::index_sequence<Xs...>) noexcept
+{
+    return constant_array<int8_t, int8_t(P::pshufb(Xs, S, G, Keep))...>::value;
+}
+
+/// pshufb control bytes of P over S-byte lanes, see shuffle_pattern::pshufb
+template <typename P, size_t S, size_t G, int Keep = 0>
+SIMD_INLINE
+const int8_t* shuffle_bytes() noexcept
+{
+    return shuffle_bytes<P, S, G, Keep>(simd::detail::make_index_sequence<P::size() * S>());
+}
+
+template <typename P, size_t S, size_t... Xs>
+SIMD_INLINE
+const int8_t* blend_bytes(simd::detail::index_sequence<Xs...>) noexcept
+{
+    return constant_array<int8_t, int8_t(P::at(Xs / S) >= P::size() ? -1 : 0)...>::value;
+}
+
+/// pblendvb mask of P over S-byte lanes, all ones where the lane comes from b
+template <typename P, size_t S>
+SIMD_INLINE
+const int8_t* blend_bytes() noexcept
+{
+    return blend_bytes<P, S>(simd::detail::make_index_sequence<P::size() * S>());
+}
+
+/// shuffle through memory, for the generic arch and for patterns whose
+/// output registers read from more than two source registers
+template <typename T, size_t W, size_t... I>
+SIMD_INLINE
+Vec<T, W> shuffle_memory(const Vec<T, W>& a, const Vec<T, W>& b, shuffle_pattern<I...>) noexcept
+{
+    T src[2 * W];
+    a.store_unaligned(src);
+    b.store_unaligned(src + W);
+    T dst[W] = {src[I]...};
+    return Vec<T, W>::load_unaligned(dst);
+}
+
+/// W-lane shuffle of Vec<T, W> over its native registers: each output
+/// register reads from at most two source registers of (a, b) and becomes
+/// one register kernel call `F::template shuffle<Q>(lo, hi)`, Q the pattern
+/// local to that register pair
+template <typename T, size_t W, typename F>
+struct shuffle_op {
+    using vec_t = Vec<T, W>;
+    using reg_t = typename vec_t::register_t;
+    static constexpr size_t L = vec_t::reg_lanes();
+    static constexpr size_t R = vec_t::n_regs();
+
+    template <size_t... I>
+    SIMD_INLINE
+    static vec_t apply(const vec_t& a, const vec_t& b, shuffle_pattern<I...> p) noexcept
+    {
+        return apply(a, b, p, std::integral_constant<bool, two_sources(p)>());
+    }
+
+private:
+    /// first / last source register of output register r
+    template <size_t... I>
+    static constexpr size_t first(shuffle_pattern<I...> p, size_t r) noexcept
+    {
+        size_t s = 2 * R;
+        for (size_t j = 0; j < L; j++) {
+            s = p.at(r * L + j) / L < s ? p.at(r * L + j) / L : s;
+        }
+        return s;
+    }
+
+    template <size_t... I>
+    static constexpr size_t last(shuffle_pattern<I...> p, size_t r) noexcept
+    {
+        size_t s = 0;
+        for (size_t j = 0; j < L; j++) {
+            s = p.at(r * L + j) / L > s ? p.at(r * L + j) / L : s;
+        }
+        return s;
+    }
+
+    template <size_t... I>
+    static constexpr bool two_sources(shuffle_pattern<I...> p) noexcept
+    {
+        for (size_t r = 0; r < R; r++) {
+            for (size_t j = 0; j < L; j++) {
+                size_t s = p.at(r * L + j) / L;
+                if (s != first(p, r) && s != last(p, r)) return false;
+            }
+        }
+        return true;
+    }
+
+    /// lane j of output register r within (first, last)
+    template <size_t... I>
+    static constexpr size_t local(shuffle_pattern<I...> p, size_t r, size_t j) noexcept
+    {
+        return p.at(r * L + j) % L + (p.at(r * L + j) / L == first(p, r) ? 0 : L);
+    }
+
+    SIMD_INLINE
+    static reg_t source(const vec_t& a, const vec_t& b, size_t s) noexcept
+    {
+        return s < R ? a.reg(s) : b.reg(s - R);
+    }
+
+    template <size_t r, size_t... I, size_t... Js>
+    SIMD_INLINE
+    static reg_t output(const vec_t& a, const vec_t& b, shuffle_pattern<I...> p,
+                        simd::detail::index_sequence<Js...>) noexcept
+    {
+        using Q = shuffle_pattern<local(shuffle_pattern<I...>(), r, Js)...>;
+        return F::template shuffle<Q>(source(a, b, first(p, r)), source(a, b, last(p, r)));
+    }
+
+    template <size_t... I, size_t... Rs>
+    SIMD_INLINE
+    static vec_t outputs(const vec_t& a, const vec_t& b, shuffle_pattern<I...> p,
+                         simd::detail::index_sequence<Rs...>) noexcept
+    {
+        vec_t ret;
+        int expand[] = {0, (ret.reg(Rs) = output<Rs>(a, b, p, simd::detail::make_index_sequence<L>()), 0)...};
+        (void)expand;
+        return ret;
+    }
+
+    template <size_t... I>
+    SIMD_INLINE
+    static vec_t apply(const vec_t& a, const vec_t& b, shuffle_pattern<I...> p, std::true_type) noexcept
+    {
+        return outputs(a, b, p, simd::detail::make_index_sequence<R>());
+    }
+
+    template <size_t... I>
+    SIMD_INLINE
+    static vec_t apply(const vec_t& a, const vec_t& b, shuffle_pattern<I...> p, std::false_type) noexcept
+    {
+        return shuffle_memory(a, b, p);
+    }
+};
+
+/// runtime permute through memory: lane i of the result is x[idx[i] % W]
+template <typename T, size_t W, typename I>
+SIMD_INLINE
+Vec<T, W> permute_memory(const Vec<T, W>& x, const Vec<I, W>& idx) noexcept
+{
+    T src[W];
+    I k[W];
+    T dst[W];
+    x.store_unaligned(src);
+    idx.store_unaligned(k);
+    for (size_t i = 0; i < W; i++) {
+        dst[i] = src[static_cast<size_t>(k[i]) % W];
+    }
+    return Vec<T, W>::load_unaligned(dst);
+}
+
+/// byte table lookup through memory: lane i of the result is table[idx[i] % N]
+template <size_t N, size_t W>
+SIMD_INLINE
+Vec<uint8_t, W> lookup_memory(const Vec<uint8_t, N>& table, const Vec<uint8_t, W>& idx) noexcept
+{
+    uint8_t t[N];
+    uint8_t k[W];
+    uint8_t dst[W];
+    table.store_unaligned(t);
+    idx.store_unaligned(k);
+    for (size_t i = 0; i < W; i++) {
+        dst[i] = t[k[i] % N];
+    }
+    return Vec<uint8_t, W>::load_unaligned(dst);
+}
+
+template <size_t S, size_t... Xs>
+SIMD_INLINE
+const int8_t* lane_low_bytes(simd::detail::index_sequence<Xs...>) noexcept
+{
+    return constant_array<int8_t, int8_t(Xs % 16 / S * S)...>::value;
+}
+
+/// pshufb control copying the low byte of every S-byte lane over the lane,
+/// B bytes
+template <size_t S, size_t B>
+SIMD_INLINE
+const int8_t* lane_low_bytes() noexcept
+{
+    return lane_low_bytes<S>(simd::detail::make_index_sequence<B>());
+}
+
+template <size_t S, size_t... Xs>
+SIMD_INLINE
+const int8_t* lane_byte_offsets(simd::detail::index_sequence<Xs...>) noexcept
+{
+    return constant_array<int8_t, int8_t(Xs % S)...>::value;
+}
+
+/// byte x of an S-byte lane holds x, B bytes; added to lane index * S it
+/// gives the pshufb control of a runtime lane permute
+template <size_t S, size_t B>
+SIMD_INLINE
+const int8_t* lane_byte_offsets() noexcept
+{
+    return lane_byte_offsets<S>(simd::detail::make_index_sequence<B>());
+}
+
+/// runtime permute of Vec<T, W>: one register kernel call
+/// `F::permute(x, idx)` when W fits a register, through memory otherwise
+template <typename T, size_t W, typename F>
+struct permute_op {
+    using vec_t = Vec<T, W>;
+
+    template <typename I>
+    SIMD_INLINE
+    static vec_t apply(const vec_t& x, const Vec<I, W>& idx) noexcept
+    {
+        return apply(x, idx, std::integral_constant<bool, vec_t::n_regs() == 1>());
+    }
+
+private:
+    template <typename I>
+    SIMD_INLINE
+    static vec_t apply(const vec_t& x, const Vec<I, W>& idx, std::true_type) noexcept
+    {
+        return vec_t(F::permute(x.reg(0), idx.reg(0)));
+    }
+
+    template <typename I>
+    SIMD_INLINE
+    static vec_t apply(const vec_t& x, const Vec<I, W>& idx, std::false_type) noexcept
+    {
+        return permute_memory(x, idx);
+    }
+};
+
+/// byte table lookup over the index registers of Vec<uint8_t, W>, the
+/// table spilled once and reloaded (broadcast) into the register width by
+/// `F::template lookup<N>(table, idx)`
+template <size_t W, typename F>
+struct lookup_op {
+    using vec_t = Vec<uint8_t, W>;
+
+    template <size_t N>
+    SIMD_INLINE
+    static vec_t apply(const Vec<uint8_t, N>& table, const vec_t& idx) noexcept
+    {
+        alignas(64) uint8_t t[N];
+        table.store_aligned(t);
+        vec_t ret;
+        for (size_t r = 0; r < vec_t::n_regs(); r++) {
+            ret.reg(r) = F::template lookup<N>(t, idx.reg(r));
+        }
+        return ret;
+    }
+};
+}  // namespace ops
+} }  // namespace simd::kernel
@@ -14,6 +14,8 @@ namespace simd { namespace kernel { namespace sse {
 #include "simd/arch/sse/logical.h"
 #include "simd/arch/sse/math.h"
 #include "simd/arch/sse/memory.h"
+#include "simd/arch/sse/transpose.h"
+#include "simd/arch/sse/shuffle.h"
 #include "simd/arch/sse/trigo.h"
 #include "simd/arch/sse/complex.h"
 
@@ -32,6 +34,23 @@ DEFINE_SSE_BINARY_OP(sub);
 DEFINE_SSE_BINARY_OP(mul);
 DEFINE_SSE_BINARY_OP(div);
 DEFINE_SSE_BINARY_OP(mod);
+DEFINE_SSE_BINARY_OP(add_sat);
+DEFINE_SSE_BINARY_OP(sub_sat);
+
+template <typename T, size_t W,
+  REQUIRES((sizeof(T) <= 4))>
+SIMD_INLINE
+Vec<T, W> mul_sat(const Vec<T, W>& lhs, const Vec<T, W>& rhs, requires_arch<SSE>) noexcept
+{
+    return sse::mul_sat<T, W>::apply(lhs, rhs);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> dot_u8i8(const Vec<T, W>& acc, const Vec<uint8_t, 4 * W>& a, const Vec<int8_t, 4 * W>& b, requires_arch<SSE>) noexcept
+{
+    return sse::dot_u8i8<T, W>::apply(acc, a, b);
+}
 
 DEFINE_SSE_BINARY_OP(bitwise_and);
 DEFINE_SSE_BINARY_OP(bitwise_or);
@@ -197,6 +216,59 @@ void store_unaligned(T* mem, const Vec<T, W>& x, requires_arch<SSE>) noexcept
     sse::store_unaligned<T, W>::apply(mem, x);
 }
 
+template <typename T, size_t W,
+    REQUIRES((sizeof(T) >= 4))>
+SIMD_INLINE
+Vec<T, W> load_masked(const T* mem, requires_arch<SSE>) noexcept
+{
+    return sse::load_masked<T, W>::apply(mem);
+}
+
+template <typename T, size_t W,
+    REQUIRES((sizeof(T) >= 4))>
+SIMD_INLINE
+void store_masked(T* mem, const Vec<T, W>& x, requires_arch<SSE>) noexcept
+{
+    sse::store_masked<T, W>::apply(mem, x);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> load_bf16(const bfloat16* mem, requires_arch<SSE>) noexcept
+{
+    return sse::load_bf16<T, W>::apply(mem);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+void store_bf16(bfloat16* mem, const Vec<T, W>& x, requires_arch<SSE>) noexcept
+{
+    sse::store_bf16<T, W>::apply(mem, x);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+std::array<Vec<T, W>, 2> unpack_bf16(const bfloat16* mem, requires_arch<SSE>) noexcept
+{
+    return sse::unpack_bf16<T, W>::apply(mem);
+}
+
+#if SIMD_WITH_F16C
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> load_half(const half* mem, requires_arch<SSE>) noexcept
+{
+    return sse::load_half<T, W>::apply(mem);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+void store_half(half* mem, const Vec<T, W>& x, requires_arch<SSE>) noexcept
+{
+    sse::store_half<T, W>::apply(mem, x);
+}
+#endif
+
 template <typename T, size_t W>
 SIMD_INLINE
 Vec<std::complex<T>, W> load_complex(const Vec<T, W>& vlo, const Vec<T, W>& vhi, requires_arch<SSE>) noexcept
@@ -253,6 +325,29 @@ Vec<U, W> cast(const Vec<T, W>& x, requires_arch<SSE>) noexcept
     return sse::cast<U, T, W>::apply(x);
 }
 
+template <typename U, typename T, size_t W>
+SIMD_INLINE
+Vec<U, 2 * W> pack_sat(const Vec<T, W>& lo, const Vec<T, W>& hi, requires_arch<SSE>) noexcept
+{
+    return sse::pack_sat<U, T, W>::apply(lo, hi);
+}
+
+template <typename U, typename T, size_t W,
+  REQUIRES((ops::native_widen<U, T>::value))>
+SIMD_INLINE
+std::array<Vec<U, W * sizeof(T) / sizeof(U)>, sizeof(U) / sizeof(T)> widen(const Vec<T, W>& x, requires_arch<SSE>) noexcept
+{
+    return sse::widen<U, T, W>::apply(x);
+}
+
+template <typename U, bool S, typename T, size_t W, size_t K,
+  REQUIRES((ops::native_narrow<U, T>::value))>
+SIMD_INLINE
+Vec<U, W * K> narrow(const std::array<Vec<T, W>, K>& x, requires_arch<SSE>) noexcept
+{
+    return sse::narrow<U, T, W, S>::apply(x);
+}
+
 template <typename T, size_t W>
 SIMD_INLINE
 Vec<T, W> select(const VecBool<T, W>& cond, const Vec<T, W>& lhs, const Vec<T, W>& rhs, requires_arch<SSE>) noexcept
@@ -289,6 +384,36 @@ T reduce_min(const Vec<T, W>& x, requires_arch<SSE>) noexcept
     return sse::reduce_min<T, W>::apply(x);
 }
 
+/// transpose
+template <typename T, size_t W>
+SIMD_INLINE
+void transpose(std::array<Vec<T, W>, W>& rows, requires_arch<SSE>) noexcept
+{
+    sse::transpose<T, W>::apply(rows);
+}
+
+/// shuffle
+template <typename T, size_t W, size_t... I>
+SIMD_INLINE
+Vec<T, W> shuffle(const Vec<T, W>& a, const Vec<T, W>& b, ops::shuffle_pattern<I...> p, requires_arch<SSE>) noexcept
+{
+    return sse::shuffle<T, W>::apply(a, b, p);
+}
+
+template <typename T, size_t W, typename I>
+SIMD_INLINE
+Vec<T, W> permute(const Vec<T, W>& x, const Vec<I, W>& idx, requires_arch<SSE>) noexcept
+{
+    return sse::permute<T, W>::apply(x, idx);
+}
+
+template <size_t N, size_t W>
+SIMD_INLINE
+Vec<uint8_t, W> lookup(const Vec<uint8_t, N>& table, const Vec<uint8_t, W>& idx, requires_arch<SSE>) noexcept
+{
+    return sse::lookup<uint8_t, W>::template apply<N>(table, idx);
+}
+
 #undef DEFINE_SSE_UNARY_OP
 #undef DEFINE_SSE_BINARY_OP
 #undef DEFINE_SSE_BINARY_CMP_OP
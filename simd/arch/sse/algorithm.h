@@ -16,21 +16,21 @@ struct min<T, W, REQUIRE_INTEGRAL(T)>
         constexpr int nregs = Vec<T, W>::n_regs();
         constexpr bool is_signed = std::is_signed<T>::value;
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm_min_epi8(lhs.reg(idx), rhs.reg(idx))
                                 : _mm_min_epu8(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm_min_epi16(lhs.reg(idx), rhs.reg(idx))
                                 : _mm_min_epu16(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                 ? _mm_min_epi32(lhs.reg(idx), rhs.reg(idx))
@@ -51,7 +51,7 @@ struct min<float, W>
     {
         Vec<float, W> ret;
         constexpr int nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_min_ps(lhs.reg(idx), rhs.reg(idx));
         }
@@ -67,7 +67,7 @@ struct min<double, W>
     {
         Vec<double, W> ret;
         constexpr int nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_min_pd(lhs.reg(idx), rhs.reg(idx));
         }
@@ -88,21 +88,21 @@ struct max<T, W, REQUIRE_INTEGRAL(T)>
         constexpr int nregs = Vec<T, W>::n_regs();
         constexpr bool is_signed = std::is_signed<T>::value;
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                     ? _mm_max_epi8(lhs.reg(idx), rhs.reg(idx))
                                     : _mm_max_epu8(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                     ? _mm_max_epi16(lhs.reg(idx), rhs.reg(idx))
                                     : _mm_max_epu16(lhs.reg(idx), rhs.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                                     ? _mm_max_epi32(lhs.reg(idx), rhs.reg(idx))
@@ -123,7 +123,7 @@ struct max<float, W>
     {
         Vec<float, W> ret;
         constexpr int nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_max_ps(lhs.reg(idx), rhs.reg(idx));
         }
@@ -139,7 +139,7 @@ struct max<double, W>
     {
         Vec<double, W> ret;
         constexpr int nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_max_pd(lhs.reg(idx), rhs.reg(idx));
         }
@@ -156,7 +156,7 @@ struct all_of<float, W>
     {
         bool ret = true;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret = ret && (_mm_movemask_ps(x.reg(idx)) == 0x0F);
         }
@@ -172,7 +172,7 @@ struct all_of<double, W>
     {
         bool ret = true;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret = ret && (_mm_movemask_pd(x.reg(idx)) == 0x03);
         }
@@ -190,7 +190,7 @@ struct all_of<T, W, REQUIRE_INTEGRAL(T)>
 
         bool ret = true;
         constexpr auto nregs = VecBool<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret = ret && (_mm_movemask_epi8(x.reg(idx)) == 0xFFFF);
         }
@@ -207,7 +207,7 @@ struct any_of<float, W>
     {
         bool ret = false;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret = ret || (_mm_movemask_ps(x.reg(idx)) != 0);
         }
@@ -223,7 +223,7 @@ struct any_of<double, W>
     {
         bool ret = false;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret = ret || (_mm_movemask_pd(x.reg(idx)) != 0);
         }
@@ -241,7 +241,7 @@ struct any_of<T, W, REQUIRE_INTEGRAL(T)>
 
         bool ret = false;
         constexpr auto nregs = VecBool<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret = ret || (!_mm_testz_si128(x.reg(idx),x.reg(idx)));
         }
@@ -260,7 +260,7 @@ struct select<T, W, REQUIRE_INTEGRAL(T)>
 
         Vec<T, W> ret;
         constexpr auto nregs = VecBool<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_or_si128(
                             _mm_and_si128(cond.reg(idx), lhs.reg(idx)),
@@ -279,7 +279,7 @@ struct select<float, W>
     {
         Vec<float, W> ret;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_blendv_ps(rhs.reg(idx), lhs.reg(idx), cond.reg(idx));
             #if 0  // naive implementation before sse4.2
@@ -301,7 +301,7 @@ struct select<double, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_blendv_pd(rhs.reg(idx), lhs.reg(idx), cond.reg(idx));
             #if 0  // naive implementation before sse4.2
@@ -324,7 +324,7 @@ struct popcount<float, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret += bits::count1(_mm_movemask_ps(x.reg(idx)));
         }
@@ -340,7 +340,7 @@ struct popcount<double, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret += bits::count1(_mm_movemask_pd(x.reg(idx)));
         }
@@ -382,23 +382,23 @@ struct popcount<T, W, REQUIRE_INTEGRAL(T)>
         int ret = 0;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += bits::count1(_mm_movemask_epi8(x.reg(idx)));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += detail::sse_count1_mask_epi16(x.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += detail::sse_count1_mask_epi32(x.reg(idx));
 
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += detail::sse_count1_mask_epi64(x.reg(idx));
             }
@@ -416,7 +416,7 @@ struct find_first_set<float, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret += bits::count1(_mm_movemask_ps(x.reg(idx)));
         }
@@ -432,7 +432,7 @@ struct find_first_set<double, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret += bits::count1(_mm_movemask_pd(x.reg(idx)));
         }
@@ -451,23 +451,23 @@ struct find_first_set<T, W, REQUIRE_INTEGRAL(T)>
         int ret = 0;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += bits::count1(_mm_movemask_epi8(x.reg(idx)));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += bits::count1(_mm_movemask_epi8(x.reg(idx)));
             }
             ret >>= 1;
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += bits::count1(_mm_movemask_ps(_mm_castsi128_ps(x.reg(idx))));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += bits::count1(_mm_movemask_pd(_mm_castsi128_pd(x.reg(idx))));
             }
@@ -485,7 +485,7 @@ struct find_last_set<float, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret += bits::count1(_mm_movemask_ps(x.reg(idx)));
         }
@@ -501,7 +501,7 @@ struct find_last_set<double, W>
     {
         int ret = 0;
         constexpr auto nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret += bits::count1(_mm_movemask_pd(x.reg(idx)));
         }
@@ -520,23 +520,23 @@ struct find_last_set<T, W, REQUIRE_INTEGRAL(T)>
         int ret = 0;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += bits::count1(_mm_movemask_epi8(x.reg(idx)));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += bits::count1(_mm_movemask_epi8(x.reg(idx)));
             }
             ret >>= 1;
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += bits::count1(_mm_movemask_ps(_mm_castsi128_ps(x.reg(idx))));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += bits::count1(_mm_movemask_pd(_mm_castsi128_pd(x.reg(idx))));
             }
@@ -599,6 +599,34 @@ double reduce_sum_f64(const __m128d& x) noexcept
     return _mm_cvtsd_f64(tmp);    /// latency=5
 #endif
 }
+
+SIMD_INLINE
+float reduce_max_f32(const __m128& x) noexcept
+{
+    auto tmp1 = _mm_max_ps(x, _mm_movehl_ps(x, x));
+    auto tmp2 = _mm_max_ps(tmp1, _mm_shuffle_ps(tmp1, tmp1, 1));
+    return _mm_cvtss_f32(tmp2);
+}
+
+SIMD_INLINE
+float reduce_min_f32(const __m128& x) noexcept
+{
+    auto tmp1 = _mm_min_ps(x, _mm_movehl_ps(x, x));
+    auto tmp2 = _mm_min_ps(tmp1, _mm_shuffle_ps(tmp1, tmp1, 1));
+    return _mm_cvtss_f32(tmp2);
+}
+
+SIMD_INLINE
+double reduce_max_f64(const __m128d& x) noexcept
+{
+    return _mm_cvtsd_f64(_mm_max_pd(x, _mm_unpackhi_pd(x, x)));
+}
+
+SIMD_INLINE
+double reduce_min_f64(const __m128d& x) noexcept
+{
+    return _mm_cvtsd_f64(_mm_min_pd(x, _mm_unpackhi_pd(x, x)));
+}
 }  // namespace detail
 template <typename T, size_t W>
 struct reduce_sum<T, W, REQUIRE_INTEGRAL(T)>
@@ -615,12 +643,12 @@ struct reduce_sum<T, W, REQUIRE_INTEGRAL(T)>
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
             ret = kernel::hadd<T, W>(x, Generic{});
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += detail::reduce_sum_i32<T>(x.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret += detail::reduce_sum_i64<T>(x.reg(idx));
             }
@@ -635,13 +663,9 @@ struct reduce_sum<float, W>
     SIMD_INLINE
     static float apply(const Vec<float, W>& x) noexcept
     {
-        float ret{};
-        constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            ret += detail::reduce_sum_f32(x.reg(idx));
-        }
-        return ret;
+        return detail::reduce_sum_f32(ops::fold_regs(x, [](const sse_reg_f& a, const sse_reg_f& b) {
+            return _mm_add_ps(a, b);
+        }));
     }
 };
 
@@ -651,13 +675,9 @@ struct reduce_sum<double, W>
     SIMD_INLINE
     static double apply(const Vec<double, W>& x) noexcept
     {
-        double ret{};
-        constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            ret += detail::reduce_sum_f64(x.reg(idx));
-        }
-        return ret;
+        return detail::reduce_sum_f64(ops::fold_regs(x, [](const sse_reg_d& a, const sse_reg_d& b) {
+            return _mm_add_pd(a, b);
+        }));
     }
 };
 
@@ -677,12 +697,12 @@ struct reduce_max<T, W, REQUIRE_INTEGRAL(T)>
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
             // TODO
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO
             }
@@ -697,13 +717,9 @@ struct reduce_max<float, W>
     SIMD_INLINE
     static float apply(const Vec<float, W>& x) noexcept
     {
-        float ret{};
-        constexpr int nregs = Vec<float, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            // TODO
-        }
-        return ret;
+        return detail::reduce_max_f32(ops::fold_regs(x, [](const sse_reg_f& a, const sse_reg_f& b) {
+            return _mm_max_ps(a, b);
+        }));
     }
 };
 
@@ -713,13 +729,9 @@ struct reduce_max<double, W>
     SIMD_INLINE
     static double apply(const Vec<double, W>& x) noexcept
     {
-        double ret{};
-        constexpr int nregs = Vec<double, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            // TODO
-        }
-        return ret;
+        return detail::reduce_max_f64(ops::fold_regs(x, [](const sse_reg_d& a, const sse_reg_d& b) {
+            return _mm_max_pd(a, b);
+        }));
     }
 };
 
@@ -739,12 +751,12 @@ struct reduce_min<T, W, REQUIRE_INTEGRAL(T)>
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
             // TODO
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO
             }
@@ -759,13 +771,9 @@ struct reduce_min<float, W>
     SIMD_INLINE
     static float apply(const Vec<float, W>& x) noexcept
     {
-        float ret{};
-        constexpr int nregs = Vec<float, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            // TODO
-        }
-        return ret;
+        return detail::reduce_min_f32(ops::fold_regs(x, [](const sse_reg_f& a, const sse_reg_f& b) {
+            return _mm_min_ps(a, b);
+        }));
     }
 };
 
@@ -775,13 +783,9 @@ struct reduce_min<double, W>
     SIMD_INLINE
     static double apply(const Vec<double, W>& x) noexcept
     {
-        double ret{};
-        constexpr int nregs = Vec<double, W>::n_regs();
-        #pragma unroll
-        for (auto idx = 0; idx < nregs; idx++) {
-            // TODO
-        }
-        return ret;
+        return detail::reduce_min_f64(ops::fold_regs(x, [](const sse_reg_d& a, const sse_reg_d& b) {
+            return _mm_min_pd(a, b);
+        }));
     }
 };
 
@@ -801,12 +805,12 @@ struct reduce<T, W, F, REQUIRE_INTEGRAL(T)>
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
             // TODO
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 // TODO
             }
@@ -823,7 +827,7 @@ struct reduce<float, W, F>
     {
         float ret{};
         constexpr int nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             // TODO
         }
@@ -839,7 +843,7 @@ struct reduce<double, W, F>
     {
         double ret{};
         constexpr int nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             // TODO
         }
@@ -123,6 +123,150 @@ struct neg_functor {
     }
 };
 
+/// saturating add, native for 8/16-bit lanes, 32/64-bit lanes detect the overflow
+template <typename T>
+struct add_sat_functor {
+    template <typename U = T, REQUIRES(IS_INT_SIZE_1(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        return _mm_adds_epi8(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_1(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        return _mm_adds_epu8(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_2(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        return _mm_adds_epi16(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_2(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        return _mm_adds_epu16(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_4(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        /// overflow when the sign of the result differs from both operands
+        __m128i r = _mm_add_epi32(x, y);
+        __m128i o = _mm_and_si128(_mm_xor_si128(x, r), _mm_xor_si128(y, r));
+        __m128i s = _mm_xor_si128(_mm_srai_epi32(x, 31), _mm_set1_epi32(INT32_MAX));
+        return _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(r), _mm_castsi128_ps(s), _mm_castsi128_ps(o)));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_4(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        /// y is clamped to `~x`, the room left before wrapping around
+        return _mm_add_epi32(x, _mm_min_epu32(y, _mm_xor_si128(x, _mm_set1_epi32(-1))));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_8(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        __m128i r = _mm_add_epi64(x, y);
+        __m128i o = _mm_and_si128(_mm_xor_si128(x, r), _mm_xor_si128(y, r));
+        __m128i s = _mm_xor_si128(_mm_cmpgt_epi64(_mm_setzero_si128(), x), _mm_set1_epi64x(INT64_MAX));
+        return _mm_castpd_si128(_mm_blendv_pd(_mm_castsi128_pd(r), _mm_castsi128_pd(s), _mm_castsi128_pd(o)));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_8(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        /// wrapped around when the result is below x, compared as signed after flipping the sign bit
+        __m128i r = _mm_add_epi64(x, y);
+        __m128i b = _mm_set1_epi64x(INT64_MIN);
+        __m128i o = _mm_cmpgt_epi64(_mm_xor_si128(x, b), _mm_xor_si128(r, b));
+        return _mm_or_si128(r, o);
+    }
+};
+
+/// saturating sub, native for 8/16-bit lanes, 32/64-bit lanes detect the overflow
+template <typename T>
+struct sub_sat_functor {
+    template <typename U = T, REQUIRES(IS_INT_SIZE_1(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        return _mm_subs_epi8(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_1(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        return _mm_subs_epu8(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_2(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        return _mm_subs_epi16(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_2(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        return _mm_subs_epu16(x, y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_4(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        /// overflow when x and y differ in sign and the result takes the sign of y
+        __m128i r = _mm_sub_epi32(x, y);
+        __m128i o = _mm_and_si128(_mm_xor_si128(x, y), _mm_xor_si128(x, r));
+        __m128i s = _mm_xor_si128(_mm_srai_epi32(x, 31), _mm_set1_epi32(INT32_MAX));
+        return _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(r), _mm_castsi128_ps(s), _mm_castsi128_ps(o)));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_4(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        return _mm_sub_epi32(_mm_max_epu32(x, y), y);
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_8(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        __m128i r = _mm_sub_epi64(x, y);
+        __m128i o = _mm_and_si128(_mm_xor_si128(x, y), _mm_xor_si128(x, r));
+        __m128i s = _mm_xor_si128(_mm_cmpgt_epi64(_mm_setzero_si128(), x), _mm_set1_epi64x(INT64_MAX));
+        return _mm_castpd_si128(_mm_blendv_pd(_mm_castsi128_pd(r), _mm_castsi128_pd(s), _mm_castsi128_pd(o)));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_8(U) && std::is_unsigned<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        __m128i b = _mm_set1_epi64x(INT64_MIN);
+        __m128i o = _mm_cmpgt_epi64(_mm_xor_si128(y, b), _mm_xor_si128(x, b));
+        return _mm_andnot_si128(o, _mm_sub_epi64(x, y));
+    }
+};
+
+/// Q7/Q15/Q31 fixed-point multiply, rounded, -1 * -1 clamped to the max value
+template <typename T>
+struct mul_sat_functor {
+    template <typename U = T, REQUIRES(IS_INT_SIZE_1(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        /// sign extend into 16-bit lanes, the final pack does the clamping
+        __m128i r = _mm_set1_epi16(1 << 6);
+        __m128i lo = _mm_mullo_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8),
+                                     _mm_srai_epi16(_mm_unpacklo_epi8(y, y), 8));
+        __m128i hi = _mm_mullo_epi16(_mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8),
+                                     _mm_srai_epi16(_mm_unpackhi_epi8(y, y), 8));
+        return _mm_packs_epi16(_mm_srai_epi16(_mm_add_epi16(lo, r), 7),
+                               _mm_srai_epi16(_mm_add_epi16(hi, r), 7));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_2(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        /// pmulhrsw only wraps for -1 * -1, the sole way to get INT16_MIN back
+        __m128i r = _mm_mulhrs_epi16(x, y);
+        return _mm_xor_si128(r, _mm_cmpeq_epi16(r, _mm_set1_epi16(INT16_MIN)));
+    }
+    template <typename U = T, REQUIRES(IS_INT_SIZE_4(U) && std::is_signed<U>::value)>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        /// 64-bit products of the even and odd lanes, bits [31, 62] are the result
+        __m128i r = _mm_set1_epi64x(int64_t(1) << 30);
+        __m128i even = _mm_add_epi64(_mm_mul_epi32(x, y), r);
+        __m128i odd = _mm_add_epi64(_mm_mul_epi32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32)), r);
+        __m128i ret = _mm_blend_epi16(_mm_srli_epi64(even, 31), _mm_slli_epi64(odd, 1), 0xCC);
+        return _mm_xor_si128(ret, _mm_cmpeq_epi32(ret, _mm_set1_epi32(INT32_MIN)));
+    }
+};
 }  // namespace detail
 
 /// add
@@ -155,6 +299,24 @@ struct mod<T, W>
     : ops::arith_binary_op<T, W, detail::mod_functor<T>>
 {};
 
+/// add_sat
+template <typename T, size_t W>
+struct add_sat<T, W>
+    : ops::arith_binary_op<T, W, detail::add_sat_functor<T>>
+{};
+
+/// sub_sat
+template <typename T, size_t W>
+struct sub_sat<T, W>
+    : ops::arith_binary_op<T, W, detail::sub_sat_functor<T>>
+{};
+
+/// mul_sat for int8/int16/int32, int64 falls back to generic
+template <typename T, size_t W>
+struct mul_sat<T, W>
+    : ops::arith_binary_op<T, W, detail::mul_sat_functor<T>>
+{};
+
 template <typename T, size_t W>
 struct neg<T, W, REQUIRE_INTEGRAL(T)>
 {
@@ -170,4 +332,26 @@ struct neg<T, W, REQUIRE_FLOATING(T)>
     : ops::arith_unary_op<T, W, detail::neg_functor<T>>
 {};
 
+
+/// dot_u8i8: acc[i] += sum(a[4i+j] * b[4i+j]), j < 4
+/// pmaddubsw + pmaddwd: the int16 sum of each byte pair saturates,
+/// exact while |a[2k] * b[2k] + a[2k+1] * b[2k+1]| <= 32767 (e.g. |b| <= 64)
+template <size_t W>
+struct dot_u8i8<int32_t, W>
+{
+    SIMD_INLINE
+    static Vec<int32_t, W> apply(const Vec<int32_t, W>& acc, const Vec<uint8_t, 4 * W>& a, const Vec<int8_t, 4 * W>& b) noexcept
+    {
+        Vec<int32_t, W> ret;
+        constexpr auto nregs = Vec<int32_t, W>::n_regs();
+        const __m128i ones = _mm_set1_epi16(1);
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            __m128i t = _mm_madd_epi16(_mm_maddubs_epi16(a.reg(idx), b.reg(idx)), ones);
+            ret.reg(idx) = _mm_add_epi32(acc.reg(idx), t);
+        }
+        return ret;
+    }
+};
+
 } } } // namespace simd::kernel::sse
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstring>
+#include <limits>
+
 namespace simd { namespace kernel { namespace sse {
 using namespace types;
 
@@ -39,7 +42,7 @@ struct cast<float, T, W, traits::enable_if_t<sizeof(T) == 4>>
     {
         Vec<float, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_cvtepi32_ps(x.reg(idx));
         }
@@ -55,7 +58,7 @@ struct cast<double, int64_t, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = Vec<int64_t, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::_cvtepi64_pd(x.reg(idx));
         }
@@ -70,7 +73,7 @@ struct cast<double, uint64_t, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = Vec<uint64_t, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::_cvtepu64_pd(x.reg(idx));
         }
@@ -87,7 +90,7 @@ struct cast<int32_t, float, W>
     {
         Vec<int32_t, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_cvtps_epi32(x.reg(idx));
         }
@@ -104,7 +107,7 @@ struct cast<int64_t, float, W>
         Vec<int64_t, W> ret;
         constexpr auto src_nregs = Vec<float, W>::n_regs();
         constexpr auto dst_nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < src_nregs; idx++) {
             assert(0 && "not implemented yet");
         }
@@ -112,18 +115,38 @@ struct cast<int64_t, float, W>
     }
 };
 template <size_t W>
-struct cast<double, float, W>
+struct cast<double, float, W,
+    traits::enable_if_t<std::is_same<typename Vec<float, W>::register_t, sse_reg_f>::value>>
 {
     /// float => double
+    /// one float register widens into two double registers
     SIMD_INLINE
     static Vec<double, W> apply(const Vec<float, W>& x) noexcept
     {
         Vec<double, W> ret;
         constexpr auto src_nregs = Vec<float, W>::n_regs();
-        constexpr auto dst_nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < src_nregs; idx++) {
-            assert(0 && "not implemented yet");
+            ret.reg(2 * idx + 0) = _mm_cvtps_pd(x.reg(idx));
+            ret.reg(2 * idx + 1) = _mm_cvtps_pd(_mm_movehl_ps(x.reg(idx), x.reg(idx)));
+        }
+        return ret;
+    }
+};
+template <size_t W>
+struct cast<double, float, W,
+    traits::enable_if_t<!std::is_same<typename Vec<float, W>::register_t, sse_reg_f>::value>>
+{
+    /// float => double
+    /// source is less than one SSE register (Generic), two floats per double register
+    SIMD_INLINE
+    static Vec<double, W> apply(const Vec<float, W>& x) noexcept
+    {
+        Vec<double, W> ret;
+        constexpr auto dst_nregs = Vec<double, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < dst_nregs; idx++) {
+            ret.reg(idx) = _mm_cvtps_pd(_mm_setr_ps(x[2 * idx + 0], x[2 * idx + 1], 0.f, 0.f));
         }
         return ret;
     }
@@ -138,7 +161,7 @@ struct cast<int64_t, double, W>
     {
         Vec<int64_t, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             //ret.reg(idx) = detail::_cvtpd_epi64(x.reg(idx));
             assert(0 && "not implemented yet");
@@ -147,20 +170,282 @@ struct cast<int64_t, double, W>
     }
 };
 template <size_t W>
-struct cast<float, double, W>
+struct cast<float, double, W,
+    traits::enable_if_t<std::is_same<typename Vec<float, W>::register_t, sse_reg_f>::value>>
 {
     /// double => float
+    /// two double registers narrow into one float register
     SIMD_INLINE
     static Vec<float, W> apply(const Vec<double, W>& x) noexcept
     {
         Vec<float, W> ret;
-        constexpr auto src_nregs = Vec<double, W>::n_regs();
         constexpr auto dst_nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
+        for (auto idx = 0; idx < dst_nregs; idx++) {
+            ret.reg(idx) = _mm_movelh_ps(_mm_cvtpd_ps(x.reg(2 * idx + 0)),
+                                         _mm_cvtpd_ps(x.reg(2 * idx + 1)));
+        }
+        return ret;
+    }
+};
+template <size_t W>
+struct cast<float, double, W,
+    traits::enable_if_t<!std::is_same<typename Vec<float, W>::register_t, sse_reg_f>::value>>
+{
+    /// double => float
+    /// destination is less than one SSE register (Generic)
+    SIMD_INLINE
+    static Vec<float, W> apply(const Vec<double, W>& x) noexcept
+    {
+        alignas(16) float buf[W < 4 ? 4 : W];
+        constexpr auto src_nregs = Vec<double, W>::n_regs();
+        SIMD_UNROLL
         for (auto idx = 0; idx < src_nregs; idx++) {
-            assert(0 && "not implemented yet");
+            _mm_storel_pi(reinterpret_cast<__m64*>(&buf[2 * idx]), _mm_cvtpd_ps(x.reg(idx)));
+        }
+        return Vec<float, W>::load_unaligned(buf);
+    }
+};
+template <size_t W>
+struct cast<float, uint8_t, W,
+    traits::enable_if_t<std::is_same<typename Vec<float, W>::register_t, sse_reg_f>::value>>
+{
+    /// uint8 => float
+    /// 4 bytes zero-extend into each float register
+    SIMD_INLINE
+    static Vec<float, W> apply(const Vec<uint8_t, W>& x) noexcept
+    {
+        alignas(16) uint8_t buf[W < 16 ? 16 : W];
+        x.store_unaligned(buf);
+        Vec<float, W> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            int32_t b;
+            std::memcpy(&b, buf + 4 * idx, sizeof(b));
+            ret.reg(idx) = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(b)));
         }
         return ret;
     }
 };
+template <size_t W>
+struct cast<uint8_t, float, W,
+    traits::enable_if_t<std::is_same<typename Vec<float, W>::register_t, sse_reg_f>::value>>
+{
+    /// float => uint8
+    /// truncated, out of range values saturate to [0, 255]
+    SIMD_INLINE
+    static Vec<uint8_t, W> apply(const Vec<float, W>& x) noexcept
+    {
+        alignas(16) uint8_t buf[W < 16 ? 16 : W];
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            __m128i i = _mm_cvttps_epi32(x.reg(idx));
+            i = _mm_packus_epi16(_mm_packs_epi32(i, i), i);
+            int32_t b = _mm_cvtsi128_si32(i);
+            std::memcpy(buf + 4 * idx, &b, sizeof(b));
+        }
+        return Vec<uint8_t, W>::load_unaligned(buf);
+    }
+};
+
+namespace detail {
+/// narrow two registers into one, clamping each lane to the range of U:
+/// packs/packus only read signed sources, so unsigned ones are clamped first
+template <typename U, typename T>
+struct pack_sat_functor {
+    template <typename V = T, REQUIRES(IS_INT_SIZE_2(V))>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        SIMD_IF_CONSTEXPR(std::is_unsigned<T>::value) {
+            __m128i m = _mm_set1_epi16(int16_t(std::numeric_limits<U>::max()));
+            return pack(_mm_min_epu16(x, m), _mm_min_epu16(y, m));
+        }
+        return pack(x, y);
+    }
+    template <typename V = T, REQUIRES(IS_INT_SIZE_4(V))>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        SIMD_IF_CONSTEXPR(std::is_unsigned<T>::value) {
+            __m128i m = _mm_set1_epi32(int32_t(std::numeric_limits<U>::max()));
+            return pack(_mm_min_epu32(x, m), _mm_min_epu32(y, m));
+        }
+        return pack(x, y);
+    }
+    template <typename V = T, REQUIRES(IS_INT_SIZE_8(V))>
+    SIMD_INLINE
+    sse_reg_i operator ()(const sse_reg_i& x, const sse_reg_i& y) noexcept {
+        /// no 64-bit pack, clamp in place then gather the low dwords
+        return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(clamp64(x)), _mm_castsi128_ps(clamp64(y)), 0x88));
+    }
+
+private:
+    SIMD_INLINE
+    static __m128i pack(const __m128i& x, const __m128i& y) noexcept {
+        SIMD_IF_CONSTEXPR(sizeof(T) == 2 && std::is_signed<U>::value) {
+            return _mm_packs_epi16(x, y);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+            return _mm_packus_epi16(x, y);
+        } else SIMD_IF_CONSTEXPR(std::is_signed<U>::value) {
+            return _mm_packs_epi32(x, y);
+        } else {
+            return _mm_packus_epi32(x, y);
+        }
+    }
+    SIMD_INLINE
+    static __m128i clamp64(const __m128i& x) noexcept {
+        __m128i hi = _mm_set1_epi64x(int64_t(std::numeric_limits<U>::max()));
+        SIMD_IF_CONSTEXPR(std::is_signed<T>::value) {
+            __m128i lo = _mm_set1_epi64x(int64_t(std::numeric_limits<U>::min()));
+            __m128i r = _mm_blendv_epi8(x, lo, _mm_cmpgt_epi64(lo, x));
+            return _mm_blendv_epi8(r, hi, _mm_cmpgt_epi64(r, hi));
+        } else {
+            __m128i b = _mm_set1_epi64x(INT64_MIN);
+            return _mm_blendv_epi8(x, hi, _mm_cmpgt_epi64(_mm_xor_si128(x, b), _mm_xor_si128(hi, b)));
+        }
+    }
+};
+}  // namespace detail
+
+/// pack_sat
+template <typename U, typename T, size_t W>
+struct pack_sat<U, T, W>
+    : ops::pack_binary_op<U, T, W, detail::pack_sat_functor<U, T>>
+{};
+
+namespace detail {
+/// sign or zero extend (by the signedness of T) the low lanes of x from T to E
+template <typename E, typename T>
+SIMD_INLINE
+__m128i extend(const __m128i& x) noexcept
+{
+    constexpr bool s = std::is_signed<T>::value;
+    SIMD_IF_CONSTEXPR(sizeof(E) == sizeof(T)) {
+        return x;
+    } else SIMD_IF_CONSTEXPR(sizeof(T) == 1 && sizeof(E) == 2) {
+        return s ? _mm_cvtepi8_epi16(x) : _mm_cvtepu8_epi16(x);
+    } else SIMD_IF_CONSTEXPR(sizeof(T) == 1 && sizeof(E) == 4) {
+        return s ? _mm_cvtepi8_epi32(x) : _mm_cvtepu8_epi32(x);
+    } else SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
+        return s ? _mm_cvtepi8_epi64(x) : _mm_cvtepu8_epi64(x);
+    } else SIMD_IF_CONSTEXPR(sizeof(T) == 2 && sizeof(E) == 4) {
+        return s ? _mm_cvtepi16_epi32(x) : _mm_cvtepu16_epi32(x);
+    } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+        return s ? _mm_cvtepi16_epi64(x) : _mm_cvtepu16_epi64(x);
+    } else {
+        return s ? _mm_cvtepi32_epi64(x) : _mm_cvtepu32_epi64(x);
+    }
+}
+
+/// one register into K: the J-th 16 / K bytes are moved down, then extended
+/// (pmovzx / pmovsx) and converted (cvtdq2ps / cvtdq2pd) as U needs
+template <typename U, typename T>
+struct widen_functor {
+    static constexpr size_t K = sizeof(U) / sizeof(T);
+    using reg_t = typename Vec<U, 16 / sizeof(U)>::register_t;
+
+    SIMD_INLINE
+    std::array<reg_t, K> operator ()(const sse_reg_i& x) noexcept {
+        return parts(x, simd::detail::make_index_sequence<K>());
+    }
+    SIMD_INLINE
+    std::array<reg_t, K> operator ()(const sse_reg_f& x) noexcept {
+        return {{ _mm_cvtps_pd(x), _mm_cvtps_pd(_mm_movehl_ps(x, x)) }};
+    }
+
+private:
+    template <size_t... J>
+    SIMD_INLINE
+    static std::array<reg_t, K> parts(const __m128i& x, simd::detail::index_sequence<J...>) noexcept {
+        return {{ convert(part<J>(x))... }};
+    }
+    template <size_t J>
+    SIMD_INLINE
+    static __m128i part(const __m128i& x) noexcept {
+        constexpr int imm = J * 16 / K;
+        return _mm_srli_si128(x, imm);
+    }
+    template <typename V = U, REQUIRES(std::is_integral<V>::value)>
+    SIMD_INLINE
+    static reg_t convert(const __m128i& x) noexcept {
+        return extend<U, T>(x);
+    }
+    template <typename V = U, REQUIRES((std::is_same<V, float>::value))>
+    SIMD_INLINE
+    static reg_t convert(const __m128i& x) noexcept {
+        return _mm_cvtepi32_ps(extend<int32_t, T>(x));
+    }
+    template <typename V = U, REQUIRES((std::is_same<V, double>::value))>
+    SIMD_INLINE
+    static reg_t convert(const __m128i& x) noexcept {
+        return _mm_cvtepi32_pd(extend<int32_t, T>(x));
+    }
+};
+
+/// halving steps of the narrow chain
+struct narrow_policy {
+    template <typename H, typename V>
+    SIMD_INLINE
+    static __m128i pack(const __m128i& a, const __m128i& b) noexcept {
+        return pack_sat_functor<H, V>()(a, b);
+    }
+    /// keep the low bits: once masked, every lane is in range of the unsigned pack
+    template <typename H, typename V>
+    SIMD_INLINE
+    static __m128i wrap(const __m128i& a, const __m128i& b) noexcept {
+        SIMD_IF_CONSTEXPR(sizeof(V) == 8) {
+            return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), 0x88));
+        }
+        using uh_t = typename std::make_unsigned<H>::type;
+        using uv_t = typename std::make_unsigned<V>::type;
+        __m128i m = sizeof(H) == 1 ? _mm_set1_epi16(0xFF) : _mm_set1_epi32(0xFFFF);
+        return pack_sat_functor<uh_t, uv_t>()(_mm_and_si128(a, m), _mm_and_si128(b, m));
+    }
+};
+
+/// K registers into one: integral lanes through the pack chain, float lanes
+/// truncated to int32 first (clamped to the range of U when saturating),
+/// double pairs through cvtpd2ps
+template <typename U, typename T, bool S>
+struct narrow_functor {
+    static constexpr size_t K = sizeof(T) / sizeof(U);
+    using reg_t = typename Vec<T, 16 / sizeof(T)>::register_t;
+
+    SIMD_INLINE
+    sse_reg_i operator ()(const std::array<sse_reg_i, K>& x) noexcept {
+        return ops::narrow_chain<U, S, narrow_policy>::template apply<T>(x.data());
+    }
+    SIMD_INLINE
+    sse_reg_i operator ()(const std::array<sse_reg_f, K>& x) noexcept {
+        __m128i i[K];
+        SIMD_UNROLL
+        for (size_t j = 0; j < K; j++) {
+            __m128 v = x[j];
+            SIMD_IF_CONSTEXPR(S) {
+                v = _mm_min_ps(_mm_max_ps(v, _mm_set1_ps(float(std::numeric_limits<U>::min()))),
+                               _mm_set1_ps(float(std::numeric_limits<U>::max())));
+            }
+            i[j] = _mm_cvttps_epi32(v);
+        }
+        return ops::narrow_chain<U, S, narrow_policy>::template apply<int32_t>(i);
+    }
+    SIMD_INLINE
+    sse_reg_f operator ()(const std::array<sse_reg_d, K>& x) noexcept {
+        return _mm_movelh_ps(_mm_cvtpd_ps(x[0]), _mm_cvtpd_ps(x[1]));
+    }
+};
+}  // namespace detail
+
+/// widen
+template <typename U, typename T, size_t W>
+struct widen<U, T, W>
+    : ops::widen_op<U, T, W, detail::widen_functor<U, T>>
+{};
+
+/// narrow, wrapping (S = false) or saturating (S = true)
+template <typename U, typename T, size_t W, bool S>
+struct narrow<U, T, W, S>
+    : ops::narrow_op<U, T, W, detail::narrow_functor<U, T, S>>
+{};
 } } } // namespace simd::kernel::sse
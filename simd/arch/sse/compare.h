@@ -148,7 +148,7 @@ struct ne<T, W, REQUIRE_INTEGRAL(T)>
         static_check_supported_type<T>();
         VecBool<T, W> ret;
         constexpr int nregs = VecBool<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_xor_si128(lhs.reg(idx), rhs.reg(idx));
         }
@@ -198,7 +198,7 @@ struct lt<T, W, REQUIRE_INTEGRAL(T)>
         constexpr bool is_signed = std::is_signed<T>::value;
         constexpr int nregs = VecBool<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? _mm_cmplt_epi8(lhs.reg(idx), rhs.reg(idx))
@@ -208,7 +208,7 @@ struct lt<T, W, REQUIRE_INTEGRAL(T)>
                     );
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? _mm_cmplt_epi16(lhs.reg(idx), rhs.reg(idx))
@@ -218,7 +218,7 @@ struct lt<T, W, REQUIRE_INTEGRAL(T)>
                     );
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? _mm_cmplt_epi32(lhs.reg(idx), rhs.reg(idx))
@@ -228,7 +228,7 @@ struct lt<T, W, REQUIRE_INTEGRAL(T)>
                     );
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? _mm_cmpgt_epi64(rhs.reg(idx), lhs.reg(idx))
@@ -269,7 +269,7 @@ struct gt<T, W, REQUIRE_INTEGRAL(T)>
         constexpr bool is_signed = std::is_signed<T>::value;
         constexpr int nregs = VecBool<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? _mm_cmpgt_epi8(lhs.reg(idx), rhs.reg(idx))
@@ -279,7 +279,7 @@ struct gt<T, W, REQUIRE_INTEGRAL(T)>
                     );
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? _mm_cmpgt_epi16(lhs.reg(idx), rhs.reg(idx))
@@ -289,7 +289,7 @@ struct gt<T, W, REQUIRE_INTEGRAL(T)>
                     );
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? _mm_cmpgt_epi32(lhs.reg(idx), rhs.reg(idx))
@@ -299,7 +299,7 @@ struct gt<T, W, REQUIRE_INTEGRAL(T)>
                     );
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? _mm_cmpgt_epi64(lhs.reg(idx), rhs.reg(idx))
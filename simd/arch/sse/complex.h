@@ -13,7 +13,7 @@ struct broadcast<cf32_t, W>
     {
         Vec<cf32_t, W> ret;
         constexpr int nregs = Vec<cf32_t, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_set1_ps(val.real());
         }
@@ -29,7 +29,7 @@ struct broadcast<cf64_t, W>
     {
         Vec<cf64_t, W> ret;
         constexpr int nregs = Vec<cf64_t, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_set1_pd(val.real());
         }
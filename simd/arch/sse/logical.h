@@ -46,7 +46,7 @@ struct bitwise_op
     {
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = F()(lhs.reg(idx), rhs.reg(idx));
         }
@@ -88,22 +88,22 @@ struct bitwise_lshift<T, W, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = detail::bitwise_slli_epi8(x.reg(idx), y);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm_slli_epi16(x.reg(idx), y);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm_slli_epi32(x.reg(idx), y);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm_slli_epi64(x.reg(idx), y);
             }
@@ -164,28 +164,28 @@ struct bitwise_rshift<T, W, REQUIRE_INTEGRAL(T)>
         constexpr bool is_signed = std::is_signed<T>::value;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? detail::bitwise_sra_epi8(x.reg(idx), y)
                     : detail::bitwise_srl_epi8(x.reg(idx), y);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? _mm_sra_epi16(x.reg(idx), _mm_set1_epi64x(y))
                     : _mm_srl_epi16(x.reg(idx), _mm_set1_epi64x(y));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? _mm_sra_epi32(x.reg(idx), _mm_set1_epi64x(y))
                     : _mm_srl_epi32(x.reg(idx), _mm_set1_epi64x(y));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = is_signed
                     ? detail::bitwise_sra_epi64(x.reg(idx), y)
@@ -214,7 +214,7 @@ struct bitwise_not<T, W, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         auto mask = _mm_set1_epi32(-1);
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_xor_si128(x.reg(idx), mask);
         }
@@ -228,7 +228,7 @@ struct bitwise_not<T, W, REQUIRE_INTEGRAL(T)>
         VecBool<T, W> ret;
         constexpr auto nregs = VecBool<T, W>::n_regs();
         auto mask = _mm_set1_epi32(-1);
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_xor_si128(x.reg(idx), mask);
         }
@@ -245,7 +245,7 @@ struct bitwise_not<float, W>
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
         auto mask = _mm_castsi128_ps(_mm_set1_epi32(-1));
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_xor_ps(x.reg(idx), mask);
         }
@@ -257,7 +257,7 @@ struct bitwise_not<float, W>
         VecBool<float, W> ret;
         constexpr auto nregs = VecBool<float, W>::n_regs();
         auto mask = _mm_castsi128_ps(_mm_set1_epi32(-1));
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_xor_ps(x.reg(idx), mask);
         }
@@ -274,7 +274,7 @@ struct bitwise_not<double, W>
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
         auto mask = _mm_castsi128_pd(_mm_set1_epi32(-1));
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_xor_pd(x.reg(idx), mask);
         }
@@ -286,7 +286,7 @@ struct bitwise_not<double, W>
         VecBool<double, W> ret;
         constexpr auto nregs = VecBool<double, W>::n_regs();
         auto mask = _mm_castsi128_pd(_mm_set1_epi32(-1));
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_xor_pd(x.reg(idx), mask);
         }
@@ -305,7 +305,7 @@ struct bitwise_andnot<T, W, REQUIRE_INTEGRAL(T)>
 
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_andnot_si128(x.reg(idx), y.reg(idx));
         }
@@ -321,7 +321,7 @@ struct bitwise_andnot<float, W>
     {
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_andnot_ps(x.reg(idx), y.reg(idx));
         }
@@ -337,7 +337,7 @@ struct bitwise_andnot<double, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_andnot_ps(x.reg(idx), y.reg(idx));
         }
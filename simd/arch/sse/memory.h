@@ -18,22 +18,22 @@ struct broadcast<T, W, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm_set1_epi8(val);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm_set1_epi16(val);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm_set1_epi32(val);
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm_set1_epi64x(val);
             }
@@ -50,7 +50,7 @@ struct broadcast<float, W>
     {
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_set1_ps(val);
         }
@@ -66,7 +66,7 @@ struct broadcast<double, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_set1_pd(val);
         }
@@ -85,7 +85,7 @@ struct setzero<T, W, REQUIRE_INTEGRAL(T)>
 
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_setzero_si128();
         }
@@ -101,7 +101,7 @@ struct setzero<float, W>
     {
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_setzero_ps();
         }
@@ -117,7 +117,7 @@ struct setzero<double, W>
     {
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_setzero_pd();
         }
@@ -253,7 +253,7 @@ struct load_aligned<T, W, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_load_si128((const sse_reg_i*)(mem + idx * reg_lanes));
         }
@@ -270,7 +270,7 @@ struct load_aligned<float, W>
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_load_ps(mem + idx * reg_lanes);
         }
@@ -287,7 +287,7 @@ struct load_aligned<double, W>
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_load_pd(mem + idx * reg_lanes);
         }
@@ -307,7 +307,7 @@ struct load_unaligned<T, W, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_loadu_si128((const sse_reg_i*)(mem + idx * reg_lanes));
         }
@@ -324,7 +324,7 @@ struct load_unaligned<float, W>
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_loadu_ps(mem + idx * reg_lanes);
         }
@@ -341,7 +341,7 @@ struct load_unaligned<double, W>
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_loadu_pd(mem + idx * reg_lanes);
         }
@@ -360,7 +360,7 @@ struct store_aligned<T, W, REQUIRE_INTEGRAL(T)>
 
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm_store_si128((sse_reg_i*)(mem + idx * reg_lanes), x.reg(idx));
         }
@@ -375,7 +375,7 @@ struct store_aligned<float, W>
     {
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm_store_ps(mem + idx * reg_lanes, x.reg(idx));
         }
@@ -391,7 +391,7 @@ struct store_aligned<double, W>
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
 
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm_store_pd(mem + idx * reg_lanes, x.reg(idx));
         }
@@ -409,7 +409,7 @@ struct store_unaligned<T, W, REQUIRE_INTEGRAL(T)>
 
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm_storeu_si128((sse_reg_i*)(mem + idx * reg_lanes), x.reg(idx));
         }
@@ -424,7 +424,7 @@ struct store_unaligned<float, W>
     {
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm_storeu_ps(mem + idx * reg_lanes, x.reg(idx));
         }
@@ -439,13 +439,153 @@ struct store_unaligned<double, W>
     {
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             _mm_storeu_pd(mem + idx * reg_lanes, x.reg(idx));
         }
     }
 };
 
+namespace detail {
+/// the first n (1..3) 32 bits lanes from mem, the others 0: movss/movsd,
+/// which never read past mem + n
+SIMD_INLINE
+sse_reg_f load_tail32(const void* mem, size_t n) noexcept
+{
+    const float* p = (const float*)mem;
+    if (n == 1) {
+        return _mm_load_ss(p);
+    }
+    const sse_reg_f lo = _mm_castpd_ps(_mm_load_sd((const double*)p));
+    return n == 2 ? lo : _mm_movelh_ps(lo, _mm_load_ss(p + 2));
+}
+
+SIMD_INLINE
+void store_tail32(void* mem, const sse_reg_f& x, size_t n) noexcept
+{
+    float* p = (float*)mem;
+    if (n == 1) {
+        _mm_store_ss(p, x);
+        return;
+    }
+    _mm_store_sd((double*)p, _mm_castps_pd(x));
+    if (n == 3) {
+        _mm_store_ss(p + 2, _mm_movehl_ps(x, x));
+    }
+}
+}  // namespace detail
+
+/// load_masked/store_masked: whole registers, then the W lanes left on the
+/// partially used last one through movss/movsd; 8/16 bits lanes take
+/// the generic path
+template <typename T, size_t W>
+struct load_masked<T, W, ENABLE_IF((std::is_integral<T>::value && sizeof(T) >= 4))>
+{
+    SIMD_INLINE
+    static Vec<T, W> apply(const T* mem) noexcept
+    {
+        Vec<T, W> ret;
+        constexpr auto nregs = Vec<T, W>::n_regs();
+        constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            ret.reg(idx) = _mm_loadu_si128((const sse_reg_i*)(mem + idx * reg_lanes));
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        ret.reg(nregs - 1) = _mm_castps_si128(detail::load_tail32(mem + last, (W - last) * sizeof(T) / 4));
+        return ret;
+    }
+};
+
+template <size_t W>
+struct load_masked<float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const float* mem) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            ret.reg(idx) = _mm_loadu_ps(mem + idx * reg_lanes);
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        ret.reg(nregs - 1) = detail::load_tail32(mem + last, W - last);
+        return ret;
+    }
+};
+
+template <size_t W>
+struct load_masked<double, W>
+{
+    SIMD_INLINE
+    static Vec<double, W> apply(const double* mem) noexcept
+    {
+        Vec<double, W> ret;
+        constexpr auto nregs = Vec<double, W>::n_regs();
+        constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            ret.reg(idx) = _mm_loadu_pd(mem + idx * reg_lanes);
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        ret.reg(nregs - 1) = _mm_load_sd(mem + last);
+        return ret;
+    }
+};
+
+template <typename T, size_t W>
+struct store_masked<T, W, ENABLE_IF((std::is_integral<T>::value && sizeof(T) >= 4))>
+{
+    SIMD_INLINE
+    static void apply(T* mem, const Vec<T, W>& x) noexcept
+    {
+        constexpr auto nregs = Vec<T, W>::n_regs();
+        constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            _mm_storeu_si128((sse_reg_i*)(mem + idx * reg_lanes), x.reg(idx));
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        detail::store_tail32(mem + last, _mm_castsi128_ps(x.reg(nregs - 1)), (W - last) * sizeof(T) / 4);
+    }
+};
+
+template <size_t W>
+struct store_masked<float, W>
+{
+    SIMD_INLINE
+    static void apply(float* mem, const Vec<float, W>& x) noexcept
+    {
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            _mm_storeu_ps(mem + idx * reg_lanes, x.reg(idx));
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        detail::store_tail32(mem + last, x.reg(nregs - 1), W - last);
+    }
+};
+
+template <size_t W>
+struct store_masked<double, W>
+{
+    SIMD_INLINE
+    static void apply(double* mem, const Vec<double, W>& x) noexcept
+    {
+        constexpr auto nregs = Vec<double, W>::n_regs();
+        constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs - 1; idx++) {
+            _mm_storeu_pd(mem + idx * reg_lanes, x.reg(idx));
+        }
+        constexpr auto last = (nregs - 1) * reg_lanes;
+        _mm_store_sd(mem + last, x.reg(nregs - 1));
+    }
+};
+
 namespace detail {
 struct load_complex
 {
@@ -479,7 +619,7 @@ struct load_complex<T, W>
     {
         Vec<value_type, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             std::tie(ret.real(), ret.imag()) = detail::load_complex()(vlo.reg(idx), vhi.reg(idx));
         }
@@ -527,7 +667,7 @@ struct complex_packlo<T, W>
     {
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::complex_packlo()(vreal.reg(idx), vimag.reg(idx));
         }
@@ -543,7 +683,7 @@ struct complex_packhi<T, W>
     {
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = detail::complex_packhi()(vreal.reg(idx), vimag.reg(idx));
         }
@@ -608,25 +748,25 @@ struct to_mask<T, W, REQUIRE_INTEGRAL(T)>
         uint64_t ret = 0;
         constexpr int nregs = VecBool<T, W>::n_regs();
         SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
-            #pragma unroll
+            SIMD_UNROLL
             for (int idx = nregs - 1; idx >= 0; idx--) {
                 ret <<= 16;  /// 16 * elements for 16 bits
                 ret |= _mm_movemask_epi8(x.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
-            #pragma unroll
+            SIMD_UNROLL
             for (int idx = nregs - 1; idx >= 0; idx--) {
-                ret <= 8;  // 8 * elements for 8 bits
+                ret <<= 8;  // 8 * elements for 8 bits
                 ret |= detail::movemask_epi16(x.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
-            #pragma unroll
+            SIMD_UNROLL
             for (int idx = nregs - 1; idx >= 0; idx--) {
                 ret <<= 4;  // 4 * elements for 4 bits
                 ret |= detail::movemask_epi32(x.reg(idx));
             }
         } else SIMD_IF_CONSTEXPR(sizeof(T) == 8) {
-            #pragma unroll
+            SIMD_UNROLL
             for (int idx = nregs - 1; idx >= 0; idx--) {
                 ret <<= 2;  // 2 * elements for 2 bits
                 ret |= detail::movemask_epi64(x.reg(idx));
@@ -644,7 +784,7 @@ struct to_mask<float, W>
     {
         uint64_t ret = 0;
         constexpr int nregs = VecBool<float, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (int idx = nregs - 1; idx >= 0; idx--) {
             ret <<= 4;  // 4 * elements for 4 bits
             ret |= _mm_movemask_ps(x.reg(idx));
@@ -661,7 +801,7 @@ struct to_mask<double, W>
     {
         uint64_t ret = 0;
         constexpr int nregs = VecBool<double, W>::n_regs();
-        #pragma unroll
+        SIMD_UNROLL
         for (int idx = nregs - 1; idx >= 0; idx--) {
             ret <<= 2;  // 2 * elements for 2 bits
             ret |= _mm_movemask_pd(x.reg(idx));
@@ -708,7 +848,7 @@ struct from_mask<float, W>
         constexpr auto nregs = VecBool<float, W>::n_regs();
         constexpr auto reg_lanes = VecBool<float, W>::reg_lanes();
         constexpr auto lanes_mask = (1ull << reg_lanes) - 1;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_castsi128_ps(_mm_load_si128(mask_lut(x & lanes_mask)));
             x >>= reg_lanes;
@@ -741,7 +881,7 @@ struct from_mask<double, W>
         constexpr auto nregs = VecBool<double, W>::n_regs();
         constexpr auto reg_lanes = VecBool<double, W>::reg_lanes();
         constexpr auto lanes_mask = (1ull << reg_lanes) - 1;
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             ret.reg(idx) = _mm_castsi128_pd(_mm_load_si128(mask_lut(x & lanes_mask)));
             x >>= reg_lanes;
@@ -816,7 +956,7 @@ struct from_mask<T, W, REQUIRE_INTEGRAL(T)>
             constexpr auto nregs = VecBool<T, W>::n_regs();
             constexpr auto reg_lanes = VecBool<T, W>::reg_lanes();
             constexpr auto lanes_mask = (1ull << reg_lanes) - 1;
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 auto mask = x & lanes_mask;
                 ret.reg(idx) = _mm_setr_epi32(  // each one gen 4 bytes(32bits)
@@ -833,7 +973,7 @@ struct from_mask<T, W, REQUIRE_INTEGRAL(T)>
             constexpr auto nregs = VecBool<T, W>::n_regs();
             constexpr auto reg_lanes = VecBool<T, W>::reg_lanes();
             constexpr auto lanes_mask = (1ull << reg_lanes) - 1;
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 auto mask = x & lanes_mask;
                 ret.reg(idx) = _mm_set_epi64x(  // each one gen 8 bytes(64bits)
@@ -847,7 +987,7 @@ struct from_mask<T, W, REQUIRE_INTEGRAL(T)>
             VecBool<T, W> ret;
             constexpr auto nregs = VecBool<T, W>::n_regs();
             auto float_mask = sse::from_mask<float, W>::apply(x);
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm_castps_si128(float_mask.reg(idx));
             }
@@ -856,7 +996,7 @@ struct from_mask<T, W, REQUIRE_INTEGRAL(T)>
             VecBool<T, W> ret;
             constexpr auto nregs = VecBool<T, W>::n_regs();
             auto float_mask = sse::from_mask<double, W>::apply(x);
-            #pragma unroll
+            SIMD_UNROLL
             for (auto idx = 0; idx < nregs; idx++) {
                 ret.reg(idx) = _mm_castpd_si128(float_mask.reg(idx));
             }
@@ -877,7 +1017,7 @@ struct gather<T, W, U, V, REQUIRE_INTEGRAL(T)>
         Vec<T, W> ret;
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
             // TODO
         }
@@ -894,7 +1034,7 @@ struct gather<float, W, U, V>
         Vec<float, W> ret;
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
         }
         return ret;
@@ -910,7 +1050,7 @@ struct gather<double, W, U, V>
         Vec<double, W> ret;
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
         }
         return ret;
@@ -928,7 +1068,7 @@ struct scatter<T, W, U, V, REQUIRE_INTEGRAL(T)>
 
         constexpr auto nregs = Vec<T, W>::n_regs();
         constexpr auto reg_lanes = Vec<T, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
         }
     }
@@ -942,7 +1082,7 @@ struct scatter<float, W, U, V>
     {
         constexpr auto nregs = Vec<float, W>::n_regs();
         constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
         }
     }
@@ -956,9 +1096,116 @@ struct scatter<double, W, U, V>
     {
         constexpr auto nregs = Vec<double, W>::n_regs();
         constexpr auto reg_lanes = Vec<double, W>::reg_lanes();
-        #pragma unroll
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+        }
+    }
+};
+
+#if SIMD_WITH_F16C
+/// load_half/store_half: fp16 <-> fp32 via F16C, round to nearest even
+template <size_t W>
+struct load_half<float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const half* mem) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            ret.reg(idx) = _mm_cvtph_ps(_mm_loadl_epi64((const __m128i*)(mem + idx * reg_lanes)));
+        }
+        return ret;
+    }
+};
+
+template <size_t W>
+struct store_half<float, W>
+{
+    SIMD_INLINE
+    static void apply(half* mem, const Vec<float, W>& x) noexcept
+    {
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            _mm_storel_epi64((__m128i*)(mem + idx * reg_lanes), _mm_cvtps_ph(x.reg(idx), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        }
+    }
+};
+#endif
+
+namespace detail {
+/// float lanes -> bfloat16 bits in the low half of each 32-bit lane,
+/// round to nearest even, NaN made quiet
+SIMD_INLINE
+__m128i round_bf16(__m128 x) noexcept
+{
+    const __m128i xi = _mm_castps_si128(x);
+    const __m128i hi = _mm_srli_epi32(xi, 16);
+    const __m128i lsb = _mm_and_si128(hi, _mm_set1_epi32(1));
+    const __m128i r = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(xi, _mm_set1_epi32(0x7FFF)), lsb), 16);
+    const __m128i nan = _mm_castps_si128(_mm_cmpunord_ps(x, x));
+    return _mm_blendv_epi8(r, _mm_or_si128(hi, _mm_set1_epi32(0x40)), nan);
+}
+}  // namespace detail
+
+/// load_bf16/store_bf16: bfloat16 is the upper half of a float, so
+/// loading is a 16 bit shift and storing a rounding add plus a pack
+template <size_t W>
+struct load_bf16<float, W>
+{
+    SIMD_INLINE
+    static Vec<float, W> apply(const bfloat16* mem) noexcept
+    {
+        Vec<float, W> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
         for (auto idx = 0; idx < nregs; idx++) {
+            __m128i x = _mm_loadl_epi64((const sse_reg_i*)(mem + idx * reg_lanes));
+            ret.reg(idx) = _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), x));
         }
+        return ret;
+    }
+};
+
+template <size_t W>
+struct store_bf16<float, W>
+{
+    SIMD_INLINE
+    static void apply(bfloat16* mem, const Vec<float, W>& x) noexcept
+    {
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            __m128i r = detail::round_bf16(x.reg(idx));
+            _mm_storel_epi64((sse_reg_i*)(mem + idx * reg_lanes), _mm_packus_epi32(r, r));
+        }
+    }
+};
+
+/// unpack_bf16: 2W bfloat16 as W pairs, {even elements, odd elements} as float
+template <size_t W>
+struct unpack_bf16<float, W>
+{
+    SIMD_INLINE
+    static std::array<Vec<float, W>, 2> apply(const bfloat16* mem) noexcept
+    {
+        std::array<Vec<float, W>, 2> ret;
+        constexpr auto nregs = Vec<float, W>::n_regs();
+        constexpr auto reg_lanes = Vec<float, W>::reg_lanes();
+        const __m128i odd_mask = _mm_set1_epi32(0xFFFF0000);
+        SIMD_UNROLL
+        for (auto idx = 0; idx < nregs; idx++) {
+            __m128i x = _mm_loadu_si128((const sse_reg_i*)(mem + 2 * idx * reg_lanes));
+            ret[0].reg(idx) = _mm_castsi128_ps(_mm_slli_epi32(x, 16));
+            ret[1].reg(idx) = _mm_castsi128_ps(_mm_and_si128(x, odd_mask));
+        }
+        return ret;
     }
 };
 
@@ -0,0 +1,330 @@
+#pragma once
+
+namespace simd { namespace kernel { namespace sse {
+using namespace types;
+
+namespace detail {
+/// one register shuffles, P an ops::shuffle_pattern over the register lanes
+template <typename T, typename Enable = void>
+struct shuffle_regs;
+
+/// double: every two-lane pattern is one shufpd or blendpd
+template <>
+struct shuffle_regs<double>
+{
+    template <typename P>
+    SIMD_INLINE
+    static sse_reg_d permute(const sse_reg_d& x) noexcept
+    {
+        SIMD_IF_CONSTEXPR(P::identity()) {
+            return x;
+        } else {
+            constexpr int imm = P::imm_bits();
+            return _mm_shuffle_pd(x, x, imm);
+        }
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static sse_reg_d shuffle(const sse_reg_d& a, const sse_reg_d& b) noexcept
+    {
+        using X = ops::swap_sources_t<P>;
+        SIMD_IF_CONSTEXPR(P::from_a()) {
+            return permute<P>(a);
+        } else SIMD_IF_CONSTEXPR(P::from_b()) {
+            return permute<X>(b);
+        } else SIMD_IF_CONSTEXPR(P::blend()) {
+            constexpr int mask = int(P::b_mask());
+            return _mm_blend_pd(a, b, mask);
+        } else SIMD_IF_CONSTEXPR(P::halves_ab(2)) {
+            constexpr int imm = P::imm_bits();
+            return _mm_shuffle_pd(a, b, imm);
+        } else {
+            constexpr int imm = X::imm_bits();
+            return _mm_shuffle_pd(b, a, imm);
+        }
+    }
+};
+/// float: shufps / blendps / insertps / unpcklps, pairs through the pd forms
+template <>
+struct shuffle_regs<float>
+{
+    template <typename P>
+    SIMD_INLINE
+    static sse_reg_f permute(const sse_reg_f& x) noexcept
+    {
+        SIMD_IF_CONSTEXPR(P::identity()) {
+            return x;
+        } else {
+            constexpr int imm = P::imm(4, 2);
+            return _mm_shuffle_ps(x, x, imm);
+        }
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static sse_reg_f shuffle(const sse_reg_f& a, const sse_reg_f& b) noexcept
+    {
+        using X = ops::swap_sources_t<P>;
+        SIMD_IF_CONSTEXPR(P::from_a()) {
+            return permute<P>(a);
+        } else SIMD_IF_CONSTEXPR(P::from_b()) {
+            return permute<X>(b);
+        } else SIMD_IF_CONSTEXPR(P::blend()) {
+            constexpr int mask = int(P::b_mask());
+            return _mm_blend_ps(a, b, mask);
+        } else SIMD_IF_CONSTEXPR(P::unpack(4, false)) {
+            return _mm_unpacklo_ps(a, b);
+        } else SIMD_IF_CONSTEXPR(P::unpack(4, true)) {
+            return _mm_unpackhi_ps(a, b);
+        } else SIMD_IF_CONSTEXPR(X::unpack(4, false)) {
+            return _mm_unpacklo_ps(b, a);
+        } else SIMD_IF_CONSTEXPR(X::unpack(4, true)) {
+            return _mm_unpackhi_ps(b, a);
+        } else SIMD_IF_CONSTEXPR(P::halves_ab(4)) {
+            constexpr int imm = P::imm(4, 2);
+            return _mm_shuffle_ps(a, b, imm);
+        } else SIMD_IF_CONSTEXPR(X::halves_ab(4)) {
+            constexpr int imm = X::imm(4, 2);
+            return _mm_shuffle_ps(b, a, imm);
+        } else SIMD_IF_CONSTEXPR(P::shift() != 0) {
+            constexpr int imm = P::shift() * 4;
+            return _mm_castsi128_ps(_mm_alignr_epi8(_mm_castps_si128(b), _mm_castps_si128(a), imm));
+        } else SIMD_IF_CONSTEXPR(X::shift() != 0) {
+            constexpr int imm = X::shift() * 4;
+            return _mm_castsi128_ps(_mm_alignr_epi8(_mm_castps_si128(a), _mm_castps_si128(b), imm));
+        } else SIMD_IF_CONSTEXPR(P::single_b() < 4) {
+            constexpr int imm = int((P::at(P::single_b()) - 4) << 6 | P::single_b() << 4);
+            return _mm_insert_ps(a, b, imm);
+        } else {
+            return shuffle<P>(a, b, std::integral_constant<bool, P::pairs()>());
+        }
+    }
+
+private:
+    template <typename P>
+    SIMD_INLINE
+    static sse_reg_f shuffle(const sse_reg_f& a, const sse_reg_f& b, std::true_type) noexcept
+    {
+        return _mm_castpd_ps(shuffle_regs<double>::template shuffle<ops::widen_pattern_t<P>>(
+            _mm_castps_pd(a), _mm_castps_pd(b)));
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static sse_reg_f shuffle(const sse_reg_f& a, const sse_reg_f& b, std::false_type) noexcept
+    {
+        using Q = ops::local_pattern_t<P>;
+        constexpr int mask = int(P::b_mask());
+        return _mm_blend_ps(permute<Q>(a), permute<Q>(b), mask);
+    }
+};
+
+/// integers: pshufd / pshuflw / pshufhw / palignr immediates, pblendw and
+/// punpck for two sources, pshufb (+ pblendvb) for everything else
+template <typename T>
+struct shuffle_regs<T, REQUIRE_INTEGRAL(T)>
+{
+    static constexpr size_t S = sizeof(T);
+    using wide_t = typename std::conditional<S == 1, int16_t,
+                   typename std::conditional<S == 2, int32_t, int64_t>::type>::type;
+
+    template <typename P>
+    SIMD_INLINE
+    static sse_reg_i permute(const sse_reg_i& x) noexcept
+    {
+        return permute<P>(x, std::integral_constant<bool, (S < 4 && P::pairs())>());
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static sse_reg_i shuffle(const sse_reg_i& a, const sse_reg_i& b) noexcept
+    {
+        SIMD_IF_CONSTEXPR(P::from_a()) {
+            return permute<P>(a);
+        } else SIMD_IF_CONSTEXPR(P::from_b()) {
+            return permute<ops::swap_sources_t<P>>(b);
+        } else SIMD_IF_CONSTEXPR(P::blend()) {
+            return blend<P>(a, b);
+        } else SIMD_IF_CONSTEXPR(P::unpack(P::size(), false)) {
+            return unpack<T>::lo(a, b);
+        } else SIMD_IF_CONSTEXPR(P::unpack(P::size(), true)) {
+            return unpack<T>::hi(a, b);
+        } else SIMD_IF_CONSTEXPR(ops::swap_sources_t<P>::unpack(P::size(), false)) {
+            return unpack<T>::lo(b, a);
+        } else SIMD_IF_CONSTEXPR(ops::swap_sources_t<P>::unpack(P::size(), true)) {
+            return unpack<T>::hi(b, a);
+        } else SIMD_IF_CONSTEXPR(P::shift() != 0) {
+            constexpr int imm = P::shift() * S;
+            return _mm_alignr_epi8(b, a, imm);
+        } else SIMD_IF_CONSTEXPR(ops::swap_sources_t<P>::shift() != 0) {
+            constexpr int imm = ops::swap_sources_t<P>::shift() * S;
+            return _mm_alignr_epi8(a, b, imm);
+        } else SIMD_IF_CONSTEXPR(S == 4 && (P::halves_ab(4) || ops::swap_sources_t<P>::halves_ab(4))) {
+            return _mm_castps_si128(shuffle_regs<float>::template shuffle<P>(
+                _mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+        } else {
+            return shuffle<P>(a, b, std::integral_constant<bool, (S < 8 && P::pairs())>());
+        }
+    }
+
+private:
+    template <typename P>
+    SIMD_INLINE
+    static sse_reg_i permute(const sse_reg_i& x, std::true_type) noexcept
+    {
+        return shuffle_regs<wide_t>::template permute<ops::widen_pattern_t<P>>(x);
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static sse_reg_i permute(const sse_reg_i& x, std::false_type) noexcept
+    {
+        SIMD_IF_CONSTEXPR(P::identity()) {
+            return x;
+        } else SIMD_IF_CONSTEXPR(S == 4) {
+            constexpr int imm = P::imm(4, 2);
+            return _mm_shuffle_epi32(x, imm);
+        } else SIMD_IF_CONSTEXPR(S == 8) {
+            constexpr int imm = (P::at(0) % 2) * 0x0A + (P::at(1) % 2) * 0xA0 + 0x44;
+            return _mm_shuffle_epi32(x, imm);
+        } else SIMD_IF_CONSTEXPR(P::rotate() != 0) {
+            constexpr int imm = P::rotate() * S;
+            return _mm_alignr_epi8(x, x, imm);
+        } else SIMD_IF_CONSTEXPR(S == 2 && P::in_blocks(4) && P::fixed(4, 4)) {
+            constexpr int imm = P::imm(4, 2);
+            return _mm_shufflelo_epi16(x, imm);
+        } else SIMD_IF_CONSTEXPR(S == 2 && P::in_blocks(4) && P::fixed(0, 4)) {
+            constexpr int imm = P::imm(4, 2, 4);
+            return _mm_shufflehi_epi16(x, imm);
+        } else {
+            return _mm_shuffle_epi8(x, _mm_load_si128(reinterpret_cast<const sse_reg_i*>(
+                ops::shuffle_bytes<P, S, 16 / S>())));
+        }
+    }
+
+    template <typename P>
+    SIMD_INLINE
+    static sse_reg_i shuffle(const sse_reg_i& a, const sse_reg_i& b, std::true_type) noexcept
+    {
+        return shuffle_regs<wide_t>::template shuffle<ops::widen_pattern_t<P>>(a, b);
+    }
+
+    /// both sources permuted into place, then blended
+    template <typename P>
+    SIMD_INLINE
+    static sse_reg_i shuffle(const sse_reg_i& a, const sse_reg_i& b, std::false_type) noexcept
+    {
+        using Q = ops::local_pattern_t<P>;
+        return blend<P>(permute<Q>(a), permute<Q>(b));
+    }
+
+    /// lane i from b where P reads b
+    template <typename P>
+    SIMD_INLINE
+    static sse_reg_i blend(const sse_reg_i& a, const sse_reg_i& b) noexcept
+    {
+        SIMD_IF_CONSTEXPR(S == 1) {
+            return _mm_blendv_epi8(a, b, _mm_load_si128(reinterpret_cast<const sse_reg_i*>(
+                ops::blend_bytes<P, S>())));
+        } else {
+            constexpr int mask = int(P::b_mask(S / 2));
+            return _mm_blend_epi16(a, b, mask);
+        }
+    }
+};
+
+/// runtime permute: lane indices become pshufb byte indices, idx % L times
+/// the lane size plus the byte within the lane
+template <typename T>
+struct permute_regs
+{
+    static constexpr size_t S = sizeof(T);
+    static constexpr size_t L = 16 / S;
+
+    SIMD_INLINE
+    static sse_reg_i bytes(const sse_reg_i& idx) noexcept
+    {
+        SIMD_IF_CONSTEXPR(S == 1) {
+            return _mm_and_si128(idx, _mm_set1_epi8(L - 1));
+        } else {
+            constexpr int shift = S == 2 ? 1 : S == 4 ? 2 : 3;
+            sse_reg_i k = _mm_shuffle_epi8(idx, _mm_load_si128(reinterpret_cast<const sse_reg_i*>(
+                ops::lane_low_bytes<S, 16>())));
+            k = _mm_slli_epi16(_mm_and_si128(k, _mm_set1_epi8(L - 1)), shift);
+            return _mm_add_epi8(k, _mm_load_si128(reinterpret_cast<const sse_reg_i*>(
+                ops::lane_byte_offsets<S, 16>())));
+        }
+    }
+
+    SIMD_INLINE
+    static sse_reg_i permute(const sse_reg_i& x, const sse_reg_i& idx) noexcept
+    {
+        return _mm_shuffle_epi8(x, bytes(idx));
+    }
+
+    SIMD_INLINE
+    static sse_reg_f permute(const sse_reg_f& x, const sse_reg_i& idx) noexcept
+    {
+        return _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(x), bytes(idx)));
+    }
+
+    SIMD_INLINE
+    static sse_reg_d permute(const sse_reg_d& x, const sse_reg_i& idx) noexcept
+    {
+        return _mm_castsi128_pd(_mm_shuffle_epi8(_mm_castpd_si128(x), bytes(idx)));
+    }
+};
+
+/// byte table lookup: pshufb per 16-entry slice of the table, the slices
+/// selected by bits 4 and 5 of the index through pblendvb
+struct lookup_regs
+{
+    template <size_t N>
+    SIMD_INLINE
+    static sse_reg_i lookup(const uint8_t* table, const sse_reg_i& idx) noexcept
+    {
+        const sse_reg_i lo = _mm_and_si128(idx, _mm_set1_epi8(0x0F));
+        const sse_reg_i r0 = _mm_shuffle_epi8(slice(table, 0), lo);
+        SIMD_IF_CONSTEXPR(N == 16) {
+            return r0;
+        } else {
+            const sse_reg_i b4 = _mm_slli_epi16(idx, 3);
+            const sse_reg_i r01 = _mm_blendv_epi8(r0, _mm_shuffle_epi8(slice(table, 1), lo), b4);
+            SIMD_IF_CONSTEXPR(N == 32) {
+                return r01;
+            } else {
+                const sse_reg_i r23 = _mm_blendv_epi8(_mm_shuffle_epi8(slice(table, 2), lo),
+                                                      _mm_shuffle_epi8(slice(table, 3), lo), b4);
+                return _mm_blendv_epi8(r01, r23, _mm_slli_epi16(idx, 2));
+            }
+        }
+    }
+
+private:
+    SIMD_INLINE
+    static sse_reg_i slice(const uint8_t* table, size_t k) noexcept
+    {
+        return _mm_load_si128(reinterpret_cast<const sse_reg_i*>(table + 16 * k));
+    }
+};
+}  // namespace detail
+
+/// shuffle
+template <typename T, size_t W>
+struct shuffle<T, W> : ops::shuffle_op<T, W, detail::shuffle_regs<T>>
+{
+};
+
+/// permute
+template <typename T, size_t W>
+struct permute<T, W> : ops::permute_op<T, W, detail::permute_regs<T>>
+{
+};
+
+/// lookup
+template <size_t W>
+struct lookup<uint8_t, W> : ops::lookup_op<W, detail::lookup_regs>
+{
+};
+} } } // namespace simd::kernel::sse
@@ -0,0 +1,91 @@
+#pragma once
+
+namespace simd { namespace kernel { namespace sse {
+using namespace types;
+
+namespace detail {
+/// interleave the low / high halves of two registers, T-sized elements
+template <typename T, typename Enable = void>
+struct unpack;
+
+template <typename T>
+struct unpack<T, REQUIRE_INTEGRAL(T)>
+{
+    SIMD_INLINE
+    static sse_reg_i lo(const sse_reg_i& a, const sse_reg_i& b) noexcept
+    {
+        SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
+            return _mm_unpacklo_epi8(a, b);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+            return _mm_unpacklo_epi16(a, b);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
+            return _mm_unpacklo_epi32(a, b);
+        } else {
+            return _mm_unpacklo_epi64(a, b);
+        }
+    }
+    SIMD_INLINE
+    static sse_reg_i hi(const sse_reg_i& a, const sse_reg_i& b) noexcept
+    {
+        SIMD_IF_CONSTEXPR(sizeof(T) == 1) {
+            return _mm_unpackhi_epi8(a, b);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 2) {
+            return _mm_unpackhi_epi16(a, b);
+        } else SIMD_IF_CONSTEXPR(sizeof(T) == 4) {
+            return _mm_unpackhi_epi32(a, b);
+        } else {
+            return _mm_unpackhi_epi64(a, b);
+        }
+    }
+};
+
+template <>
+struct unpack<float>
+{
+    SIMD_INLINE
+    static sse_reg_f lo(const sse_reg_f& a, const sse_reg_f& b) noexcept
+    {
+        return _mm_unpacklo_ps(a, b);
+    }
+    SIMD_INLINE
+    static sse_reg_f hi(const sse_reg_f& a, const sse_reg_f& b) noexcept
+    {
+        return _mm_unpackhi_ps(a, b);
+    }
+};
+
+template <>
+struct unpack<double>
+{
+    SIMD_INLINE
+    static sse_reg_d lo(const sse_reg_d& a, const sse_reg_d& b) noexcept
+    {
+        return _mm_unpacklo_pd(a, b);
+    }
+    SIMD_INLINE
+    static sse_reg_d hi(const sse_reg_d& a, const sse_reg_d& b) noexcept
+    {
+        return _mm_unpackhi_pd(a, b);
+    }
+};
+
+/// L x L block in L registers: log2(L) rounds of unpacks
+/// 4x4 float = 8 unpcklps/unpckhps, 16x16 int8 = 64 punpck
+template <typename T>
+struct transpose_regs
+{
+    template <typename R, size_t L>
+    SIMD_INLINE
+    void operator ()(R (&r)[L]) const noexcept
+    {
+        ops::unpack_transpose<unpack<T>, L>(r);
+    }
+};
+}  // namespace detail
+
+/// transpose
+template <typename T, size_t W>
+struct transpose<T, W> : ops::transpose_op<T, W, detail::transpose_regs<T>>
+{
+};
+} } } // namespace simd::kernel::sse
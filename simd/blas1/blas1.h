@@ -0,0 +1,441 @@
+#pragma once
+
+#include "simd/simd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+/// BLAS level-1 routines over float/double arrays
+///
+/// every routine comes in two flavours:
+/// - contiguous, `op(n, ..., x, y)`: vector loops of native_lanes<T>() lanes,
+///   unrolled 4x with independent accumulators, scalar tail
+/// - strided, `op(n, ..., x, incx, y, incy)`: reference BLAS semantics,
+///   negative increments walk the array backwards starting at the end;
+///   unit strides forward to the contiguous flavour, others run scalar
+/// multiply-adds go through `simd::fmadd`, a single instruction on FMA3 arches
+namespace simd {
+namespace blas1 {
+namespace detail {
+template <typename T>
+using vec_t = Vec<T, native_lanes<T>()>;
+
+/// first element touched by a BLAS style strided walk
+template <typename T>
+SIMD_INLINE
+T* strided_begin(T* x, size_t n, ptrdiff_t inc) noexcept
+{
+    return inc >= 0 ? x : x + (1 - static_cast<ptrdiff_t>(n)) * inc;
+}
+}  // namespace detail
+
+#define REQUIRE_BLAS1_TYPE(T) \
+    REQUIRES(std::is_floating_point<T>::value)
+
+/// y = alpha * x + y
+template <typename T, REQUIRE_BLAS1_TYPE(T)>
+void axpy(size_t n, T alpha, const T* x, T* y) noexcept
+{
+    using vec_t = detail::vec_t<T>;
+    constexpr size_t W = vec_t::size();
+    const vec_t va(alpha);
+    size_t i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        SIMD_UNROLL
+        for (size_t u = 0; u < 4; u++) {
+            auto vy = fmadd(va, vec_t::load_unaligned(x + i + u * W), vec_t::load_unaligned(y + i + u * W));
+            vy.store_unaligned(y + i + u * W);
+        }
+    }
+    for (; i + W <= n; i += W) {
+        fmadd(va, vec_t::load_unaligned(x + i), vec_t::load_unaligned(y + i)).store_unaligned(y + i);
+    }
+    for (; i < n; i++) {
+        y[i] += alpha * x[i];
+    }
+}
+
+template <typename T, REQUIRE_BLAS1_TYPE(T)>
+void axpy(size_t n, T alpha, const T* x, ptrdiff_t incx, T* y, ptrdiff_t incy) noexcept
+{
+    if (incx == 1 && incy == 1) {
+        return axpy(n, alpha, x, y);
+    }
+    x = detail::strided_begin(x, n, incx);
+    y = detail::strided_begin(y, n, incy);
+    for (size_t i = 0; i < n; i++, x += incx, y += incy) {
+        *y += alpha * *x;
+    }
+}
+
+/// x = alpha * x
+template <typename T, REQUIRE_BLAS1_TYPE(T)>
+void scal(size_t n, T alpha, T* x) noexcept
+{
+    using vec_t = detail::vec_t<T>;
+    constexpr size_t W = vec_t::size();
+    const vec_t va(alpha);
+    size_t i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        SIMD_UNROLL
+        for (size_t u = 0; u < 4; u++) {
+            (va * vec_t::load_unaligned(x + i + u * W)).store_unaligned(x + i + u * W);
+        }
+    }
+    for (; i + W <= n; i += W) {
+        (va * vec_t::load_unaligned(x + i)).store_unaligned(x + i);
+    }
+    for (; i < n; i++) {
+        x[i] *= alpha;
+    }
+}
+
+/// non-positive `incx` is a no-op, as in reference BLAS
+template <typename T, REQUIRE_BLAS1_TYPE(T)>
+void scal(size_t n, T alpha, T* x, ptrdiff_t incx) noexcept
+{
+    if (incx == 1) {
+        return scal(n, alpha, x);
+    }
+    for (size_t i = 0; incx > 0 && i < n; i++, x += incx) {
+        *x *= alpha;
+    }
+}
+
+/// sum(x[i] * y[i])
+template <typename T, REQUIRE_BLAS1_TYPE(T)>
+T dot(size_t n, const T* x, const T* y) noexcept
+{
+    using vec_t = detail::vec_t<T>;
+    constexpr size_t W = vec_t::size();
+    vec_t acc0(T(0)), acc1(T(0)), acc2(T(0)), acc3(T(0));
+    size_t i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        acc0 = fmadd(vec_t::load_unaligned(x + i + 0 * W), vec_t::load_unaligned(y + i + 0 * W), acc0);
+        acc1 = fmadd(vec_t::load_unaligned(x + i + 1 * W), vec_t::load_unaligned(y + i + 1 * W), acc1);
+        acc2 = fmadd(vec_t::load_unaligned(x + i + 2 * W), vec_t::load_unaligned(y + i + 2 * W), acc2);
+        acc3 = fmadd(vec_t::load_unaligned(x + i + 3 * W), vec_t::load_unaligned(y + i + 3 * W), acc3);
+    }
+    for (; i + W <= n; i += W) {
+        acc0 = fmadd(vec_t::load_unaligned(x + i), vec_t::load_unaligned(y + i), acc0);
+    }
+    T ret = reduce_sum((acc0 + acc1) + (acc2 + acc3));
+    for (; i < n; i++) {
+        ret += x[i] * y[i];
+    }
+    return ret;
+}
+
+template <typename T, REQUIRE_BLAS1_TYPE(T)>
+T dot(size_t n, const T* x, ptrdiff_t incx, const T* y, ptrdiff_t incy) noexcept
+{
+    if (incx == 1 && incy == 1) {
+        return dot(n, x, y);
+    }
+    x = detail::strided_begin(x, n, incx);
+    y = detail::strided_begin(y, n, incy);
+    T ret{};
+    for (size_t i = 0; i < n; i++, x += incx, y += incy) {
+        ret += *x * *y;
+    }
+    return ret;
+}
+
+/// sum(|x[i]|)
+template <typename T, REQUIRE_BLAS1_TYPE(T)>
+T asum(size_t n, const T* x) noexcept
+{
+    using vec_t = detail::vec_t<T>;
+    constexpr size_t W = vec_t::size();
+    vec_t acc0(T(0)), acc1(T(0)), acc2(T(0)), acc3(T(0));
+    size_t i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        acc0 += abs(vec_t::load_unaligned(x + i + 0 * W));
+        acc1 += abs(vec_t::load_unaligned(x + i + 1 * W));
+        acc2 += abs(vec_t::load_unaligned(x + i + 2 * W));
+        acc3 += abs(vec_t::load_unaligned(x + i + 3 * W));
+    }
+    for (; i + W <= n; i += W) {
+        acc0 += abs(vec_t::load_unaligned(x + i));
+    }
+    T ret = reduce_sum((acc0 + acc1) + (acc2 + acc3));
+    for (; i < n; i++) {
+        ret += std::abs(x[i]);
+    }
+    return ret;
+}
+
+/// non-positive `incx` returns 0, as in reference BLAS
+template <typename T, REQUIRE_BLAS1_TYPE(T)>
+T asum(size_t n, const T* x, ptrdiff_t incx) noexcept
+{
+    if (incx == 1) {
+        return asum(n, x);
+    }
+    T ret{};
+    for (size_t i = 0; incx > 0 && i < n; i++, x += incx) {
+        ret += std::abs(*x);
+    }
+    return ret;
+}
+
+namespace detail {
+/// sum((scale * x[i])^2) and max(|x[i]|) in one pass
+template <typename T>
+T sum_squares(size_t n, const T* x, T scale, T& amax) noexcept
+{
+    using vec_t = vec_t<T>;
+    constexpr size_t W = vec_t::size();
+    const vec_t vs(scale);
+    vec_t acc0(T(0)), acc1(T(0)), vmax(T(0));
+    size_t i = 0;
+    for (; i + 2 * W <= n; i += 2 * W) {
+        auto x0 = vec_t::load_unaligned(x + i + 0 * W);
+        auto x1 = vec_t::load_unaligned(x + i + 1 * W);
+        vmax = max(vmax, max(abs(x0), abs(x1)));
+        x0 *= vs;
+        x1 *= vs;
+        acc0 = fmadd(x0, x0, acc0);
+        acc1 = fmadd(x1, x1, acc1);
+    }
+    for (; i + W <= n; i += W) {
+        auto x0 = vec_t::load_unaligned(x + i);
+        vmax = max(vmax, abs(x0));
+        x0 *= vs;
+        acc0 = fmadd(x0, x0, acc0);
+    }
+    T ssq = reduce_sum(acc0 + acc1);
+    amax = reduce_max(vmax);
+    for (; i < n; i++) {
+        amax = std::max(amax, std::abs(x[i]));
+        ssq += (scale * x[i]) * (scale * x[i]);
+    }
+    return ssq;
+}
+}  // namespace detail
+
+/// sqrt(sum(x[i]^2)) without intermediate overflow/underflow
+/// the first pass squares unscaled; only when that overflowed or fell into
+/// the range where squares lose precision, a second pass reruns it scaled
+/// by a power of two (exact) derived from max(|x[i]|)
+template <typename T, REQUIRE_BLAS1_TYPE(T)>
+T nrm2(size_t n, const T* x) noexcept
+{
+    T amax{};
+    T ssq = detail::sum_squares(n, x, T(1), amax);
+    constexpr T tiny = std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon();
+    if (std::isfinite(ssq) && (ssq >= tiny || amax == T(0))) {
+        return std::sqrt(ssq);
+    }
+    if (!std::isfinite(amax)) {
+        return amax;  /// inf or nan
+    }
+    /// bring max(|x|) into [0.5, 1); a subnormal max takes the largest
+    /// finite power of two instead, its squares are still normal
+    int e;
+    std::frexp(amax, &e);
+    e = std::max(e, 1 - std::numeric_limits<T>::max_exponent);
+    T scale = std::ldexp(T(1), -e);
+    ssq = detail::sum_squares(n, x, scale, amax);
+    return std::sqrt(ssq) / scale;
+}
+
+template <typename T, REQUIRE_BLAS1_TYPE(T)>
+T nrm2(size_t n, const T* x, ptrdiff_t incx) noexcept
+{
+    if (incx == 1) {
+        return nrm2(n, x);
+    }
+    /// strided: classic one pass scale/ssq update
+    T scale{}, ssq = T(1);
+    for (size_t i = 0; incx > 0 && i < n; i++, x += incx) {
+        T ax = std::abs(*x);
+        if (ax == T(0)) {
+            continue;
+        }
+        if (scale < ax) {
+            ssq = T(1) + ssq * (scale / ax) * (scale / ax);
+            scale = ax;
+        } else {
+            ssq += (ax / scale) * (ax / scale);
+        }
+    }
+    return scale * std::sqrt(ssq);
+}
+
+/// index (0 based) of the first element with the largest |x[i]|, 0 if n == 0
+/// blocks are scanned with vector max, only the winning block is rescanned
+template <typename T, REQUIRE_BLAS1_TYPE(T)>
+size_t iamax(size_t n, const T* x) noexcept
+{
+    using vec_t = detail::vec_t<T>;
+    constexpr size_t W = vec_t::size();
+    constexpr size_t block = 64 * W;
+
+    T best = T(-1);
+    size_t best_begin = 0;
+    size_t i = 0;
+    for (; i + block <= n; i += block) {
+        vec_t m0 = abs(vec_t::load_unaligned(x + i));
+        vec_t m1 = abs(vec_t::load_unaligned(x + i + W));
+        for (size_t j = 2 * W; j < block; j += 2 * W) {
+            m0 = max(m0, abs(vec_t::load_unaligned(x + i + j)));
+            m1 = max(m1, abs(vec_t::load_unaligned(x + i + j + W)));
+        }
+        T m = reduce_max(max(m0, m1));
+        if (m > best) {
+            best = m;
+            best_begin = i;
+        }
+    }
+    size_t best_end = best_begin + block;
+    for (; i < n; i++) {
+        T a = std::abs(x[i]);
+        if (a > best) {
+            best = a;
+            best_begin = i;
+            best_end = i + 1;
+        }
+    }
+    for (size_t j = best_begin; j < best_end && j < n; j++) {
+        if (std::abs(x[j]) == best) {
+            return j;
+        }
+    }
+    return 0;
+}
+
+/// non-positive `incx` returns 0
+template <typename T, REQUIRE_BLAS1_TYPE(T)>
+size_t iamax(size_t n, const T* x, ptrdiff_t incx) noexcept
+{
+    if (incx == 1) {
+        return iamax(n, x);
+    }
+    size_t ret = 0;
+    T best = T(-1);
+    for (size_t i = 0; incx > 0 && i < n; i++, x += incx) {
+        if (std::abs(*x) > best) {
+            best = std::abs(*x);
+            ret = i;
+        }
+    }
+    return ret;
+}
+
+/// plane rotation
+/// x[i] =  c * x[i] + s * y[i]
+/// y[i] = -s * x[i] + c * y[i]
+template <typename T, REQUIRE_BLAS1_TYPE(T)>
+void rot(size_t n, T* x, T* y, T c, T s) noexcept
+{
+    using vec_t = detail::vec_t<T>;
+    constexpr size_t W = vec_t::size();
+    const vec_t vc(c), vs(s);
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        auto vx = vec_t::load_unaligned(x + i);
+        auto vy = vec_t::load_unaligned(y + i);
+        fmadd(vc, vx, vs * vy).store_unaligned(x + i);
+        fmsub(vc, vy, vs * vx).store_unaligned(y + i);
+    }
+    for (; i < n; i++) {
+        T tx = x[i], ty = y[i];
+        x[i] = c * tx + s * ty;
+        y[i] = c * ty - s * tx;
+    }
+}
+
+template <typename T, REQUIRE_BLAS1_TYPE(T)>
+void rot(size_t n, T* x, ptrdiff_t incx, T* y, ptrdiff_t incy, T c, T s) noexcept
+{
+    if (incx == 1 && incy == 1) {
+        return rot(n, x, y, c, s);
+    }
+    x = detail::strided_begin(x, n, incx);
+    y = detail::strided_begin(y, n, incy);
+    for (size_t i = 0; i < n; i++, x += incx, y += incy) {
+        T tx = *x, ty = *y;
+        *x = c * tx + s * ty;
+        *y = c * ty - s * tx;
+    }
+}
+
+/// fp16 storage, fp32 compute: halves are widened on load, accumulated
+/// in float and rounded back to nearest even on store, which halves the
+/// memory traffic of the float flavour on bandwidth bound sizes
+
+/// y = alpha * x + y
+inline void axpy(size_t n, float alpha, const half* x, half* y) noexcept
+{
+    using vec_t = detail::vec_t<float>;
+    constexpr size_t W = vec_t::size();
+    const vec_t va(alpha);
+    size_t i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        SIMD_UNROLL
+        for (size_t u = 0; u < 4; u++) {
+            store_half(y + i + u * W, fmadd(va, load_half<W>(x + i + u * W), load_half<W>(y + i + u * W)));
+        }
+    }
+    for (; i + W <= n; i += W) {
+        store_half(y + i, fmadd(va, load_half<W>(x + i), load_half<W>(y + i)));
+    }
+    for (; i < n; i++) {
+        y[i] = half(alpha * float(x[i]) + float(y[i]));
+    }
+}
+
+/// sum(x[i] * y[i]), accumulated in float
+inline float dot(size_t n, const half* x, const half* y) noexcept
+{
+    using vec_t = detail::vec_t<float>;
+    constexpr size_t W = vec_t::size();
+    vec_t acc0(0.f), acc1(0.f), acc2(0.f), acc3(0.f);
+    size_t i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        acc0 = fmadd(load_half<W>(x + i + 0 * W), load_half<W>(y + i + 0 * W), acc0);
+        acc1 = fmadd(load_half<W>(x + i + 1 * W), load_half<W>(y + i + 1 * W), acc1);
+        acc2 = fmadd(load_half<W>(x + i + 2 * W), load_half<W>(y + i + 2 * W), acc2);
+        acc3 = fmadd(load_half<W>(x + i + 3 * W), load_half<W>(y + i + 3 * W), acc3);
+    }
+    for (; i + W <= n; i += W) {
+        acc0 = fmadd(load_half<W>(x + i), load_half<W>(y + i), acc0);
+    }
+    float ret = reduce_sum((acc0 + acc1) + (acc2 + acc3));
+    for (; i < n; i++) {
+        ret += float(x[i]) * float(y[i]);
+    }
+    return ret;
+}
+
+/// bfloat16 storage, fp32 accumulation: pairs go through `dot_bf16`
+inline float dot(size_t n, const bfloat16* x, const bfloat16* y) noexcept
+{
+    using vec_t = detail::vec_t<float>;
+    constexpr size_t W = vec_t::size();
+    constexpr size_t S = 2 * W;  /// bfloat16 per dot_bf16 step
+    vec_t acc0(0.f), acc1(0.f), acc2(0.f), acc3(0.f);
+    size_t i = 0;
+    for (; i + 4 * S <= n; i += 4 * S) {
+        acc0 = dot_bf16(acc0, x + i + 0 * S, y + i + 0 * S);
+        acc1 = dot_bf16(acc1, x + i + 1 * S, y + i + 1 * S);
+        acc2 = dot_bf16(acc2, x + i + 2 * S, y + i + 2 * S);
+        acc3 = dot_bf16(acc3, x + i + 3 * S, y + i + 3 * S);
+    }
+    for (; i + S <= n; i += S) {
+        acc0 = dot_bf16(acc0, x + i, y + i);
+    }
+    float ret = reduce_sum((acc0 + acc1) + (acc2 + acc3));
+    for (; i < n; i++) {
+        ret += float(x[i]) * float(y[i]);
+    }
+    return ret;
+}
+
+#undef REQUIRE_BLAS1_TYPE
+}  // namespace blas1
+}  // namespace simd
@@ -0,0 +1,240 @@
+#pragma once
+
+#include "simd/simd.h"
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+
+namespace simd {
+namespace bulk {
+/// element-wise ops over std::complex<T> arrays
+///
+/// each op picks the register layout that suits its instruction mix:
+/// - mul, mul_conj, fmadd run on VecInterleaved, native_lanes / 2
+///   elements per register: plain loads / stores, 2 in-lane shuffles
+///   + 2 FMA per register
+/// - div, norm and the functions (abs, arg, exp, log, sqrt, polar) run
+///   on the split Vec<std::complex<T>, W>: division would compute every
+///   quotient twice on duplicated lanes, and the rest produce or take
+///   real arrays or work on re / im separately, so the deinterleave is
+///   paid once and every lane op does useful work
+///
+/// measured with examples/complex_mul_bench (float, n = 4096), interleaved
+/// mul vs. the split kernel behind a deinterleaving load and store: 1.9x
+/// on AVX2 + FMA, 1.25x on AVX512; split div vs. interleaved div: 1.05x
+/// on AVX2 + FMA, 1.5x on AVX512.
+/// `out` may alias any input.
+namespace detail {
+template <typename T>
+std::complex<T> mul(const std::complex<T>& x, const std::complex<T>& y) noexcept
+{
+    return std::complex<T>(x.real() * y.real() - x.imag() * y.imag(),
+                           x.real() * y.imag() + x.imag() * y.real());
+}
+
+template <typename T>
+std::complex<T> div(const std::complex<T>& x, const std::complex<T>& y) noexcept
+{
+    if (std::abs(y.real()) >= std::abs(y.imag())) {
+        const T r = y.imag() / y.real();
+        const T inv = T(1) / (y.real() + y.imag() * r);
+        return std::complex<T>((x.real() + x.imag() * r) * inv, (x.imag() - x.real() * r) * inv);
+    }
+    const T r = y.real() / y.imag();
+    const T inv = T(1) / (y.real() * r + y.imag());
+    return std::complex<T>((x.real() * r + x.imag()) * inv, (x.imag() * r - x.real()) * inv);
+}
+}  // namespace detail
+
+/// out[i] = a[i] * b[i]
+template <typename T,
+    REQUIRES(std::is_floating_point<T>::value)
+>
+void mul(size_t n, const std::complex<T>* a, const std::complex<T>* b, std::complex<T>* out) noexcept
+{
+    constexpr size_t W = native_lanes<T>() / 2;
+    using vec_t = VecInterleaved<std::complex<T>, W>;
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        (vec_t::load_unaligned(a + i) * vec_t::load_unaligned(b + i)).store_unaligned(out + i);
+    }
+    for (; i < n; i++) {
+        out[i] = detail::mul(a[i], b[i]);
+    }
+}
+
+/// out[i] = a[i] * conj(b[i])
+template <typename T,
+    REQUIRES(std::is_floating_point<T>::value)
+>
+void mul_conj(size_t n, const std::complex<T>* a, const std::complex<T>* b, std::complex<T>* out) noexcept
+{
+    constexpr size_t W = native_lanes<T>() / 2;
+    using vec_t = VecInterleaved<std::complex<T>, W>;
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        simd::mul_conj(vec_t::load_unaligned(a + i), vec_t::load_unaligned(b + i)).store_unaligned(out + i);
+    }
+    for (; i < n; i++) {
+        out[i] = detail::mul(a[i], std::conj(b[i]));
+    }
+}
+
+/// out[i] = a[i] * b[i] + c[i]
+template <typename T,
+    REQUIRES(std::is_floating_point<T>::value)
+>
+void fmadd(size_t n, const std::complex<T>* a, const std::complex<T>* b, const std::complex<T>* c,
+           std::complex<T>* out) noexcept
+{
+    constexpr size_t W = native_lanes<T>() / 2;
+    using vec_t = VecInterleaved<std::complex<T>, W>;
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        simd::fmadd(vec_t::load_unaligned(a + i), vec_t::load_unaligned(b + i),
+                    vec_t::load_unaligned(c + i)).store_unaligned(out + i);
+    }
+    for (; i < n; i++) {
+        out[i] = detail::mul(a[i], b[i]) + c[i];
+    }
+}
+
+/// out[i] = a[i] / b[i], Smith's algorithm (no overflow in |b|^2)
+template <typename T,
+    REQUIRES(std::is_floating_point<T>::value)
+>
+void div(size_t n, const std::complex<T>* a, const std::complex<T>* b, std::complex<T>* out) noexcept
+{
+    constexpr size_t W = native_lanes<T>();
+    using vec_t = Vec<std::complex<T>, W>;
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        (vec_t::load_unaligned(a + i) / vec_t::load_unaligned(b + i)).store_unaligned(out + i);
+    }
+    for (; i < n; i++) {
+        out[i] = detail::div(a[i], b[i]);
+    }
+}
+
+/// out[i] = |a[i]|^2, as std::norm
+template <typename T,
+    REQUIRES(std::is_floating_point<T>::value)
+>
+void norm(size_t n, const std::complex<T>* a, T* out) noexcept
+{
+    constexpr size_t W = native_lanes<T>();
+    using vec_t = Vec<std::complex<T>, W>;
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        const vec_t x = vec_t::load_unaligned(a + i);
+        simd::fmadd(x.real(), x.real(), x.imag() * x.imag()).store_unaligned(out + i);
+    }
+    for (; i < n; i++) {
+        out[i] = a[i].real() * a[i].real() + a[i].imag() * a[i].imag();
+    }
+}
+/// out[i] = |a[i]|, as std::abs, no overflow in re^2 + im^2
+template <typename T,
+    REQUIRES(std::is_floating_point<T>::value)
+>
+void abs(size_t n, const std::complex<T>* a, T* out) noexcept
+{
+    constexpr size_t W = native_lanes<T>();
+    using vec_t = Vec<std::complex<T>, W>;
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        simd::abs(vec_t::load_unaligned(a + i)).store_unaligned(out + i);
+    }
+    for (; i < n; i++) {
+        out[i] = std::abs(a[i]);
+    }
+}
+
+/// out[i] = arg(a[i]) in [-pi, pi]
+template <typename T,
+    REQUIRES(std::is_floating_point<T>::value)
+>
+void arg(size_t n, const std::complex<T>* a, T* out) noexcept
+{
+    constexpr size_t W = native_lanes<T>();
+    using vec_t = Vec<std::complex<T>, W>;
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        simd::arg(vec_t::load_unaligned(a + i)).store_unaligned(out + i);
+    }
+    for (; i < n; i++) {
+        out[i] = std::arg(a[i]);
+    }
+}
+
+/// out[i] = exp(a[i])
+template <typename T,
+    REQUIRES(std::is_floating_point<T>::value)
+>
+void exp(size_t n, const std::complex<T>* a, std::complex<T>* out) noexcept
+{
+    constexpr size_t W = native_lanes<T>();
+    using vec_t = Vec<std::complex<T>, W>;
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        simd::exp(vec_t::load_unaligned(a + i)).store_unaligned(out + i);
+    }
+    for (; i < n; i++) {
+        out[i] = std::exp(a[i]);
+    }
+}
+
+/// out[i] = log(a[i]), principal branch
+template <typename T,
+    REQUIRES(std::is_floating_point<T>::value)
+>
+void log(size_t n, const std::complex<T>* a, std::complex<T>* out) noexcept
+{
+    constexpr size_t W = native_lanes<T>();
+    using vec_t = Vec<std::complex<T>, W>;
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        simd::log(vec_t::load_unaligned(a + i)).store_unaligned(out + i);
+    }
+    for (; i < n; i++) {
+        out[i] = std::log(a[i]);
+    }
+}
+
+/// out[i] = sqrt(a[i]), principal root
+template <typename T,
+    REQUIRES(std::is_floating_point<T>::value)
+>
+void sqrt(size_t n, const std::complex<T>* a, std::complex<T>* out) noexcept
+{
+    constexpr size_t W = native_lanes<T>();
+    using vec_t = Vec<std::complex<T>, W>;
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        simd::sqrt(vec_t::load_unaligned(a + i)).store_unaligned(out + i);
+    }
+    for (; i < n; i++) {
+        out[i] = std::sqrt(a[i]);
+    }
+}
+
+/// out[i] = rho[i] * (cos(theta[i]) + sin(theta[i])i), as std::polar
+template <typename T,
+    REQUIRES(std::is_floating_point<T>::value)
+>
+void polar(size_t n, const T* rho, const T* theta, std::complex<T>* out) noexcept
+{
+    constexpr size_t W = native_lanes<T>();
+    using vec_t = Vec<T, W>;
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        simd::polar(vec_t::load_unaligned(rho + i), vec_t::load_unaligned(theta + i)).store_unaligned(out + i);
+    }
+    for (; i < n; i++) {
+        out[i] = std::polar(rho[i], theta[i]);
+    }
+}
+}  // namespace bulk
+}  // namespace simd
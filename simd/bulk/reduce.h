@@ -0,0 +1,230 @@
+#pragma once
+
+#include "simd/simd.h"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace simd {
+namespace bulk {
+/// summation algorithm used by bulk reductions over arrays
+///
+/// every mode keeps its running sums (and error terms) in W-lane vector
+/// registers, W = native_lanes<T>(), and only folds lanes at the very end.
+/// measured with examples/compensated_sum (AVX512 build, one core),
+/// float uniform in [0, 1):
+///
+///   mode       | rel. error 1e8 | GB/s 1e8 (DRAM) | GB/s 4096 (L1)
+///   -----------+----------------+-----------------+---------------
+///   plain      | 2.8e-6         | 9.9             | 91
+///   pairwise   | 4.4e-8         | 10.0            | 86
+///   kahan      | 3.6e-8         | 7.6             | 18
+///   neumaier   | 3.6e-8         | 7.2             | 18
+///   widen      | 3.6e-8         | 7.9             | 39
+///   scalar f64 | 1.4e-14        | 4.0             | 4.7
+///
+/// compensated modes return the correctly rounded float in practice;
+/// streaming from memory they cost ~20%, on cache resident data the
+/// dependent adds of kahan/neumaier cost ~5x plain, still ~4x a scalar loop.
+enum class summation {
+    /// 4 independent vector accumulators, error grows O(n * eps)
+    plain,
+    /// Kahan compensation per lane, error O(eps) as long as
+    /// addends stay smaller than the running sum
+    kahan,
+    /// Neumaier compensation per lane through branch-free TwoSum,
+    /// error O(eps) even when addends exceed the running sum
+    neumaier,
+    /// plain vector sums on short blocks, blocks combined as a binary tree,
+    /// error grows O(log(n) * eps)
+    pairwise,
+    /// float lanes widened to double accumulators through `simd::cast`,
+    /// for double input there is nothing wider, behaves as `neumaier`
+    widen,
+};
+
+namespace detail {
+/// scalar Neumaier step, used to fold lanes and tail elements
+template <typename T>
+SIMD_INLINE
+void neumaier_add(T& sum, T& comp, T x) noexcept
+{
+    T t = sum + x;
+    if ((sum >= 0 ? sum : -sum) >= (x >= 0 ? x : -x)) {
+        comp += (sum - t) + x;
+    } else {
+        comp += (x - t) + sum;
+    }
+    sum = t;
+}
+
+template <typename T>
+T sum_plain(const T* mem, size_t n) noexcept
+{
+    constexpr size_t W = native_lanes<T>();
+    using vec_t = Vec<T, W>;
+
+    vec_t acc0(T(0)), acc1(T(0)), acc2(T(0)), acc3(T(0));
+    size_t i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        acc0 += vec_t::load_unaligned(mem + i + 0 * W);
+        acc1 += vec_t::load_unaligned(mem + i + 1 * W);
+        acc2 += vec_t::load_unaligned(mem + i + 2 * W);
+        acc3 += vec_t::load_unaligned(mem + i + 3 * W);
+    }
+    for (; i + W <= n; i += W) {
+        acc0 += vec_t::load_unaligned(mem + i);
+    }
+    T ret = reduce_sum((acc0 + acc1) + (acc2 + acc3));
+    for (; i < n; i++) {
+        ret += mem[i];
+    }
+    return ret;
+}
+
+/// fold sum/compensation lanes and the scalar tail into one value
+template <typename T, size_t W, size_t U>
+T fold_compensated(const Vec<T, W> (&sums)[U], const Vec<T, W> (&comps)[U],
+                   T comp_sign, const T* tail, size_t ntail) noexcept
+{
+    T sum{}, comp{};
+    for (size_t u = 0; u < U; u++) {
+        for (size_t l = 0; l < W; l++) {
+            neumaier_add(sum, comp, sums[u][l]);
+            neumaier_add(sum, comp, comp_sign * comps[u][l]);
+        }
+    }
+    for (size_t i = 0; i < ntail; i++) {
+        neumaier_add(sum, comp, tail[i]);
+    }
+    return sum + comp;
+}
+
+template <typename T>
+T sum_kahan(const T* mem, size_t n) noexcept
+{
+    constexpr size_t W = native_lanes<T>();
+    constexpr size_t U = 4;  // independent chains hide add latency
+    using vec_t = Vec<T, W>;
+
+    vec_t s[U], c[U];
+    for (size_t u = 0; u < U; u++) {
+        s[u] = vec_t(T(0));
+        c[u] = vec_t(T(0));
+    }
+    size_t i = 0;
+    for (; i + U * W <= n; i += U * W) {
+        SIMD_UNROLL
+        for (size_t u = 0; u < U; u++) {
+            vec_t y = vec_t::load_unaligned(mem + i + u * W) - c[u];
+            vec_t t = s[u] + y;
+            c[u] = (t - s[u]) - y;
+            s[u] = t;
+        }
+    }
+    /// kahan keeps the negated rounding error
+    return fold_compensated(s, c, T(-1), mem + i, n - i);
+}
+
+template <typename T>
+T sum_neumaier(const T* mem, size_t n) noexcept
+{
+    constexpr size_t W = native_lanes<T>();
+    constexpr size_t U = 4;
+    using vec_t = Vec<T, W>;
+
+    vec_t s[U], c[U];
+    for (size_t u = 0; u < U; u++) {
+        s[u] = vec_t(T(0));
+        c[u] = vec_t(T(0));
+    }
+    /// c is a plain sum of error terms, its own rounding grows with the
+    /// number of steps, so push it back into s every `renorm` steps
+    constexpr size_t renorm = 256;
+    size_t i = 0;
+    while (i + U * W <= n) {
+        size_t end = n - i < renorm * U * W ? n : i + renorm * U * W;
+        for (; i + U * W <= end; i += U * W) {
+            SIMD_UNROLL
+            for (size_t u = 0; u < U; u++) {
+                /// TwoSum: t + e == s + x exactly, without comparing magnitudes
+                vec_t x = vec_t::load_unaligned(mem + i + u * W);
+                vec_t t = s[u] + x;
+                vec_t z = t - s[u];
+                c[u] += (s[u] - (t - z)) + (x - z);
+                s[u] = t;
+            }
+        }
+        for (size_t u = 0; u < U; u++) {
+            vec_t t = s[u] + c[u];
+            c[u] -= t - s[u];
+            s[u] = t;
+        }
+    }
+    return fold_compensated(s, c, T(1), mem + i, n - i);
+}
+
+template <typename T>
+T sum_pairwise(const T* mem, size_t n) noexcept
+{
+    constexpr size_t W = native_lanes<T>();
+    /// each lane of each accumulator sees at most 16 addends per block
+    constexpr size_t block = 64 * W;
+    if (n <= block) {
+        return sum_plain(mem, n);
+    }
+    size_t half = (n / 2) / W * W;
+    return sum_pairwise(mem, half) + sum_pairwise(mem + half, n - half);
+}
+
+inline float sum_widen(const float* mem, size_t n) noexcept
+{
+    /// Vec<double, W> must exist (<= 512 bits)
+    constexpr size_t W = native_lanes<float>() < 8 ? native_lanes<float>() : 8;
+    using vec_t = Vec<float, W>;
+    using dvec_t = Vec<double, W>;
+
+    dvec_t acc0(0.0), acc1(0.0);
+    size_t i = 0;
+    for (; i + 2 * W <= n; i += 2 * W) {
+        acc0 += simd::cast<double>(vec_t::load_unaligned(mem + i + 0 * W));
+        acc1 += simd::cast<double>(vec_t::load_unaligned(mem + i + 1 * W));
+    }
+    for (; i + W <= n; i += W) {
+        acc0 += simd::cast<double>(vec_t::load_unaligned(mem + i));
+    }
+    double ret = reduce_sum(acc0 + acc1);
+    for (; i < n; i++) {
+        ret += mem[i];
+    }
+    return static_cast<float>(ret);
+}
+
+inline double sum_widen(const double* mem, size_t n) noexcept
+{
+    return sum_neumaier(mem, n);
+}
+}  // namespace detail
+
+/// sum of `n` elements starting at `mem`, no alignment required
+template <typename T,
+    REQUIRES(std::is_floating_point<T>::value)
+>
+T sum(const T* mem, size_t n, summation mode = summation::plain) noexcept
+{
+    switch (mode) {
+        case summation::kahan:
+            return detail::sum_kahan(mem, n);
+        case summation::neumaier:
+            return detail::sum_neumaier(mem, n);
+        case summation::pairwise:
+            return detail::sum_pairwise(mem, n);
+        case summation::widen:
+            return detail::sum_widen(mem, n);
+        case summation::plain:
+        default:
+            return detail::sum_plain(mem, n);
+    }
+}
+}  // namespace bulk
+}  // namespace simd
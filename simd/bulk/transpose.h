@@ -0,0 +1,101 @@
+#pragma once
+
+#include "simd/simd.h"
+
+#include <array>
+#include <cstddef>
+
+namespace simd {
+namespace bulk {
+namespace detail {
+/// W x W tile: W row loads, in-register `simd::transpose`, W row stores
+template <typename T, size_t W>
+SIMD_INLINE
+void transpose_tile(const T* in, size_t ld_in, T* out, size_t ld_out) noexcept
+{
+    std::array<Vec<T, W>, W> rows;
+    for (size_t i = 0; i < W; i++) {
+        rows[i] = Vec<T, W>::load_unaligned(in + i * ld_in);
+    }
+    simd::transpose(rows);
+    for (size_t i = 0; i < W; i++) {
+        rows[i].store_unaligned(out + i * ld_out);
+    }
+}
+
+/// block small enough for its source rows and destination rows to stay
+/// in L1 while being walked: full tiles through registers, ragged edges scalar
+template <typename T, size_t W>
+void transpose_leaf(size_t rows, size_t cols, const T* in, size_t ld_in, T* out, size_t ld_out) noexcept
+{
+    const size_t rw = rows / W * W;
+    const size_t cw = cols / W * W;
+    for (size_t i = 0; i < rw; i += W) {
+        for (size_t j = 0; j < cw; j += W) {
+            transpose_tile<T, W>(in + i * ld_in + j, ld_in, out + j * ld_out + i, ld_out);
+        }
+    }
+    for (size_t i = 0; i < rows; i++) {
+        for (size_t j = (i < rw ? cw : 0); j < cols; j++) {
+            out[j * ld_out + i] = in[i * ld_in + j];
+        }
+    }
+}
+
+/// cache-oblivious recursion: halve the longer side, on a multiple of W so
+/// every leaf but the last along each side is made of full tiles
+template <typename T, size_t W>
+void transpose_rec(size_t rows, size_t cols, const T* in, size_t ld_in, T* out, size_t ld_out) noexcept
+{
+    constexpr size_t leaf = 4 * W;
+    while (rows > leaf || cols > leaf) {
+        if (rows >= cols) {
+            size_t h = rows / 2 / W * W;
+            transpose_rec<T, W>(h, cols, in, ld_in, out, ld_out);
+            in += h * ld_in;
+            out += h;
+            rows -= h;
+        } else {
+            size_t h = cols / 2 / W * W;
+            transpose_rec<T, W>(rows, h, in, ld_in, out, ld_out);
+            in += h;
+            out += h * ld_out;
+            cols -= h;
+        }
+    }
+    transpose_leaf<T, W>(rows, cols, in, ld_in, out, ld_out);
+}
+}  // namespace detail
+
+/// out = in^T, `in` is rows x cols row-major with leading dimension ld_in,
+/// `out` is cols x rows row-major with leading dimension ld_out;
+/// in and out must not overlap
+///
+/// recursive halving down to (4W)^2 blocks, W = native_lanes<T>(), which are
+/// transposed as W x W register tiles, so each block's source and destination
+/// rows stay cache resident where a naive loop strides one side by a full row.
+/// at n = 4096 the page-sized row stride still costs TLB and set conflicts.
+/// measured with examples/transpose (AVX2 build,
+/// float, one core):
+///
+///   n x n | naive GB/s | simd GB/s
+///   ------+------------+----------
+///   64    | 19         | 40
+///   256   | 2.2        | 17
+///   1000  | 3.8        | 8.4
+///   1024  | 0.75       | 5.9
+///   4096  | 0.52       | 2.0
+template <typename T>
+void transpose(size_t rows, size_t cols, const T* in, size_t ld_in, T* out, size_t ld_out) noexcept
+{
+    detail::transpose_rec<T, native_lanes<T>()>(rows, cols, in, ld_in, out, ld_out);
+}
+
+/// packed rows x cols matrix
+template <typename T>
+void transpose(size_t rows, size_t cols, const T* in, T* out) noexcept
+{
+    transpose(rows, cols, in, cols, out, rows);
+}
+}  // namespace bulk
+}  // namespace simd
@@ -33,6 +33,16 @@
 #define SIMD_WITH_FMA3_AVX2 0
 #endif  // __FMA__
 
+/// -mf16c: vcvtph2ps / vcvtps2ph half <-> float conversions
+/// define SIMD_WITH_F16C to 0 beforehand to use the scalar bit conversion
+#ifndef SIMD_WITH_F16C
+#if defined(__F16C__)
+#define SIMD_WITH_F16C 1
+#else
+#define SIMD_WITH_F16C 0
+#endif
+#endif  // SIMD_WITH_F16C
+
 /// compiler flags below enable these macro definitions
 /// -mavx512f -mavx512cd -mavx512dq -mavx512bw -mavx512vl
 /// we bunch them to form one flag to enable avx512
@@ -42,3 +52,33 @@
 #else
 #define SIMD_WITH_AVX512 0
 #endif  // __AVX512__
+
+/// -mavx512bf16 on top of the avx512 bunch: vcvtneps2bf16 / vdpbf16ps
+/// define SIMD_WITH_AVX512_BF16 to 0 beforehand to force the emulation
+#ifndef SIMD_WITH_AVX512_BF16
+#if SIMD_WITH_AVX512 && defined(__AVX512BF16__)
+#define SIMD_WITH_AVX512_BF16 1
+#else
+#define SIMD_WITH_AVX512_BF16 0
+#endif
+#endif  // SIMD_WITH_AVX512_BF16
+
+/// -mavx512vnni on top of the avx512 bunch: vpdpbusd
+/// define SIMD_WITH_AVX512_VNNI to 0 beforehand to use vpmaddubsw instead
+#ifndef SIMD_WITH_AVX512_VNNI
+#if SIMD_WITH_AVX512 && defined(__AVX512VNNI__)
+#define SIMD_WITH_AVX512_VNNI 1
+#else
+#define SIMD_WITH_AVX512_VNNI 0
+#endif
+#endif  // SIMD_WITH_AVX512_VNNI
+
+/// -mavx512vbmi on top of the avx512 bunch: vpermb / vpermi2b byte permutes
+/// define SIMD_WITH_AVX512_VBMI to 0 beforehand to use vpshufb per 128-bit lane
+#ifndef SIMD_WITH_AVX512_VBMI
+#if SIMD_WITH_AVX512 && defined(__AVX512VBMI__)
+#define SIMD_WITH_AVX512_VBMI 1
+#else
+#define SIMD_WITH_AVX512_VBMI 0
+#endif
+#endif  // SIMD_WITH_AVX512_VBMI
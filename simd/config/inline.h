@@ -1,3 +1,15 @@
 #pragma once
 
 #define SIMD_INLINE inline __attribute__((always_inline))
+
+/// unroll the next loop: the register loops (n_regs iterations) must be
+/// flattened for a multi-register Vec to live in registers; gcc ignores
+/// `#pragma unroll`, and at -O2 keeps loops over 3+ registers rolled,
+/// spilling the whole vector to the stack every iteration
+#if defined(__clang__)
+#define SIMD_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__)
+#define SIMD_UNROLL _Pragma("GCC unroll 32")
+#else
+#define SIMD_UNROLL
+#endif
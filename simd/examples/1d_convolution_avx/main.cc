@@ -1,6 +1,77 @@
 #include "simd/simd.h"
+#include "simd/filter/fir.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/// streaming FIR filter through simd::fir vs. a scalar convolution
+/// usage: 1d_convolution [taps]
+namespace {
+using clock_type = std::chrono::steady_clock;
+
+/// keep the reference scalar, GCC auto-vectorizes at -O2 otherwise
+__attribute__((optimize("no-tree-vectorize")))
+void fir_scalar(const std::vector<float>& h, const float* x, float* y, size_t n)
+{
+    const size_t taps = h.size();
+    for (size_t i = taps - 1; i < n; i++) {
+        float acc = 0;
+        for (size_t k = 0; k < taps; k++) {
+            acc += h[k] * x[i - k];
+        }
+        y[i] = acc;
+    }
+}
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+
+void run(size_t taps, size_t n, int reps)
+{
+    std::vector<float> h(taps), x(n), y0(n), y1(n);
+    for (size_t k = 0; k < taps; k++) {
+        h[k] = std::sin(0.1f * k) / taps;
+    }
+    for (size_t i = 0; i < n; i++) {
+        x[i] = float(i % 97) * 0.01f;
+    }
+    simd::fir<float> f(h);
+    double ts = best_seconds([&] { fir_scalar(h, x.data(), y0.data(), n); }, reps);
+    double tv = best_seconds([&] { f.reset(); f.process(x.data(), y1.data(), n); }, reps);
+
+    /// the scalar loop skips the warm-up outputs
+    float max_diff = 0;
+    for (size_t i = taps - 1; i < n; i++) {
+        max_diff = std::max(max_diff, std::abs(y0[i] - y1[i]));
+    }
+    std::printf("%6zu %16.1f %16.1f %8.2fx %12.2e\n", taps,
+        n / ts * 1e-6, n / tv * 1e-6, ts / tv, max_diff);
+}
+}  // namespace
 
 int main(int argc, char** argv)
 {
+    const size_t n = 1 << 20;
+    std::printf("%6s %16s %16s %9s %12s\n", "taps", "scalar Msmp/s", "simd Msmp/s", "speedup", "max |diff|");
+    if (argc > 1) {
+        run(std::strtoull(argv[1], nullptr, 10), n, 5);
+        return 0;
+    }
+    for (size_t taps : {16, 64, 128, 256, 512}) {
+        run(taps, n, 5);
+    }
     return 0;
 }
@@ -1,6 +1,103 @@
 #include "simd/simd.h"
+#include "simd/filter/conv2d.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+/// 2D convolution of a 3840 x 2160 image through simd::conv2d vs. a scalar
+/// loop, full and separable kernels, float and u8 pixels, clamp border
+namespace {
+using clock_type = std::chrono::steady_clock;
+
+/// keep the reference scalar, GCC auto-vectorizes at -O2 otherwise
+__attribute__((optimize("no-tree-vectorize")))
+void conv_scalar(const float* src, size_t h, size_t w, const float* k, size_t kh, size_t kw, float* dst)
+{
+    const ptrdiff_t ry = kh / 2, rx = kw / 2;
+    for (ptrdiff_t y = 0; y < ptrdiff_t(h); y++) {
+        for (ptrdiff_t x = 0; x < ptrdiff_t(w); x++) {
+            float acc = 0;
+            for (ptrdiff_t i = 0; i < ptrdiff_t(kh); i++) {
+                ptrdiff_t sy = std::min(std::max(y + i - ry, ptrdiff_t(0)), ptrdiff_t(h) - 1);
+                for (ptrdiff_t j = 0; j < ptrdiff_t(kw); j++) {
+                    ptrdiff_t sx = std::min(std::max(x + j - rx, ptrdiff_t(0)), ptrdiff_t(w) - 1);
+                    acc += k[i * kw + j] * src[sy * w + sx];
+                }
+            }
+            dst[y * w + x] = acc;
+        }
+    }
+}
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+
+std::vector<float> make_kernel(size_t n, bool separable)
+{
+    std::vector<float> k(n * n);
+    float sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            float di = float(i) - n / 2, dj = float(j) - n / 2;
+            k[i * n + j] = std::exp(-(di * di + dj * dj) / n);
+            if (!separable && i == j) {
+                k[i * n + j] *= 2;
+            }
+            sum += k[i * n + j];
+        }
+    }
+    for (auto& v : k) {
+        v /= sum;
+    }
+    return k;
+}
+
+void run(size_t n, bool separable)
+{
+    const size_t h = 2160, w = 3840;
+    std::vector<float> src(h * w), dst0(h * w), dst1(h * w);
+    std::vector<uint8_t> src8(h * w), dst8(h * w);
+    for (size_t i = 0; i < h * w; i++) {
+        src8[i] = uint8_t((i * 2654435761u) >> 24);
+        src[i] = src8[i];
+    }
+    auto k = make_kernel(n, separable);
+    simd::conv2d conv(k, n, n);
+
+    double ts = best_seconds([&] { conv_scalar(src.data(), h, w, k.data(), n, n, dst0.data()); }, 1);
+    double tf = best_seconds([&] { conv.apply(src.data(), h, w, dst1.data()); }, 5);
+    double tu = best_seconds([&] { conv.apply(src8.data(), h, w, dst8.data()); }, 5);
+
+    float max_diff = 0;
+    for (size_t i = 0; i < h * w; i++) {
+        max_diff = std::max(max_diff, std::abs(dst0[i] - dst1[i]));
+    }
+    const double mpix = h * w * 1e-6;
+    std::printf("%3zux%-3zu %10s %14.1f %14.1f %14.1f %12.2e\n", n, n,
+        conv.separable() ? "separable" : "full", mpix / ts, mpix / tf, mpix / tu, max_diff);
+}
+}  // namespace
 
 int main(int argc, char** argv)
 {
+    std::printf("%7s %10s %14s %14s %14s %12s\n", "kernel", "path",
+        "scalar MP/s", "simd f32 MP/s", "simd u8 MP/s", "max |diff|");
+    for (size_t n : {3, 5, 9, 15}) {
+        run(n, false);
+        run(n, true);
+    }
     return 0;
 }
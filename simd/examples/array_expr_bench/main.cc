@@ -0,0 +1,104 @@
+#include "simd/simd.h"
+#include "simd/expr/array.h"
+#include "simd/memory/aligned_allocator.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+/// y = exp(a * x + b) / (1 + c) over float arrays, in M elements/s:
+/// - scalar std loop
+/// - unfused: one Vec pass per op through temporaries, as a chain of
+///   whole-array calls would run it
+/// - fused: simd::expr::assign, one pass, a * x + b as one fmadd
+/// - fused on the thread pool
+/// usage: array_expr_bench [n]
+/// at n far beyond the last level cache the unfused chain is bound by
+/// its 4 extra array passes
+namespace {
+using clock_type = std::chrono::steady_clock;
+using aligned_vector = std::vector<float, simd::aligned_allocator<float, 64>>;
+constexpr size_t W = simd::native_lanes<float>();
+using vec_t = simd::Vec<float, W>;
+
+__attribute__((optimize("no-tree-vectorize")))
+void scalar(size_t n, float a, float b, const float* x, const float* c, float* y)
+{
+    for (size_t i = 0; i < n; i++) {
+        y[i] = std::exp(a * x[i] + b) / (1.f + c[i]);
+    }
+}
+
+/// n a multiple of W
+void unfused(size_t n, float a, float b, const float* x, const float* c, float* t0, float* t1, float* y)
+{
+    for (size_t i = 0; i < n; i += W) {
+        (vec_t::load_aligned(x + i) * vec_t(a)).store_aligned(t0 + i);
+    }
+    for (size_t i = 0; i < n; i += W) {
+        (vec_t::load_aligned(t0 + i) + vec_t(b)).store_aligned(t0 + i);
+    }
+    for (size_t i = 0; i < n; i += W) {
+        simd::exp(vec_t::load_aligned(t0 + i)).store_aligned(t0 + i);
+    }
+    for (size_t i = 0; i < n; i += W) {
+        (vec_t::load_aligned(c + i) + vec_t(1.f)).store_aligned(t1 + i);
+    }
+    for (size_t i = 0; i < n; i += W) {
+        (vec_t::load_aligned(t0 + i) / vec_t::load_aligned(t1 + i)).store_aligned(y + i);
+    }
+}
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 24;
+    n = (n + W - 1) / W * W;
+    const int reps = int(1000000000ull / (n * 16)) + 3;
+    aligned_vector x(n), c(n), y(n), ref(n), t0(n), t1(n);
+    for (size_t i = 0; i < n; i++) {
+        x[i] = float(int(i % 101) - 50) / 16.f;
+        c[i] = float(i % 13) * 0.5f;
+    }
+    const float a = 0.75f, b = -0.5f;
+    namespace ex = simd::expr;
+    ex::aligned_span<const float> sx(x), sc(c);
+    ex::aligned_span<float> sy(y);
+    const auto e = ex::exp(a * sx + b) / (1.f + sc);
+
+    const double m = 1e-6 * n;
+    double ts = best_seconds([&] { scalar(n, a, b, x.data(), c.data(), ref.data()); }, reps);
+    double tu = best_seconds([&] { unfused(n, a, b, x.data(), c.data(), t0.data(), t1.data(), y.data()); }, reps);
+    double tf = best_seconds([&] { ex::assign(sy, e); }, reps);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < n; i++) {
+        mismatches += std::abs(ref[i] - y[i]) > 1e-5f * std::abs(ref[i]);
+    }
+    simd::parallel::options opt;
+    double tp = best_seconds([&] { ex::assign(sy, e, opt); }, reps);
+    for (size_t i = 0; i < n; i++) {
+        mismatches += std::abs(ref[i] - y[i]) > 1e-5f * std::abs(ref[i]);
+    }
+    std::printf("n = %zu float, %s, %zu threads, M elements/s\n", n, SIMD_WITH_AVX512 ? "AVX512" : "AVX2 + FMA",
+                simd::parallel::thread_pool::global().size());
+    std::printf("%10s %10s %10s %10s %12s\n", "scalar", "unfused", "fused", "parallel", "mismatches");
+    std::printf("%10.0f %10.0f %10.0f %10.0f %12zu\n", m / ts, m / tu, m / tf, m / tp, mismatches);
+    std::printf("fused vs. unfused %.2fx\n", tu / tf);
+    return 0;
+}
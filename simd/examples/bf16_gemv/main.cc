@@ -0,0 +1,71 @@
+#include "simd/simd.h"
+#include "simd/gemm/gemv.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+/// y = A * x over bfloat16 weights: scalar convert-then-multiply vs.
+/// simd::gemm::gemv, GFLOP/s and the largest relative difference
+/// usage: bf16_gemv [rows] [cols]
+/// bf16_gemv runs the AVX2 shift-and-fmadd emulation, bf16_gemv_avx512
+/// (built with -mavx512bf16) the vdpbf16ps path
+namespace {
+using clock_type = std::chrono::steady_clock;
+
+/// keep the reference scalar, GCC auto-vectorizes at -O2 otherwise
+__attribute__((optimize("no-tree-vectorize")))
+void gemv_scalar(size_t M, size_t K, const simd::bfloat16* A, const simd::bfloat16* x, float* y)
+{
+    for (size_t i = 0; i < M; i++) {
+        float s = 0.f;
+        for (size_t k = 0; k < K; k++) {
+            s += float(A[i * K + k]) * float(x[k]);
+        }
+        y[i] = s;
+    }
+}
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t M = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4096;
+    size_t K = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 4096;
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<simd::bfloat16> A(M * K), x(K);
+    for (auto& v : A) {
+        v = simd::bfloat16(dist(rng));
+    }
+    for (auto& v : x) {
+        v = simd::bfloat16(dist(rng));
+    }
+    std::vector<float> y0(M), y1(M);
+    double ts = best_seconds([&] { gemv_scalar(M, K, A.data(), x.data(), y0.data()); }, 10);
+    double tv = best_seconds([&] { simd::gemm::gemv(M, K, 1.f, A.data(), K, x.data(), 0.f, y1.data()); }, 10);
+    double err = 0;
+    for (size_t i = 0; i < M; i++) {
+        err = std::max(err, std::abs(double(y1[i]) - y0[i]) / (std::abs(double(y0[i])) + 1.0));
+    }
+    const double gflop = 2e-9 * M * K;
+    std::printf("%zu x %zu bfloat16, %s\n", M, K, SIMD_WITH_AVX512_BF16 ? "vdpbf16ps" : "emulated");
+    std::printf("%12s %12s %9s %12s\n", "scalar GF/s", "simd GF/s", "speedup", "max rel diff");
+    std::printf("%12.2f %12.2f %8.2fx %12.2e\n", gflop / ts, gflop / tv, ts / tv, err);
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include "simd/simd.h"
+#include "simd/bulk/reduce.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+/// accuracy and throughput of simd::bulk::sum modes,
+/// once on a large out-of-cache array and once on an L1 resident one
+/// usage: compensated_sum [n]
+namespace {
+using clock_type = std::chrono::steady_clock;
+
+double scalar_double_sum(const float* x, size_t n)
+{
+    double s = 0;
+    for (size_t i = 0; i < n; i++) {
+        s += x[i];
+    }
+    return s;
+}
+
+template <typename F>
+double best_seconds(F&& f, size_t reps)
+{
+    double best = 1e30;
+    for (size_t r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+
+void run(const std::vector<float>& x, size_t reps)
+{
+    long double ref = 0;
+    for (float v : x) {
+        ref += v;
+    }
+    const size_t n = x.size();
+    const double bytes = n * sizeof(float);
+    std::printf("n = %zu (%.1f KB)\n", n, bytes / 1024);
+    std::printf("  %-10s %14s %10s\n", "mode", "rel. error", "GB/s");
+
+    static const char* names[] = {"plain", "kahan", "neumaier", "pairwise", "widen"};
+    for (int m = 0; m < 5; m++) {
+        auto mode = static_cast<simd::bulk::summation>(m);
+        volatile float s = 0;
+        double sec = best_seconds([&] { s = simd::bulk::sum(x.data(), n, mode); }, reps);
+        double err = std::fabs((s - ref) / ref);
+        std::printf("  %-10s %14.3e %10.2f\n", names[m], err, bytes / sec * 1e-9);
+    }
+    volatile double s = 0;
+    double sec = best_seconds([&] { s = scalar_double_sum(x.data(), n); }, reps);
+    double err = std::fabs((s - ref) / ref);
+    std::printf("  %-10s %14.3e %10.2f\n", "scalar f64", err, bytes / sec * 1e-9);
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000000;
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    std::vector<float> x(n);
+    for (auto& v : x) {
+        v = dist(rng);
+    }
+    run(x, 5);
+
+    x.resize(4096);
+    run(x, 20000);
+    return 0;
+}
@@ -0,0 +1,165 @@
+#include "simd/simd.h"
+#include "simd/bulk/complex.h"
+
+#include <chrono>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/// bulk complex array multiply c[i] = a[i] * b[i] (and divide), float, in
+/// M complex products/s:
+/// - std::complex loop (the C99 Annex G inf / nan recovery of operator*)
+/// - scalar loop on split re / im arrays
+/// - Vec<std::complex<float>, W> on split arrays: fmsub / fmadd per lane pair
+/// - Vec<std::complex<float>, W> on interleaved std::complex arrays: the
+///   same kernel between a deinterleaving load and an interleaving store
+/// - VecInterleaved<std::complex<float>, W / 2>: permute + fmaddsub in
+///   place on the std::complex layout (simd::bulk::mul)
+/// divide: std::complex, VecInterleaved, split (simd::bulk::div)
+/// usage: complex_mul_bench [n]
+/// built as is it runs AVX2 + FMA; add
+/// -mavx512f -mavx512cd -mavx512dq -mavx512bw -mavx512vl
+/// to the compile options for the AVX512 path
+namespace {
+using clock_type = std::chrono::steady_clock;
+using cf = std::complex<float>;
+constexpr size_t W = simd::native_lanes<float>();
+using cvec = simd::Vec<cf, W>;
+using ivec = simd::VecInterleaved<cf, W / 2>;
+
+__attribute__((optimize("no-tree-vectorize")))
+void mul_std(size_t n, const cf* a, const cf* b, cf* c)
+{
+    for (size_t i = 0; i < n; i++) {
+        c[i] = a[i] * b[i];
+    }
+}
+
+__attribute__((optimize("no-tree-vectorize")))
+void mul_split_scalar(size_t n, const float* ar, const float* ai, const float* br, const float* bi,
+                      float* cr, float* ci)
+{
+    for (size_t i = 0; i < n; i++) {
+        cr[i] = ar[i] * br[i] - ai[i] * bi[i];
+        ci[i] = ar[i] * bi[i] + ai[i] * br[i];
+    }
+}
+
+void mul_split_simd(size_t n, const float* ar, const float* ai, const float* br, const float* bi,
+                    float* cr, float* ci)
+{
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        (cvec::load_unaligned(ar + i, ai + i) * cvec::load_unaligned(br + i, bi + i)).store_unaligned(cr + i, ci + i);
+    }
+    for (; i < n; i++) {
+        cr[i] = ar[i] * br[i] - ai[i] * bi[i];
+        ci[i] = ar[i] * bi[i] + ai[i] * br[i];
+    }
+}
+
+void mul_interleaved_simd(size_t n, const cf* a, const cf* b, cf* c)
+{
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        (cvec::load_unaligned(a + i) * cvec::load_unaligned(b + i)).store_unaligned(c + i);
+    }
+    for (; i < n; i++) {
+        c[i] = cf(a[i].real() * b[i].real() - a[i].imag() * b[i].imag(),
+                  a[i].real() * b[i].imag() + a[i].imag() * b[i].real());
+    }
+}
+
+__attribute__((optimize("no-tree-vectorize")))
+void div_std(size_t n, const cf* a, const cf* b, cf* c)
+{
+    for (size_t i = 0; i < n; i++) {
+        c[i] = a[i] / b[i];
+    }
+}
+
+void div_interleaved_simd(size_t n, const cf* a, const cf* b, cf* c)
+{
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        (cvec::load_unaligned(a + i) / cvec::load_unaligned(b + i)).store_unaligned(c + i);
+    }
+    for (; i < n; i++) {
+        c[i] = a[i] / b[i];
+    }
+}
+
+void div_vec_interleaved(size_t n, const cf* a, const cf* b, cf* c)
+{
+    size_t i = 0;
+    for (; i + W / 2 <= n; i += W / 2) {
+        (ivec::load_unaligned(a + i) / ivec::load_unaligned(b + i)).store_unaligned(c + i);
+    }
+    for (; i < n; i++) {
+        c[i] = a[i] / b[i];
+    }
+}
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4096;
+    const int reps = int(2000000000ull / (n * 64)) + 5;
+    std::vector<cf> a(n), b(n), c(n), ref(n);
+    std::vector<float> ar(n), ai(n), br(n), bi(n), cr(n), ci(n);
+    for (size_t i = 0; i < n; i++) {
+        a[i] = cf(float(i % 17) - 8.f, float(i % 5) + 0.5f);
+        b[i] = cf(float(i % 7) + 0.25f, 3.f - float(i % 11));
+        ar[i] = a[i].real();
+        ai[i] = a[i].imag();
+        br[i] = b[i].real();
+        bi[i] = b[i].imag();
+    }
+
+    const double m = 1e-6 * n;
+    double ts = best_seconds([&] { mul_std(n, a.data(), b.data(), ref.data()); }, reps);
+    double tss = best_seconds([&] { mul_split_scalar(n, ar.data(), ai.data(), br.data(), bi.data(), cr.data(), ci.data()); }, reps);
+    double tsv = best_seconds([&] { mul_split_simd(n, ar.data(), ai.data(), br.data(), bi.data(), cr.data(), ci.data()); }, reps);
+    double tiv = best_seconds([&] { mul_interleaved_simd(n, a.data(), b.data(), c.data()); }, reps);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < n; i++) {
+        mismatches += std::abs(ref[i] - c[i]) > 1e-5f * std::abs(ref[i]);
+        mismatches += std::abs(ref[i] - cf(cr[i], ci[i])) > 1e-5f * std::abs(ref[i]);
+    }
+    double tvi = best_seconds([&] { simd::bulk::mul(n, a.data(), b.data(), c.data()); }, reps);
+    for (size_t i = 0; i < n; i++) {
+        mismatches += std::abs(ref[i] - c[i]) > 1e-5f * std::abs(ref[i]);
+    }
+    std::printf("n = %zu complex<float>, %s, M products/s\n", n, SIMD_WITH_AVX512 ? "AVX512" : "AVX2 + FMA");
+    std::printf("%14s %14s %14s %14s %14s %12s\n", "std::complex", "split scalar", "split simd", "interleaved",
+                "VecInterleaved", "mismatches");
+    std::printf("%14.0f %14.0f %14.0f %14.0f %14.0f %12zu\n", m / ts, m / tss, m / tsv, m / tiv, m / tvi, mismatches);
+
+    double tds = best_seconds([&] { div_std(n, a.data(), b.data(), ref.data()); }, reps);
+    double tdv = best_seconds([&] { div_interleaved_simd(n, a.data(), b.data(), c.data()); }, reps);
+    mismatches = 0;
+    for (size_t i = 0; i < n; i++) {
+        mismatches += std::abs(ref[i] - c[i]) > 1e-5f * std::abs(ref[i]);
+    }
+    double tdi = best_seconds([&] { div_vec_interleaved(n, a.data(), b.data(), c.data()); }, reps);
+    for (size_t i = 0; i < n; i++) {
+        mismatches += std::abs(ref[i] - c[i]) > 1e-5f * std::abs(ref[i]);
+    }
+    std::printf("divide (Smith): std::complex %.0f, split simd %.0f M/s (%.2fx), VecInterleaved %.0f M/s, "
+                "%zu mismatches\n", m / tds, m / tdv, tds / tdv, m / tdi, mismatches);
+    return 0;
+}
@@ -0,0 +1,167 @@
+#include "simd/simd.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+/// u8 <=> f32 and i16 <=> i32 conversion throughput through simd::widen /
+/// simd::narrow_sat vs. scalar loops, M elements/s
+/// usage: convert_throughput [elements], the default input stays in L2
+namespace {
+using clock_type = std::chrono::steady_clock;
+constexpr size_t W = 32;
+using bytes_t = simd::Vec<uint8_t, W>;
+using floats_t = simd::Vec<float, 8>;
+using shorts_t = simd::Vec<int16_t, 16>;
+using ints_t = simd::Vec<int32_t, 8>;
+
+/// keep the references scalar, GCC auto-vectorizes at -O2 otherwise
+__attribute__((optimize("no-tree-vectorize")))
+void u8_to_f32_scalar(const uint8_t* src, size_t n, float* dst)
+{
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = static_cast<float>(src[i]);
+    }
+}
+
+__attribute__((optimize("no-tree-vectorize")))
+void f32_to_u8_scalar(const float* src, size_t n, uint8_t* dst)
+{
+    for (size_t i = 0; i < n; i++) {
+        float v = src[i] < 0.f ? 0.f : src[i] > 255.f ? 255.f : src[i];
+        dst[i] = static_cast<uint8_t>(v);
+    }
+}
+
+__attribute__((optimize("no-tree-vectorize")))
+void scale_u8_scalar(const uint8_t* src, size_t n, uint8_t* dst)
+{
+    for (size_t i = 0; i < n; i++) {
+        float v = static_cast<float>(src[i]) * 1.25f - 16.f;
+        v = v < 0.f ? 0.f : v > 255.f ? 255.f : v;
+        dst[i] = static_cast<uint8_t>(v);
+    }
+}
+
+__attribute__((optimize("no-tree-vectorize")))
+void i16_to_i32_scalar(const int16_t* src, size_t n, int32_t* dst)
+{
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = src[i];
+    }
+}
+
+__attribute__((optimize("no-tree-vectorize")))
+void i32_to_i16_scalar(const int32_t* src, size_t n, int16_t* dst)
+{
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = static_cast<int16_t>(src[i] < -32768 ? -32768 : src[i] > 32767 ? 32767 : src[i]);
+    }
+}
+
+void u8_to_f32_simd(const uint8_t* src, size_t n, float* dst)
+{
+    for (size_t i = 0; i < n; i += W) {
+        auto f = simd::widen<float>(bytes_t::load_unaligned(src + i));
+        for (size_t k = 0; k < f.size(); k++) {
+            f[k].store_unaligned(dst + i + 8 * k);
+        }
+    }
+}
+
+void f32_to_u8_simd(const float* src, size_t n, uint8_t* dst)
+{
+    for (size_t i = 0; i < n; i += W) {
+        simd::narrow_sat<uint8_t>(floats_t::load_unaligned(src + i),
+                                  floats_t::load_unaligned(src + i + 8),
+                                  floats_t::load_unaligned(src + i + 16),
+                                  floats_t::load_unaligned(src + i + 24)).store_unaligned(dst + i);
+    }
+}
+
+/// u8 => f32 => a * x + b => u8 with saturation, the pixel pipeline round trip
+void scale_u8_simd(const uint8_t* src, size_t n, uint8_t* dst)
+{
+    const floats_t a(1.25f), b(-16.f);
+    for (size_t i = 0; i < n; i += W) {
+        auto f = simd::widen<float>(bytes_t::load_unaligned(src + i));
+        for (auto& v : f) {
+            v = v * a + b;
+        }
+        simd::narrow_sat<uint8_t>(f).store_unaligned(dst + i);
+    }
+}
+
+void i16_to_i32_simd(const int16_t* src, size_t n, int32_t* dst)
+{
+    for (size_t i = 0; i < n; i += 16) {
+        auto r = simd::widen<int32_t>(shorts_t::load_unaligned(src + i));
+        r[0].store_unaligned(dst + i);
+        r[1].store_unaligned(dst + i + 8);
+    }
+}
+
+void i32_to_i16_simd(const int32_t* src, size_t n, int16_t* dst)
+{
+    for (size_t i = 0; i < n; i += 16) {
+        simd::narrow_sat<int16_t>(ints_t::load_unaligned(src + i),
+                                  ints_t::load_unaligned(src + i + 8)).store_unaligned(dst + i);
+    }
+}
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+
+template <typename S, typename D, typename FS, typename FV>
+void run(const char* name, const std::vector<S>& src, FS&& scalar, FV&& vector, int reps)
+{
+    const size_t n = src.size();
+    std::vector<D> out0(n), out1(n);
+    double ts = best_seconds([&] { scalar(src.data(), n, out0.data()); }, reps);
+    double tv = best_seconds([&] { vector(src.data(), n, out1.data()); }, reps);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < n; i++) {
+        mismatches += out0[i] != out1[i];
+    }
+    const double m = 1e-6 * n;
+    std::printf("%12s %12.1f %12.1f %8.2fx %12zu\n", name, m / ts, m / tv, ts / tv, mismatches);
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : (size_t(1) << 16);
+    n = n / W * W;
+    std::mt19937 rng(1);
+    std::vector<uint8_t> u8(n);
+    std::vector<float> f32(n);
+    std::vector<int16_t> i16(n);
+    std::vector<int32_t> i32(n);
+    for (size_t i = 0; i < n; i++) {
+        u8[i] = static_cast<uint8_t>(rng());
+        f32[i] = static_cast<float>(rng() % 40000) * 0.01f - 70.f;
+        i16[i] = static_cast<int16_t>(rng());
+        i32[i] = static_cast<int32_t>(rng() % 200000) - 100000;
+    }
+    std::printf("%zu elements\n", n);
+    std::printf("%12s %12s %12s %9s %12s\n", "op", "scalar M/s", "simd M/s", "speedup", "mismatches");
+    run<uint8_t, float>("u8->f32", u8, u8_to_f32_scalar, u8_to_f32_simd, 50);
+    run<float, uint8_t>("f32->u8 sat", f32, f32_to_u8_scalar, f32_to_u8_simd, 50);
+    run<uint8_t, uint8_t>("u8 scale", u8, scale_u8_scalar, scale_u8_simd, 50);
+    run<int16_t, int32_t>("i16->i32", i16, i16_to_i32_scalar, i16_to_i32_simd, 50);
+    run<int32_t, int16_t>("i32->i16 sat", i32, i32_to_i16_scalar, i32_to_i16_simd, 50);
+    return 0;
+}
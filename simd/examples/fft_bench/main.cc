@@ -0,0 +1,138 @@
+#include "simd/simd.h"
+#include "simd/fft/fft.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/// complex FFT throughput in GFLOP/s (5 n log2(n) flops per transform),
+/// naive O(n^2) DFT and scalar iterative radix-2 vs. simd::fft::plan, float
+/// and double, plus the real-input transform
+/// usage: fft_bench [max log2 n]
+/// built as is it runs AVX2 + FMA; add
+/// -mavx512f -mavx512cd -mavx512dq -mavx512bw -mavx512vl
+/// to the compile options for the AVX512 path
+namespace {
+using clock_type = std::chrono::steady_clock;
+
+template <typename T>
+using cvec = std::vector<std::complex<T>>;
+
+/// table driven DFT, the O(n^2) baseline
+template <typename T>
+__attribute__((optimize("no-tree-vectorize")))
+void dft_naive(size_t n, const std::complex<T>* w, const std::complex<T>* x, std::complex<T>* y)
+{
+    for (size_t k = 0; k < n; k++) {
+        T sr = 0, si = 0;
+        for (size_t j = 0, jk = 0; j < n; j++, jk = (jk + k) & (n - 1)) {
+            sr += x[j].real() * w[jk].real() - x[j].imag() * w[jk].imag();
+            si += x[j].real() * w[jk].imag() + x[j].imag() * w[jk].real();
+        }
+        y[k] = std::complex<T>(sr, si);
+    }
+}
+
+/// in-place iterative radix-2 (bit reversal, then log2(n) butterfly passes)
+template <typename T>
+__attribute__((optimize("no-tree-vectorize")))
+void fft_radix2(size_t n, const std::complex<T>* w, std::complex<T>* x)
+{
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(x[i], x[j]);
+        }
+    }
+    for (size_t len = 2; len <= n; len <<= 1) {
+        const size_t step = n / len;
+        for (size_t i = 0; i < n; i += len) {
+            for (size_t k = 0; k < len / 2; k++) {
+                const std::complex<T> u = x[i + k], v = x[i + k + len / 2];
+                const std::complex<T> t = w[k * step];
+                const T tr = v.real() * t.real() - v.imag() * t.imag();
+                const T ti = v.real() * t.imag() + v.imag() * t.real();
+                x[i + k] = std::complex<T>(u.real() + tr, u.imag() + ti);
+                x[i + k + len / 2] = std::complex<T>(u.real() - tr, u.imag() - ti);
+            }
+        }
+    }
+}
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+
+template <typename T>
+void run(const char* name, size_t max_log2)
+{
+    std::printf("%s\n%8s %10s %10s %10s %10s %8s %10s\n", name,
+                "n", "dft", "radix-2", "simd", "real", "speedup", "rel err");
+    for (size_t lg = 4; lg <= max_log2; lg += 2) {
+        const size_t n = size_t(1) << lg;
+        const int reps = int(std::max<size_t>(3, (size_t(1) << 22) / (n * lg)));
+        cvec<T> w(n), x(n), y0(n), y1(n), y2(n), tmp(n);
+        std::vector<T> xr(n);
+        for (size_t i = 0; i < n; i++) {
+            const double a = -2 * M_PI * double(i) / double(n);
+            w[i] = std::complex<T>(T(std::cos(a)), T(std::sin(a)));
+            x[i] = std::complex<T>(T(std::sin(0.1 * i)), T(std::cos(0.37 * i)));
+            xr[i] = x[i].real();
+        }
+        simd::fft::plan<T> p(n);
+        cvec<T> yr(n / 2 + 1);
+
+        const double flops = 5.0 * n * lg * 1e-9;
+        double td = 0;
+        if (n <= 4096) {
+            td = best_seconds([&] { dft_naive(n, w.data(), x.data(), y0.data()); }, 3);
+        }
+        const double t2 = best_seconds([&] {
+            tmp = x;
+            fft_radix2(n, w.data(), tmp.data());
+        }, reps);
+        y1 = tmp;
+        const double tv = best_seconds([&] { p.forward(x.data(), y2.data()); }, reps);
+        const double tr = best_seconds([&] { p.forward_real(xr.data(), yr.data()); }, reps);
+        double err = 0, mag = 0;
+        for (size_t k = 0; k < n; k++) {
+            err = std::max(err, double(std::abs(y1[k] - y2[k])));
+            mag = std::max(mag, double(std::abs(y1[k])));
+        }
+        char dft[16] = "-";
+        if (td > 0) {
+            std::snprintf(dft, sizeof(dft), "%.2f", flops / td);
+        }
+        /// real input: half the work of a complex transform of size n
+        std::printf("%8zu %10s %10.2f %10.2f %10.2f %7.2fx %10.2e\n", n,
+                    dft, flops / t2, flops / tv, 0.5 * flops / tr, t2 / tv, err / mag);
+    }
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t max_log2 = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20;
+    std::printf("GFLOP/s, 5 n log2(n) flops per complex transform, %s\n",
+                SIMD_WITH_AVX512 ? "AVX512" : "AVX2 + FMA");
+    run<float>("float", max_log2);
+    run<double>("double", max_log2);
+    return 0;
+}
@@ -1,6 +1,99 @@
 #include "simd/simd.h"
+#include "simd/matrix/mat4.h"
+
+#include <x86intrin.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/// cycles per 4x4 float matrix: scalar loops vs. simd::Mat4f vs. the
+/// packed batch routines in simd::matrix
+/// usage: float_matmul_4x4_avx [n]
+namespace {
+/// keep the reference scalar, GCC auto-vectorizes at -O2 otherwise
+__attribute__((optimize("no-tree-vectorize")))
+void mul_scalar(size_t n, const simd::Mat4f* a, const simd::Mat4f* b, simd::Mat4f* c)
+{
+    for (size_t m = 0; m < n; m++) {
+        const float* pa = a[m].data();
+        const float* pb = b[m].data();
+        float* pc = c[m].data();
+        for (int i = 0; i < 4; i++) {
+            for (int j = 0; j < 4; j++) {
+                float s = 0;
+                for (int k = 0; k < 4; k++) {
+                    s += pa[i * 4 + k] * pb[k * 4 + j];
+                }
+                pc[i * 4 + j] = s;
+            }
+        }
+    }
+}
+
+template <typename F>
+double cycles_per_item(F&& f, size_t n, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        unsigned long long t0 = __rdtsc();
+        f();
+        double dt = double(__rdtsc() - t0) / n;
+        best = dt < best ? dt : best;
+    }
+    return best;
+}
+
+void run(size_t n, int reps)
+{
+    std::vector<simd::Mat4f> a(n), b(n), c(n);
+    for (size_t m = 0; m < n; m++) {
+        float* pa = a[m].data();
+        float* pb = b[m].data();
+        for (int i = 0; i < 16; i++) {
+            pa[i] = float((i * 7 + m) % 11) * 0.125f;
+            pb[i] = float((i * 5 + m) % 13) * 0.125f;
+        }
+        for (int i = 0; i < 4; i++) {
+            pa[i * 5] += 4.f;
+        }
+    }
+    std::vector<float> pts(4 * n, 1.f);
+
+    double t_scalar = cycles_per_item([&] { mul_scalar(n, a.data(), b.data(), c.data()); }, n, reps);
+    double t_mat4 = cycles_per_item([&] {
+        for (size_t m = 0; m < n; m++) {
+            c[m] = a[m] * b[m];
+        }
+    }, n, reps);
+    double t_batch = cycles_per_item([&] { simd::matrix::mul(n, a.data(), b.data(), c.data()); }, n, reps);
+    double t_inv = cycles_per_item([&] {
+        for (size_t m = 0; m < n; m++) {
+            c[m] = simd::inverse(a[m]);
+        }
+    }, n, reps);
+    double t_inv_batch = cycles_per_item([&] { simd::matrix::inverse(n, a.data(), c.data()); }, n, reps);
+    double t_xform = cycles_per_item([&] {
+        simd::matrix::transform(a[0], n, pts.data(), pts.data());
+    }, n, reps);
+
+    std::printf("%8zu %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f\n", n,
+        t_scalar, t_mat4, t_batch, t_inv, t_inv_batch, t_xform);
+}
+}  // namespace
 
 int main(int argc, char** argv)
 {
+    std::printf("matrices per register: %zu\n", simd::matrix::detail::pack_size<float>());
+    std::printf("cycles (TSC) per matrix / point:\n");
+    std::printf("%8s %10s %10s %10s %10s %10s %10s\n", "n",
+        "mul scal", "mul Mat4", "mul batch", "inv Mat4", "inv batch", "xform pt");
+    if (argc > 1) {
+        run(std::strtoull(argv[1], nullptr, 10), 20);
+        return 0;
+    }
+    /// L1 and L2 resident
+    run(256, 2000);
+    run(8192, 100);
     return 0;
 }
@@ -1,6 +1,97 @@
 #include "simd/simd.h"
+#include "simd/gemm/gemm.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/// SGEMM throughput through simd::gemm::gemm vs. the measured FMA peak
+/// usage: float_matrix_op_avx [n]
+namespace {
+using clock_type = std::chrono::steady_clock;
+using vec_t = simd::Vec<float, simd::native_lanes<float>()>;
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+
+/// single core FMA peak: 12 independent chains cover 2 ports x 4-5 cycles latency
+double peak_gflops()
+{
+    constexpr size_t chains = 12;
+    constexpr long iters = 20000000;
+    vec_t acc[chains];
+    for (size_t c = 0; c < chains; c++) {
+        acc[c] = vec_t(float(c));
+    }
+    const vec_t a(0.999999f), b(1e-7f);
+    double t = best_seconds([&] {
+        for (long i = 0; i < iters; i++) {
+            simd::gemm::detail::static_for<chains>([&](auto c) {
+                acc[c] = simd::fmadd(acc[c], a, b);
+            });
+        }
+    }, 3);
+    float sink = 0;
+    for (size_t c = 0; c < chains; c++) {
+        sink += acc[c][0];
+    }
+    if (sink == 42.f) {
+        std::printf("\n");
+    }
+    return 2.0 * vec_t::size() * chains * iters / t * 1e-9;
+}
+
+void run(size_t n, int reps, double peak)
+{
+    std::vector<float> a(n * n), b(n * n), c(n * n);
+    for (size_t i = 0; i < n * n; i++) {
+        a[i] = float(i % 17) * 0.1f - 0.8f;
+        b[i] = float(i % 13) * 0.1f - 0.6f;
+    }
+    double t = best_seconds([&] {
+        simd::gemm::gemm(n, n, n, a.data(), b.data(), c.data());
+    }, reps);
+
+    /// spot check a few entries against the scalar dot product
+    double max_diff = 0;
+    for (size_t i = 0; i < n; i += n / 7 + 1) {
+        for (size_t j = 0; j < n; j += n / 5 + 1) {
+            double ref = 0;
+            for (size_t k = 0; k < n; k++) {
+                ref += double(a[i * n + k]) * b[k * n + j];
+            }
+            max_diff = std::max(max_diff, std::abs(ref - c[i * n + j]));
+        }
+    }
+    const double gflops = 2.0 * n * n * n / t * 1e-9;
+    std::printf("%8zu %12.2f %10.1f%% %12.2e\n", n, gflops, 100 * gflops / peak, max_diff);
+}
+}  // namespace
 
 int main(int argc, char** argv)
 {
+    const double peak = peak_gflops();
+    std::printf("fma peak: %.2f GFLOP/s (%zu lanes)\n", peak, vec_t::size());
+    std::printf("%8s %12s %11s %12s\n", "n", "GFLOP/s", "of peak", "max |diff|");
+    if (argc > 1) {
+        run(std::strtoull(argv[1], nullptr, 10), 5, peak);
+        return 0;
+    }
+    for (size_t n : {64, 128, 256, 512, 1024, 2048}) {
+        run(n, n <= 256 ? 50 : 3, peak);
+    }
     return 0;
 }
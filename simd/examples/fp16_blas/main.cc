@@ -0,0 +1,71 @@
+#include "simd/simd.h"
+#include "simd/blas1/blas1.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+/// blas1 dot/axpy on fp16 storage (fp32 compute) vs. fp32 storage, M elements/s
+/// (error: relative for dot, max absolute for axpy, both against fp32 storage)
+/// usage: fp16_blas [elements], the default arrays are well past the LLC so
+/// both flavours are bandwidth bound and fp16 moves half the bytes
+namespace {
+using clock_type = std::chrono::steady_clock;
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+
+void report(const char* name, size_t n, double t32, double t16, double err)
+{
+    const double m = 1e-6 * n;
+    std::printf("%8s %12.1f %12.1f %8.2fx %12.2e\n", name, m / t32, m / t16, t32 / t16, err);
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : (size_t(1) << 24);
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<float> x32(n), y32(n);
+    std::vector<simd::half> x16(n), y16(n);
+    for (size_t i = 0; i < n; i++) {
+        /// the fp32 arrays hold the same (half rounded) values as the fp16 ones
+        x16[i] = simd::half(dist(rng));
+        y16[i] = simd::half(dist(rng));
+        x32[i] = x16[i];
+        y32[i] = y16[i];
+    }
+    std::printf("%zu elements\n", n);
+    std::printf("%8s %12s %12s %9s %12s\n", "op", "fp32 M/s", "fp16 M/s", "speedup", "error");
+
+    float d32 = 0, d16 = 0;
+    double t32 = best_seconds([&] { d32 = simd::blas1::dot(n, x32.data(), y32.data()); }, 20);
+    double t16 = best_seconds([&] { d16 = simd::blas1::dot(n, x16.data(), y16.data()); }, 20);
+    report("dot", n, t32, t16, std::abs(double(d16) - d32) / std::abs(double(d32)));
+
+    /// alternate the sign of alpha so y stays bounded over the repetitions
+    float alpha = 1.f / 1024;
+    t32 = best_seconds([&] { simd::blas1::axpy(n, alpha, x32.data(), y32.data()); alpha = -alpha; }, 20);
+    alpha = 1.f / 1024;
+    t16 = best_seconds([&] { simd::blas1::axpy(n, alpha, x16.data(), y16.data()); alpha = -alpha; }, 20);
+    double err = 0;
+    for (size_t i = 0; i < n; i++) {
+        err = std::max(err, std::abs(double(float(y16[i])) - y32[i]));
+    }
+    report("axpy", n, t32, t16, err);
+    return 0;
+}
@@ -0,0 +1,159 @@
+#include "simd/simd.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/// xyz points, AoS (x0 y0 z0 x1 y1 z1 ...) vs. SoA (x[], y[], z[]), in
+/// M points/s for two kernels:
+/// - affine: p * s + t per component
+/// - length: |p| per point
+/// AoS layouts:
+/// - Vec<float, 3>: one point per vector, the 4th lane padding, loads and
+///   stores masked to 3 floats, |p| from a reduce_sum which skips the pad
+/// - Vec<float, 12>: 4 points per vector (2 registers on AVX2, 4 lanes of
+///   padding; 1 register on AVX512), the s and t pattern repeats per point
+/// - Vec<float, 24>: 8 points, 3 whole AVX2 registers, no padding
+/// SoA runs native width vectors over the 3 arrays, the layout to use when
+/// the data can be laid out for it; when it cannot, padded AoS vectors
+/// beat scalar code on lane-wise kernels, while a horizontal reduction per
+/// point (length on Vec<float, 3>) stays behind it
+/// usage: geometry_bench [n]
+namespace {
+using clock_type = std::chrono::steady_clock;
+constexpr size_t N = simd::native_lanes<float>();
+
+__attribute__((optimize("no-tree-vectorize")))
+void affine_scalar(size_t n, const float* s, const float* t, const float* p, float* q)
+{
+    for (size_t i = 0; i < n; i++) {
+        for (int c = 0; c < 3; c++) {
+            q[3 * i + c] = p[3 * i + c] * s[c] + t[c];
+        }
+    }
+}
+
+/// K points per Vec<float, 3 * K>, n a multiple of K
+template <size_t K>
+__attribute__((noinline))
+void affine_aos(size_t n, const float* s, const float* t, const float* p, float* q)
+{
+    using vec_t = simd::Vec<float, 3 * K>;
+    const vec_t vs([&](int i) { return s[i % 3]; });
+    const vec_t vt([&](int i) { return t[i % 3]; });
+    for (size_t i = 0; i < 3 * n; i += 3 * K) {
+        simd::fmadd(vec_t::load_unaligned(p + i), vs, vt).store_unaligned(q + i);
+    }
+}
+
+__attribute__((noinline))
+void affine_soa(size_t n, const float* s, const float* t, const float* x, const float* y, const float* z,
+                float* qx, float* qy, float* qz)
+{
+    using vec_t = simd::Vec<float, N>;
+    const vec_t sx(s[0]), sy(s[1]), sz(s[2]), tx(t[0]), ty(t[1]), tz(t[2]);
+    for (size_t i = 0; i < n; i += N) {
+        simd::fmadd(vec_t::load_unaligned(x + i), sx, tx).store_unaligned(qx + i);
+        simd::fmadd(vec_t::load_unaligned(y + i), sy, ty).store_unaligned(qy + i);
+        simd::fmadd(vec_t::load_unaligned(z + i), sz, tz).store_unaligned(qz + i);
+    }
+}
+
+__attribute__((optimize("no-tree-vectorize")))
+void length_scalar(size_t n, const float* p, float* r)
+{
+    for (size_t i = 0; i < n; i++) {
+        r[i] = std::sqrt(p[3 * i] * p[3 * i] + p[3 * i + 1] * p[3 * i + 1] + p[3 * i + 2] * p[3 * i + 2]);
+    }
+}
+
+__attribute__((noinline))
+void length_aos(size_t n, const float* p, float* r)
+{
+    using vec_t = simd::Vec<float, 3>;
+    for (size_t i = 0; i < n; i++) {
+        auto v = vec_t::load_unaligned(p + 3 * i);
+        r[i] = std::sqrt(simd::reduce_sum(v * v));
+    }
+}
+
+__attribute__((noinline))
+void length_soa(size_t n, const float* x, const float* y, const float* z, float* r)
+{
+    using vec_t = simd::Vec<float, N>;
+    for (size_t i = 0; i < n; i += N) {
+        auto vx = vec_t::load_unaligned(x + i);
+        auto vy = vec_t::load_unaligned(y + i);
+        auto vz = vec_t::load_unaligned(z + i);
+        simd::sqrt(simd::fmadd(vx, vx, simd::fmadd(vy, vy, vz * vz))).store_unaligned(r + i);
+    }
+}
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+
+size_t mismatches(const std::vector<float>& ref, const std::vector<float>& out)
+{
+    size_t ret = 0;
+    for (size_t i = 0; i < ref.size(); i++) {
+        ret += std::abs(ref[i] - out[i]) > 1e-5f * (1.f + std::abs(ref[i]));
+    }
+    return ret;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4096;
+    n = (n + 8 * N - 1) / (8 * N) * (8 * N);
+    const int reps = int(2000000000ull / (n * 24)) + 5;
+    std::vector<float> p(3 * n), q(3 * n), ref(3 * n);
+    std::vector<float> x(n), y(n), z(n), qx(n), qy(n), qz(n), r(n), rref(n);
+    for (size_t i = 0; i < n; i++) {
+        x[i] = p[3 * i] = float(i % 101) * 0.01f - 0.5f;
+        y[i] = p[3 * i + 1] = float(i % 37) * 0.1f - 1.5f;
+        z[i] = p[3 * i + 2] = float(i % 13) - 6.f;
+    }
+    const float s[3] = {2.f, -0.5f, 0.25f}, t[3] = {1.f, 2.f, -3.f};
+
+    const double m = 1e-6 * n;
+    size_t bad = 0;
+    double ta0 = best_seconds([&] { affine_scalar(n, s, t, p.data(), ref.data()); }, reps);
+    double ta1 = best_seconds([&] { affine_aos<1>(n, s, t, p.data(), q.data()); }, reps);
+    bad += mismatches(ref, q);
+    double ta4 = best_seconds([&] { affine_aos<4>(n, s, t, p.data(), q.data()); }, reps);
+    bad += mismatches(ref, q);
+    double ta8 = best_seconds([&] { affine_aos<8>(n, s, t, p.data(), q.data()); }, reps);
+    bad += mismatches(ref, q);
+    double tas = best_seconds([&] {
+        affine_soa(n, s, t, x.data(), y.data(), z.data(), qx.data(), qy.data(), qz.data());
+    }, reps);
+    for (size_t i = 0; i < n; i++) {
+        bad += qx[i] != ref[3 * i] || qy[i] != ref[3 * i + 1] || qz[i] != ref[3 * i + 2];
+    }
+
+    double tl0 = best_seconds([&] { length_scalar(n, p.data(), rref.data()); }, reps);
+    double tl1 = best_seconds([&] { length_aos(n, p.data(), r.data()); }, reps);
+    bad += mismatches(rref, r);
+    double tls = best_seconds([&] { length_soa(n, x.data(), y.data(), z.data(), r.data()); }, reps);
+    bad += mismatches(rref, r);
+
+    std::printf("n = %zu points, %s, M points/s\n", n, SIMD_WITH_AVX512 ? "AVX512" : "AVX2 + FMA");
+    std::printf("%8s %10s %10s %10s %10s %10s\n", "", "scalar", "AoS x3", "AoS x12", "AoS x24", "SoA");
+    std::printf("%8s %10.0f %10.0f %10.0f %10.0f %10.0f\n", "affine", m / ta0, m / ta1, m / ta4, m / ta8, m / tas);
+    std::printf("%8s %10.0f %10.0f %10s %10s %10.0f\n", "length", m / tl0, m / tl1, "-", "-", m / tls);
+    std::printf("mismatches %zu\n", bad);
+    return 0;
+}
@@ -1,6 +1,84 @@
 #include "simd/simd.h"
+#include "simd/image/gray.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+/// RGB / RGBA u8 to gray through simd::image vs. a scalar fixed point loop,
+/// single thread and on the global pool, megapixels/s
+/// usage: gray_scale_image [width height]
+namespace {
+using clock_type = std::chrono::steady_clock;
+
+/// keep the reference scalar, GCC auto-vectorizes at -O2 otherwise
+template <size_t C>
+__attribute__((optimize("no-tree-vectorize")))
+void gray_scalar(const uint8_t* src, size_t npixels, uint8_t* dst)
+{
+    const auto k = simd::image::detail::weights(simd::image::luma::bt601);
+    for (size_t i = 0; i < npixels; i++) {
+        dst[i] = simd::image::detail::gray_q7(src[C * i], src[C * i + 1], src[C * i + 2], k);
+    }
+}
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+
+template <size_t C>
+void run(const char* name, size_t w, size_t h, int reps)
+{
+    std::mt19937 rng(1);
+    std::vector<uint8_t> src(C * w * h), out0(w * h), out1(w * h), out2(w * h);
+    for (auto& v : src) {
+        v = static_cast<uint8_t>(rng());
+    }
+    simd::parallel::thread_pool one(1);
+    simd::parallel::options single;
+    single.pool = &one;
+
+    auto convert = [&](uint8_t* dst, const simd::parallel::options& opt) {
+        if (C == 3) {
+            simd::image::rgb_to_gray(src.data(), h, w, dst, simd::image::luma::bt601, opt);
+        } else {
+            simd::image::rgba_to_gray(src.data(), h, w, dst, simd::image::luma::bt601, opt);
+        }
+    };
+    double ts = best_seconds([&] { gray_scalar<C>(src.data(), w * h, out0.data()); }, reps);
+    double t1 = best_seconds([&] { convert(out1.data(), single); }, reps);
+    double tn = best_seconds([&] { convert(out2.data(), simd::parallel::options()); }, reps);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < w * h; i++) {
+        mismatches += (out0[i] != out1[i]) + (out0[i] != out2[i]);
+    }
+    const double mp = 1e-6 * w * h;
+    std::printf("%6s %12.1f %12.1f %12.1f %8.2fx %12zu\n", name,
+        mp / ts, mp / t1, mp / tn, ts / t1, mismatches);
+}
+}  // namespace
 
 int main(int argc, char** argv)
 {
+    size_t w = argc > 2 ? std::strtoull(argv[1], nullptr, 10) : 3840;
+    size_t h = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 2160;
+    std::printf("%zu x %zu, %zu threads in the global pool\n", w, h,
+        simd::parallel::thread_pool::global().size());
+    std::printf("%6s %12s %12s %12s %9s %12s\n", "input", "scalar MP/s", "simd MP/s",
+        "pool MP/s", "speedup", "mismatches");
+    run<3>("RGB", w, h, 20);
+    run<4>("RGBA", w, h, 20);
     return 0;
 }
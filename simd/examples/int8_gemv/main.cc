@@ -0,0 +1,87 @@
+#include "simd/simd.h"
+#include "simd/gemm/gemv.h"
+#include "simd/quant/quant.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+/// int8 weights x uint8 activations -> int32, scalar loop vs. simd::gemm::gemv,
+/// in TOPS (1e12 multiply-adds counted as 2 ops), plus quantize/dequantize
+/// throughput in M elements/s
+/// usage: int8_gemv [rows] [cols]
+/// int8_gemv runs AVX2 vpmaddubsw + vpmaddwd, int8_gemv_avx512 (built with
+/// -mavx512vnni) the vpdpbusd path
+namespace {
+using clock_type = std::chrono::steady_clock;
+
+/// keep the reference scalar, GCC auto-vectorizes at -O2 otherwise
+__attribute__((optimize("no-tree-vectorize")))
+void gemv_scalar(size_t M, size_t K, const int8_t* A, const uint8_t* x, int32_t* y)
+{
+    for (size_t i = 0; i < M; i++) {
+        int32_t s = 0;
+        for (size_t k = 0; k < K; k++) {
+            s += int32_t(A[i * K + k]) * int32_t(x[k]);
+        }
+        y[i] = s;
+    }
+}
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t M = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1024;
+    size_t K = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1024;
+    std::mt19937 rng(1);
+    std::normal_distribution<float> dist(0.f, 1.f);
+
+    /// symmetric weights at 1/16 per step keep nearly all of them within
+    /// [-64, 64], where pmaddubsw cannot saturate; mismatches would show it
+    std::vector<float> wf(M * K), xf(K);
+    for (auto& v : wf) {
+        v = dist(rng);
+    }
+    for (auto& v : xf) {
+        v = std::abs(dist(rng));
+    }
+    std::vector<int8_t> A(M * K);
+    std::vector<uint8_t> x(K);
+    simd::quant::params pw{4.f / 64, 0};
+    auto px = simd::quant::choose_params<uint8_t>(0.f, 4.f);
+    simd::quant::quantize(M * K, wf.data(), pw, A.data());
+    simd::quant::quantize(K, xf.data(), px, x.data());
+
+    std::vector<int32_t> y0(M), y1(M);
+    double ts = best_seconds([&] { gemv_scalar(M, K, A.data(), x.data(), y0.data()); }, 20);
+    double tv = best_seconds([&] { simd::gemm::gemv(M, K, A.data(), K, x.data(), y1.data()); }, 20);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < M; i++) {
+        mismatches += y0[i] != y1[i];
+    }
+    const double tops = 2e-12 * M * K;
+    std::printf("%zu x %zu int8, %s\n", M, K, SIMD_WITH_AVX512_VNNI ? "vpdpbusd" : "pmaddubsw");
+    std::printf("%12s %12s %9s %12s\n", "scalar TOPS", "simd TOPS", "speedup", "mismatches");
+    std::printf("%12.4f %12.4f %8.2fx %12zu\n", tops / ts, tops / tv, ts / tv, mismatches);
+
+    std::vector<float> back(M * K);
+    double tq = best_seconds([&] { simd::quant::quantize(M * K, wf.data(), pw, A.data()); }, 20);
+    double td = best_seconds([&] { simd::quant::dequantize(M * K, A.data(), pw, back.data()); }, 20);
+    std::printf("quantize %.1f M/s, dequantize %.1f M/s\n", 1e-6 * M * K / tq, 1e-6 * M * K / td);
+    return 0;
+}
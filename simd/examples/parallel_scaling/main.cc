@@ -0,0 +1,73 @@
+#include "simd/simd.h"
+#include "simd/parallel/parallel.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/// scaling of simd::parallel::transform/reduce from 1 to N threads
+/// usage: parallel_scaling [n] [max_threads]
+namespace {
+using clock_type = std::chrono::steady_clock;
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000000;
+    size_t max_threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10)
+                                  : simd::parallel::thread_pool::default_size();
+
+    std::vector<float, simd::aligned_allocator<float, 64>> x(n, 1.f), y(n);
+    auto axpb = [](auto v) { return v * 3.f + 1.f; };
+    auto plus = [](auto a, auto b) { return a + b; };
+
+    std::printf("n = %zu floats, %zu hardware threads\n", n,
+        simd::parallel::thread_pool::default_size());
+    std::printf("%8s %16s %8s %16s %8s\n", "threads", "transform GB/s", "speedup",
+        "reduce GB/s", "speedup");
+
+    /// 1, 2, 4, ... and max_threads itself
+    std::vector<size_t> counts;
+    for (size_t t = 1; t < max_threads; t *= 2) {
+        counts.push_back(t);
+    }
+    counts.push_back(max_threads);
+
+    double t1_transform = 0, t1_reduce = 0;
+    for (size_t nthreads : counts) {
+        simd::parallel::thread_pool pool(nthreads);
+        simd::parallel::options opt;
+        opt.pool = &pool;
+
+        double tt = best_seconds([&] {
+            simd::parallel::transform(x.data(), y.data(), n, axpb, opt);
+        }, 5);
+        volatile float s = 0;
+        double tr = best_seconds([&] {
+            s = simd::parallel::reduce(y.data(), n, 0.f, plus, opt);
+        }, 5);
+        if (nthreads == 1) {
+            t1_transform = tt;
+            t1_reduce = tr;
+        }
+        /// transform moves 2 floats per element, reduce reads 1
+        std::printf("%8zu %16.2f %8.2f %16.2f %8.2f\n", nthreads,
+            2.0 * n * sizeof(float) / tt * 1e-9, t1_transform / tt,
+            1.0 * n * sizeof(float) / tr * 1e-9, t1_reduce / tr);
+    }
+    return 0;
+}
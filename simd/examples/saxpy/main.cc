@@ -1,6 +1,73 @@
 #include "simd/simd.h"
+#include "simd/blas1/blas1.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/// saxpy (y = a * x + y) through simd::blas1::axpy vs. a scalar loop
+/// usage: saxpy [n]
+namespace {
+using clock_type = std::chrono::steady_clock;
+
+/// keep the reference scalar, GCC auto-vectorizes at -O2 otherwise
+__attribute__((optimize("no-tree-vectorize")))
+void saxpy_scalar(size_t n, float a, const float* x, float* y)
+{
+    for (size_t i = 0; i < n; i++) {
+        y[i] = a * x[i] + y[i];
+    }
+}
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+
+void run(size_t n, int reps)
+{
+    std::vector<float> x(n), y0(n), y1(n);
+    for (size_t i = 0; i < n; i++) {
+        x[i] = float(i % 100) * 0.01f;
+        y0[i] = y1[i] = 1.f;
+    }
+    /// tiny alpha keeps y bounded over many repetitions
+    const float a = 1e-6f;
+    double ts = best_seconds([&] { saxpy_scalar(n, a, x.data(), y0.data()); }, reps);
+    double tv = best_seconds([&] { simd::blas1::axpy(n, a, x.data(), y1.data()); }, reps);
+
+    float max_diff = 0;
+    for (size_t i = 0; i < n; i++) {
+        max_diff = std::max(max_diff, std::abs(y0[i] - y1[i]));
+    }
+    /// read x, read y, write y
+    const double bytes = 3.0 * n * sizeof(float);
+    std::printf("%12zu %14.2f %14.2f %8.2fx %12.2e\n", n,
+        bytes / ts * 1e-9, bytes / tv * 1e-9, ts / tv, max_diff);
+}
+}  // namespace
 
 int main(int argc, char** argv)
 {
+    std::printf("%12s %14s %14s %9s %12s\n", "n", "scalar GB/s", "simd GB/s", "speedup", "max |diff|");
+    if (argc > 1) {
+        run(std::strtoull(argv[1], nullptr, 10), 10);
+        return 0;
+    }
+    /// L1, L2, LLC and DRAM resident
+    run(1 << 10, 100000);
+    run(1 << 15, 5000);
+    run(1 << 20, 200);
+    run(1 << 25, 10);
     return 0;
 }
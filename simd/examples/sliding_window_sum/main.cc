@@ -0,0 +1,110 @@
+#include "simd/simd.h"
+#include "simd/memory/aligned_allocator.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+/// out[i] = x[i] + ... + x[i + R - 1], R = 8: scalar, R unaligned loads per
+/// output vector, and two aligned loads with simd::slide_left for the rest,
+/// Melements/s
+/// usage: sliding_window_sum [n]
+namespace {
+using clock_type = std::chrono::steady_clock;
+using vec_t = simd::Vec<float, 8>;
+constexpr size_t W = vec_t::size();
+constexpr size_t R = 8;
+
+/// keep the reference scalar, GCC auto-vectorizes at -O2 otherwise
+__attribute__((optimize("no-tree-vectorize")))
+void window_scalar(const float* x, size_t n, float* out)
+{
+    for (size_t i = 0; i + R <= n; i++) {
+        float s = 0;
+        for (size_t j = 0; j < R; j++) {
+            s += x[i + j];
+        }
+        out[i] = s;
+    }
+}
+
+void window_unaligned(const float* x, size_t n, float* out)
+{
+    for (size_t i = 0; i + W + R <= n; i += W) {
+        vec_t s = vec_t::load_unaligned(x + i);
+        for (size_t j = 1; j < R; j++) {
+            s += vec_t::load_unaligned(x + i + j);
+        }
+        s.store_aligned(out + i);
+    }
+}
+
+/// slide_left<0> + ... + slide_left<J - 1> of (a, b)
+template <size_t J>
+struct slides {
+    static vec_t sum(const vec_t& a, const vec_t& b) noexcept
+    {
+        return slides<J - 1>::sum(a, b) + simd::slide_left<J - 1>(a, b);
+    }
+};
+
+template <>
+struct slides<1> {
+    static vec_t sum(const vec_t& a, const vec_t&) noexcept
+    {
+        return a;
+    }
+};
+
+void window_slide(const float* x, size_t n, float* out)
+{
+    vec_t a = vec_t::load_aligned(x);
+    for (size_t i = 0; i + W + R <= n; i += W) {
+        vec_t b = vec_t::load_aligned(x + i + W);
+        slides<R>::sum(a, b).store_aligned(out + i);
+        a = b;
+    }
+}
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : (size_t(1) << 16);
+    n = n / W * W;
+    using buffer_t = std::vector<float, simd::aligned_allocator<float, 64>>;
+    buffer_t x(n), out0(n), out1(n), out2(n);
+    std::mt19937 rng(1);
+    for (auto& v : x) {
+        v = static_cast<float>(rng() % 1000) * 0.01f;
+    }
+    const int reps = 50;
+    double ts = best_seconds([&] { window_scalar(x.data(), n, out0.data()); }, reps);
+    double tu = best_seconds([&] { window_unaligned(x.data(), n, out1.data()); }, reps);
+    double tv = best_seconds([&] { window_slide(x.data(), n, out2.data()); }, reps);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i + W + R <= n; i++) {
+        mismatches += std::fabs(out0[i] - out1[i]) > 1e-3f || std::fabs(out0[i] - out2[i]) > 1e-3f;
+    }
+    const double me = 1e-6 * n;
+    std::printf("%zu floats, window %zu\n", n, R);
+    std::printf("%12s %12s %12s %10s %12s\n", "scalar Me/s", "loadu Me/s", "slide Me/s", "vs loadu", "mismatches");
+    std::printf("%12.1f %12.1f %12.1f %9.2fx %12zu\n", me / ts, me / tu, me / tv, tu / tv, mismatches);
+    return 0;
+}
@@ -0,0 +1,146 @@
+#include "simd/simd.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+/// data-dependent lookups through simd::lookup16/32/64 and simd::permute
+/// vs. scalar table loads, MB/s of input
+/// usage: table_lookup [bytes], the default input stays in L2
+namespace {
+using clock_type = std::chrono::steady_clock;
+constexpr size_t W = 32;
+using bytes_t = simd::Vec<uint8_t, W>;
+
+/// keep the references scalar, GCC auto-vectorizes at -O2 otherwise
+template <size_t N>
+__attribute__((optimize("no-tree-vectorize")))
+void lookup_scalar(const uint8_t* table, const uint8_t* src, size_t n, uint8_t* dst)
+{
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = table[src[i] % N];
+    }
+}
+
+__attribute__((optimize("no-tree-vectorize")))
+void permute_scalar(const float* x, const int32_t* idx, size_t n, float* dst)
+{
+    for (size_t i = 0; i < n; i += 8) {
+        for (size_t j = 0; j < 8; j++) {
+            dst[i + j] = x[i + (idx[i + j] & 7)];
+        }
+    }
+}
+
+template <size_t N>
+void lookup_simd(const simd::Vec<uint8_t, N>& table, const uint8_t* src, size_t n, uint8_t* dst);
+
+template <>
+void lookup_simd<16>(const simd::Vec<uint8_t, 16>& table, const uint8_t* src, size_t n, uint8_t* dst)
+{
+    for (size_t i = 0; i < n; i += W) {
+        simd::lookup16(table, bytes_t::load_unaligned(src + i)).store_unaligned(dst + i);
+    }
+}
+
+template <>
+void lookup_simd<32>(const simd::Vec<uint8_t, 32>& table, const uint8_t* src, size_t n, uint8_t* dst)
+{
+    for (size_t i = 0; i < n; i += W) {
+        simd::lookup32(table, bytes_t::load_unaligned(src + i)).store_unaligned(dst + i);
+    }
+}
+
+template <>
+void lookup_simd<64>(const simd::Vec<uint8_t, 64>& table, const uint8_t* src, size_t n, uint8_t* dst)
+{
+    for (size_t i = 0; i < n; i += W) {
+        simd::lookup64(table, bytes_t::load_unaligned(src + i)).store_unaligned(dst + i);
+    }
+}
+
+void permute_simd(const float* x, const int32_t* idx, size_t n, float* dst)
+{
+    using vf = simd::Vec<float, 8>;
+    using vi = simd::Vec<int32_t, 8>;
+    for (size_t i = 0; i < n; i += 8) {
+        simd::permute(vf::load_unaligned(x + i), vi::load_unaligned(idx + i)).store_unaligned(dst + i);
+    }
+}
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+
+void report(const char* name, size_t bytes, double ts, double tv, size_t mismatches)
+{
+    const double mb = 1e-6 * bytes;
+    std::printf("%10s %12.1f %12.1f %8.2fx %12zu\n", name, mb / ts, mb / tv, ts / tv, mismatches);
+}
+
+template <size_t N>
+void run_lookup(const char* name, const std::vector<uint8_t>& src, int reps)
+{
+    simd::Vec<uint8_t, N> table;
+    uint8_t t[N];
+    for (size_t i = 0; i < N; i++) {
+        t[i] = table[i] = static_cast<uint8_t>(i * 37 + 5);
+    }
+    const size_t n = src.size();
+    std::vector<uint8_t> out0(n), out1(n);
+    double ts = best_seconds([&] { lookup_scalar<N>(t, src.data(), n, out0.data()); }, reps);
+    double tv = best_seconds([&] { lookup_simd<N>(table, src.data(), n, out1.data()); }, reps);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < n; i++) {
+        mismatches += out0[i] != out1[i];
+    }
+    report(name, n, ts, tv, mismatches);
+}
+
+void run_permute(size_t n, int reps)
+{
+    std::mt19937 rng(2);
+    std::vector<float> x(n), out0(n), out1(n);
+    std::vector<int32_t> idx(n);
+    for (size_t i = 0; i < n; i++) {
+        x[i] = static_cast<float>(rng() % 1000);
+        idx[i] = static_cast<int32_t>(rng() % 8);
+    }
+    double ts = best_seconds([&] { permute_scalar(x.data(), idx.data(), n, out0.data()); }, reps);
+    double tv = best_seconds([&] { permute_simd(x.data(), idx.data(), n, out1.data()); }, reps);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < n; i++) {
+        mismatches += out0[i] != out1[i];
+    }
+    report("permute8", n * sizeof(float), ts, tv, mismatches);
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : (size_t(1) << 18);
+    n = n / W * W;
+    std::mt19937 rng(1);
+    std::vector<uint8_t> src(n);
+    for (auto& v : src) {
+        v = static_cast<uint8_t>(rng());
+    }
+    std::printf("%zu bytes\n", n);
+    std::printf("%10s %12s %12s %9s %12s\n", "op", "scalar MB/s", "simd MB/s", "speedup", "mismatches");
+    run_lookup<16>("lookup16", src, 20);
+    run_lookup<32>("lookup32", src, 20);
+    run_lookup<64>("lookup64", src, 20);
+    run_permute(n / 4, 20);
+    return 0;
+}
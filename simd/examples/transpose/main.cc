@@ -0,0 +1,73 @@
+#include "simd/simd.h"
+#include "simd/bulk/transpose.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/// n x n float transpose through simd::bulk::transpose vs. a naive scalar loop
+/// usage: transpose [n]
+namespace {
+using clock_type = std::chrono::steady_clock;
+
+/// keep the reference scalar, GCC auto-vectorizes at -O2 otherwise
+__attribute__((optimize("no-tree-vectorize")))
+void transpose_scalar(size_t n, const float* in, float* out)
+{
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            out[j * n + i] = in[i * n + j];
+        }
+    }
+}
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+
+void run(size_t n, int reps)
+{
+    std::vector<float> in(n * n), out0(n * n), out1(n * n);
+    for (size_t i = 0; i < n * n; i++) {
+        in[i] = float(i);
+    }
+    double ts = best_seconds([&] { transpose_scalar(n, in.data(), out0.data()); }, reps);
+    double tv = best_seconds([&] { simd::bulk::transpose(n, n, in.data(), out1.data()); }, reps);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < n * n; i++) {
+        mismatches += out0[i] != out1[i];
+    }
+    /// read in, write out
+    const double bytes = 2.0 * n * n * sizeof(float);
+    std::printf("%8zu %14.2f %14.2f %8.2fx %12zu\n", n,
+        bytes / ts * 1e-9, bytes / tv * 1e-9, ts / tv, mismatches);
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    std::printf("%8s %14s %14s %9s %12s\n", "n", "naive GB/s", "simd GB/s", "speedup", "mismatches");
+    if (argc > 1) {
+        run(std::strtoull(argv[1], nullptr, 10), 10);
+        return 0;
+    }
+    /// L1, L2, LLC and DRAM resident; powers of two are the worst case
+    /// for the naive loop, every column store maps to the same cache sets
+    run(64, 100000);
+    run(256, 5000);
+    run(1000, 200);
+    run(1024, 200);
+    run(4096, 10);
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include "simd/simd.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/// logical vector width vs. throughput, float, W lanes per Vec:
+/// - sum: acc += x over an array; one Vec accumulator is one dependent
+///   add chain per register, so Vec<float, 4 * native> carries 4
+///   independent chains and hides the add latency with plain syntax
+/// - poly: degree 11 Horner per element, y = p(x); elements are
+///   independent, so out-of-order execution already overlaps the fmadd
+///   chains of successive iterations and width barely matters, until
+///   register pressure spills (8 registers)
+/// usage: wide_vec_bench [n]
+/// built as is it runs AVX2 + FMA; add
+/// -mavx512f -mavx512cd -mavx512dq -mavx512bw -mavx512vl
+/// to the compile options for the AVX512 path
+namespace {
+using clock_type = std::chrono::steady_clock;
+constexpr size_t N = simd::native_lanes<float>();
+
+template <size_t W>
+__attribute__((noinline))
+float sum(size_t n, const float* x)
+{
+    using vec_t = simd::Vec<float, W>;
+    vec_t acc(0.f);
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        acc += vec_t::load_unaligned(x + i);
+    }
+    float ret = simd::reduce_sum(acc);
+    for (; i < n; i++) {
+        ret += x[i];
+    }
+    return ret;
+}
+
+template <typename V>
+V horner(const V&, const V& p)
+{
+    return p;
+}
+
+template <typename V, typename... Cs>
+V horner(const V& x, const V& p, float c, Cs... cs)
+{
+    return horner(x, simd::fmadd(p, x, V(c)), cs...);
+}
+
+template <size_t W>
+__attribute__((noinline))
+void poly(size_t n, const float* x, float* y)
+{
+    using vec_t = simd::Vec<float, W>;
+    static const float c[] = {1.f / 39916800, 1.f / 3628800, 1.f / 362880, 1.f / 40320, 1.f / 5040,
+                              1.f / 720, 1.f / 120, 1.f / 24, 1.f / 6, 0.5f, 1.f, 1.f};
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        horner(vec_t::load_unaligned(x + i), vec_t(c[0]), c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8],
+               c[9], c[10], c[11]).store_unaligned(y + i);
+    }
+    for (; i < n; i++) {
+        float p = c[0];
+        for (int k = 1; k < 12; k++) {
+            p = p * x[i] + c[k];
+        }
+        y[i] = p;
+    }
+}
+
+template <typename F>
+double best_seconds(F&& f, int reps)
+{
+    double best = 1e30;
+    for (int r = 0; r < reps; r++) {
+        auto t0 = clock_type::now();
+        f();
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        best = dt.count() < best ? dt.count() : best;
+    }
+    return best;
+}
+
+template <size_t W>
+void run(size_t n, int reps, const std::vector<float>& x, std::vector<float>& y)
+{
+    volatile float sink = 0;
+    double ts = best_seconds([&] { sink = sink + sum<W>(n, x.data()); }, reps);
+    double tp = best_seconds([&] { poly<W>(n, x.data(), y.data()); }, reps);
+    std::printf("%6zu %6zu %12.0f %12.0f %14.6f\n", W * 32, W / N, 1e-6 * n / ts, 1e-6 * n / tp, sum<W>(n, x.data()));
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 8192;
+    const int reps = int(4000000000ull / (n * 32)) + 5;
+    std::vector<float> x(n), y(n);
+    for (size_t i = 0; i < n; i++) {
+        x[i] = float(i % 1000) * 1e-3f - 0.5f;
+    }
+    std::printf("n = %zu float, %s, M elements/s\n", n, SIMD_WITH_AVX512 ? "AVX512" : "AVX2 + FMA");
+    std::printf("%6s %6s %12s %12s %14s\n", "bits", "regs", "sum", "poly", "sum value");
+    run<N>(n, reps, x, y);
+    run<2 * N>(n, reps, x, y);
+    run<4 * N>(n, reps, x, y);
+    run<8 * N>(n, reps, x, y);
+    return 0;
+}
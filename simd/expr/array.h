@@ -0,0 +1,481 @@
+#pragma once
+
+#include "simd/simd.h"
+#include "simd/types/vec_expr.h"
+#include "simd/memory/alignment.h"
+#include "simd/parallel/parallel.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace simd {
+/// lazy element-wise expressions over arrays: operators and functions on
+/// aligned_span build a compile-time tree, nothing is computed until
+/// `assign(out, e)` runs the whole tree in one loop over the arrays:
+///
+///     expr::aligned_span<const float> x(px, n), c(pc, n);
+///     expr::aligned_span<float> y(py, n);
+///     expr::assign(y, expr::exp(a * x + b) / (1.f + c));
+///
+/// one pass over memory instead of one per op, no temporaries; each
+/// vector step is a Vec expression (types/vec_expr.h), so a * x + b
+/// becomes one fmadd.
+/// `assign(out, e, parallel::options)` cuts the loop into cache line
+/// aligned chunks on the thread pool.
+/// every span must start on a Vec<T, native_lanes<T>()> boundary and
+/// have the size of `out`; scalars broadcast
+namespace expr {
+/// T[size] view with data() aligned for Vec<T, native_lanes<T>()>
+template <typename T>
+class aligned_span
+{
+public:
+    using value_type = typename std::remove_const<T>::type;
+
+    aligned_span(T* data, size_t size) noexcept
+        : data_(data), size_(size)
+    {
+        assert(is_aligned(data, Vec<value_type, native_lanes<value_type>()>::alignment()));
+    }
+
+    template <typename A>
+    aligned_span(std::vector<value_type, A>& v) noexcept
+        : aligned_span(v.data(), v.size())
+    {
+    }
+
+    template <typename A, typename U = T, REQUIRES(std::is_const<U>::value)>
+    aligned_span(const std::vector<value_type, A>& v) noexcept
+        : aligned_span(v.data(), v.size())
+    {
+    }
+
+    /// a writable span reads as a const one
+    template <typename U = T, REQUIRES(!std::is_const<U>::value)>
+    operator aligned_span<const value_type>() const noexcept
+    {
+        return aligned_span<const value_type>(data_, size_);
+    }
+
+    T* data() const noexcept
+    {
+        return data_;
+    }
+
+    size_t size() const noexcept
+    {
+        return size_;
+    }
+
+private:
+    T* data_;
+    size_t size_;
+};
+
+/// tree nodes; each one gives, for a lane count W,
+/// - at<W>(i): the Vec expression of elements [i, i + W), i aligned
+/// - tail<W>(i, m): the same for the last m < W elements, padded with 0
+/// - size(): elements, or array_npos for a broadcast scalar
+constexpr size_t array_npos = std::numeric_limits<size_t>::max();
+
+template <typename T>
+struct ArrayRef
+{
+    using value_type = T;
+
+    const T* data;
+    size_t n;
+
+    size_t size() const noexcept
+    {
+        return n;
+    }
+
+    template <size_t W>
+    SIMD_INLINE
+    Term<Vec<T, W>> at(size_t i) const noexcept
+    {
+        return Term<Vec<T, W>>(Vec<T, W>::load_aligned(data + i));
+    }
+
+    template <size_t W>
+    SIMD_INLINE
+    Term<Vec<T, W>> tail(size_t i, size_t m) const noexcept
+    {
+        alignas(Vec<T, W>::alignment()) T buf[W] = {};
+        std::copy(data + i, data + i + m, buf);
+        return Term<Vec<T, W>>(Vec<T, W>::load_aligned(buf));
+    }
+};
+
+template <typename T>
+struct ArrayScalar
+{
+    using value_type = T;
+
+    T value;
+
+    size_t size() const noexcept
+    {
+        return array_npos;
+    }
+
+    template <size_t W>
+    SIMD_INLINE
+    Term<Vec<T, W>> at(size_t) const noexcept
+    {
+        return Term<Vec<T, W>>(Vec<T, W>(value));
+    }
+
+    template <size_t W>
+    SIMD_INLINE
+    Term<Vec<T, W>> tail(size_t, size_t) const noexcept
+    {
+        return Term<Vec<T, W>>(Vec<T, W>(value));
+    }
+};
+
+/// x op y as a Vec expression, so vec_expr fuses across nodes
+template <typename Op, typename L, typename R>
+struct ArrayBinary
+{
+    using value_type = typename L::value_type;
+
+    L l;
+    R r;
+
+    size_t size() const noexcept
+    {
+        return std::min(l.size(), r.size());
+    }
+
+    template <size_t W>
+    SIMD_INLINE
+    Binary<Op, decltype(l.template at<W>(0)), decltype(r.template at<W>(0))> at(size_t i) const noexcept
+    {
+        return {l.template at<W>(i), r.template at<W>(i)};
+    }
+
+    template <size_t W>
+    SIMD_INLINE
+    Binary<Op, decltype(l.template at<W>(0)), decltype(r.template at<W>(0))> tail(size_t i, size_t m) const noexcept
+    {
+        return {l.template tail<W>(i, m), r.template tail<W>(i, m)};
+    }
+};
+
+template <typename Op, typename X>
+struct ArrayUnary
+{
+    using value_type = typename X::value_type;
+
+    X x;
+
+    size_t size() const noexcept
+    {
+        return x.size();
+    }
+
+    template <size_t W>
+    SIMD_INLINE
+    Unary<Op, decltype(x.template at<W>(0))> at(size_t i) const noexcept
+    {
+        return Unary<Op, decltype(x.template at<W>(0))>(x.template at<W>(i));
+    }
+
+    template <size_t W>
+    SIMD_INLINE
+    Unary<Op, decltype(x.template at<W>(0))> tail(size_t i, size_t m) const noexcept
+    {
+        return Unary<Op, decltype(x.template at<W>(0))>(x.template tail<W>(i, m));
+    }
+};
+
+/// F applied to the evaluated Vec of each operand: math functions, min, max
+template <typename F, typename... X>
+struct ArrayCall
+{
+    using value_type = typename std::tuple_element<0, std::tuple<X...>>::type::value_type;
+
+    std::tuple<X...> xs;
+
+    size_t size() const noexcept
+    {
+        return size(simd::detail::make_index_sequence<sizeof...(X)>());
+    }
+
+    template <size_t W>
+    SIMD_INLINE
+    Term<Vec<value_type, W>> at(size_t i) const noexcept
+    {
+        return at<W>(i, simd::detail::make_index_sequence<sizeof...(X)>());
+    }
+
+    template <size_t W>
+    SIMD_INLINE
+    Term<Vec<value_type, W>> tail(size_t i, size_t m) const noexcept
+    {
+        return tail<W>(i, m, simd::detail::make_index_sequence<sizeof...(X)>());
+    }
+
+private:
+    template <size_t... I>
+    size_t size(simd::detail::index_sequence<I...>) const noexcept
+    {
+        return std::min({std::get<I>(xs).size()...});
+    }
+
+    template <size_t W, size_t... I>
+    SIMD_INLINE
+    Term<Vec<value_type, W>> at(size_t i, simd::detail::index_sequence<I...>) const noexcept
+    {
+        return Term<Vec<value_type, W>>(F::apply(Vec<value_type, W>(std::get<I>(xs).template at<W>(i))...));
+    }
+
+    template <size_t W, size_t... I>
+    SIMD_INLINE
+    Term<Vec<value_type, W>> tail(size_t i, size_t m, simd::detail::index_sequence<I...>) const noexcept
+    {
+        return Term<Vec<value_type, W>>(F::apply(Vec<value_type, W>(std::get<I>(xs).template tail<W>(i, m))...));
+    }
+};
+
+namespace detail {
+template <typename E>
+struct is_node : std::false_type {};
+template <typename T>
+struct is_node<ArrayRef<T>> : std::true_type {};
+template <typename T>
+struct is_node<ArrayScalar<T>> : std::true_type {};
+template <typename Op, typename L, typename R>
+struct is_node<ArrayBinary<Op, L, R>> : std::true_type {};
+template <typename Op, typename X>
+struct is_node<ArrayUnary<Op, X>> : std::true_type {};
+template <typename F, typename... X>
+struct is_node<ArrayCall<F, X...>> : std::true_type {};
+
+template <typename E>
+struct is_span : std::false_type {};
+template <typename T>
+struct is_span<aligned_span<T>> : std::true_type {};
+
+/// spans and nodes take part in array expressions
+template <typename E>
+struct is_operand : std::integral_constant<bool, is_node<E>::value || is_span<E>::value> {};
+
+template <typename E>
+SIMD_INLINE
+const E& as_node(const E& e) noexcept
+{
+    return e;
+}
+
+template <typename T>
+SIMD_INLINE
+ArrayRef<typename aligned_span<T>::value_type> as_node(const aligned_span<T>& s) noexcept
+{
+    return {s.data(), s.size()};
+}
+
+template <typename E>
+using node_t = typename std::decay<decltype(as_node(std::declval<const E&>()))>::type;
+
+/// element type of an operand, a scalar takes it from the other side
+template <typename E, typename Other, typename Enable = void>
+struct operand
+{
+    using type = node_t<E>;
+
+    SIMD_INLINE
+    static type make(const E& e) noexcept
+    {
+        return as_node(e);
+    }
+};
+
+template <typename E, typename Other>
+struct operand<E, Other, traits::enable_if_t<std::is_arithmetic<E>::value>>
+{
+    using type = ArrayScalar<typename node_t<Other>::value_type>;
+
+    SIMD_INLINE
+    static type make(const E& e) noexcept
+    {
+        return {static_cast<typename node_t<Other>::value_type>(e)};
+    }
+};
+
+template <typename L, typename R>
+using enable_array_binary_t = traits::enable_if_t<(is_operand<L>::value && (is_operand<R>::value || std::is_arithmetic<R>::value))
+                                            || (std::is_arithmetic<L>::value && is_operand<R>::value)>;
+
+template <typename Op, typename L, typename R>
+using binary_t = ArrayBinary<Op, typename operand<L, R>::type, typename operand<R, L>::type>;
+
+struct min_fn
+{
+    static constexpr bool heavy = false;
+    template <typename V>
+    SIMD_INLINE
+    static V apply(const V& x, const V& y) noexcept { return simd::min(x, y); }
+};
+
+struct max_fn
+{
+    static constexpr bool heavy = false;
+    template <typename V>
+    SIMD_INLINE
+    static V apply(const V& x, const V& y) noexcept { return simd::max(x, y); }
+};
+
+#define DEFINE_ARRAY_FN(FN, HEAVY) \
+struct FN##_fn \
+{ \
+    static constexpr bool heavy = HEAVY; \
+    template <typename V> \
+    SIMD_INLINE \
+    static V apply(const V& x) noexcept { return simd::FN(x); } \
+}; \
+///
+
+DEFINE_ARRAY_FN(abs, false);
+DEFINE_ARRAY_FN(sqrt, false);
+DEFINE_ARRAY_FN(exp, true);
+DEFINE_ARRAY_FN(log, true);
+DEFINE_ARRAY_FN(sin, true);
+DEFINE_ARRAY_FN(cos, true);
+
+#undef DEFINE_ARRAY_FN
+
+/// vectors per loop iteration: 4 hide the latency of arithmetic trees,
+/// a polynomial function (exp, log, sin, cos) already fills the
+/// pipeline, and 4 copies of it spill registers
+template <typename E>
+struct unroll : std::integral_constant<size_t, 4> {};
+template <typename Op, typename L, typename R>
+struct unroll<ArrayBinary<Op, L, R>>
+    : std::integral_constant<size_t, std::min(unroll<L>::value, unroll<R>::value)> {};
+template <typename Op, typename X>
+struct unroll<ArrayUnary<Op, X>> : unroll<X> {};
+template <typename F, typename... X>
+struct unroll<ArrayCall<F, X...>>
+    : std::integral_constant<size_t, F::heavy ? 1 : std::min({size_t(4), unroll<X>::value...})> {};
+
+/// out[i, i + n) = e, i on a vector boundary
+template <typename T, typename E>
+void eval_range(T* out, const E& e, size_t i, size_t n) noexcept
+{
+    constexpr size_t W = native_lanes<T>();
+    using vec_t = Vec<T, W>;
+    if (unroll<E>::value == 4) {
+        for (; i + 4 * W <= n; i += 4 * W) {
+            const vec_t r0 = e.template at<W>(i);
+            const vec_t r1 = e.template at<W>(i + W);
+            const vec_t r2 = e.template at<W>(i + 2 * W);
+            const vec_t r3 = e.template at<W>(i + 3 * W);
+            r0.store_aligned(out + i);
+            r1.store_aligned(out + i + W);
+            r2.store_aligned(out + i + 2 * W);
+            r3.store_aligned(out + i + 3 * W);
+        }
+    }
+    for (; i + W <= n; i += W) {
+        vec_t(e.template at<W>(i)).store_aligned(out + i);
+    }
+    if (i < n) {
+        /// padded lanes are computed and dropped
+        alignas(vec_t::alignment()) T buf[W];
+        vec_t(e.template tail<W>(i, n - i)).store_aligned(buf);
+        std::copy(buf, buf + (n - i), out + i);
+    }
+}
+}  // namespace detail
+
+#define DEFINE_ARRAY_BINARY_OP(SYM, OP) \
+template <typename L, typename R, typename = detail::enable_array_binary_t<L, R>> \
+SIMD_INLINE \
+detail::binary_t<op::OP, L, R> operator SYM(const L& l, const R& r) noexcept \
+{ \
+    return {detail::operand<L, R>::make(l), detail::operand<R, L>::make(r)}; \
+} \
+///
+
+DEFINE_ARRAY_BINARY_OP(+, add);
+DEFINE_ARRAY_BINARY_OP(-, sub);
+DEFINE_ARRAY_BINARY_OP(*, mul);
+DEFINE_ARRAY_BINARY_OP(/, div);
+
+#undef DEFINE_ARRAY_BINARY_OP
+
+template <typename X, REQUIRES(detail::is_operand<X>::value)>
+SIMD_INLINE
+ArrayUnary<op::neg, detail::node_t<X>> operator -(const X& x) noexcept
+{
+    return {detail::as_node(x)};
+}
+
+#define DEFINE_ARRAY_UNARY_FN(FN) \
+template <typename X, REQUIRES(detail::is_operand<X>::value)> \
+SIMD_INLINE \
+ArrayCall<detail::FN##_fn, detail::node_t<X>> FN(const X& x) noexcept \
+{ \
+    return {std::make_tuple(detail::as_node(x))}; \
+} \
+///
+
+DEFINE_ARRAY_UNARY_FN(abs);
+DEFINE_ARRAY_UNARY_FN(sqrt);
+DEFINE_ARRAY_UNARY_FN(exp);
+DEFINE_ARRAY_UNARY_FN(log);
+DEFINE_ARRAY_UNARY_FN(sin);
+DEFINE_ARRAY_UNARY_FN(cos);
+
+#undef DEFINE_ARRAY_UNARY_FN
+
+#define DEFINE_ARRAY_BINARY_FN(FN) \
+template <typename L, typename R, typename = detail::enable_array_binary_t<L, R>> \
+SIMD_INLINE \
+ArrayCall<detail::FN##_fn, typename detail::operand<L, R>::type, typename detail::operand<R, L>::type> \
+FN(const L& l, const R& r) noexcept \
+{ \
+    return {std::make_tuple(detail::operand<L, R>::make(l), detail::operand<R, L>::make(r))}; \
+} \
+///
+
+DEFINE_ARRAY_BINARY_FN(min);
+DEFINE_ARRAY_BINARY_FN(max);
+
+#undef DEFINE_ARRAY_BINARY_FN
+
+/// out[i] = e[i] for every i, one fused loop
+template <typename T, typename E, REQUIRES(detail::is_operand<E>::value)>
+void assign(const aligned_span<T>& out, const E& e) noexcept
+{
+    const auto node = detail::as_node(e);
+    assert(node.size() == array_npos || node.size() == out.size());
+    detail::eval_range(out.data(), node, 0, out.size());
+}
+
+/// the same loop cut into chunks on the thread pool of `opt`; chunk
+/// bounds fall on cache lines of `out`, so on vector bounds of every span
+template <typename T, typename E, REQUIRES(detail::is_operand<E>::value)>
+void assign(const aligned_span<T>& out, const E& e, const parallel::options& opt)
+{
+    const auto node = detail::as_node(e);
+    assert(node.size() == array_npos || node.size() == out.size());
+    auto& pool = opt.pool ? *opt.pool : parallel::thread_pool::global();
+    auto c = parallel::detail::make_chunking<T>(out.data(), out.size(), opt.chunk);
+    auto body = [&](size_t k) {
+        detail::eval_range(out.data(), node, c.begin(k), c.begin(k + 1));
+    };
+    parallel::detail::for_each_chunk(pool, c.count, body);
+}
+}  // namespace expr
+}  // namespace simd
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "simd/simd.h"
+
+#include <cstddef>
+
+namespace simd {
+namespace gemm {
+/// register and cache blocking of the GEMM loop nest
+///
+///   for jc in [0, N) step NC        B panel KC x NC   -> L3
+///     for pc in [0, K) step KC
+///       pack B(pc, jc)
+///       for ic in [0, M) step MC    A block MC x KC   -> L2
+///         pack A(ic, pc)
+///         for jr in [0, NC) step NR B micro-panel KC x NR -> L1
+///           for ir in [0, MC) step MR
+///             micro-kernel: C(MR x NR) += A(MR x KC) * B(KC x NR)
+///
+/// MR x NR accumulators stay in registers: MR * NR / W accumulators
+/// + NR / W B vectors + 1 broadcast A must fit the register file
+template <typename T>
+struct blocking {
+    /// lanes of one register
+    static constexpr size_t W = native_lanes<T>();
+#if SIMD_WITH_AVX512
+    /// 32 zmm: 14 x 2 accumulators + 2 B + 1 A = 31
+    static constexpr size_t MR = 14;
+    static constexpr size_t NR = 2 * W;
+#else
+    /// 16 xmm/ymm: 6 x 2 accumulators + 2 B + 1 A = 15
+    static constexpr size_t MR = 6;
+    static constexpr size_t NR = 2 * W;
+#endif
+    /// k depth of one rank-KC update: the B micro-panel (KC x NR) stays
+    /// in L1 (16KB for AVX, 32KB for AVX-512 floats) across the ir loop
+    static constexpr size_t KC = 256;
+    /// A block (MC x KC) takes 256KB, a fraction of L2
+    static constexpr size_t MC = 256 * 1024 / (KC * sizeof(T)) / MR * MR;
+    /// B panel (KC x NC) takes 4MB (float) of L3
+    static constexpr size_t NC = 4096 / NR * NR;
+
+    static_assert(MR * (NR / W) + NR / W + 1 <= (SIMD_WITH_AVX512 ? 32 : 16),
+                  "micro-kernel does not fit the register file");
+};
+}  // namespace gemm
+}  // namespace simd
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "simd/simd.h"
+#include "simd/gemm/micro_kernel.h"
+
+#include <cstddef>
+
+/// matrix-vector products on low precision storage, A is M x K row-major
+/// - bfloat16 A and x, float y: y = alpha * A * x + beta * y, each step
+///   consumes 2W bfloat16 of a row through `dot_bf16` (a single vdpbf16ps
+///   with SIMD_WITH_AVX512_BF16, shift-and-fmadd elsewhere)
+/// - int8 A, uint8 x, int32 y: y = A * x, each step consumes 4W bytes of a
+///   row through `dot_u8i8` (vpdpbusd with SIMD_WITH_AVX512_VNNI,
+///   (v)pmaddubsw + (v)pmaddwd elsewhere, see its saturation caveat)
+///
+/// MR rows run together so every x load feeds MR independent accumulators
+namespace simd {
+namespace gemm {
+namespace detail {
+/// out[r] = dot(A row r, x) for MR consecutive rows
+template <size_t MR>
+SIMD_INLINE
+void gemv_rows(size_t K, const bfloat16* a, size_t lda, const bfloat16* x, float* out) noexcept
+{
+    using vec_t = Vec<float, native_lanes<float>()>;
+    constexpr size_t S = 2 * vec_t::size();
+    vec_t acc[MR];
+    static_for<MR>([&](auto r) {
+        acc[r] = vec_t(0.f);
+    });
+    size_t k = 0;
+    for (; k + S <= K; k += S) {
+        static_for<MR>([&](auto r) {
+            acc[r] = dot_bf16(acc[r], a + r * lda + k, x + k);
+        });
+    }
+    static_for<MR>([&](auto r) {
+        float s = reduce_sum(acc[r]);
+        for (size_t j = k; j < K; j++) {
+            s += float(a[r * lda + j]) * float(x[j]);
+        }
+        out[r] = s;
+    });
+}
+
+/// out[r] = dot(A row r, x) for MR consecutive rows, int8 by uint8
+template <size_t MR>
+SIMD_INLINE
+void gemv_rows(size_t K, const int8_t* a, size_t lda, const uint8_t* x, int32_t* out) noexcept
+{
+    constexpr size_t W = native_lanes<int32_t>();
+    constexpr size_t S = 4 * W;
+    using vec_t = Vec<int32_t, W>;
+    vec_t acc[MR];
+    static_for<MR>([&](auto r) {
+        acc[r] = vec_t(0);
+    });
+    size_t k = 0;
+    for (; k + S <= K; k += S) {
+        auto xv = Vec<uint8_t, S>::load_unaligned(x + k);
+        static_for<MR>([&](auto r) {
+            acc[r] = dot_u8i8(acc[r], xv, Vec<int8_t, S>::load_unaligned(a + r * lda + k));
+        });
+    }
+    static_for<MR>([&](auto r) {
+        int32_t s = reduce_sum(acc[r]);
+        for (size_t j = k; j < K; j++) {
+            s += int32_t(a[r * lda + j]) * int32_t(x[j]);
+        }
+        out[r] = s;
+    });
+}
+}  // namespace detail
+
+/// beta == 0 overwrites y without reading it
+inline void gemv(size_t M, size_t K, float alpha, const bfloat16* A, size_t lda,
+                 const bfloat16* x, float beta, float* y) noexcept
+{
+    constexpr size_t MR = 4;
+    float dots[MR];
+    auto update = [&](size_t i, float d) {
+        y[i] = beta != 0.f ? alpha * d + beta * y[i] : alpha * d;
+    };
+    size_t i = 0;
+    for (; i + MR <= M; i += MR) {
+        detail::gemv_rows<MR>(K, A + i * lda, lda, x, dots);
+        for (size_t r = 0; r < MR; r++) {
+            update(i + r, dots[r]);
+        }
+    }
+    for (; i < M; i++) {
+        detail::gemv_rows<1>(K, A + i * lda, lda, x, dots);
+        update(i, dots[0]);
+    }
+}
+
+inline void gemv(size_t M, size_t K, const int8_t* A, size_t lda,
+                 const uint8_t* x, int32_t* y) noexcept
+{
+    constexpr size_t MR = 4;
+    size_t i = 0;
+    for (; i + MR <= M; i += MR) {
+        detail::gemv_rows<MR>(K, A + i * lda, lda, x, y + i);
+    }
+    for (; i < M; i++) {
+        detail::gemv_rows<1>(K, A + i * lda, lda, x, y + i);
+    }
+}
+}  // namespace gemm
+}  // namespace simd
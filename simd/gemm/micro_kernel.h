@@ -0,0 +1,87 @@
+#pragma once
+
+#include "simd/simd.h"
+#include "simd/util/static_for.h"
+
+#include <cstddef>
+
+namespace simd {
+namespace gemm {
+namespace detail {
+using simd::detail::static_for;
+
+/// ab = A(MR x kc) * B(kc x NR) from packed micro-panels
+/// MR x NR / W accumulators live in registers for the whole k loop,
+/// each step loads NR / W vectors of B and broadcasts MR scalars of A
+template <size_t MR, size_t NR, typename T>
+SIMD_INLINE
+void micro_kernel(size_t kc, const T* __restrict a, const T* __restrict b,
+                  Vec<T, native_lanes<T>()> (&ab)[MR][NR / native_lanes<T>()]) noexcept
+{
+    constexpr size_t W = native_lanes<T>();
+    constexpr size_t NV = NR / W;
+    using vec_t = Vec<T, W>;
+
+    static_for<MR>([&](auto i) {
+        static_for<NV>([&](auto j) {
+            ab[i][j] = vec_t(T(0));
+        });
+    });
+    for (size_t k = 0; k < kc; k++) {
+        vec_t bv[NV];
+        static_for<NV>([&](auto j) {
+            bv[j] = vec_t::load_aligned(b + j * W);
+        });
+        static_for<MR>([&](auto i) {
+            vec_t av(a[i]);
+            static_for<NV>([&](auto j) {
+                ab[i][j] = fmadd(av, bv[j], ab[i][j]);
+            });
+        });
+        a += MR;
+        b += NR;
+    }
+}
+
+/// C(mr x nr) = alpha * ab + beta * C, mr <= MR, nr <= NR
+/// beta == 0 never reads C, so it may hold garbage (NaN)
+template <size_t MR, size_t NR, typename T>
+SIMD_INLINE
+void update_c(const Vec<T, native_lanes<T>()> (&ab)[MR][NR / native_lanes<T>()],
+              size_t mr, size_t nr, T alpha, T beta, T* c, size_t ldc) noexcept
+{
+    constexpr size_t W = native_lanes<T>();
+    constexpr size_t NV = NR / W;
+    using vec_t = Vec<T, W>;
+
+    const vec_t va(alpha), vb(beta);
+    if (mr == MR && nr == NR) {
+        static_for<MR>([&](auto i) {
+            static_for<NV>([&](auto j) {
+                T* p = c + i * ldc + j * W;
+                vec_t r = va * ab[i][j];
+                if (beta != T(0)) {
+                    r = fmadd(vb, vec_t::load_unaligned(p), r);
+                }
+                r.store_unaligned(p);
+            });
+        });
+        return;
+    }
+    /// edge tile
+    alignas(vec_t::alignment()) T tile[MR][NR];
+    static_for<MR>([&](auto i) {
+        static_for<NV>([&](auto j) {
+            (va * ab[i][j]).store_aligned(&tile[i][j * W]);
+        });
+    });
+    for (size_t i = 0; i < mr; i++) {
+        for (size_t j = 0; j < nr; j++) {
+            T& r = c[i * ldc + j];
+            r = beta != T(0) ? tile[i][j] + beta * r : tile[i][j];
+        }
+    }
+}
+}  // namespace detail
+}  // namespace gemm
+}  // namespace simd
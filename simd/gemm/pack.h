@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+namespace simd {
+namespace gemm {
+namespace detail {
+/// strided 2D view, op(X)(i, j) with optional transpose
+template <typename T>
+struct matrix_view {
+    const T* data;
+    size_t ld;
+    bool trans;
+
+    const T& operator()(size_t i, size_t j) const noexcept
+    {
+        return trans ? data[j * ld + i] : data[i * ld + j];
+    }
+};
+
+/// pack the mc x kc block of A at (i0, k0) into MR row micro-panels
+/// micro-panel p holds A(i0 + p * MR + i, k0 + k) at [p][k * MR + i],
+/// rows beyond mc are zero so the micro-kernel never branches
+template <size_t MR, typename T>
+void pack_a(const matrix_view<T>& a, size_t i0, size_t k0,
+            size_t mc, size_t kc, T* dst) noexcept
+{
+    for (size_t ir = 0; ir < mc; ir += MR) {
+        size_t mr = std::min(MR, mc - ir);
+        for (size_t k = 0; k < kc; k++) {
+            for (size_t i = 0; i < mr; i++) {
+                dst[i] = a(i0 + ir + i, k0 + k);
+            }
+            for (size_t i = mr; i < MR; i++) {
+                dst[i] = T(0);
+            }
+            dst += MR;
+        }
+    }
+}
+
+/// pack the kc x nc block of B at (k0, j0) into NR column micro-panels
+/// micro-panel p holds B(k0 + k, j0 + p * NR + j) at [p][k * NR + j]
+template <size_t NR, typename T>
+void pack_b(const matrix_view<T>& b, size_t k0, size_t j0,
+            size_t kc, size_t nc, T* dst) noexcept
+{
+    for (size_t jr = 0; jr < nc; jr += NR) {
+        size_t nr = std::min(NR, nc - jr);
+        for (size_t k = 0; k < kc; k++) {
+            if (!b.trans && nr == NR) {
+                /// contiguous row segment
+                std::copy_n(&b(k0 + k, j0 + jr), NR, dst);
+            } else {
+                for (size_t j = 0; j < nr; j++) {
+                    dst[j] = b(k0 + k, j0 + jr + j);
+                }
+                for (size_t j = nr; j < NR; j++) {
+                    dst[j] = T(0);
+                }
+            }
+            dst += NR;
+        }
+    }
+}
+}  // namespace detail
+}  // namespace gemm
+}  // namespace simd
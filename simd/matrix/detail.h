@@ -0,0 +1,325 @@
+#pragma once
+
+#include "simd/simd.h"
+
+#include <cstddef>
+
+/// in-group lane shuffles used by the 4x4 matrix kernels
+///
+/// a row vector `Vec<T, 4 * P>` holds one matrix row per group of 4 lanes,
+/// every operation below is applied to each group independently:
+/// - swizzle<I0, I1, I2, I3>(a)    -> (a[I0], a[I1], a[I2], a[I3])
+/// - shuffle<I0, I1, I2, I3>(a, b) -> (a[I0], a[I1], b[I2], b[I3])
+/// single-register vectors lower to one in-lane shuffle instruction
+/// (shufps, vpermilps, vpermpd/vpermq, vpermilps zmm),
+/// anything else falls back to per-lane copies
+/// calls are qualified as detail::shuffle, an unqualified one would also
+/// find the whole-vector simd::shuffle through ADL
+namespace simd {
+namespace matrix {
+namespace detail {
+/// immediate of _mm_shuffle_ps, lane 0 in the low bits
+template <int I0, int I1, int I2, int I3>
+struct shuffle_imm {
+    static_assert(I0 >= 0 && I0 < 4 && I1 >= 0 && I1 < 4 &&
+                  I2 >= 0 && I2 < 4 && I3 >= 0 && I3 < 4,
+                  "lane index out of group");
+    static constexpr int value = I0 | (I1 << 2) | (I2 << 4) | (I3 << 6);
+};
+
+template <typename R, size_t N, typename Enable = void>
+struct group_ops {
+    template <int I0, int I1, int I2, int I3, typename T, size_t W>
+    SIMD_INLINE
+    static Vec<T, W> swizzle(const Vec<T, W>& a) noexcept
+    {
+        constexpr int idx[4] = {I0, I1, I2, I3};
+        Vec<T, W> r;
+        for (size_t l = 0; l < W; l++) {
+            r[l] = a[l / 4 * 4 + idx[l % 4]];
+        }
+        return r;
+    }
+
+    template <int I0, int I1, int I2, int I3, typename T, size_t W>
+    SIMD_INLINE
+    static Vec<T, W> shuffle(const Vec<T, W>& a, const Vec<T, W>& b) noexcept
+    {
+        constexpr int idx[4] = {I0, I1, I2, I3};
+        Vec<T, W> r;
+        for (size_t l = 0; l < W; l++) {
+            r[l] = (l % 4 < 2 ? a : b)[l / 4 * 4 + idx[l % 4]];
+        }
+        return r;
+    }
+};
+
+#if SIMD_WITH_SSE
+template <>
+struct group_ops<types::sse_reg_f, 1> {
+    template <int I0, int I1, int I2, int I3, typename T, size_t W>
+    SIMD_INLINE
+    static Vec<T, W> swizzle(const Vec<T, W>& a) noexcept
+    {
+        constexpr int imm = shuffle_imm<I0, I1, I2, I3>::value;
+        return _mm_shuffle_ps(a.reg(), a.reg(), imm);
+    }
+
+    template <int I0, int I1, int I2, int I3, typename T, size_t W>
+    SIMD_INLINE
+    static Vec<T, W> shuffle(const Vec<T, W>& a, const Vec<T, W>& b) noexcept
+    {
+        constexpr int imm = shuffle_imm<I0, I1, I2, I3>::value;
+        return _mm_shuffle_ps(a.reg(), b.reg(), imm);
+    }
+};
+#endif  // SIMD_WITH_SSE
+
+#if SIMD_WITH_AVX
+template <>
+struct group_ops<types::avx_reg_f, 1> {
+    template <int I0, int I1, int I2, int I3, typename T, size_t W>
+    SIMD_INLINE
+    static Vec<T, W> swizzle(const Vec<T, W>& a) noexcept
+    {
+        constexpr int imm = shuffle_imm<I0, I1, I2, I3>::value;
+        return _mm256_permute_ps(a.reg(), imm);
+    }
+
+    template <int I0, int I1, int I2, int I3, typename T, size_t W>
+    SIMD_INLINE
+    static Vec<T, W> shuffle(const Vec<T, W>& a, const Vec<T, W>& b) noexcept
+    {
+        constexpr int imm = shuffle_imm<I0, I1, I2, I3>::value;
+        return _mm256_shuffle_ps(a.reg(), b.reg(), imm);
+    }
+};
+#endif  // SIMD_WITH_AVX
+
+#if SIMD_WITH_AVX2
+/// one double row fills a ymm, vpermpd permutes across the 128-bit halves
+template <>
+struct group_ops<types::avx_reg_d, 1> {
+    template <int I0, int I1, int I2, int I3, typename T, size_t W>
+    SIMD_INLINE
+    static Vec<T, W> swizzle(const Vec<T, W>& a) noexcept
+    {
+        constexpr int imm = shuffle_imm<I0, I1, I2, I3>::value;
+        return _mm256_permute4x64_pd(a.reg(), imm);
+    }
+
+    template <int I0, int I1, int I2, int I3, typename T, size_t W>
+    SIMD_INLINE
+    static Vec<T, W> shuffle(const Vec<T, W>& a, const Vec<T, W>& b) noexcept
+    {
+        constexpr int imm = shuffle_imm<I0, I1, I2, I3>::value;
+        return _mm256_blend_pd(_mm256_permute4x64_pd(a.reg(), imm),
+                               _mm256_permute4x64_pd(b.reg(), imm), 0xC);
+    }
+};
+#endif  // SIMD_WITH_AVX2
+
+#if SIMD_WITH_AVX512
+template <>
+struct group_ops<types::avx512_reg_f, 1> {
+    template <int I0, int I1, int I2, int I3, typename T, size_t W>
+    SIMD_INLINE
+    static Vec<T, W> swizzle(const Vec<T, W>& a) noexcept
+    {
+        constexpr int imm = shuffle_imm<I0, I1, I2, I3>::value;
+        return _mm512_permute_ps(a.reg(), imm);
+    }
+
+    template <int I0, int I1, int I2, int I3, typename T, size_t W>
+    SIMD_INLINE
+    static Vec<T, W> shuffle(const Vec<T, W>& a, const Vec<T, W>& b) noexcept
+    {
+        constexpr int imm = shuffle_imm<I0, I1, I2, I3>::value;
+        return _mm512_shuffle_ps(a.reg(), b.reg(), imm);
+    }
+};
+
+/// two double rows per zmm, vpermpd zmm permutes within each 256-bit half
+template <>
+struct group_ops<types::avx512_reg_d, 1> {
+    template <int I0, int I1, int I2, int I3, typename T, size_t W>
+    SIMD_INLINE
+    static Vec<T, W> swizzle(const Vec<T, W>& a) noexcept
+    {
+        constexpr int imm = shuffle_imm<I0, I1, I2, I3>::value;
+        return _mm512_permutex_pd(a.reg(), imm);
+    }
+
+    template <int I0, int I1, int I2, int I3, typename T, size_t W>
+    SIMD_INLINE
+    static Vec<T, W> shuffle(const Vec<T, W>& a, const Vec<T, W>& b) noexcept
+    {
+        constexpr int imm = shuffle_imm<I0, I1, I2, I3>::value;
+        return _mm512_mask_blend_pd(0xCC, _mm512_permutex_pd(a.reg(), imm),
+                                          _mm512_permutex_pd(b.reg(), imm));
+    }
+};
+#endif  // SIMD_WITH_AVX512
+
+/// group g of a row vector <-> mem + g * stride, the pack of W / 4 matrices
+/// (stride 16) or one row broadcast to every group (stride 0)
+template <typename R, size_t N, typename Enable = void>
+struct group_io {
+    template <typename T, size_t W>
+    SIMD_INLINE
+    static Vec<T, W> load(const T* mem, size_t stride) noexcept
+    {
+        if (stride == 4) {
+            return Vec<T, W>::load_unaligned(mem);
+        }
+        Vec<T, W> r;
+        for (size_t l = 0; l < W; l++) {
+            r[l] = mem[l / 4 * stride + l % 4];
+        }
+        return r;
+    }
+
+    template <typename T, size_t W>
+    SIMD_INLINE
+    static void store(const Vec<T, W>& x, T* mem, size_t stride) noexcept
+    {
+        if (stride == 4) {
+            x.store_unaligned(mem);
+            return;
+        }
+        for (size_t l = 0; l < W; l++) {
+            mem[l / 4 * stride + l % 4] = x[l];
+        }
+    }
+};
+
+#if SIMD_WITH_AVX
+template <>
+struct group_io<types::avx_reg_f, 1> {
+    template <typename T, size_t W>
+    SIMD_INLINE
+    static Vec<T, W> load(const T* mem, size_t stride) noexcept
+    {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(mem)),
+                                    _mm_loadu_ps(mem + stride), 1);
+    }
+
+    template <typename T, size_t W>
+    SIMD_INLINE
+    static void store(const Vec<T, W>& x, T* mem, size_t stride) noexcept
+    {
+        _mm_storeu_ps(mem, _mm256_castps256_ps128(x.reg()));
+        _mm_storeu_ps(mem + stride, _mm256_extractf128_ps(x.reg(), 1));
+    }
+};
+#endif  // SIMD_WITH_AVX
+
+#if SIMD_WITH_AVX512
+template <>
+struct group_io<types::avx512_reg_f, 1> {
+    template <typename T, size_t W>
+    SIMD_INLINE
+    static Vec<T, W> load(const T* mem, size_t stride) noexcept
+    {
+        __m512 r = _mm512_castps128_ps512(_mm_loadu_ps(mem));
+        r = _mm512_insertf32x4(r, _mm_loadu_ps(mem + stride), 1);
+        r = _mm512_insertf32x4(r, _mm_loadu_ps(mem + 2 * stride), 2);
+        return _mm512_insertf32x4(r, _mm_loadu_ps(mem + 3 * stride), 3);
+    }
+
+    template <typename T, size_t W>
+    SIMD_INLINE
+    static void store(const Vec<T, W>& x, T* mem, size_t stride) noexcept
+    {
+        _mm_storeu_ps(mem, _mm512_castps512_ps128(x.reg()));
+        _mm_storeu_ps(mem + stride, _mm512_extractf32x4_ps(x.reg(), 1));
+        _mm_storeu_ps(mem + 2 * stride, _mm512_extractf32x4_ps(x.reg(), 2));
+        _mm_storeu_ps(mem + 3 * stride, _mm512_extractf32x4_ps(x.reg(), 3));
+    }
+};
+
+template <>
+struct group_io<types::avx512_reg_d, 1> {
+    template <typename T, size_t W>
+    SIMD_INLINE
+    static Vec<T, W> load(const T* mem, size_t stride) noexcept
+    {
+        return _mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_loadu_pd(mem)),
+                                  _mm256_loadu_pd(mem + stride), 1);
+    }
+
+    template <typename T, size_t W>
+    SIMD_INLINE
+    static void store(const Vec<T, W>& x, T* mem, size_t stride) noexcept
+    {
+        _mm256_storeu_pd(mem, _mm512_castpd512_pd256(x.reg()));
+        _mm256_storeu_pd(mem + stride, _mm512_extractf64x4_pd(x.reg(), 1));
+    }
+};
+#endif  // SIMD_WITH_AVX512
+
+template <typename T, size_t W>
+using group_io_t = group_io<typename Vec<T, W>::register_t, Vec<T, W>::n_regs()>;
+
+template <typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> load_groups(const T* mem, size_t stride) noexcept
+{
+    return W == 4 ? Vec<T, W>::load_unaligned(mem)
+                  : group_io_t<T, W>::template load<T, W>(mem, stride);
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+void store_groups(const Vec<T, W>& x, T* mem, size_t stride) noexcept
+{
+    if (W == 4) {
+        x.store_unaligned(mem);
+    } else {
+        group_io_t<T, W>::store(x, mem, stride);
+    }
+}
+
+template <typename T, size_t W>
+using group_ops_t = group_ops<typename Vec<T, W>::register_t, Vec<T, W>::n_regs()>;
+
+template <int I0, int I1, int I2, int I3, typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> swizzle(const Vec<T, W>& a) noexcept
+{
+    return group_ops_t<T, W>::template swizzle<I0, I1, I2, I3>(a);
+}
+
+template <int I0, int I1, int I2, int I3, typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> shuffle(const Vec<T, W>& a, const Vec<T, W>& b) noexcept
+{
+    return group_ops_t<T, W>::template shuffle<I0, I1, I2, I3>(a, b);
+}
+
+/// broadcast lane I of each group
+template <int I, typename T, size_t W>
+SIMD_INLINE
+Vec<T, W> splat(const Vec<T, W>& a) noexcept
+{
+    return swizzle<I, I, I, I>(a);
+}
+
+/// transpose each 4x4 block spread across the groups of r0..r3
+template <typename T, size_t W>
+SIMD_INLINE
+void transpose(Vec<T, W>& r0, Vec<T, W>& r1, Vec<T, W>& r2, Vec<T, W>& r3) noexcept
+{
+    /// (00 01 10 11), (02 03 12 13), (20 21 30 31), (22 23 32 33)
+    Vec<T, W> t0 = detail::shuffle<0, 1, 0, 1>(r0, r1);
+    Vec<T, W> t1 = detail::shuffle<2, 3, 2, 3>(r0, r1);
+    Vec<T, W> t2 = detail::shuffle<0, 1, 0, 1>(r2, r3);
+    Vec<T, W> t3 = detail::shuffle<2, 3, 2, 3>(r2, r3);
+    r0 = detail::shuffle<0, 2, 0, 2>(t0, t2);
+    r1 = detail::shuffle<1, 3, 1, 3>(t0, t2);
+    r2 = detail::shuffle<0, 2, 0, 2>(t1, t3);
+    r3 = detail::shuffle<1, 3, 1, 3>(t1, t3);
+}
+}  // namespace detail
+}  // namespace matrix
+}  // namespace simd
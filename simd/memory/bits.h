@@ -44,7 +44,7 @@ T ones()
         char b[sizeof(T)];
         T t;
     };
-    #pragma unroll
+    SIMD_UNROLL
     for (int i = 0; i < sizeof(T); i++) {
         b[i] = 0xFF;
     }
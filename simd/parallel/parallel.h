@@ -0,0 +1,269 @@
+#pragma once
+
+#include "simd/simd.h"
+#include "simd/parallel/thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace simd {
+namespace parallel {
+/// knobs shared by the bulk parallel algorithms
+struct options {
+    /// pool to run on, nullptr means thread_pool::global()
+    thread_pool* pool = nullptr;
+    /// elements per chunk, 0 picks `default_chunk_bytes` worth
+    /// always rounded up to whole cache lines (hence whole vectors)
+    size_t chunk = 0;
+    /// reduce: combine per-chunk partials in chunk order, so the result
+    /// only depends on the input, never on thread count or scheduling
+    /// otherwise partials are combined as chunks complete
+    bool deterministic = false;
+};
+
+/// big enough to amortize a task (~1us), small enough to balance load
+constexpr size_t default_chunk_bytes = 128 * 1024;
+
+namespace detail {
+/// [0, n) cut into chunks whose inner boundaries all fall on a
+/// cache line of `anchor`, so no two tasks ever write the same line
+/// chunk k covers [begin(k), begin(k + 1))
+struct chunking {
+    size_t n;
+    size_t head;
+    size_t chunk;
+    size_t count;
+
+    size_t begin(size_t k) const noexcept
+    {
+        return k == 0 ? 0 : std::min(n, head + k * chunk);
+    }
+};
+
+template <typename T>
+chunking make_chunking(const void* anchor, size_t n, size_t chunk) noexcept
+{
+    /// a cache line holds whole vectors of every enabled width
+    constexpr size_t line = cache_line_size / sizeof(T);
+    static_assert(line % native_lanes<T>() == 0, "vector wider than a cache line");
+
+    if (chunk == 0) {
+        chunk = default_chunk_bytes / sizeof(T);
+    }
+    chunk = (chunk + line - 1) / line * line;
+
+    auto addr = reinterpret_cast<uintptr_t>(anchor);
+    size_t head = ((cache_line_size - addr % cache_line_size) % cache_line_size) / sizeof(T);
+    head = std::min(head, n);
+
+    /// chunk 0 also takes the misaligned head
+    size_t count = n == 0 ? 0 : std::max<size_t>(1, (n - head + chunk - 1) / chunk);
+    return chunking{n, head, chunk, count};
+}
+
+/// run body(k) for k in [0, count) on `pool`; the calling thread helps,
+/// and returns once every chunk has completed
+/// chunks are dealt to workers in contiguous blocks, idle workers steal
+template <typename F>
+void for_each_chunk(thread_pool& pool, size_t count, F& body)
+{
+    if (count <= 1 || pool.size() <= 1) {
+        for (size_t k = 0; k < count; k++) {
+            body(k);
+        }
+        return;
+    }
+    std::atomic<size_t> remaining{count};
+    for (size_t k = 0; k < count; k++) {
+        pool.submit([&body, &remaining, k] {
+            body(k);
+            remaining.fetch_sub(1, std::memory_order_acq_rel);
+        }, k * pool.size() / count);
+    }
+    size_t self = pool.current_index();
+    while (remaining.load(std::memory_order_acquire) > 0) {
+        if (!pool.try_run_one(self)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+template <size_t W, typename T, typename U, typename F>
+void transform_range(const T* in, U* out, size_t n, F& f) noexcept
+{
+    using vec_t = Vec<T, W>;
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        f(vec_t::load_unaligned(in + i)).store_unaligned(out + i);
+    }
+    if (i < n) {
+        /// tail runs through a padded vector, unused lanes are dropped
+        T src[W] = {};
+        U dst[W];
+        std::copy(in + i, in + n, src);
+        f(vec_t::load_unaligned(src)).store_unaligned(dst);
+        std::copy(dst, dst + (n - i), out + i);
+    }
+}
+
+template <size_t W, typename T, typename U, typename F>
+void transform_range(const T* in0, const T* in1, U* out, size_t n, F& f) noexcept
+{
+    using vec_t = Vec<T, W>;
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        f(vec_t::load_unaligned(in0 + i), vec_t::load_unaligned(in1 + i)).store_unaligned(out + i);
+    }
+    if (i < n) {
+        T src0[W] = {}, src1[W] = {};
+        U dst[W];
+        std::copy(in0 + i, in0 + n, src0);
+        std::copy(in1 + i, in1 + n, src1);
+        f(vec_t::load_unaligned(src0), vec_t::load_unaligned(src1)).store_unaligned(dst);
+        std::copy(dst, dst + (n - i), out + i);
+    }
+}
+
+/// n >= 1
+template <size_t W, typename T, typename Op>
+T reduce_range(const T* mem, size_t n, Op& op) noexcept
+{
+    using vec_t = Vec<T, W>;
+    size_t i = 0;
+    T ret;
+    if (n >= 4 * W) {
+        /// 4 independent chains hide the latency of op
+        vec_t acc0 = vec_t::load_unaligned(mem + 0 * W);
+        vec_t acc1 = vec_t::load_unaligned(mem + 1 * W);
+        vec_t acc2 = vec_t::load_unaligned(mem + 2 * W);
+        vec_t acc3 = vec_t::load_unaligned(mem + 3 * W);
+        for (i = 4 * W; i + 4 * W <= n; i += 4 * W) {
+            acc0 = op(acc0, vec_t::load_unaligned(mem + i + 0 * W));
+            acc1 = op(acc1, vec_t::load_unaligned(mem + i + 1 * W));
+            acc2 = op(acc2, vec_t::load_unaligned(mem + i + 2 * W));
+            acc3 = op(acc3, vec_t::load_unaligned(mem + i + 3 * W));
+        }
+        for (; i + W <= n; i += W) {
+            acc0 = op(acc0, vec_t::load_unaligned(mem + i));
+        }
+        vec_t acc = op(op(acc0, acc1), op(acc2, acc3));
+        ret = acc[0];
+        for (size_t l = 1; l < W; l++) {
+            ret = op(ret, acc[l]);
+        }
+    } else {
+        ret = mem[0];
+        i = 1;
+    }
+    for (; i < n; i++) {
+        ret = op(ret, mem[i]);
+    }
+    return ret;
+}
+
+template <typename T>
+struct alignas(cache_line_size) partial_t {
+    T value;
+};
+
+template <typename T, typename U>
+constexpr size_t transform_lanes() noexcept
+{
+    /// lanes of the wider element type, so both vectors exist
+    return sizeof(T) >= sizeof(U) ? native_lanes<T>() : native_lanes<U>();
+}
+}  // namespace detail
+
+/// out[i] = f(in[i]) for i in [0, n)
+/// `f` maps Vec<T, W> to Vec<U, W>, e.g. `[](auto x) { return x * 2.f; }`
+/// chunks are anchored on `out`, so writers never share a cache line
+template <typename T, typename U, typename F>
+void transform(const T* in, U* out, size_t n, F f, const options& opt = options())
+{
+    constexpr size_t W = detail::transform_lanes<T, U>();
+    auto& pool = opt.pool ? *opt.pool : thread_pool::global();
+    auto c = detail::make_chunking<U>(out, n, opt.chunk);
+    auto body = [&](size_t k) {
+        size_t b = c.begin(k), e = c.begin(k + 1);
+        detail::transform_range<W>(in + b, out + b, e - b, f);
+    };
+    detail::for_each_chunk(pool, c.count, body);
+}
+
+/// out[i] = f(in0[i], in1[i]) for i in [0, n)
+template <typename T, typename U, typename F>
+void transform(const T* in0, const T* in1, U* out, size_t n, F f, const options& opt = options())
+{
+    constexpr size_t W = detail::transform_lanes<T, U>();
+    auto& pool = opt.pool ? *opt.pool : thread_pool::global();
+    auto c = detail::make_chunking<U>(out, n, opt.chunk);
+    auto body = [&](size_t k) {
+        size_t b = c.begin(k), e = c.begin(k + 1);
+        detail::transform_range<W>(in0 + b, in1 + b, out + b, e - b, f);
+    };
+    detail::for_each_chunk(pool, c.count, body);
+}
+
+/// f(begin, end) over [0, n) cut into ranges of `opt.chunk` items,
+/// 0 picks about 4 ranges per thread; for work that is not a flat array,
+/// e.g. bands of image rows
+template <typename F>
+void for_each_range(size_t n, F f, const options& opt = options())
+{
+    auto& pool = opt.pool ? *opt.pool : thread_pool::global();
+    const size_t parts = 4 * pool.size();
+    const size_t chunk = opt.chunk ? opt.chunk : std::max<size_t>(1, (n + parts - 1) / parts);
+    const size_t count = (n + chunk - 1) / chunk;
+    auto body = [&](size_t k) {
+        f(k * chunk, std::min(n, (k + 1) * chunk));
+    };
+    detail::for_each_chunk(pool, count, body);
+}
+
+/// op(init, in[0], ..., in[n - 1]) in an unspecified grouping
+/// `op` must be associative and accept both (Vec<T, W>, Vec<T, W>) and (T, T),
+/// e.g. `[](auto a, auto b) { return a + b; }` or `simd::max` wrapped likewise
+template <typename T, typename Op>
+T reduce(const T* mem, size_t n, T init, Op op, const options& opt = options())
+{
+    constexpr size_t W = native_lanes<T>();
+    if (n == 0) {
+        return init;
+    }
+    auto& pool = opt.pool ? *opt.pool : thread_pool::global();
+    auto c = detail::make_chunking<T>(mem, n, opt.chunk);
+
+    if (opt.deterministic) {
+        std::vector<detail::partial_t<T>> partials(c.count);
+        auto body = [&](size_t k) {
+            size_t b = c.begin(k), e = c.begin(k + 1);
+            partials[k].value = detail::reduce_range<W>(mem + b, e - b, op);
+        };
+        detail::for_each_chunk(pool, c.count, body);
+        T ret = init;
+        for (const auto& p : partials) {
+            ret = op(ret, p.value);
+        }
+        return ret;
+    }
+
+    T ret = init;
+    std::mutex mutex;
+    auto body = [&](size_t k) {
+        size_t b = c.begin(k), e = c.begin(k + 1);
+        T r = detail::reduce_range<W>(mem + b, e - b, op);
+        std::lock_guard<std::mutex> lock(mutex);
+        ret = op(ret, r);
+    };
+    detail::for_each_chunk(pool, c.count, body);
+    return ret;
+}
+}  // namespace parallel
+}  // namespace simd
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace simd {
+namespace parallel {
+/// destructive interference size on every x86 target we care about
+constexpr size_t cache_line_size = 64;
+
+/// fixed size pool of workers, one task deque per worker
+/// a worker pops from the back of its own deque (most recently pushed,
+/// still hot in cache) and, when that is empty, steals from the front
+/// of the other deques
+class thread_pool
+{
+public:
+    using task_t = std::function<void()>;
+
+    explicit thread_pool(size_t nthreads = default_size())
+        : queues_(nthreads > 0 ? nthreads : 1)
+    {
+        for (auto& q : queues_) {
+            q.reset(new queue_t);
+        }
+        workers_.reserve(queues_.size());
+        for (size_t i = 0; i < queues_.size(); i++) {
+            workers_.emplace_back([this, i] { worker_loop(i); });
+        }
+    }
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_ = true;
+        }
+        sleep_cv_.notify_all();
+        for (auto& w : workers_) {
+            w.join();
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    /// number of worker threads
+    size_t size() const noexcept
+    {
+        return queues_.size();
+    }
+
+    /// push `task` on worker `hint % size()`
+    void submit(task_t task, size_t hint)
+    {
+        auto& q = *queues_[hint % queues_.size()];
+        pending_.fetch_add(1, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(q.mutex);
+            q.tasks.push_back(std::move(task));
+        }
+        /// a worker between its predicate check and wait() holds sleep_mutex_
+        { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+        sleep_cv_.notify_one();
+    }
+
+    /// run one queued task on the calling thread, if any
+    /// lets a thread that waits on its own tasks help instead of blocking
+    bool try_run_one(size_t hint = 0)
+    {
+        task_t task;
+        if (!pop_task(hint % queues_.size(), task)) {
+            return false;
+        }
+        task();
+        return true;
+    }
+
+    /// index of the calling thread within this pool,
+    /// size() for any thread which is not one of its workers
+    size_t current_index() const noexcept
+    {
+        return tls_pool() == this ? tls_index() : queues_.size();
+    }
+
+    /// process wide pool, one worker per hardware thread
+    static thread_pool& global()
+    {
+        static thread_pool pool;
+        return pool;
+    }
+
+    static size_t default_size() noexcept
+    {
+        size_t n = std::thread::hardware_concurrency();
+        return n > 0 ? n : 1;
+    }
+
+private:
+    struct alignas(cache_line_size) queue_t {
+        std::mutex mutex;
+        std::deque<task_t> tasks;
+    };
+
+    static const thread_pool*& tls_pool() noexcept
+    {
+        static thread_local const thread_pool* pool = nullptr;
+        return pool;
+    }
+
+    static size_t& tls_index() noexcept
+    {
+        static thread_local size_t index = 0;
+        return index;
+    }
+
+    bool pop_task(size_t self, task_t& task)
+    {
+        {
+            auto& q = *queues_[self];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            if (!q.tasks.empty()) {
+                task = std::move(q.tasks.back());
+                q.tasks.pop_back();
+                pending_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        for (size_t k = 1; k < queues_.size(); k++) {
+            auto& q = *queues_[(self + k) % queues_.size()];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            if (!q.tasks.empty()) {
+                task = std::move(q.tasks.front());
+                q.tasks.pop_front();
+                pending_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void worker_loop(size_t self)
+    {
+        tls_pool() = this;
+        tls_index() = self;
+        task_t task;
+        for (;;) {
+            if (pop_task(self, task)) {
+                task();
+                task = nullptr;
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            sleep_cv_.wait(lock, [this] {
+                return stop_ || pending_.load(std::memory_order_acquire) > 0;
+            });
+            if (stop_ && pending_.load(std::memory_order_acquire) == 0) {
+                return;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<queue_t>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<size_t> pending_{0};
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+    bool stop_ = false;
+};
+}  // namespace parallel
+}  // namespace simd
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "simd/simd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/// affine 8-bit quantization, real = scale * (q - zero_point)
+///
+/// float -> int8/uint8 goes through fmadd + floor and one narrow_sat of
+/// four float vectors (packssdw/packuswb or vpmov), int8/uint8 -> float
+/// through widen<float>; the scalar tails clamp the same way (NaN to qmin)
+/// but round x * inv + off as a separate multiply and add
+namespace simd {
+namespace quant {
+struct params {
+    float scale;
+    int32_t zero_point;
+};
+
+#define REQUIRE_QUANT_TYPE(Q) \
+    REQUIRES((std::is_same<Q, int8_t>::value || std::is_same<Q, uint8_t>::value))
+
+/// scale / zero point mapping [lo, hi] (widened to contain 0, so that 0 is
+/// exact) onto the full range of Q
+template <typename Q, REQUIRE_QUANT_TYPE(Q)>
+params choose_params(float lo, float hi) noexcept
+{
+    constexpr float qmin = std::numeric_limits<Q>::min();
+    constexpr float qmax = std::numeric_limits<Q>::max();
+    lo = std::min(lo, 0.f);
+    hi = std::max(hi, 0.f);
+    float scale = hi > lo ? (hi - lo) / (qmax - qmin) : 1.f;
+    float zp = std::min(std::max(qmin - std::round(lo / scale), qmin), qmax);
+    return params{scale, static_cast<int32_t>(zp)};
+}
+
+/// q[i] = clamp(floor(x[i] / scale + 0.5) + zero_point) to the range of Q
+template <typename Q, REQUIRE_QUANT_TYPE(Q)>
+void quantize(size_t n, const float* x, params p, Q* q) noexcept
+{
+    constexpr size_t W = native_lanes<float>();
+    using fvec = Vec<float, W>;
+    const float inv = 1.f / p.scale;
+    const float off = float(p.zero_point) + 0.5f;
+    const fvec vinv(inv), voff(off);
+    size_t i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        narrow_sat<Q>(floor(fmadd(fvec::load_unaligned(x + i + 0 * W), vinv, voff)),
+                      floor(fmadd(fvec::load_unaligned(x + i + 1 * W), vinv, voff)),
+                      floor(fmadd(fvec::load_unaligned(x + i + 2 * W), vinv, voff)),
+                      floor(fmadd(fvec::load_unaligned(x + i + 3 * W), vinv, voff))).store_unaligned(q + i);
+    }
+    constexpr float qmin = std::numeric_limits<Q>::min();
+    constexpr float qmax = std::numeric_limits<Q>::max();
+    for (; i < n; i++) {
+        const float v = std::floor(x[i] * inv + off);
+        /// NaN fails the compare and lands on qmin, as in narrow_sat
+        q[i] = static_cast<Q>(!(v >= qmin) ? qmin : std::min(v, qmax));
+    }
+}
+
+/// x[i] = scale * (q[i] - zero_point)
+template <typename Q, REQUIRE_QUANT_TYPE(Q)>
+void dequantize(size_t n, const Q* q, params p, float* x) noexcept
+{
+    constexpr size_t W = native_lanes<float>();
+    using fvec = Vec<float, W>;
+    using qvec = Vec<Q, 4 * W>;
+    const fvec vs(p.scale), vzp(float(p.zero_point));
+    size_t i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        auto f = widen<float>(qvec::load_unaligned(q + i));
+        for (size_t k = 0; k < 4; k++) {
+            ((f[k] - vzp) * vs).store_unaligned(x + i + k * W);
+        }
+    }
+    for (; i < n; i++) {
+        x[i] = (float(q[i]) - float(p.zero_point)) * p.scale;
+    }
+}
+
+#undef REQUIRE_QUANT_TYPE
+}  // namespace quant
+}  // namespace simd
@@ -21,3 +21,4 @@
 #include "simd/types/vec.h"
 #include "simd/util/util.h"
 #include "simd/api/all.h"
+#include "simd/types/vec_interleaved.h"
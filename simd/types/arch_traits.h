@@ -9,8 +9,30 @@
 
 namespace simd {
 namespace types {
+namespace detail {
+/// lanes of T in the narrowest of 128, 256, ..., 4096 bits holding W lanes
+template <typename T>
+constexpr size_t padded_lanes(size_t W) noexcept
+{
+    size_t bits = 128;
+    while (bits < 4096 && bits / 8 / sizeof(T) < W) {
+        bits *= 2;
+    }
+    return bits / 8 / sizeof(T);
+}
+
+struct no_arch_traits { };
+}  // namespace detail
+
+/// any other lane count (Vec<float, 3>, Vec<float, 12>) takes the arch of
+/// the next width up, its registers padded (simd_register_base::padded_lanes)
+/// only widths up to 4096 bits of the arithmetic types below have an arch
 template <typename T, size_t W>
-struct arch_traits;
+struct arch_traits
+    : std::conditional<(W < detail::padded_lanes<T>(W)),
+                       arch_traits<T, detail::padded_lanes<T>(W)>,
+                       detail::no_arch_traits>::type
+{ };
 
 template <typename T, size_t W>
 using arch_traits_t = typename arch_traits<T, W>::arch_t;
@@ -57,6 +79,30 @@ DEFINE_ARCH_TRAITS_512_BITS(double);
 
 #undef DEFINE_ARCH_TRAITS_512_BITS
 
+/// 1024, 2048 and 4096 bits: arrays of the widest registers, each op
+/// loops over them (n_regs), so independent chains hide op latency
+#define DEFINE_ARCH_TRAITS_WIDE_BITS(T) \
+template <> \
+struct arch_traits<T, 1024/sizeof(T)/8> : detail::arch_512_traits_base { }; \
+template <> \
+struct arch_traits<T, 2048/sizeof(T)/8> : detail::arch_512_traits_base { }; \
+template <> \
+struct arch_traits<T, 4096/sizeof(T)/8> : detail::arch_512_traits_base { } \
+///
+
+DEFINE_ARCH_TRAITS_WIDE_BITS(int8_t);
+DEFINE_ARCH_TRAITS_WIDE_BITS(uint8_t);
+DEFINE_ARCH_TRAITS_WIDE_BITS(int16_t);
+DEFINE_ARCH_TRAITS_WIDE_BITS(uint16_t);
+DEFINE_ARCH_TRAITS_WIDE_BITS(int32_t);
+DEFINE_ARCH_TRAITS_WIDE_BITS(uint32_t);
+DEFINE_ARCH_TRAITS_WIDE_BITS(int64_t);
+DEFINE_ARCH_TRAITS_WIDE_BITS(uint64_t);
+DEFINE_ARCH_TRAITS_WIDE_BITS(float);
+DEFINE_ARCH_TRAITS_WIDE_BITS(double);
+
+#undef DEFINE_ARCH_TRAITS_WIDE_BITS
+
 /// 256bits
 namespace detail {
 struct arch_256_traits_base {
@@ -170,4 +216,13 @@ DEFINE_ARCH_TRAITS_64_BITS(double);
 
 #undef DEFINE_ARCH_TRAITS_64_BITS
 }  // namespace types
+
+/// number of T lanes which fit in the widest enabled register
+/// Vec<T, native_lanes<T>()> is backed by exactly one register
+/// compile-time const expression
+template <typename T>
+constexpr size_t native_lanes() noexcept
+{
+    return (SIMD_WITH_AVX512 ? 64 : SIMD_WITH_AVX ? 32 : 16) / sizeof(T);
+}
 }  // namespace simd
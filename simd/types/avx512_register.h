@@ -80,15 +80,21 @@ struct simd_avx512_bool_register {
     using scalar_t = bool;
     using arch_t = AVX512;
     using register_t = avx512_mask_traits_t<T>;
-    // how many registers for this bool vector
+    // how many registers for this bool vector, the last one partially
+    // used when W is not a multiple of the mask bits
     static constexpr size_t n_regs() {
-        return W / 8 / sizeof(register_t);
+        return (W + 8 * sizeof(register_t) - 1) / 8 / sizeof(register_t);
     }
     static constexpr size_t reg_lanes() {
         return 8 * sizeof(register_t);
     }
 
-    union alignas(n_regs() * sizeof(register_t)) {
+    // power of two factor of n_regs(), a 3 registers mask packs as 1
+    static constexpr size_t vec_alignment() {
+        return (n_regs() & (~n_regs() + 1)) * sizeof(register_t);
+    }
+
+    union alignas(vec_alignment()) {
         register_t regs_[n_regs()];
         std::bitset<W> bits_;
     };
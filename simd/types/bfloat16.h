@@ -0,0 +1,59 @@
+#pragma once
+
+#include "simd/config/inline.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace simd {
+namespace detail {
+/// binary32 -> bfloat16 bits: the upper half, round to nearest even, NaN stays quiet
+inline uint16_t float_to_bf16_bits(float f) noexcept
+{
+    uint32_t x;
+    std::memcpy(&x, &f, sizeof(x));
+    if ((x & 0x7FFFFFFFu) > 0x7F800000u) {
+        return static_cast<uint16_t>((x >> 16) | 0x40u);
+    }
+    return static_cast<uint16_t>((x + 0x7FFFu + ((x >> 16) & 1u)) >> 16);
+}
+
+/// bfloat16 bits -> binary32, exact
+SIMD_INLINE
+float bf16_bits_to_float(uint16_t h) noexcept
+{
+    const uint32_t x = static_cast<uint32_t>(h) << 16;
+    float f;
+    std::memcpy(&f, &x, sizeof(f));
+    return f;
+}
+}  // namespace detail
+
+/// bfloat16 storage type: the upper 16 bits of a float
+/// no arithmetic of its own: values are converted to float for compute,
+/// see `load_bf16`/`store_bf16` for the vector conversions and `dot_bf16`
+struct bfloat16
+{
+    uint16_t bits;
+
+    bfloat16() = default;
+    explicit bfloat16(float f) noexcept
+        : bits(detail::float_to_bf16_bits(f))
+    {
+    }
+
+    operator float() const noexcept
+    {
+        return detail::bf16_bits_to_float(bits);
+    }
+
+    static bfloat16 from_bits(uint16_t b) noexcept
+    {
+        bfloat16 h;
+        h.bits = b;
+        return h;
+    }
+};
+
+static_assert(sizeof(bfloat16) == 2, "bfloat16 must be 16 bits");
+}  // namespace simd
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "simd/config/config.h"
+#include "simd/config/inline.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if SIMD_WITH_F16C
+#include <immintrin.h>
+#endif
+
+namespace simd {
+namespace detail {
+/// IEEE 754 binary32 -> binary16 bits, round to nearest even, NaN stays quiet
+/// bit exact with vcvtps2ph, used where F16C is not available
+inline uint16_t float_to_half_bits_soft(float f) noexcept
+{
+    uint32_t x;
+    std::memcpy(&x, &f, sizeof(x));
+    const uint32_t sign = (x >> 16) & 0x8000u;
+    const uint32_t abs = x & 0x7FFFFFFFu;
+    if (abs >= 0x7F800000u) {  // inf, nan
+        return sign | 0x7C00u | (abs > 0x7F800000u ? 0x200u | ((abs >> 13) & 0x3FFu) : 0u);
+    }
+    if (abs >= 0x477FF000u) {  // rounds to 65520 or above
+        return sign | 0x7C00u;
+    }
+    if (abs < 0x38800000u) {  // below 2^-14: half subnormal or zero
+        if (abs < 0x33000000u) {
+            return sign;
+        }
+        const uint32_t shift = 126u - (abs >> 23);
+        const uint32_t m = (abs & 0x7FFFFFu) | 0x800000u;
+        const uint32_t rem = m & ((1u << shift) - 1u);
+        const uint32_t tie = 1u << (shift - 1u);
+        uint32_t r = m >> shift;
+        r += (rem > tie || (rem == tie && (r & 1u))) ? 1u : 0u;
+        return static_cast<uint16_t>(sign | r);
+    }
+    /// rebias exponent 127 -> 15, then round the 13 dropped mantissa bits
+    const uint32_t r = abs - 0x38000000u;
+    return static_cast<uint16_t>(sign | ((r + 0xFFFu + ((r >> 13) & 1u)) >> 13));
+}
+
+/// IEEE 754 binary16 bits -> binary32, exact
+inline float half_bits_to_float_soft(uint16_t h) noexcept
+{
+    const uint32_t sign = static_cast<uint32_t>(h & 0x8000u) << 16;
+    uint32_t e = (h >> 10) & 0x1Fu;
+    uint32_t m = h & 0x3FFu;
+    uint32_t x;
+    if (e == 0x1Fu) {
+        x = sign | 0x7F800000u | (m << 13);
+    } else if (e != 0) {
+        x = sign | ((e + 112u) << 23) | (m << 13);
+    } else if (m == 0) {
+        x = sign;
+    } else {  // subnormal, normalize
+        e = 113;
+        while (!(m & 0x400u)) {
+            m <<= 1;
+            e--;
+        }
+        x = sign | (e << 23) | ((m & 0x3FFu) << 13);
+    }
+    float f;
+    std::memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+SIMD_INLINE
+uint16_t float_to_half_bits(float f) noexcept
+{
+#if SIMD_WITH_F16C
+    return static_cast<uint16_t>(_cvtss_sh(f, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#else
+    return float_to_half_bits_soft(f);
+#endif
+}
+
+SIMD_INLINE
+float half_bits_to_float(uint16_t h) noexcept
+{
+#if SIMD_WITH_F16C
+    return _cvtsh_ss(h);
+#else
+    return half_bits_to_float_soft(h);
+#endif
+}
+}  // namespace detail
+
+/// IEEE 754 half precision storage type
+/// no arithmetic of its own: values are converted to float for compute,
+/// see `load_half`/`store_half` for the vector conversions
+struct half
+{
+    uint16_t bits;
+
+    half() = default;
+    explicit half(float f) noexcept
+        : bits(detail::float_to_half_bits(f))
+    {
+    }
+
+    operator float() const noexcept
+    {
+        return detail::half_bits_to_float(bits);
+    }
+
+    static half from_bits(uint16_t b) noexcept
+    {
+        half h;
+        h.bits = b;
+        return h;
+    }
+};
+
+static_assert(sizeof(half) == 2, "half must be 16 bits");
+}  // namespace simd
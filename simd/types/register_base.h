@@ -12,19 +12,31 @@ struct simd_register_base {
     using scalar_t = ST;
     using arch_t = A;
     using register_t = VT;
-    /// how many registers for this vector
+    /// how many registers for this vector, the last one partially
+    /// used when W lanes do not fill whole registers (Vec<float, 3>)
     static constexpr size_t n_regs() {
-        return sizeof(scalar_t) * W / sizeof(register_t);
+        return (sizeof(scalar_t) * W + sizeof(register_t) - 1) / sizeof(register_t);
     }
     /// how many lanes per register
     static constexpr size_t reg_lanes() {
-        return W / n_regs();
+        return sizeof(register_t) / sizeof(scalar_t);
+    }
+    /// lanes of storage, W plus the padding lanes of the last register
+    static constexpr size_t padded_lanes() {
+        return n_regs() * reg_lanes();
+    }
+
+    /// aligned to the whole vector, at most a cache line: beyond that
+    /// (vectors of 1024 bits and up) it only bloats stack frames; an odd
+    /// register count (Vec<float, 12> on SSE) keeps its power of two factor
+    static constexpr size_t vec_alignment() {
+        return (n_regs() & (~n_regs() + 1)) * arch_t::alignment() < 64
+             ? (n_regs() & (~n_regs() + 1)) * arch_t::alignment() : 64;
     }
 
-    /// aligned to the whole vector
-    union alignas(n_regs() * arch_t::alignment()) {
+    union alignas(vec_alignment()) {
         register_t regs_[n_regs()];
-        scalar_t array_[W];
+        scalar_t array_[padded_lanes()];
     };
 
     simd_register_base() noexcept {}
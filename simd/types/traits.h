@@ -106,8 +106,16 @@ struct to_integral<double> {
 template <typename T>
 using to_integral_t = typename detail::to_integral<T>::type;
 
+/// widths without a name of their own, e.g. the padded Vec<float, 3>
 template <typename T, size_t W>
-struct vec_type_traits;
+struct vec_type_traits {
+    static constexpr const char* type() {
+        return "vec";
+    }
+    static constexpr const char* bool_type() {
+        return "vecb";
+    }
+};
 
 #define stringify(X) #X
 
@@ -167,5 +175,47 @@ DEFINE_VEC_TYPE_TRAITS(double,    8, "f64");
 DEFINE_VEC_TYPE_TRAITS(std::complex<float>,  8, "cf32");
 DEFINE_VEC_TYPE_TRAITS(std::complex<double>, 4, "cf64");
 
+/// 1024bits
+DEFINE_VEC_TYPE_TRAITS(int8_t,   128, "i8" );
+DEFINE_VEC_TYPE_TRAITS(uint8_t,  128, "u8" );
+DEFINE_VEC_TYPE_TRAITS(int16_t,   64, "i16");
+DEFINE_VEC_TYPE_TRAITS(uint16_t,  64, "u16");
+DEFINE_VEC_TYPE_TRAITS(int32_t,   32, "i32");
+DEFINE_VEC_TYPE_TRAITS(uint32_t,  32, "u32");
+DEFINE_VEC_TYPE_TRAITS(int64_t,   16, "i64");
+DEFINE_VEC_TYPE_TRAITS(uint64_t,  16, "u64");
+DEFINE_VEC_TYPE_TRAITS(float,     32, "f32");
+DEFINE_VEC_TYPE_TRAITS(double,    16, "f64");
+DEFINE_VEC_TYPE_TRAITS(std::complex<float>, 16, "cf32");
+DEFINE_VEC_TYPE_TRAITS(std::complex<double>, 8, "cf64");
+
+/// 2048bits
+DEFINE_VEC_TYPE_TRAITS(int8_t,   256, "i8" );
+DEFINE_VEC_TYPE_TRAITS(uint8_t,  256, "u8" );
+DEFINE_VEC_TYPE_TRAITS(int16_t,  128, "i16");
+DEFINE_VEC_TYPE_TRAITS(uint16_t, 128, "u16");
+DEFINE_VEC_TYPE_TRAITS(int32_t,   64, "i32");
+DEFINE_VEC_TYPE_TRAITS(uint32_t,  64, "u32");
+DEFINE_VEC_TYPE_TRAITS(int64_t,   32, "i64");
+DEFINE_VEC_TYPE_TRAITS(uint64_t,  32, "u64");
+DEFINE_VEC_TYPE_TRAITS(float,     64, "f32");
+DEFINE_VEC_TYPE_TRAITS(double,    32, "f64");
+DEFINE_VEC_TYPE_TRAITS(std::complex<float>, 32, "cf32");
+DEFINE_VEC_TYPE_TRAITS(std::complex<double>, 16, "cf64");
+
+/// 4096bits
+DEFINE_VEC_TYPE_TRAITS(int8_t,   512, "i8" );
+DEFINE_VEC_TYPE_TRAITS(uint8_t,  512, "u8" );
+DEFINE_VEC_TYPE_TRAITS(int16_t,  256, "i16");
+DEFINE_VEC_TYPE_TRAITS(uint16_t, 256, "u16");
+DEFINE_VEC_TYPE_TRAITS(int32_t,  128, "i32");
+DEFINE_VEC_TYPE_TRAITS(uint32_t, 128, "u32");
+DEFINE_VEC_TYPE_TRAITS(int64_t,   64, "i64");
+DEFINE_VEC_TYPE_TRAITS(uint64_t,  64, "u64");
+DEFINE_VEC_TYPE_TRAITS(float,    128, "f32");
+DEFINE_VEC_TYPE_TRAITS(double,    64, "f64");
+DEFINE_VEC_TYPE_TRAITS(std::complex<float>, 64, "cf32");
+DEFINE_VEC_TYPE_TRAITS(std::complex<double>, 32, "cf64");
+
 }  // namespace traits
 }  // namespace simd
@@ -6,6 +6,8 @@
 #include "simd/memory/alignment.h"
 #include "simd/types/arch_traits.h"
 #include "simd/types/traits.h"
+#include "simd/types/half.h"
+#include "simd/types/bfloat16.h"
 #include "simd/types/vec_ops_fwd.h"
 #include "simd/types/integral_only_ops.h"
 
@@ -54,6 +56,14 @@ public:
         return A::alignment();
     }
 
+    /// W lanes which do not fill whole registers (Vec<float, 3>), the last
+    /// register holds padded_lanes() - W padding lanes: loads/stores mask
+    /// them off memory and reductions/mask queries ignore them
+    /// compile-time const expression
+    static constexpr bool padded() {
+        return base_t::padded_lanes() != W;
+    }
+
 public:
     SIMD_INLINE
     Vec() noexcept = default;
@@ -314,6 +324,10 @@ private:
     template <typename G>
     SIMD_INLINE
     void gen_values(G&& generator) noexcept;
+
+    template <typename... Ts>
+    SIMD_INLINE
+    static Vec set_values(T val0, T val1, Ts... vals) noexcept;
 };
 
 using vi8x64_t  = Vec<int8_t,  64>;    // 512 bits
@@ -330,6 +344,9 @@ using vu16x32_t = Vec<uint16_t, 32>;   // 512 bits
 using vu16x16_t = Vec<uint16_t, 16>;   // 256 bits
 using vu16x8_t  = Vec<uint16_t,  8>;   // 128 bits
 
+using vi32x128_t = Vec<int32_t, 128>; // 4096 bits
+using vi32x64_t = Vec<int32_t,  64>;   // 2048 bits
+using vi32x32_t = Vec<int32_t,  32>;   // 1024 bits
 using vi32x16_t = Vec<int32_t,  16>;   // 512 bits
 using vi32x8_t  = Vec<int32_t,   8>;   // 256 bits
 using vi32x4_t  = Vec<int32_t,   4>;   // 128 bits
@@ -344,10 +361,16 @@ using vu64x8_t  = Vec<uint64_t, 8>;    // 512 bits
 using vu64x4_t  = Vec<uint64_t, 4>;    // 256 bits
 using vu64x2_t  = Vec<uint64_t, 2>;    // 128 bits
 
+using vf32x128_t = Vec<float, 128>;   // 4096 bits
+using vf32x64_t = Vec<float, 64>;      // 2048 bits
+using vf32x32_t = Vec<float, 32>;      // 1024 bits
 using vf32x16_t = Vec<float, 16>;      // 512 bits
 using vf32x8_t  = Vec<float,  8>;      // 256 bits
 using vf32x4_t  = Vec<float,  4>;      // 128 bits
 
+using vf64x64_t = Vec<double, 64>;     // 4096 bits
+using vf64x32_t = Vec<double, 32>;     // 2048 bits
+using vf64x16_t = Vec<double, 16>;     // 1024 bits
 using vf64x8_t  = Vec<double, 8>;      // 512 bits
 using vf64x4_t  = Vec<double, 4>;      // 256 bits
 using vf64x2_t  = Vec<double, 2>;      // 128 bits
@@ -56,7 +56,7 @@ template <typename T, size_t W>
 template <typename... Ts>
 SIMD_INLINE
 Vec<T, W>::Vec(T val0, T val1, Ts... vals) noexcept
-    : self_t(kernel::set<T, W>(A{}, val0, val1, static_cast<T>(vals)...))
+    : self_t(set_values(val0, val1, static_cast<T>(vals)...))
 {
     static_assert(sizeof...(Ts) + 2 == W,
         "the constructor requires as many arguments as vector elements");
@@ -67,7 +67,7 @@ SIMD_INLINE
 Vec<T, W>::Vec(const vec_bool_t& b) noexcept
 {
     constexpr int nregs = Vec<T, W>::n_regs();
-    #pragma unroll
+    SIMD_UNROLL
     for (auto idx = 0; idx < nregs; idx++) {
         this->reg(idx) = b.reg(idx);
     }
@@ -92,17 +92,32 @@ Vec<T, W>::Vec(const Vec<T, Ws>&... vecs) noexcept
     // TODO: validation
 }
 
+template <typename T, size_t W>
+template <typename... Ts>
+SIMD_INLINE
+Vec<T, W> Vec<T, W>::set_values(T val0, T val1, Ts... vals) noexcept
+{
+    /// the set kernels take 1, 2 or 4 registers of values
+    SIMD_IF_CONSTEXPR(padded() || (W & (W - 1)) != 0) {
+        const T mem[] = {val0, val1, vals...};
+        return load_unaligned(mem);
+    } else {
+        return kernel::set<T, W>(A{}, val0, val1, vals...);
+    }
+}
+
 template <typename T, size_t W>
 template <typename G>
 SIMD_INLINE
 void Vec<T, W>::gen_values(G&& generator) noexcept
 {
-    alignas(A::alignment()) T buf[W];
-    #pragma unroll
-    for (int i = 0; i < W; i++) {
-        buf[i] = (T)generator(i);
+    constexpr auto lanes = base_t::padded_lanes();
+    alignas(A::alignment()) T buf[lanes];
+    SIMD_UNROLL
+    for (int i = 0; i < lanes; i++) {
+        buf[i] = i < W ? (T)generator(i) : T(0);
     }
-    load(buf);
+    *this = kernel::load_aligned<T, W>(buf, A{});
 }
 
 template <typename T, size_t W>
@@ -119,7 +134,11 @@ Vec<T, W> Vec<T, W>::load_aligned(const U* mem) noexcept
 {
     assert(is_aligned(mem, A::alignment())
         && "loaded location is not properly aligned");
-    return kernel::load_aligned<T, W>((const T*)mem, A{});
+    SIMD_IF_CONSTEXPR(padded()) {
+        return kernel::load_masked<T, W>((const T*)mem, A{});
+    } else {
+        return kernel::load_aligned<T, W>((const T*)mem, A{});
+    }
 }
 
 template <typename T, size_t W>
@@ -127,7 +146,11 @@ template <typename U>
 SIMD_INLINE
 Vec<T, W> Vec<T, W>::load_unaligned(const U* mem) noexcept
 {
-    return kernel::load_unaligned<T, W>((const T*)mem, A{});
+    SIMD_IF_CONSTEXPR(padded()) {
+        return kernel::load_masked<T, W>((const T*)mem, A{});
+    } else {
+        return kernel::load_unaligned<T, W>((const T*)mem, A{});
+    }
 }
 
 template <typename T, size_t W>
@@ -137,7 +160,11 @@ void Vec<T, W>::store_aligned(U* mem) const noexcept
 {
     assert(is_aligned(mem, A::alignment())
         && "store location is not properly aligned");
-    kernel::store_aligned<T, W>((T*)mem, *this, A{});
+    SIMD_IF_CONSTEXPR(padded()) {
+        kernel::store_masked<T, W>((T*)mem, *this, A{});
+    } else {
+        kernel::store_aligned<T, W>((T*)mem, *this, A{});
+    }
 }
 
 template <typename T, size_t W>
@@ -145,7 +172,11 @@ template <typename U>
 SIMD_INLINE
 void Vec<T, W>::store_unaligned(U* mem) const noexcept
 {
-    kernel::store_unaligned<T, W>((T*)mem, *this, A{});
+    SIMD_IF_CONSTEXPR(padded()) {
+        kernel::store_masked<T, W>((T*)mem, *this, A{});
+    } else {
+        kernel::store_unaligned<T, W>((T*)mem, *this, A{});
+    }
 }
 
 template <typename T, size_t W>
@@ -207,7 +238,7 @@ VecBool<T, W>::VecBool(bool val) noexcept
 {
     auto regval = make_register(detail::make_index_sequence<self_t::reg_lanes() - 1>(), val);
     constexpr auto nregs = VecBool<T, W>::n_regs();
-    #pragma unroll
+    SIMD_UNROLL
     for (auto idx = 0; idx < nregs; idx++) {
         this->reg(idx) = regval;
     }
@@ -220,12 +251,11 @@ VecBool<T, W>::VecBool(bool val0, bool val1, Ts... vals) noexcept
 {
     static_assert(sizeof...(Ts) + 2 == W,
         "constructor requires as many as arguments as vector elements");
-    auto vec = kernel::set<T, W>(A{},
-                    val0 ? bits::ones<T>() : bits::zeros<T>(),
-                    val1 ? bits::ones<T>() : bits::zeros<T>(),
-     static_cast<T>(vals ? bits::ones<T>() : bits::zeros<T>())...);
+    vec_t vec(val0 ? bits::ones<T>() : bits::zeros<T>(),
+              val1 ? bits::ones<T>() : bits::zeros<T>(),
+              static_cast<T>(vals ? bits::ones<T>() : bits::zeros<T>())...);
     constexpr int nregs = self_t::n_regs();
-    #pragma unroll
+    SIMD_UNROLL
     for (auto idx = 0; idx < nregs; idx++) {
         this->reg(idx) = vec.reg(idx);
     }
@@ -235,7 +265,6 @@ template <typename T, size_t W>
 SIMD_INLINE
 void VecBool<T, W>::store_aligned(bool* mem) const noexcept
 {
-    #pragma unroll
     for (auto i = 0; i < size(); i++) {
         mem[i] = bits::at_msb(this->get(i));
     }
@@ -253,13 +282,12 @@ SIMD_INLINE
 VecBool<T, W> VecBool<T, W>::load_aligned(const bool* mem) noexcept
 {
     Vec<T, W> vec;
-    #pragma unroll
     for (auto i = 0; i < size(); i++) {
         vec[i] = mem[i] ? bits::ones<T>() : bits::zeros<T>();
     }
     VecBool<T, W> ret;
     constexpr int nregs = self_t::n_regs();
-    #pragma unroll
+    SIMD_UNROLL
     for (auto idx = 0; idx < nregs; idx++) {
         ret.reg(idx) = vec.reg(idx);
     }
@@ -277,7 +305,13 @@ template <typename T, size_t W>
 SIMD_INLINE
 uint64_t VecBool<T, W>::to_mask() const noexcept
 {
-    return kernel::to_mask(*this, A{});
+    SIMD_IF_CONSTEXPR(vec_t::padded()) {
+        /// padding lanes past W are not part of the mask
+        static_assert(W <= 64, "to_mask holds 64 lanes, all_of/popcount/find_*_set take any W");
+        return kernel::to_mask(*this, A{}) & (~0ull >> (64 - W));
+    } else {
+        return kernel::to_mask(*this, A{});
+    }
 }
 
 template <typename T, size_t W>
@@ -58,7 +58,7 @@ SIMD_INLINE
 void Vec<std::complex<T>, W>::gen_values(G&& generator) noexcept
 {
     alignas(real_arch_t::alignment()) value_type buf[W];
-    #pragma unroll
+    SIMD_UNROLL
     for (int i = 0; i < W; i++) {
         buf[i] = (value_type)generator(i);
     }
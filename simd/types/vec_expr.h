@@ -0,0 +1,595 @@
+#pragma once
+
+#include "simd/simd.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace simd {
+/// opt-in expression templates on Vec: `lazy(a) * b + c` and
+/// `(lazy(a) & b) | ~c` build a tree instead of a Vec, the tree is
+/// pattern-matched at compile time and lowered on conversion to Vec:
+/// - x * y + z, z + x * y   -> fmadd(x, y, z)
+/// - x * y - z              -> fmsub(x, y, z)
+/// - z - x * y              -> fnmadd(x, y, z)
+/// - -(x * y) - z           -> fnmsub(x, y, z)
+///   (floating point lanes only; integer lanes keep mul and add)
+/// - any tree of &, |, ^, ~ over at most 3 operands -> one
+///   bitwise_ternlog, a single vpternlog per register on AVX512, the
+///   plain ops elsewhere; larger trees are split into such subtrees
+/// everything else evaluates as the Vec operators would.
+/// `lowered_ops<E>()` is the number of kernel ops the lowering of E
+/// issues, each one instruction per register where the ISA has it;
+/// unit_test/codegen checks the instructions actually emitted
+namespace expr {
+namespace op {
+struct add {};
+struct sub {};
+struct mul {};
+struct div {};
+struct neg {};
+struct bit_and {};
+struct bit_or {};
+struct bit_xor {};
+struct bit_not {};
+}  // namespace op
+
+template <typename V>
+struct Term;
+template <typename Op, typename L, typename R>
+struct Binary;
+template <typename Op, typename X>
+struct Unary;
+
+template <typename E>
+struct is_expr : std::false_type {};
+template <typename V>
+struct is_expr<Term<V>> : std::true_type {};
+template <typename Op, typename L, typename R>
+struct is_expr<Binary<Op, L, R>> : std::true_type {};
+template <typename Op, typename X>
+struct is_expr<Unary<Op, X>> : std::true_type {};
+
+template <typename E, typename Enable = void>
+struct lower;
+
+/// the Vec an expression evaluates to
+template <typename E>
+using vec_of = typename E::vec_t;
+
+/// CRTP base: conversion to the Vec type runs the lowering
+template <typename E, typename V>
+struct Expr
+{
+    using vec_t = V;
+
+    SIMD_INLINE
+    V eval() const noexcept
+    {
+        return lower<E>::apply(static_cast<const E&>(*this));
+    }
+
+    SIMD_INLINE
+    operator V() const noexcept
+    {
+        return eval();
+    }
+};
+
+template <typename V>
+struct Term : Expr<Term<V>, V>
+{
+    SIMD_INLINE
+    explicit Term(const V& v) noexcept : v(v) {}
+
+    V v;
+};
+
+template <typename Op, typename L, typename R>
+struct Binary : Expr<Binary<Op, L, R>, vec_of<L>>
+{
+    static_assert(std::is_same<vec_of<L>, vec_of<R>>::value, "expression operands of different Vec types");
+
+    SIMD_INLINE
+    Binary(const L& l, const R& r) noexcept : l(l), r(r) {}
+
+    L l;
+    R r;
+};
+
+template <typename Op, typename X>
+struct Unary : Expr<Unary<Op, X>, vec_of<X>>
+{
+    SIMD_INLINE
+    explicit Unary(const X& x) noexcept : x(x) {}
+
+    X x;
+};
+
+/// start an expression from a Vec
+template <typename T, size_t W>
+SIMD_INLINE
+Term<Vec<T, W>> lazy(const Vec<T, W>& v) noexcept
+{
+    return Term<Vec<T, W>>(v);
+}
+
+namespace detail {
+/// Vec operands join an expression as Term leaves
+template <typename X>
+SIMD_INLINE
+const X& as_expr(const X& x) noexcept
+{
+    return x;
+}
+
+template <typename T, size_t W>
+SIMD_INLINE
+Term<Vec<T, W>> as_expr(const Vec<T, W>& v) noexcept
+{
+    return Term<Vec<T, W>>(v);
+}
+
+template <typename X>
+using as_expr_t = typename std::decay<decltype(as_expr(std::declval<const X&>()))>::type;
+
+template <typename X>
+struct is_vec : std::false_type {};
+template <typename T, size_t W>
+struct is_vec<Vec<T, W>> : std::true_type {};
+
+/// at least one side is an expression, the other an expression or a Vec
+template <typename L, typename R>
+using enable_binary_t = traits::enable_if_t<(is_expr<L>::value && (is_expr<R>::value || is_vec<R>::value))
+                                            || (is_vec<L>::value && is_expr<R>::value)>;
+}  // namespace detail
+
+#define DEFINE_EXPR_BINARY_OP(SYM, OP) \
+template <typename L, typename R, typename = detail::enable_binary_t<L, R>> \
+SIMD_INLINE \
+Binary<op::OP, detail::as_expr_t<L>, detail::as_expr_t<R>> operator SYM(const L& l, const R& r) noexcept \
+{ \
+    return Binary<op::OP, detail::as_expr_t<L>, detail::as_expr_t<R>>(detail::as_expr(l), detail::as_expr(r)); \
+} \
+///
+
+DEFINE_EXPR_BINARY_OP(+, add);
+DEFINE_EXPR_BINARY_OP(-, sub);
+DEFINE_EXPR_BINARY_OP(*, mul);
+DEFINE_EXPR_BINARY_OP(/, div);
+DEFINE_EXPR_BINARY_OP(&, bit_and);
+DEFINE_EXPR_BINARY_OP(|, bit_or);
+DEFINE_EXPR_BINARY_OP(^, bit_xor);
+
+#undef DEFINE_EXPR_BINARY_OP
+
+template <typename X, REQUIRES(is_expr<X>::value)>
+SIMD_INLINE
+Unary<op::neg, X> operator -(const X& x) noexcept
+{
+    return Unary<op::neg, X>(x);
+}
+
+template <typename X, REQUIRES(is_expr<X>::value)>
+SIMD_INLINE
+Unary<op::bit_not, X> operator ~(const X& x) noexcept
+{
+    return Unary<op::bit_not, X>(x);
+}
+
+namespace detail {
+/// the Vec op behind each node
+template <typename Op>
+struct apply_op;
+
+#define DEFINE_EXPR_APPLY_OP(OP, EXPR) \
+template <> \
+struct apply_op<op::OP> \
+{ \
+    template <typename V> \
+    SIMD_INLINE \
+    static V apply(const V& x, const V& y) noexcept \
+    { \
+        return EXPR; \
+    } \
+}; \
+///
+
+DEFINE_EXPR_APPLY_OP(add, x + y);
+DEFINE_EXPR_APPLY_OP(sub, x - y);
+DEFINE_EXPR_APPLY_OP(mul, x * y);
+DEFINE_EXPR_APPLY_OP(div, x / y);
+DEFINE_EXPR_APPLY_OP(bit_and, x & y);
+DEFINE_EXPR_APPLY_OP(bit_or, x | y);
+DEFINE_EXPR_APPLY_OP(bit_xor, x ^ y);
+
+#undef DEFINE_EXPR_APPLY_OP
+
+template <>
+struct apply_op<op::neg>
+{
+    template <typename V>
+    SIMD_INLINE
+    static V apply(const V& x) noexcept
+    {
+        return -x;
+    }
+};
+
+template <>
+struct apply_op<op::bit_not>
+{
+    template <typename V>
+    SIMD_INLINE
+    static V apply(const V& x) noexcept
+    {
+        return ~x;
+    }
+};
+
+/// x * y + z as one fused op on floating point lanes, mul and add else
+template <typename V, bool = std::is_floating_point<typename V::value_type>::value>
+struct fused
+{
+    static constexpr size_t fmadd_ops = 1;
+    static constexpr size_t fmsub_ops = 1;
+    static constexpr size_t fnmadd_ops = 1;
+    static constexpr size_t fnmsub_ops = 1;
+
+    SIMD_INLINE
+    static V fmadd(const V& x, const V& y, const V& z) noexcept { return simd::fmadd(x, y, z); }
+    SIMD_INLINE
+    static V fmsub(const V& x, const V& y, const V& z) noexcept { return simd::fmsub(x, y, z); }
+    SIMD_INLINE
+    static V fnmadd(const V& x, const V& y, const V& z) noexcept { return simd::fnmadd(x, y, z); }
+    SIMD_INLINE
+    static V fnmsub(const V& x, const V& y, const V& z) noexcept { return simd::fnmsub(x, y, z); }
+};
+
+template <typename V>
+struct fused<V, false>
+{
+    static constexpr size_t fmadd_ops = 2;
+    static constexpr size_t fmsub_ops = 2;
+    static constexpr size_t fnmadd_ops = 2;
+    static constexpr size_t fnmsub_ops = 3;
+
+    SIMD_INLINE
+    static V fmadd(const V& x, const V& y, const V& z) noexcept { return x * y + z; }
+    SIMD_INLINE
+    static V fmsub(const V& x, const V& y, const V& z) noexcept { return x * y - z; }
+    SIMD_INLINE
+    static V fnmadd(const V& x, const V& y, const V& z) noexcept { return z - x * y; }
+    SIMD_INLINE
+    static V fnmsub(const V& x, const V& y, const V& z) noexcept { return -(x * y) - z; }
+};
+
+/// truth table of operand k of a ternlog: a, b, c
+constexpr uint8_t operand_table(size_t k) noexcept
+{
+    return k == 0 ? 0xF0 : k == 1 ? 0xCC : 0xAA;
+}
+
+/// E seen as a bitwise function: the non-bitwise subtrees are its operands
+/// (`leaves`, numbered left to right from `first` in table()), `nodes`
+/// the &, |, ^, ~ between them
+template <typename E>
+struct logic
+{
+    static constexpr size_t leaves = 1;
+    static constexpr size_t nodes = 0;
+    static constexpr size_t leaf_ops = lower<E>::ops;
+
+    static constexpr uint8_t table(size_t first) noexcept
+    {
+        return operand_table(first);
+    }
+
+    template <typename V>
+    SIMD_INLINE
+    static void collect(const E& e, V* out) noexcept
+    {
+        out[0] = lower<E>::apply(e);
+    }
+};
+
+template <typename Op, typename L, typename R>
+struct logic_binary
+{
+    static constexpr size_t leaves = logic<L>::leaves + logic<R>::leaves;
+    static constexpr size_t nodes = 1 + logic<L>::nodes + logic<R>::nodes;
+    static constexpr size_t leaf_ops = logic<L>::leaf_ops + logic<R>::leaf_ops;
+
+    template <typename V>
+    SIMD_INLINE
+    static void collect(const Binary<Op, L, R>& e, V* out) noexcept
+    {
+        logic<L>::collect(e.l, out);
+        logic<R>::collect(e.r, out + logic<L>::leaves);
+    }
+};
+
+template <typename L, typename R>
+struct logic<Binary<op::bit_and, L, R>> : logic_binary<op::bit_and, L, R>
+{
+    static constexpr uint8_t table(size_t first) noexcept
+    {
+        return logic<L>::table(first) & logic<R>::table(first + logic<L>::leaves);
+    }
+};
+
+template <typename L, typename R>
+struct logic<Binary<op::bit_or, L, R>> : logic_binary<op::bit_or, L, R>
+{
+    static constexpr uint8_t table(size_t first) noexcept
+    {
+        return logic<L>::table(first) | logic<R>::table(first + logic<L>::leaves);
+    }
+};
+
+template <typename L, typename R>
+struct logic<Binary<op::bit_xor, L, R>> : logic_binary<op::bit_xor, L, R>
+{
+    static constexpr uint8_t table(size_t first) noexcept
+    {
+        return logic<L>::table(first) ^ logic<R>::table(first + logic<L>::leaves);
+    }
+};
+
+template <typename X>
+struct logic<Unary<op::bit_not, X>>
+{
+    static constexpr size_t leaves = logic<X>::leaves;
+    static constexpr size_t nodes = 1 + logic<X>::nodes;
+    static constexpr size_t leaf_ops = logic<X>::leaf_ops;
+
+    static constexpr uint8_t table(size_t first) noexcept
+    {
+        return uint8_t(~logic<X>::table(first));
+    }
+
+    template <typename V>
+    SIMD_INLINE
+    static void collect(const Unary<op::bit_not, X>& e, V* out) noexcept
+    {
+        logic<X>::collect(e.x, out);
+    }
+};
+
+/// a bitwise tree worth one ternlog: 2+ ops over at most 3 operands, on
+/// an ISA with the instruction
+template <typename E>
+struct use_ternlog
+    : std::integral_constant<bool, std::is_base_of<AVX512, typename vec_of<E>::arch_t>::value
+                                   && logic<E>::leaves <= 3 && logic<E>::nodes >= 2>
+{};
+
+template <typename E>
+struct lower_ternlog
+{
+    static constexpr size_t ops = 1 + logic<E>::leaf_ops;
+
+    SIMD_INLINE
+    static vec_of<E> apply(const E& e) noexcept
+    {
+        using V = vec_of<E>;
+        constexpr size_t n = logic<E>::leaves;
+        V x[3];
+        logic<E>::collect(e, x);
+        /// unused operands repeat the first, the table ignores them
+        return bitwise_ternlog<logic<E>::table(0)>(x[0], x[n > 1 ? 1 : 0], x[n > 2 ? 2 : 0]);
+    }
+};
+
+template <typename Op, typename L, typename R>
+struct lower_binary
+{
+    static constexpr size_t ops = 1 + lower<L>::ops + lower<R>::ops;
+
+    SIMD_INLINE
+    static vec_of<L> apply(const Binary<Op, L, R>& e) noexcept
+    {
+        return apply_op<Op>::apply(lower<L>::apply(e.l), lower<R>::apply(e.r));
+    }
+};
+
+template <typename Op, typename X>
+struct lower_unary
+{
+    static constexpr size_t ops = 1 + lower<X>::ops;
+
+    SIMD_INLINE
+    static vec_of<X> apply(const Unary<Op, X>& e) noexcept
+    {
+        return apply_op<Op>::apply(lower<X>::apply(e.x));
+    }
+};
+
+template <typename V>
+struct lower_term
+{
+    static constexpr size_t ops = 0;
+
+    SIMD_INLINE
+    static const V& apply(const Term<V>& e) noexcept
+    {
+        return e.v;
+    }
+};
+
+/// x * y +- z forms; X, Y, Z pick the three operands out of the node
+#define DEFINE_EXPR_LOWER_FUSED(OP) \
+template <typename E, typename X, typename Y, typename Z> \
+struct lower_##OP \
+{ \
+    using V = vec_of<E>; \
+    static constexpr size_t ops = fused<V>::OP##_ops + lower<typename X::type>::ops \
+                                + lower<typename Y::type>::ops + lower<typename Z::type>::ops; \
+    \
+    SIMD_INLINE \
+    static V apply(const E& e) noexcept \
+    { \
+        return fused<V>::OP(lower<typename X::type>::apply(X::get(e)), \
+                            lower<typename Y::type>::apply(Y::get(e)), \
+                            lower<typename Z::type>::apply(Z::get(e))); \
+    } \
+}; \
+///
+
+DEFINE_EXPR_LOWER_FUSED(fmadd);
+DEFINE_EXPR_LOWER_FUSED(fmsub);
+DEFINE_EXPR_LOWER_FUSED(fnmadd);
+DEFINE_EXPR_LOWER_FUSED(fnmsub);
+
+#undef DEFINE_EXPR_LOWER_FUSED
+
+/// operand paths: left / right child, left / right child of the left or
+/// right child, through a neg
+template <typename E>
+struct left
+{
+    using type = decltype(std::declval<E>().l);
+    SIMD_INLINE
+    static const type& get(const E& e) noexcept { return e.l; }
+};
+
+template <typename E>
+struct right
+{
+    using type = decltype(std::declval<E>().r);
+    SIMD_INLINE
+    static const type& get(const E& e) noexcept { return e.r; }
+};
+
+template <typename P, typename Q>
+struct path
+{
+    using type = typename Q::template at<typename P::type>::type;
+    template <typename E>
+    SIMD_INLINE
+    static const type& get(const E& e) noexcept { return Q::template at<typename P::type>::get(P::get(e)); }
+};
+
+template <template <typename> class F>
+struct step
+{
+    template <typename E>
+    using at = F<E>;
+};
+
+template <typename E>
+struct negated
+{
+    using type = decltype(std::declval<E>().x);
+    SIMD_INLINE
+    static const type& get(const E& e) noexcept { return e.x; }
+};
+
+/// pattern table for the fused forms, void when E is none of them
+template <typename E>
+struct fused_match
+{
+    using type = void;
+};
+
+template <typename A, typename B, typename C>
+struct fused_match<Binary<op::add, Binary<op::mul, A, B>, C>>
+{
+    using E = Binary<op::add, Binary<op::mul, A, B>, C>;
+    using type = lower_fmadd<E, path<left<E>, step<left>>, path<left<E>, step<right>>, right<E>>;
+};
+
+template <typename A, typename B, typename C>
+struct fused_match<Binary<op::add, C, Binary<op::mul, A, B>>>
+{
+    using E = Binary<op::add, C, Binary<op::mul, A, B>>;
+    using type = lower_fmadd<E, path<right<E>, step<left>>, path<right<E>, step<right>>, left<E>>;
+};
+
+template <typename A, typename B, typename C, typename D>
+struct fused_match<Binary<op::add, Binary<op::mul, A, B>, Binary<op::mul, C, D>>>
+{
+    using E = Binary<op::add, Binary<op::mul, A, B>, Binary<op::mul, C, D>>;
+    using type = lower_fmadd<E, path<left<E>, step<left>>, path<left<E>, step<right>>, right<E>>;
+};
+
+template <typename A, typename B, typename C>
+struct fused_match<Binary<op::sub, Binary<op::mul, A, B>, C>>
+{
+    using E = Binary<op::sub, Binary<op::mul, A, B>, C>;
+    using type = lower_fmsub<E, path<left<E>, step<left>>, path<left<E>, step<right>>, right<E>>;
+};
+
+template <typename A, typename B, typename C>
+struct fused_match<Binary<op::sub, C, Binary<op::mul, A, B>>>
+{
+    using E = Binary<op::sub, C, Binary<op::mul, A, B>>;
+    using type = lower_fnmadd<E, path<right<E>, step<left>>, path<right<E>, step<right>>, left<E>>;
+};
+
+template <typename A, typename B, typename C, typename D>
+struct fused_match<Binary<op::sub, Binary<op::mul, A, B>, Binary<op::mul, C, D>>>
+{
+    using E = Binary<op::sub, Binary<op::mul, A, B>, Binary<op::mul, C, D>>;
+    using type = lower_fmsub<E, path<left<E>, step<left>>, path<left<E>, step<right>>, right<E>>;
+};
+
+template <typename A, typename B, typename C>
+struct fused_match<Binary<op::sub, Unary<op::neg, Binary<op::mul, A, B>>, C>>
+{
+    using E = Binary<op::sub, Unary<op::neg, Binary<op::mul, A, B>>, C>;
+    using N = path<left<E>, step<negated>>;
+    using type = lower_fnmsub<E, path<N, step<left>>, path<N, step<right>>, right<E>>;
+};
+
+template <typename A, typename B, typename C, typename D>
+struct fused_match<Binary<op::sub, Unary<op::neg, Binary<op::mul, A, B>>, Binary<op::mul, C, D>>>
+{
+    using E = Binary<op::sub, Unary<op::neg, Binary<op::mul, A, B>>, Binary<op::mul, C, D>>;
+    using N = path<left<E>, step<negated>>;
+    using type = lower_fnmsub<E, path<N, step<left>>, path<N, step<right>>, right<E>>;
+};
+
+template <typename E>
+struct lowering;
+
+template <typename V>
+struct lowering<Term<V>>
+{
+    using type = lower_term<V>;
+};
+
+template <typename Op, typename L, typename R>
+struct lowering<Binary<Op, L, R>>
+{
+    using E = Binary<Op, L, R>;
+    using fused_t = typename fused_match<E>::type;
+    using type = typename std::conditional<use_ternlog<E>::value, lower_ternlog<E>,
+                 typename std::conditional<std::is_void<fused_t>::value, lower_binary<Op, L, R>,
+                                           fused_t>::type>::type;
+};
+
+template <typename Op, typename X>
+struct lowering<Unary<Op, X>>
+{
+    using E = Unary<Op, X>;
+    using type = typename std::conditional<use_ternlog<E>::value, lower_ternlog<E>, lower_unary<Op, X>>::type;
+};
+}  // namespace detail
+
+/// lowering of E: apply() and the number of kernel ops it issues
+template <typename E, typename Enable>
+struct lower : detail::lowering<E>::type
+{};
+
+/// kernel ops `e` lowers to, one instruction each per register on an
+/// ISA with the op (fma, vpternlog)
+template <typename E, REQUIRES(is_expr<E>::value)>
+constexpr size_t lowered_ops(const E&) noexcept
+{
+    return lower<E>::ops;
+}
+
+}  // namespace expr
+}  // namespace simd
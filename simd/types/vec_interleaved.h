@@ -0,0 +1,251 @@
+#pragma once
+
+#include "simd/types/vec.h"
+#include "simd/api/all.h"
+
+#include <complex>
+#include <cstddef>
+
+namespace simd {
+namespace detail {
+template <typename T, size_t N, size_t... I>
+SIMD_INLINE
+Vec<T, N> dup_even(const Vec<T, N>& x, index_sequence<I...>) noexcept
+{
+    return shuffle<(I & ~size_t(1))...>(x);
+}
+
+template <typename T, size_t N, size_t... I>
+SIMD_INLINE
+Vec<T, N> dup_odd(const Vec<T, N>& x, index_sequence<I...>) noexcept
+{
+    return shuffle<(I | 1)...>(x);
+}
+
+template <typename T, size_t N, size_t... I>
+SIMD_INLINE
+Vec<T, N> swap_pairs(const Vec<T, N>& x, index_sequence<I...>) noexcept
+{
+    return shuffle<(I ^ 1)...>(x);
+}
+
+/// (even, odd, even, odd, ...)
+template <typename T, size_t N>
+SIMD_INLINE
+Vec<T, N> alternate(T even, T odd) noexcept
+{
+    alignas(Vec<T, N>::alignment()) T buf[N];
+    for (size_t i = 0; i < N; i += 2) {
+        buf[i] = even;
+        buf[i + 1] = odd;
+    }
+    return Vec<T, N>::load_aligned(buf);
+}
+}  // namespace detail
+
+template <typename T, size_t W>
+class VecInterleaved;
+
+/// W complex<T> kept interleaved (re, im, re, im, ...) in one Vec<T, 2W>,
+/// the memory layout of a std::complex<T> array: loads and stores are
+/// plain vector moves, no de-interleaving as in Vec<std::complex<T>, W>
+///
+/// multiply is the permute + fmaddsub form: (a + bi)(c + di) from
+/// x * (c, c) -/+ swap(x) * (d, d), 2 in-lane shuffles and 2 arithmetic
+/// instructions for W products; every lane op runs on 2W lanes, so
+/// long chains of arithmetic, division (which computes each quotient
+/// twice) and ops with real results are cheaper in the split layout
+template <typename T, size_t W>
+class VecInterleaved<std::complex<T>, W>
+{
+public:
+    using value_type = std::complex<T>;
+    using scalar_t = T;
+    using data_t = Vec<T, 2 * W>;
+
+    static constexpr size_t size() { return W; }
+
+    SIMD_INLINE
+    VecInterleaved() noexcept = default;
+
+    /// from the interleaved lanes (re0, im0, re1, im1, ...)
+    SIMD_INLINE
+    explicit VecInterleaved(const data_t& data) noexcept
+        : data_(data)
+    {
+    }
+
+    /// all elements `val`
+    SIMD_INLINE
+    VecInterleaved(const value_type& val) noexcept
+        : data_(detail::alternate<T, 2 * W>(val.real(), val.imag()))
+    {
+    }
+
+    SIMD_INLINE
+    static VecInterleaved load_aligned(const value_type* mem) noexcept
+    {
+        return VecInterleaved(data_t::load_aligned(reinterpret_cast<const T*>(mem)));
+    }
+
+    SIMD_INLINE
+    static VecInterleaved load_unaligned(const value_type* mem) noexcept
+    {
+        return VecInterleaved(data_t::load_unaligned(reinterpret_cast<const T*>(mem)));
+    }
+
+    SIMD_INLINE
+    void store_aligned(value_type* mem) const noexcept
+    {
+        data_.store_aligned(reinterpret_cast<T*>(mem));
+    }
+
+    SIMD_INLINE
+    void store_unaligned(value_type* mem) const noexcept
+    {
+        data_.store_unaligned(reinterpret_cast<T*>(mem));
+    }
+
+    SIMD_INLINE
+    const data_t& data() const noexcept
+    {
+        return data_;
+    }
+
+    SIMD_INLINE
+    value_type operator [](size_t idx) const noexcept
+    {
+        return value_type(data_[2 * idx], data_[2 * idx + 1]);
+    }
+
+    /// (re, re) and (im, im) of every element
+    SIMD_INLINE
+    data_t real_dup() const noexcept
+    {
+        return detail::dup_even(data_, detail::make_index_sequence<2 * W>());
+    }
+
+    SIMD_INLINE
+    data_t imag_dup() const noexcept
+    {
+        return detail::dup_odd(data_, detail::make_index_sequence<2 * W>());
+    }
+
+    /// (im, re) of every element
+    SIMD_INLINE
+    data_t swapped() const noexcept
+    {
+        return detail::swap_pairs(data_, detail::make_index_sequence<2 * W>());
+    }
+
+    SIMD_INLINE
+    VecInterleaved operator -() const noexcept
+    {
+        return VecInterleaved(-data_);
+    }
+
+    SIMD_INLINE
+    VecInterleaved operator +() const noexcept
+    {
+        return *this;
+    }
+
+    SIMD_INLINE
+    friend VecInterleaved operator +(const VecInterleaved& lhs, const VecInterleaved& rhs) noexcept
+    {
+        return VecInterleaved(lhs.data_ + rhs.data_);
+    }
+
+    SIMD_INLINE
+    friend VecInterleaved operator -(const VecInterleaved& lhs, const VecInterleaved& rhs) noexcept
+    {
+        return VecInterleaved(lhs.data_ - rhs.data_);
+    }
+
+    SIMD_INLINE
+    friend VecInterleaved operator *(const VecInterleaved& lhs, const VecInterleaved& rhs) noexcept
+    {
+        // even lanes: a * c - b * d, odd lanes: b * c + a * d
+        return VecInterleaved(fmaddsub(lhs.data_, rhs.real_dup(), lhs.swapped() * rhs.imag_dup()));
+    }
+
+    SIMD_INLINE
+    friend VecInterleaved operator /(const VecInterleaved& lhs, const VecInterleaved& rhs) noexcept
+    {
+        /*
+            Smith's algorithm as in the split layout, on duplicated c / d:
+            |c| >= |d|: r = d / c, ((a + b r) + (b - a r)i) / (c + d r)
+            |c| <  |d|: r = c / d, ((a r + b) + (b r - a)i) / (c r + d)
+            with x = (a, b), xs = (b, a) the numerators are
+            fmsubadd(xs, r, x) with the odd lanes negated, and
+            fmsubadd(x, r, xs)
+        */
+        const data_t c = rhs.real_dup();
+        const data_t d = rhs.imag_dup();
+        const data_t xs = lhs.swapped();
+        const auto ge = abs(c) >= abs(d);
+        const data_t p = select(ge, c, d);
+        const data_t q = select(ge, d, c);
+        const data_t r = q / p;
+        const data_t t = fmsubadd(select(ge, xs, lhs.data_), r, select(ge, lhs.data_, xs));
+        const data_t flip = select(ge, detail::alternate<T, 2 * W>(T(1), T(-1)), data_t(T(1)));
+        return VecInterleaved(t * flip / fmadd(q, r, p));
+    }
+
+    SIMD_INLINE
+    VecInterleaved& operator +=(const VecInterleaved& other) noexcept
+    {
+        return *this = *this + other;
+    }
+
+    SIMD_INLINE
+    VecInterleaved& operator -=(const VecInterleaved& other) noexcept
+    {
+        return *this = *this - other;
+    }
+
+    SIMD_INLINE
+    VecInterleaved& operator *=(const VecInterleaved& other) noexcept
+    {
+        return *this = *this * other;
+    }
+
+    SIMD_INLINE
+    VecInterleaved& operator /=(const VecInterleaved& other) noexcept
+    {
+        return *this = *this / other;
+    }
+
+private:
+    data_t data_;
+};
+
+/// complex conjugate, negates the odd lanes
+template <typename T, size_t W>
+SIMD_INLINE
+VecInterleaved<std::complex<T>, W> conj(const VecInterleaved<std::complex<T>, W>& x) noexcept
+{
+    return VecInterleaved<std::complex<T>, W>(x.data() * detail::alternate<T, 2 * W>(T(1), T(-1)));
+}
+
+/// compute `x * conj(y)`: even lanes a * c + b * d, odd lanes b * c - a * d
+template <typename T, size_t W>
+SIMD_INLINE
+VecInterleaved<std::complex<T>, W> mul_conj(const VecInterleaved<std::complex<T>, W>& x,
+                                            const VecInterleaved<std::complex<T>, W>& y) noexcept
+{
+    return VecInterleaved<std::complex<T>, W>(fmsubadd(x.data(), y.real_dup(), x.swapped() * y.imag_dup()));
+}
+
+/// compute complex `(x * y) + z`
+template <typename T, size_t W>
+SIMD_INLINE
+VecInterleaved<std::complex<T>, W> fmadd(const VecInterleaved<std::complex<T>, W>& x,
+                                         const VecInterleaved<std::complex<T>, W>& y,
+                                         const VecInterleaved<std::complex<T>, W>& z) noexcept
+{
+    // t = (b * d - zr, a * d + zi), then (a * c - t, b * c + t)
+    const auto t = fmaddsub(x.swapped(), y.imag_dup(), z.data());
+    return VecInterleaved<std::complex<T>, W>(fmaddsub(x.data(), y.real_dup(), t));
+}
+}  // namespace simd
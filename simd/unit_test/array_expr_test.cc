@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "simd/expr/array.h"
+#include "simd/memory/aligned_allocator.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+template <typename T>
+using aligned_vector = std::vector<T, simd::aligned_allocator<T, 64>>;
+
+template <typename T>
+void check_array_expr(size_t n)
+{
+    namespace ex = simd::expr;
+    aligned_vector<T> x(n), c(n), y(n, T(-1)), z(n, T(-1));
+    for (size_t i = 0; i < n; i++) {
+        x[i] = T(int(i % 23) - 11) / T(8);
+        c[i] = T(i % 7) + T(0.5);
+    }
+    const T a = T(0.75), b = T(-0.25);
+    ex::aligned_span<const T> sx(x), sc(c);
+    ex::aligned_span<T> sy(y);
+
+    ex::assign(sy, ex::exp(a * sx + b) / (1 + sc));
+    for (size_t i = 0; i < n; i++) {
+        T ref = std::exp(a * x[i] + b) / (1 + c[i]);
+        EXPECT_NEAR(ref, y[i], std::abs(ref) * T(1e-5)) << "n " << n << " i " << i;
+    }
+
+    /// every node kind, and the output as an input
+    ex::assign(sy, ex::max(-sx, sc - 3) * sx - ex::sqrt(ex::abs(sx)) + ex::min(sy, T(2)));
+    for (size_t i = 0; i < n; i++) {
+        T prev = std::exp(a * x[i] + b) / (1 + c[i]);
+        T ref = std::max(-x[i], c[i] - 3) * x[i] - std::sqrt(std::abs(x[i])) + std::min(prev, T(2));
+        EXPECT_NEAR(ref, y[i], T(1e-5) * (1 + std::abs(ref))) << "n " << n << " i " << i;
+    }
+
+    ex::assign(sy, ex::log(sc) + ex::sin(sx) * ex::cos(sx));
+    simd::parallel::thread_pool pool(3);
+    simd::parallel::options opt;
+    opt.pool = &pool;
+    opt.chunk = 100;
+    ex::assign(ex::aligned_span<T>(z), ex::log(sc) + ex::sin(sx) * ex::cos(sx), opt);
+    for (size_t i = 0; i < n; i++) {
+        T ref = std::log(c[i]) + std::sin(x[i]) * std::cos(x[i]);
+        EXPECT_NEAR(ref, y[i], T(1e-5) * (1 + std::abs(ref))) << "n " << n << " i " << i;
+        EXPECT_EQ(y[i], z[i]) << "n " << n << " i " << i;
+    }
+
+    /// a scalar only expression broadcasts
+    ex::assign(sy, ex::aligned_span<const T>(c) * 0 + 3);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(T(3), y[i]);
+    }
+}
+}  // namespace
+
+TEST(array_expr, test_float)
+{
+    for (size_t n : {0, 1, 3, 4, 7, 16, 31, 64, 100, 1001, 20000}) {
+        check_array_expr<float>(n);
+    }
+}
+
+TEST(array_expr, test_double)
+{
+    for (size_t n : {0, 1, 2, 5, 8, 33, 1000, 12345}) {
+        check_array_expr<double>(n);
+    }
+}
@@ -0,0 +1,30 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "check_arch.h"
+
+TEST(vec_op_avx, test_algo_reduce_sum)
+{
+    {
+        simd::Vec<double, 4> a(1,2,3,4.5);
+        EXPECT_DOUBLE_EQ(10.5, simd::reduce_sum(a));
+    }
+    {
+        simd::Vec<float, 8> a(1,2,3,4,5,6,7,8.5f);
+        EXPECT_FLOAT_EQ(36.5f, simd::reduce_sum(a));
+    }
+}
+
+TEST(vec_op_avx, test_algo_reduce_max_min)
+{
+    {
+        simd::Vec<float, 16> a(1, -2, 3, 4, -5, 6, 7, 0.5f, 9, 1, 1, 1, -8, 1, 1, 1);
+        EXPECT_EQ(9, simd::reduce_max(a));
+        EXPECT_EQ(-8, simd::reduce_min(a));
+    }
+    {
+        simd::Vec<double, 4> a(1, -2, 3, 0.5);
+        EXPECT_EQ(3, simd::reduce_max(simd::abs(a)));
+        EXPECT_EQ(-2, simd::reduce_min(simd::min(a, simd::Vec<double, 4>(0.0))));
+    }
+}
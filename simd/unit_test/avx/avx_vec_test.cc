@@ -2,6 +2,8 @@
 
 #include "simd/simd.h"
 #include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_wide.h"
+#include "simd/unit_test/check_padded.h"
 #include "check_arch.h"
 
 using namespace simd;
@@ -56,3 +58,36 @@ TEST(vec_avx, test_types)
     TEST_VEC_TYPE(simd::vcf64x4_t, 4, 1, 4, simd::Generic);
     TEST_VEC_TYPE(simd::vcf64x8_t, 8, 2, 4, simd::Generic);
 }
+
+TEST(vec_avx, test_wide)
+{
+    TEST_VEC_TYPE(simd::vf32x32_t,  32,  4,  8, simd::AVX);
+    TEST_VEC_TYPE(simd::vf32x128_t, 128, 16, 8, simd::AVX);
+    TEST_VEC_TYPE(simd::vf64x16_t,  16,  4,  4, simd::AVX);
+    TEST_VEC_TYPE(simd::vf64x64_t,  64,  16, 4, simd::AVX);
+
+    TEST_CHECK(ut::check_wide<float, 32>());
+    TEST_CHECK(ut::check_wide<float, 64>());
+    TEST_CHECK(ut::check_wide<float, 128>());
+    TEST_CHECK(ut::check_wide<double, 16>());
+    TEST_CHECK(ut::check_wide<double, 32>());
+    TEST_CHECK(ut::check_wide<double, 64>());
+}
+
+TEST(vec_avx, test_padded)
+{
+    using vf32x5_t = simd::Vec<float, 5>;
+    EXPECT_EQ(true, (std::is_same<simd::AVX, vf32x5_t::arch_t>::value));
+    EXPECT_EQ(1, vf32x5_t::n_regs());
+    EXPECT_EQ(8, vf32x5_t::padded_lanes());
+    using vf32x12_t = simd::Vec<float, 12>;
+    EXPECT_EQ(2, vf32x12_t::n_regs());
+    EXPECT_EQ(16, vf32x12_t::padded_lanes());
+
+    TEST_CHECK(ut::check_padded<float, 3>());
+    TEST_CHECK(ut::check_padded<float, 5>());
+    TEST_CHECK(ut::check_padded<float, 12>());
+    TEST_CHECK(ut::check_padded<float, 20>());
+    TEST_CHECK(ut::check_padded<double, 3>());
+    TEST_CHECK(ut::check_padded<double, 6>());
+}
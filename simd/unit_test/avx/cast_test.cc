@@ -0,0 +1,24 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "check_arch.h"
+
+TEST(vec_avx, test_vec_cast)
+{
+    {
+        simd::Vec<float, 8> a(1.5f,-2,3,4,5,6,-7,8);
+        simd::Vec<double, 8> p(1.5,-2,3,4,5,6,-7,8);
+        auto b = simd::cast<double>(a);
+        EXPECT_TRUE(simd::all_of(p == b));
+        auto c = simd::cast<float>(b);
+        EXPECT_TRUE(simd::all_of(a == c));
+    }
+    {
+        simd::Vec<float, 4> a(1.5f,-2,3,4);
+        simd::Vec<double, 4> p(1.5,-2,3,4);
+        auto b = simd::cast<double>(a);
+        EXPECT_TRUE(simd::all_of(p == b));
+        auto c = simd::cast<float>(b);
+        EXPECT_TRUE(simd::all_of(a == c));
+    }
+}
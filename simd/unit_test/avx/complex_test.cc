@@ -2,6 +2,9 @@
 
 #include "simd/simd.h"
 #include "check_arch.h"
+#include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_complex.h"
+#include "simd/unit_test/check_math.h"
 
 #include <algorithm>
 
@@ -131,6 +134,28 @@ TEST(vec_complex_avx, test_arith_div)
     }
 }
 
+/// fused mul, mul_conj, fmadd and Smith's division on split vectors
+TEST(vec_complex_avx, test_arith_fused)
+{
+    TEST_CHECK(simd::ut::check_complex_arith<float, 8>());
+    TEST_CHECK(simd::ut::check_complex_arith<double, 4>());
+    TEST_CHECK(simd::ut::check_complex_arith<double, 8>());
+}
+
+/// abs, norm, arg, exp, log, sqrt, conj, polar against std::complex
+TEST(vec_complex_avx, test_complex_math)
+{
+    TEST_CHECK(simd::ut::check_complex_math<float, 8>());
+    TEST_CHECK(simd::ut::check_complex_math<double, 4>());
+}
+
+/// VecInterleaved: permute + fmaddsub multiply, Smith division, plain I/O
+TEST(vec_complex_avx, test_complex_interleaved)
+{
+    TEST_CHECK(simd::ut::check_interleaved_complex<float, 8>());
+    TEST_CHECK(simd::ut::check_interleaved_complex<double, 4>());
+}
+
 TEST(vec_complex_avx, test_memory_load_aligned)
 {
     {
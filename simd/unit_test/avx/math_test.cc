@@ -0,0 +1,14 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "check_arch.h"
+#include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_math.h"
+
+/// exp, log, sin, cos, sincos, atan2, hypot in ulp against std
+TEST(vec_op_avx, test_math_transcendental)
+{
+    TEST_CHECK(simd::ut::check_real_math<float, 8>());
+    TEST_CHECK(simd::ut::check_real_math<double, 4>());
+    TEST_CHECK(simd::ut::check_real_math<double, 8>());
+}
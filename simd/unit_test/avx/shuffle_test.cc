@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "check_arch.h"
+#include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_shuffle.h"
+
+TEST(vec_op_avx, test_shuffle)
+{
+    using simd::ut::check_shuffle;
+    TEST_CHECK(check_shuffle<int32_t, 8>());
+    TEST_CHECK(check_shuffle<uint64_t, 4>());
+    TEST_CHECK(check_shuffle<float, 8>());
+    TEST_CHECK(check_shuffle<double, 4>());
+    TEST_CHECK(check_shuffle<float, 16>());
+    TEST_CHECK(check_shuffle<double, 8>());
+    /// 8 / 16-bit lanes take the generic path on AVX
+    TEST_CHECK(check_shuffle<int16_t, 16>());
+}
+
+TEST(vec_op_avx, test_permute)
+{
+    using simd::ut::check_permute;
+    TEST_CHECK(check_permute<float, 8>());
+    TEST_CHECK(check_permute<double, 4>());
+    /// integer lanes take the generic path on AVX
+    TEST_CHECK(check_permute<int32_t, 8>());
+}
+
+TEST(vec_op_avx, test_slide)
+{
+    using simd::ut::check_slide;
+    TEST_CHECK(check_slide<float, 8>());
+    TEST_CHECK(check_slide<double, 4>());
+    TEST_CHECK(check_slide<int32_t, 8>());
+    TEST_CHECK(check_slide<uint64_t, 4>());
+    TEST_CHECK(check_slide<float, 16>());
+}
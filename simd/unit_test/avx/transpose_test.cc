@@ -0,0 +1,20 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "check_arch.h"
+#include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_transpose.h"
+
+TEST(vec_op_avx, test_transpose)
+{
+    using simd::ut::check_transpose;
+    TEST_CHECK(check_transpose<float, 8>());
+    TEST_CHECK(check_transpose<double, 4>());
+    TEST_CHECK(check_transpose<int32_t, 8>());
+    TEST_CHECK(check_transpose<uint64_t, 4>());
+    /// two registers per row
+    TEST_CHECK(check_transpose<float, 16>());
+    TEST_CHECK(check_transpose<double, 8>());
+    /// no 256-bit integer unpack before AVX2, element fallback
+    TEST_CHECK(check_transpose<int8_t, 32>());
+}
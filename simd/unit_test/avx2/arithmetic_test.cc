@@ -2,6 +2,9 @@
 
 #include "simd/simd.h"
 #include "check_arch.h"
+#include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_saturate.h"
+#include "simd/unit_test/check_dot.h"
 
 using namespace simd;
 
@@ -47,3 +50,30 @@ TEST(vec_op_avx2, test_arith_add)
         EXPECT_TRUE(simd::all_of(p == g));
     }
 }
+
+TEST(vec_op_avx2, test_arith_saturate)
+{
+    {
+        simd::Vec<int16_t, 16> a(30000), b(30000), p(32767);
+        auto c = simd::add_sat(a, b);
+        EXPECT_TRUE(simd::all_of(p == c));
+        auto d = simd::sub_sat(-a, b);
+        EXPECT_TRUE(simd::all_of(d == int16_t(-32768)));
+    }
+    using simd::ut::check_saturate;
+    TEST_CHECK(check_saturate<int8_t, 32>());
+    TEST_CHECK(check_saturate<uint8_t, 32>());
+    TEST_CHECK(check_saturate<int16_t, 16>());
+    TEST_CHECK(check_saturate<uint16_t, 16>());
+    TEST_CHECK(check_saturate<int32_t, 8>());
+    TEST_CHECK(check_saturate<uint32_t, 8>());
+    TEST_CHECK(check_saturate<int64_t, 4>());
+    TEST_CHECK(check_saturate<uint64_t, 4>());
+    TEST_CHECK(check_saturate<int8_t, 64>());
+}
+
+TEST(vec_op_avx2, test_arith_dot_u8i8)
+{
+    TEST_CHECK(simd::ut::check_dot_u8i8<8>());
+    TEST_CHECK(simd::ut::check_dot_u8i8<16>());
+}
@@ -3,6 +3,7 @@
 #include "simd/simd.h"
 
 #include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_padded.h"
 #include "check_arch.h"
 
 using namespace simd;
@@ -58,3 +59,19 @@ TEST(vec_avx2, test_types)
     TEST_VEC_TYPE(simd::vcf64x4_t, 4, 1, 4, simd::Generic);
     TEST_VEC_TYPE(simd::vcf64x8_t, 8, 2, 4, simd::Generic);
 }
+
+TEST(vec_avx2, test_padded)
+{
+    using vi8x100_t = simd::Vec<int8_t, 100>;
+    EXPECT_EQ(true, (std::is_same<simd::AVX2, vi8x100_t::arch_t>::value));
+    EXPECT_EQ(4, vi8x100_t::n_regs());
+    EXPECT_EQ(128, vi8x100_t::padded_lanes());
+
+    TEST_CHECK(ut::check_padded<float, 12>());
+    TEST_CHECK(ut::check_padded<int32_t, 13>());
+    TEST_CHECK(ut::check_padded<int8_t, 50>());
+    /// mask queries past 64 lanes, 8-bit lanes past 128
+    TEST_CHECK(ut::check_padded<int8_t, 100>());
+    TEST_CHECK(ut::check_padded<int8_t, 200>());
+    TEST_CHECK(ut::check_padded<uint8_t, 200>());
+}
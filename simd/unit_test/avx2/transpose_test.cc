@@ -0,0 +1,16 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "check_arch.h"
+#include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_transpose.h"
+
+TEST(vec_op_avx2, test_transpose)
+{
+    using simd::ut::check_transpose;
+    TEST_CHECK(check_transpose<int8_t, 32>());
+    TEST_CHECK(check_transpose<uint16_t, 16>());
+    TEST_CHECK(check_transpose<uint32_t, 8>());
+    TEST_CHECK(check_transpose<int64_t, 4>());
+    TEST_CHECK(check_transpose<int16_t, 32>());
+}
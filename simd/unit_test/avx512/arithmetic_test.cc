@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "check_arch.h"
+#include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_saturate.h"
+#include "simd/unit_test/check_dot.h"
+#include "simd/unit_test/check_complex.h"
+#include "simd/unit_test/check_math.h"
+
+TEST(vec_op_avx512, test_arith_saturate)
+{
+    {
+        simd::Vec<uint32_t, 16> a(UINT32_MAX - 5), b(10), p(UINT32_MAX);
+        auto c = simd::add_sat(a, b);
+        EXPECT_TRUE(simd::all_of(p == c));
+        auto d = simd::sub_sat(b, a);
+        EXPECT_TRUE(simd::all_of(d == 0u));
+    }
+    using simd::ut::check_saturate;
+    TEST_CHECK(check_saturate<int8_t, 64>());
+    TEST_CHECK(check_saturate<uint8_t, 64>());
+    TEST_CHECK(check_saturate<int16_t, 32>());
+    TEST_CHECK(check_saturate<uint16_t, 32>());
+    TEST_CHECK(check_saturate<int32_t, 16>());
+    TEST_CHECK(check_saturate<uint32_t, 16>());
+    TEST_CHECK(check_saturate<int64_t, 8>());
+    TEST_CHECK(check_saturate<uint64_t, 8>());
+}
+
+TEST(vec_op_avx512, test_arith_dot_u8i8)
+{
+    TEST_CHECK(simd::ut::check_dot_u8i8<16>());
+    TEST_CHECK(simd::ut::check_dot_u8i8<4>());
+}
+
+TEST(vec_op_avx512, test_floor_ceil)
+{
+    simd::Vec<float, 16> x;
+    simd::Vec<double, 8> y;
+    for (int i = 0; i < 16; i++) {
+        x[i] = (i - 8) * 0.75f;
+    }
+    for (int i = 0; i < 8; i++) {
+        y[i] = (i - 4) * 1.25;
+    }
+    auto fx = simd::floor(x), cx = simd::ceil(x);
+    auto fy = simd::floor(y), cy = simd::ceil(y);
+    for (int i = 0; i < 16; i++) {
+        EXPECT_EQ(std::floor(x[i]), fx[i]);
+        EXPECT_EQ(std::ceil(x[i]), cx[i]);
+    }
+    for (int i = 0; i < 8; i++) {
+        EXPECT_EQ(std::floor(y[i]), fy[i]);
+        EXPECT_EQ(std::ceil(y[i]), cy[i]);
+    }
+}
+
+TEST(vec_op_avx512, test_complex_arith)
+{
+    TEST_CHECK(simd::ut::check_complex_arith<float, 16>());
+    TEST_CHECK(simd::ut::check_complex_arith<double, 8>());
+}
+
+/// exp, log, sin, cos, sincos, atan2, hypot in ulp against std
+TEST(vec_op_avx512, test_math_transcendental)
+{
+    TEST_CHECK(simd::ut::check_real_math<float, 16>());
+    TEST_CHECK(simd::ut::check_real_math<double, 8>());
+}
+
+/// abs, norm, arg, exp, log, sqrt, conj, polar against std::complex
+TEST(vec_op_avx512, test_complex_math)
+{
+    TEST_CHECK(simd::ut::check_complex_math<float, 16>());
+    TEST_CHECK(simd::ut::check_complex_math<double, 8>());
+}
+
+/// VecInterleaved: permute + fmaddsub multiply, Smith division, plain I/O
+TEST(vec_op_avx512, test_complex_interleaved)
+{
+    TEST_CHECK(simd::ut::check_interleaved_complex<float, 8>());
+    TEST_CHECK(simd::ut::check_interleaved_complex<double, 4>());
+}
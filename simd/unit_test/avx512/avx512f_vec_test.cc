@@ -3,6 +3,8 @@
 #include "simd/simd.h"
 
 #include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_wide.h"
+#include "simd/unit_test/check_padded.h"
 #include "check_arch.h"
 
 using namespace simd;
@@ -57,3 +59,53 @@ TEST(vec_avx512, test_types)
     TEST_VEC_TYPE(simd::vcf64x4_t, 4, 1, 4, simd::AVX2);
     TEST_VEC_TYPE(simd::vcf64x8_t, 8, 1, 8, simd::AVX512);
 }
+
+TEST(vec_avx512, test_wide)
+{
+    TEST_VEC_TYPE(simd::vf32x32_t,  32,  2,  16, simd::AVX512);
+    TEST_VEC_TYPE(simd::vf32x128_t, 128, 8, 16, simd::AVX512);
+    TEST_VEC_TYPE(simd::vf64x16_t,  16,  2,  8, simd::AVX512);
+    TEST_VEC_TYPE(simd::vf64x64_t,  64,  8, 8, simd::AVX512);
+
+    TEST_CHECK(ut::check_wide<float, 32>());
+    TEST_CHECK(ut::check_wide<float, 64>());
+    TEST_CHECK(ut::check_wide<float, 128>());
+    TEST_CHECK(ut::check_wide<double, 16>());
+    TEST_CHECK(ut::check_wide<double, 32>());
+    TEST_CHECK(ut::check_wide<double, 64>());
+    TEST_CHECK(ut::check_wide<int32_t, 32>());
+    TEST_CHECK(ut::check_wide<int32_t, 128>());
+    TEST_CHECK(ut::check_wide<uint8_t, 256>());
+    TEST_CHECK(ut::check_wide<int64_t, 64>());
+}
+
+TEST(vec_avx512, test_padded)
+{
+    using vf32x12_t = simd::Vec<float, 12>;
+    EXPECT_EQ(true, (std::is_same<simd::AVX512, vf32x12_t::arch_t>::value));
+    EXPECT_EQ(1, vf32x12_t::n_regs());
+    EXPECT_EQ(16, vf32x12_t::padded_lanes());
+    EXPECT_EQ(1, vf32x12_t::vec_bool_t::n_regs());
+    using vf64x20_t = simd::Vec<double, 20>;
+    EXPECT_EQ(3, vf64x20_t::n_regs());
+    EXPECT_EQ(24, vf64x20_t::padded_lanes());
+
+    TEST_CHECK(ut::check_padded<float, 3>());
+    TEST_CHECK(ut::check_padded<float, 5>());
+    TEST_CHECK(ut::check_padded<float, 12>());
+    TEST_CHECK(ut::check_padded<float, 20>());
+    TEST_CHECK(ut::check_padded<double, 3>());
+    TEST_CHECK(ut::check_padded<double, 5>());
+    TEST_CHECK(ut::check_padded<double, 20>());
+    TEST_CHECK(ut::check_padded<int32_t, 5>());
+    TEST_CHECK(ut::check_padded<int32_t, 13>());
+    TEST_CHECK(ut::check_padded<int64_t, 3>());
+    TEST_CHECK(ut::check_padded<int8_t, 20>());
+    TEST_CHECK(ut::check_padded<int8_t, 50>());
+    TEST_CHECK(ut::check_padded<int16_t, 12>());
+    TEST_CHECK(ut::check_padded<uint8_t, 7>());
+    /// mask queries past 64 lanes, 8-bit lanes past 128
+    TEST_CHECK(ut::check_padded<int8_t, 100>());
+    TEST_CHECK(ut::check_padded<int8_t, 200>());
+    TEST_CHECK(ut::check_padded<int16_t, 70>());
+}
@@ -0,0 +1,28 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "check_arch.h"
+#include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_ternlog.h"
+#include "simd/unit_test/check_vec_expr.h"
+
+/// vpternlog for every immediate and lane type
+TEST(vec_op_avx512, test_ternlog)
+{
+    TEST_CHECK(simd::ut::check_ternlog<uint8_t, 64>());
+    TEST_CHECK(simd::ut::check_ternlog<int16_t, 32>());
+    TEST_CHECK(simd::ut::check_ternlog<int32_t, 16>());
+    TEST_CHECK(simd::ut::check_ternlog<uint64_t, 8>());
+    TEST_CHECK(simd::ut::check_ternlog<float, 16>());
+    TEST_CHECK(simd::ut::check_ternlog<double, 8>());
+}
+
+/// expr::lazy: fma forms and bitwise trees in one vfmadd / vpternlog
+TEST(vec_op_avx512, test_vec_expr)
+{
+    TEST_CHECK(simd::ut::check_vec_expr<float, 16>());
+    TEST_CHECK(simd::ut::check_vec_expr<double, 8>());
+    TEST_CHECK(simd::ut::check_vec_expr_bitwise<int32_t, 16>());
+    TEST_CHECK(simd::ut::check_vec_expr_bitwise<uint8_t, 64>());
+    TEST_CHECK(simd::ut::check_vec_expr_bitwise<int64_t, 8>());
+}
@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "check_arch.h"
+#include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_shuffle.h"
+
+TEST(vec_op_avx512, test_shuffle)
+{
+    using simd::ut::check_shuffle;
+    TEST_CHECK(check_shuffle<uint8_t, 64>());
+    TEST_CHECK(check_shuffle<int16_t, 32>());
+    TEST_CHECK(check_shuffle<int32_t, 16>());
+    TEST_CHECK(check_shuffle<uint64_t, 8>());
+    TEST_CHECK(check_shuffle<float, 16>());
+    TEST_CHECK(check_shuffle<double, 8>());
+    TEST_CHECK(check_shuffle<int8_t, 32>());
+    TEST_CHECK(check_shuffle<float, 8>());
+}
+
+TEST(vec_op_avx512, test_permute)
+{
+    using simd::ut::check_permute;
+    TEST_CHECK(check_permute<uint8_t, 64>());
+    TEST_CHECK(check_permute<int16_t, 32>());
+    TEST_CHECK(check_permute<float, 16>());
+    TEST_CHECK(check_permute<int32_t, 16>());
+    TEST_CHECK(check_permute<double, 8>());
+    TEST_CHECK(check_permute<int64_t, 8>());
+}
+
+TEST(vec_op_avx512, test_lookup)
+{
+    TEST_CHECK(simd::ut::check_lookup<64>());
+}
+
+TEST(vec_op_avx512, test_slide)
+{
+    using simd::ut::check_slide;
+    TEST_CHECK(check_slide<uint8_t, 64>());
+    TEST_CHECK(check_slide<int16_t, 32>());
+    TEST_CHECK(check_slide<int32_t, 16>());
+    TEST_CHECK(check_slide<uint64_t, 8>());
+    TEST_CHECK(check_slide<float, 16>());
+    TEST_CHECK(check_slide<double, 8>());
+}
@@ -0,0 +1,20 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "check_arch.h"
+#include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_transpose.h"
+
+TEST(vec_op_avx512, test_transpose)
+{
+    using simd::ut::check_transpose;
+    TEST_CHECK(check_transpose<uint8_t, 64>());
+    TEST_CHECK(check_transpose<int16_t, 32>());
+    TEST_CHECK(check_transpose<int32_t, 16>());
+    TEST_CHECK(check_transpose<uint64_t, 8>());
+    TEST_CHECK(check_transpose<float, 16>());
+    TEST_CHECK(check_transpose<double, 8>());
+    /// 256-bit rows run on AVX2 even with AVX-512 enabled
+    TEST_CHECK(check_transpose<float, 8>());
+    TEST_CHECK(check_transpose<int8_t, 32>());
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "simd/blas1/blas1.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+template <typename T>
+std::vector<T> ramp(size_t n, T scale)
+{
+    std::vector<T> x(n);
+    for (size_t i = 0; i < n; i++) {
+        x[i] = scale * T(int(i % 13) - 6);
+    }
+    return x;
+}
+}  // namespace
+
+TEST(blas1, test_axpy_scal)
+{
+    for (size_t n : {0, 3, 16, 37, 200}) {
+        auto x = ramp<float>(n, 1.f);
+        auto y = ramp<float>(n, 0.5f);
+        simd::blas1::axpy(n, 2.f, x.data(), y.data());
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_FLOAT_EQ(2.5f * x[i], y[i]);
+        }
+        simd::blas1::scal(n, -2.0f, y.data());
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_FLOAT_EQ(-5.f * x[i], y[i]);
+        }
+    }
+    {
+        /// y[0, 2, 4] += 3 * x[2, 1, 0]
+        std::vector<double> x{1, 2, 3}, y{10, 0, 20, 0, 30};
+        simd::blas1::axpy(3, 3.0, x.data(), -1, y.data(), 2);
+        EXPECT_EQ((std::vector<double>{19, 0, 26, 0, 33}), y);
+        simd::blas1::scal(2, 2.0, y.data(), 4);
+        EXPECT_EQ((std::vector<double>{38, 0, 26, 0, 66}), y);
+    }
+}
+
+TEST(blas1, test_dot_asum)
+{
+    for (size_t n : {0, 5, 64, 101}) {
+        auto x = ramp<double>(n, 1.0);
+        auto y = ramp<double>(n, -0.25);
+        double d = 0, a = 0;
+        for (size_t i = 0; i < n; i++) {
+            d += x[i] * y[i];
+            a += std::abs(y[i]);
+        }
+        EXPECT_DOUBLE_EQ(d, simd::blas1::dot(n, x.data(), y.data()));
+        EXPECT_DOUBLE_EQ(a, simd::blas1::asum(n, y.data()));
+    }
+    std::vector<float> x{1, 2, 3, 4}, y{1, 1, 2, 2, 3, 3, 4, 4};
+    EXPECT_FLOAT_EQ(30.f, simd::blas1::dot(4, x.data(), 1, y.data(), 2));
+    EXPECT_FLOAT_EQ(20.f, simd::blas1::dot(4, x.data(), -1, y.data(), 2));
+    EXPECT_FLOAT_EQ(10.f, simd::blas1::asum(4, y.data(), 2));
+}
+
+TEST(blas1, test_nrm2)
+{
+    std::vector<float> x(100, 3.f);
+    EXPECT_FLOAT_EQ(30.f, simd::blas1::nrm2(x.size(), x.data()));
+    EXPECT_FLOAT_EQ(std::sqrt(50.f) * 3.f, simd::blas1::nrm2(50, x.data(), 2));
+
+    /// squares overflow / underflow float, the norm itself does not
+    for (float scale : {1e30f, 1e-30f}) {
+        std::vector<float> y(99, 3.f * scale);
+        EXPECT_NEAR(std::sqrt(99.f) * 3.f, simd::blas1::nrm2(y.size(), y.data()) / scale, 1e-5f);
+        EXPECT_NEAR(std::sqrt(33.f) * 3.f, simd::blas1::nrm2(33, y.data(), 3) / scale, 1e-5f);
+    }
+    /// subnormal max(|x|), 2^-e alone would overflow
+    std::vector<float> y{1e-40f, 0.f, 1e-40f};
+    EXPECT_NEAR(std::sqrt(2.f), simd::blas1::nrm2(y.size(), y.data()) / 1e-40f, 1e-4f);
+    EXPECT_EQ(1e-40f, simd::blas1::nrm2(1, y.data()));
+    y.assign(3, std::numeric_limits<float>::denorm_min());
+    EXPECT_EQ(y[0], simd::blas1::nrm2(1, y.data()));
+    EXPECT_FALSE(std::isnan(simd::blas1::nrm2(y.size(), y.data())));
+    std::vector<double> z(20, 0.0);
+    EXPECT_EQ(0.0, simd::blas1::nrm2(z.size(), z.data()));
+    z[7] = std::numeric_limits<double>::infinity();
+    EXPECT_TRUE(std::isinf(simd::blas1::nrm2(z.size(), z.data())));
+}
+
+TEST(blas1, test_iamax)
+{
+    for (size_t n : {1, 9, 100, 3000}) {
+        auto x = ramp<float>(n, 1.f);
+        size_t pos = n * 2 / 3;
+        x[pos] = -100.f;
+        if (pos + 5 < n) {
+            x[pos + 5] = 100.f;  /// ties resolve to the first
+        }
+        EXPECT_EQ(pos, simd::blas1::iamax(n, x.data()));
+    }
+    std::vector<double> x{1, -7, 3, 9, 5, -9};
+    EXPECT_EQ(2u, simd::blas1::iamax(3, x.data(), 2));
+    EXPECT_EQ(1u, simd::blas1::iamax(3, x.data() + 1, 2));
+    EXPECT_EQ(0u, simd::blas1::iamax(0, x.data()));
+}
+
+TEST(blas1, test_rot)
+{
+    const double c = 0.6, s = 0.8;
+    for (size_t n : {3, 32, 45}) {
+        auto x = ramp<double>(n, 1.0);
+        auto y = ramp<double>(n, 2.0);
+        auto x0 = x, y0 = y;
+        simd::blas1::rot(n, x.data(), y.data(), c, s);
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_NEAR(c * x0[i] + s * y0[i], x[i], 1e-12);
+            EXPECT_NEAR(c * y0[i] - s * x0[i], y[i], 1e-12);
+        }
+    }
+    std::vector<float> x{1, 0, 2, 0}, y{1, 2};
+    simd::blas1::rot(2, x.data(), 2, y.data(), 1, 0.f, 1.f);
+    EXPECT_EQ((std::vector<float>{1, 0, 2, 0}), x);
+    EXPECT_EQ((std::vector<float>{-1, -2}), y);
+}
+
+TEST(blas1, test_half_dot_axpy)
+{
+    for (size_t n : {0, 7, 64, 133}) {
+        /// small quarter-integers: exact in half, products and sums exact in float
+        auto xf = ramp<float>(n, 0.25f);
+        auto yf = ramp<float>(n, -0.5f);
+        std::vector<simd::half> x(n), y(n);
+        float d = 0;
+        for (size_t i = 0; i < n; i++) {
+            x[i] = simd::half(xf[i]);
+            y[i] = simd::half(yf[i]);
+            d += xf[i] * yf[i];
+        }
+        EXPECT_EQ(d, simd::blas1::dot(n, x.data(), y.data()));
+        simd::blas1::axpy(n, 2.f, x.data(), y.data());
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_EQ(2.f * xf[i] + yf[i], float(y[i])) << i;
+        }
+    }
+}
+
+TEST(blas1, test_bf16_dot)
+{
+    for (size_t n : {0, 9, 64, 211}) {
+        auto xf = ramp<float>(n, 0.5f);
+        auto yf = ramp<float>(n, -0.25f);
+        std::vector<simd::bfloat16> x(n), y(n);
+        float d = 0;
+        for (size_t i = 0; i < n; i++) {
+            x[i] = simd::bfloat16(xf[i]);
+            y[i] = simd::bfloat16(yf[i]);
+            d += xf[i] * yf[i];
+        }
+        EXPECT_EQ(d, simd::blas1::dot(n, x.data(), y.data()));
+    }
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "simd/bulk/complex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+
+namespace {
+template <typename T>
+void expect_near(std::complex<T> ref, std::complex<T> got, const char* op, size_t i)
+{
+    const T tol = 8 * std::numeric_limits<T>::epsilon() * std::max(std::abs(ref.real()), std::abs(ref.imag()));
+    ASSERT_NEAR(ref.real(), got.real(), tol) << op << " n " << i;
+    ASSERT_NEAR(ref.imag(), got.imag(), tol) << op << " n " << i;
+}
+
+/// every length up to 3 vectors + tail, against std::complex
+template <typename T>
+void check_ops()
+{
+    using C = std::complex<T>;
+    for (size_t n = 0; n <= 3 * simd::native_lanes<T>() + 3; n++) {
+        std::vector<C> a(n), b(n), c(n), out(n);
+        std::vector<T> nrm(n);
+        for (size_t i = 0; i < n; i++) {
+            a[i] = C(T(int(i * 7 % 13) - 6) + T(0.5), T(int(i * 5 % 11) - 5) - T(0.25));
+            b[i] = C((T(int(i * 3 % 7) - 3) + T(0.75)) * (i & 1 ? 1 : 4),
+                     (T(int(i * 2 % 5) - 2) + T(0.125)) * (i & 1 ? 4 : 1));
+            c[i] = C(T(i), -T(i) / 2);
+        }
+        simd::bulk::mul(n, a.data(), b.data(), out.data());
+        for (size_t i = 0; i < n; i++) {
+            expect_near(a[i] * b[i], out[i], "mul", n);
+        }
+        simd::bulk::mul_conj(n, a.data(), b.data(), out.data());
+        for (size_t i = 0; i < n; i++) {
+            expect_near(a[i] * std::conj(b[i]), out[i], "mul_conj", n);
+        }
+        simd::bulk::fmadd(n, a.data(), b.data(), c.data(), out.data());
+        for (size_t i = 0; i < n; i++) {
+            expect_near(a[i] * b[i] + c[i], out[i], "fmadd", n);
+        }
+        simd::bulk::div(n, a.data(), b.data(), out.data());
+        for (size_t i = 0; i < n; i++) {
+            expect_near(a[i] / b[i], out[i], "div", n);
+        }
+        simd::bulk::norm(n, a.data(), nrm.data());
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_NEAR(std::norm(a[i]), nrm[i], 4 * std::numeric_limits<T>::epsilon() * std::norm(a[i])) << "norm n " << n;
+        }
+        std::vector<T> mag(n), ang(n);
+        simd::bulk::abs(n, a.data(), mag.data());
+        simd::bulk::arg(n, a.data(), ang.data());
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_NEAR(std::abs(a[i]), mag[i], 4 * std::numeric_limits<T>::epsilon() * std::abs(a[i])) << "abs n " << n;
+            ASSERT_NEAR(std::arg(a[i]), ang[i], 8 * std::numeric_limits<T>::epsilon() * std::abs(ang[i])) << "arg n " << n;
+        }
+        simd::bulk::polar(n, mag.data(), ang.data(), out.data());
+        for (size_t i = 0; i < n; i++) {
+            expect_near(a[i], out[i], "polar", n);
+        }
+        simd::bulk::sqrt(n, a.data(), out.data());
+        for (size_t i = 0; i < n; i++) {
+            expect_near(std::sqrt(a[i]), out[i], "sqrt", n);
+        }
+        simd::bulk::exp(n, c.data(), out.data());
+        for (size_t i = 0; i < n; i++) {
+            expect_near(std::exp(c[i]), out[i], "exp", n);
+        }
+        simd::bulk::log(n, b.data(), out.data());
+        for (size_t i = 0; i < n; i++) {
+            expect_near(std::log(b[i]), out[i], "log", n);
+        }
+        /// in place
+        out = a;
+        simd::bulk::mul(n, out.data(), b.data(), out.data());
+        simd::bulk::div(n, out.data(), b.data(), out.data());
+        for (size_t i = 0; i < n; i++) {
+            expect_near(a[i], out[i], "mul div", n);
+        }
+    }
+}
+}  // namespace
+
+TEST(bulk_complex, test_float_double)
+{
+    check_ops<float>();
+    check_ops<double>();
+}
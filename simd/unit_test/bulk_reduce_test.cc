@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "simd/bulk/reduce.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+template <typename T>
+std::vector<T> make_data(size_t n)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> mant(-1.0, 1.0);
+    std::uniform_int_distribution<int> expo(-8, 8);
+    std::vector<T> x(n);
+    for (auto& v : x) {
+        v = static_cast<T>(std::ldexp(mant(rng), expo(rng)));
+    }
+    return x;
+}
+
+template <typename T>
+void check_compensated(const std::vector<T>& x)
+{
+    long double ref = 0, abs_sum = 0;
+    for (T v : x) {
+        ref += v;
+        abs_sum += std::fabs(v);
+    }
+    const long double tol = 4 * std::numeric_limits<T>::epsilon() * abs_sum;
+    using simd::bulk::summation;
+    for (auto mode : {summation::kahan, summation::neumaier, summation::widen}) {
+        T s = simd::bulk::sum(x.data(), x.size(), mode);
+        EXPECT_LE(std::fabs(s - ref), tol) << "mode " << static_cast<int>(mode);
+    }
+    T s = simd::bulk::sum(x.data(), x.size(), summation::pairwise);
+    EXPECT_LE(std::fabs(s - ref), 64 * tol);
+    s = simd::bulk::sum(x.data(), x.size());
+    EXPECT_LE(std::fabs(s - ref), x.size() * tol);
+}
+}  // namespace
+
+TEST(bulk_reduce, test_sum_small)
+{
+    using simd::bulk::summation;
+    for (size_t n = 0; n < 100; n++) {
+        std::vector<float> x(n, 1.f);
+        for (auto mode : {summation::plain, summation::kahan, summation::neumaier,
+                          summation::pairwise, summation::widen}) {
+            EXPECT_FLOAT_EQ(float(n), simd::bulk::sum(x.data(), n, mode));
+        }
+    }
+}
+
+TEST(bulk_reduce, test_sum_float)
+{
+    check_compensated(make_data<float>((1 << 20) + 13));
+}
+
+TEST(bulk_reduce, test_sum_double)
+{
+    check_compensated(make_data<double>((1 << 18) + 7));
+}
+
+TEST(bulk_reduce, test_sum_drift)
+{
+    /// a long run of equal addends drifts badly in float
+    std::vector<float> x((1 << 22) + 3, 0.1f);
+    const double ref = double(0.1f) * x.size();
+    using simd::bulk::summation;
+    for (auto mode : {summation::kahan, summation::neumaier, summation::widen}) {
+        float s = simd::bulk::sum(x.data(), x.size(), mode);
+        EXPECT_NEAR(ref, s, ref * 1e-7);
+    }
+}
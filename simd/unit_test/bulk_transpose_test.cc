@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "simd/bulk/transpose.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+template <typename T>
+void check_transpose(size_t rows, size_t cols, size_t pad)
+{
+    const size_t ld_in = cols + pad, ld_out = rows + pad;
+    std::vector<T> in(rows * ld_in), out(cols * ld_out, T(-1));
+    for (size_t i = 0; i < in.size(); i++) {
+        in[i] = T(uint32_t(i * 2654435761u) >> 24);
+    }
+    simd::bulk::transpose(rows, cols, in.data(), ld_in, out.data(), ld_out);
+    for (size_t j = 0; j < cols; j++) {
+        for (size_t i = 0; i < rows; i++) {
+            ASSERT_EQ(in[i * ld_in + j], out[j * ld_out + i]) << rows << "x" << cols << " at " << i << "," << j;
+        }
+        for (size_t i = rows; i < ld_out; i++) {
+            ASSERT_EQ(T(-1), out[j * ld_out + i]) << "padding written";
+        }
+    }
+}
+
+template <typename T>
+void check_shapes()
+{
+    const size_t sizes[] = {1, 3, 4, 8, 17, 64, 100, 257};
+    for (size_t r : sizes) {
+        for (size_t c : sizes) {
+            check_transpose<T>(r, c, 0);
+        }
+    }
+    check_transpose<T>(300, 70, 5);
+    check_transpose<T>(33, 513, 1);
+}
+}  // namespace
+
+TEST(bulk_transpose, test_float_double)
+{
+    check_shapes<float>();
+    check_shapes<double>();
+}
+
+TEST(bulk_transpose, test_integers)
+{
+    check_shapes<int8_t>();
+    check_shapes<uint16_t>();
+    check_shapes<int32_t>();
+    check_shapes<int64_t>();
+}
+
+TEST(bulk_transpose, test_packed)
+{
+    std::vector<float> a(123 * 45), b(a.size()), c(a.size());
+    for (size_t i = 0; i < a.size(); i++) {
+        a[i] = float(i);
+    }
+    simd::bulk::transpose(123, 45, a.data(), b.data());
+    simd::bulk::transpose(45, 123, b.data(), c.data());
+    EXPECT_EQ(a, c);
+}
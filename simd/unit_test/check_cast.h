@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "simd/unit_test/check_saturate.h"
+
+namespace simd {
+namespace ut {
+
+/// pack_sat from T lanes into U lanes, both halves and every edge value of T
+template <typename U, typename T, size_t W>
+void check_pack_sat()
+{
+    auto e = saturate_edges<T>();
+    constexpr size_t P = e.size();
+    for (size_t s = 0; s * W < 2 * P; s++) {
+        Vec<T, W> lo, hi;
+        for (size_t i = 0; i < W; i++) {
+            lo[i] = e[(s * W + i) % P];
+            hi[i] = e[(s * W + i + P / 2 + 1) % P];
+        }
+        Vec<U, 2 * W> r = simd::pack_sat<U>(lo, hi);
+        for (size_t i = 0; i < W; i++) {
+            ASSERT_EQ(saturate_ref<U>(lo[i]), r[i]) << Vec<T, W>::type() << " lane " << i;
+            ASSERT_EQ(saturate_ref<U>(hi[i]), r[W + i]) << Vec<T, W>::type() << " lane " << W + i;
+        }
+    }
+}
+
+/// widen edge values and a ramp, lane i lands in vector i / M, lane i % M
+template <typename U, typename T, size_t W>
+void check_widen()
+{
+    constexpr size_t K = sizeof(U) / sizeof(T);
+    constexpr size_t M = W / K;
+    auto e = saturate_edges<T>();
+    Vec<T, W> x;
+    for (size_t i = 0; i < W; i++) {
+        x[i] = i < e.size() ? e[i] : static_cast<T>(i * 37);
+    }
+    std::array<Vec<U, M>, K> r = simd::widen<U>(x);
+    for (size_t i = 0; i < W; i++) {
+        ASSERT_EQ(static_cast<U>(x[i]), r[i / M][i % M]) << Vec<T, W>::type() << " lane " << i;
+    }
+}
+
+/// narrow / narrow_sat from edge values (integral T) or a range of
+/// fractional values crossing the range of U (floating T)
+template <typename U, typename T, size_t W>
+void check_narrow()
+{
+    constexpr size_t K = sizeof(T) / sizeof(U);
+    std::array<Vec<T, W>, K> x;
+    for (size_t k = 0; k < K; k++) {
+        for (size_t i = 0; i < W; i++) {
+            size_t n = k * W + i;
+            SIMD_IF_CONSTEXPR(std::is_floating_point<T>::value) {
+                double span = 3.0 * double(std::numeric_limits<U>::max()) + 3.0;
+                x[k][i] = static_cast<T>(-span + 2.0 * span * double(n) / double(W * K) + 0.75);
+            } else {
+                auto e = saturate_edges<T>();
+                x[k][i] = n < e.size() ? e[n] : static_cast<T>(n * 2654435761u);
+            }
+        }
+    }
+    Vec<U, W * K> a = simd::narrow<U>(x);
+    Vec<U, W * K> b = simd::narrow_sat<U>(x);
+    for (size_t n = 0; n < W * K; n++) {
+        T v = x[n / W][n % W];
+        SIMD_IF_CONSTEXPR(std::is_floating_point<U>::value) {
+            ASSERT_EQ(static_cast<U>(v), a[n]) << "narrow " << v;
+            ASSERT_EQ(static_cast<U>(v), b[n]) << "narrow_sat " << v;
+        } else SIMD_IF_CONSTEXPR(std::is_floating_point<T>::value) {
+            if (v > -2147483648.0 && v < 2147483648.0) {
+                /// wrapping past the int32 range is undefined, like `static_cast`
+                ASSERT_EQ(static_cast<U>(int64_t(v)), a[n]) << "narrow " << v;
+            }
+            ASSERT_EQ(saturate_ref<U>(int64_t(v)), b[n]) << "narrow_sat " << v;
+        } else {
+            ASSERT_EQ(static_cast<U>(v), a[n]) << "narrow " << int64_t(v);
+            ASSERT_EQ(saturate_ref<U>(v), b[n]) << "narrow_sat " << int64_t(v);
+        }
+    }
+}
+
+}  // namespace ut
+}  // namespace simd
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace simd {
+namespace ut {
+
+/// split layout complex mul / mul_conj / fmadd / div against std::complex,
+/// within a few ulp of the largest part (fused and unfused roundings
+/// differ); divisors of magnitude ~1e20 (1e200 for double) square past the
+/// range of T, which Smith's scaling keeps finite
+template <typename T, size_t W>
+void check_complex_arith()
+{
+    using C = std::complex<T>;
+    const T big = std::is_same<T, float>::value ? T(1e20) : T(1e200);
+    const T tol = 8 * std::numeric_limits<T>::epsilon();
+    auto near = [&](C ref, C got, const char* op, size_t lane) {
+        T mag = std::max(std::abs(ref.real()), std::abs(ref.imag()));
+        ASSERT_NEAR(ref.real(), got.real(), tol * mag) << op << " lane " << lane;
+        ASSERT_NEAR(ref.imag(), got.imag(), tol * mag) << op << " lane " << lane;
+    };
+    for (size_t round = 0; round < 3; round++) {
+        const T scale = round == 0 ? T(1) : round == 1 ? big : 1 / big;
+        Vec<C, W> x, y, z;
+        for (size_t i = 0; i < W; i++) {
+            x.real()[i] = T(int(i * 7 % 11) - 5) + T(0.25);
+            x.imag()[i] = T(int(i * 3 % 7) - 3) - T(0.5);
+            /// alternate |c| >= |d| and |c| < |d|
+            y.real()[i] = (T(int(i * 5 % 9) - 4) + T(0.75)) * (i & 1 ? 1 : 3) * scale;
+            y.imag()[i] = (T(int(i * 2 % 5) - 2) + T(0.125)) * (i & 1 ? 3 : 1) * scale;
+            z.real()[i] = T(i) - T(1.5);
+            z.imag()[i] = T(2) - T(i);
+        }
+        auto q = x / y;
+        for (size_t i = 0; i < W; i++) {
+            C a(x.real()[i], x.imag()[i]), b(y.real()[i], y.imag()[i]);
+            near(a / b, C(q.real()[i], q.imag()[i]), "div", i);
+        }
+        if (round != 0) {
+            continue;
+        }
+        auto m = x * y;
+        auto mc = simd::mul_conj(x, y);
+        auto f = simd::fmadd(x, y, z);
+        auto cj = simd::conj(x);
+        for (size_t i = 0; i < W; i++) {
+            C a(x.real()[i], x.imag()[i]), b(y.real()[i], y.imag()[i]), c(z.real()[i], z.imag()[i]);
+            near(a * b, C(m.real()[i], m.imag()[i]), "mul", i);
+            near(a * std::conj(b), C(mc.real()[i], mc.imag()[i]), "mul_conj", i);
+            near(a * b + c, C(f.real()[i], f.imag()[i]), "fmadd", i);
+            ASSERT_EQ(std::conj(a), C(cj.real()[i], cj.imag()[i])) << "conj lane " << i;
+        }
+    }
+}
+
+/// VecInterleaved<std::complex<T>, W> against std::complex, element by element
+template <typename T, size_t W>
+void check_interleaved_complex()
+{
+    using C = std::complex<T>;
+    using V = VecInterleaved<C, W>;
+    const T big = std::is_same<T, float>::value ? T(1e20) : T(1e200);
+    const T tol = 8 * std::numeric_limits<T>::epsilon();
+    auto near = [&](C ref, C got, const char* op, size_t lane) {
+        T mag = std::max(std::abs(ref.real()), std::abs(ref.imag()));
+        ASSERT_NEAR(ref.real(), got.real(), tol * mag) << op << " lane " << lane;
+        ASSERT_NEAR(ref.imag(), got.imag(), tol * mag) << op << " lane " << lane;
+    };
+    for (size_t round = 0; round < 3; round++) {
+        const T scale = round == 0 ? T(1) : round == 1 ? big : 1 / big;
+        alignas(V::data_t::alignment()) C a[W], b[W], c[W], out[W];
+        for (size_t i = 0; i < W; i++) {
+            a[i] = C(T(int(i * 7 % 11) - 5) + T(0.25), T(int(i * 3 % 7) - 3) - T(0.5));
+            /// alternate |c| >= |d| and |c| < |d|
+            b[i] = C((T(int(i * 5 % 9) - 4) + T(0.75)) * (i & 1 ? 1 : 3) * scale,
+                     (T(int(i * 2 % 5) - 2) + T(0.125)) * (i & 1 ? 3 : 1) * scale);
+            c[i] = C(T(i) - T(1.5), T(2) - T(i));
+        }
+        const V x = V::load_aligned(a), y = V::load_unaligned(b), z = V::load_aligned(c);
+        (x / y).store_aligned(out);
+        for (size_t i = 0; i < W; i++) {
+            near(a[i] / b[i], out[i], "div", i);
+        }
+        if (round != 0) {
+            continue;
+        }
+        (x * y).store_unaligned(out);
+        for (size_t i = 0; i < W; i++) {
+            ASSERT_EQ(a[i], x[i]) << "lane " << i;
+            near(a[i] * b[i], out[i], "mul", i);
+        }
+        const V mc = simd::mul_conj(x, y), f = simd::fmadd(x, y, z), cj = simd::conj(x);
+        const V s = x + y - z, w = -x, k(C(T(2), T(-3)));
+        V acc = x;
+        acc *= y;
+        acc += z;
+        for (size_t i = 0; i < W; i++) {
+            near(a[i] * std::conj(b[i]), mc[i], "mul_conj", i);
+            near(a[i] * b[i] + c[i], f[i], "fmadd", i);
+            near(a[i] * b[i] + c[i], acc[i], "*= +=", i);
+            ASSERT_EQ(std::conj(a[i]), cj[i]) << "conj lane " << i;
+            ASSERT_EQ(a[i] + b[i] - c[i], s[i]) << "add sub lane " << i;
+            ASSERT_EQ(-a[i], w[i]) << "neg lane " << i;
+            ASSERT_EQ(C(T(2), T(-3)), k[i]) << "broadcast lane " << i;
+        }
+    }
+}
+
+}  // namespace ut
+}  // namespace simd
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace simd {
+namespace ut {
+
+/// dot_bf16 over a few steps against a scalar pairwise reference;
+/// small integers keep every product and sum exact, fused or not
+template <size_t W>
+void check_dot_bf16()
+{
+    constexpr size_t N = 2 * W * 5;
+    std::array<simd::bfloat16, N> a, b;
+    for (size_t i = 0; i < N; i++) {
+        a[i] = simd::bfloat16(float(int(i * 7 % 19) - 9));
+        b[i] = simd::bfloat16(float(int(i * 5 % 13) - 6) * 0.5f);
+    }
+    Vec<float, W> acc(1.f);
+    for (size_t k = 0; k < N; k += 2 * W) {
+        acc = simd::dot_bf16(acc, a.data() + k, b.data() + k);
+    }
+    for (size_t i = 0; i < W; i++) {
+        float ref = 1.f;
+        for (size_t k = 0; k < N; k += 2 * W) {
+            ref += float(a[k + 2 * i]) * float(b[k + 2 * i]) + float(a[k + 2 * i + 1]) * float(b[k + 2 * i + 1]);
+        }
+        ASSERT_EQ(ref, acc[i]) << "lane " << i;
+    }
+}
+
+/// dot_u8i8 against a scalar reference over the full uint8 range with
+/// |b| <= 64, where the pmaddubsw pair sums cannot saturate
+template <size_t W>
+void check_dot_u8i8()
+{
+    Vec<uint8_t, 4 * W> a;
+    Vec<int8_t, 4 * W> b;
+    Vec<int32_t, W> acc;
+    for (size_t i = 0; i < W; i++) {
+        acc[i] = static_cast<int32_t>(i * 1000) - 7000;
+    }
+    for (size_t round = 0; round < 64; round++) {
+        for (size_t i = 0; i < 4 * W; i++) {
+            a[i] = static_cast<uint8_t>(round == 0 ? 255 : (i * 37 + round * 11) & 0xFF);
+            b[i] = static_cast<int8_t>(round == 0 ? (i & 1 ? 64 : -64) : int((i * 29 + round * 5) % 129) - 64);
+        }
+        Vec<int32_t, W> r = simd::dot_u8i8(acc, a, b);
+        for (size_t i = 0; i < W; i++) {
+            int32_t ref = acc[i];
+            for (size_t j = 0; j < 4; j++) {
+                ref += int32_t(a[4 * i + j]) * int32_t(b[4 * i + j]);
+            }
+            ASSERT_EQ(ref, r[i]) << "round " << round << " lane " << i;
+        }
+        acc = r;
+    }
+}
+
+}  // namespace ut
+}  // namespace simd
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace simd {
+namespace ut {
+
+/// load_half/store_half against the software conversions: every half bit
+/// pattern through load and back through store, then a sweep of float bit
+/// patterns (normals, subnormals, overflow, ties) through store
+template <size_t W>
+void check_half()
+{
+    auto bits_of = [](float f) {
+        uint32_t b;
+        std::memcpy(&b, &f, sizeof(b));
+        return b;
+    };
+    std::array<simd::half, W> h, r;
+    for (uint32_t base = 0; base < 0x10000u; base += W) {
+        for (size_t i = 0; i < W; i++) {
+            h[i] = simd::half::from_bits(static_cast<uint16_t>(base + i));
+        }
+        Vec<float, W> v = simd::load_half<W>(h.data());
+        simd::store_half(r.data(), v);
+        for (size_t i = 0; i < W; i++) {
+            float ref = simd::detail::half_bits_to_float_soft(h[i].bits);
+            if (ref != ref) {
+                ASSERT_TRUE(v[i] != v[i]) << std::hex << h[i].bits;
+                ASSERT_EQ(0x7C00, r[i].bits & 0x7C00) << std::hex << h[i].bits;
+                continue;
+            }
+            ASSERT_EQ(bits_of(ref), bits_of(v[i])) << std::hex << h[i].bits;
+            ASSERT_EQ(h[i].bits, r[i].bits);
+        }
+    }
+    for (uint64_t base = 0; base < 0x100000000ull; base += 0x1001ull * W) {
+        Vec<float, W> v;
+        for (size_t i = 0; i < W; i++) {
+            uint32_t b = static_cast<uint32_t>(base + 0x1001ull * i);
+            float f;
+            std::memcpy(&f, &b, sizeof(f));
+            v[i] = f == f ? f : 0.f;
+        }
+        simd::store_half(r.data(), v);
+        for (size_t i = 0; i < W; i++) {
+            ASSERT_EQ(simd::detail::float_to_half_bits_soft(v[i]), r[i].bits) << std::hex << bits_of(v[i]);
+        }
+    }
+}
+
+/// load_bf16/store_bf16 against the scalar conversions, like check_half;
+/// vcvtneps2bf16 (SIMD_WITH_AVX512_BF16, 512-bit registers) flushes
+/// denormal inputs, which then only have to come out as a signed zero
+template <size_t W>
+void check_bf16()
+{
+    auto bits_of = [](float f) {
+        uint32_t b;
+        std::memcpy(&b, &f, sizeof(b));
+        return b;
+    };
+    constexpr bool daz = SIMD_WITH_AVX512_BF16 &&
+        std::is_same<typename Vec<float, W>::arch_t, simd::AVX512>::value;
+    std::array<simd::bfloat16, W> h, r;
+    for (uint32_t base = 0; base < 0x10000u; base += W) {
+        for (size_t i = 0; i < W; i++) {
+            h[i] = simd::bfloat16::from_bits(static_cast<uint16_t>(base + i));
+        }
+        Vec<float, W> v = simd::load_bf16<W>(h.data());
+        simd::store_bf16(r.data(), v);
+        for (size_t i = 0; i < W; i++) {
+            ASSERT_EQ(uint32_t(h[i].bits) << 16, bits_of(v[i])) << std::hex << h[i].bits;
+            if (v[i] != v[i]) {
+                ASSERT_EQ(h[i].bits | 0x40, r[i].bits) << std::hex << h[i].bits;
+            } else if (daz && (h[i].bits & 0x7F80) == 0) {
+                ASSERT_EQ(h[i].bits & 0x8000, r[i].bits) << std::hex << h[i].bits;
+            } else {
+                ASSERT_EQ(h[i].bits, r[i].bits) << std::hex << h[i].bits;
+            }
+        }
+    }
+    for (uint64_t base = 0; base < 0x100000000ull; base += 0x1001ull * W) {
+        Vec<float, W> v;
+        for (size_t i = 0; i < W; i++) {
+            uint32_t b = static_cast<uint32_t>(base + 0x1001ull * i);
+            float f;
+            std::memcpy(&f, &b, sizeof(f));
+            v[i] = f == f ? f : 0.f;
+        }
+        simd::store_bf16(r.data(), v);
+        for (size_t i = 0; i < W; i++) {
+            uint32_t b = bits_of(v[i]);
+            uint16_t ref = daz && (b & 0x7F800000u) == 0 ? uint16_t(b >> 16) & 0x8000 : simd::detail::float_to_bf16_bits(v[i]);
+            ASSERT_EQ(ref, r[i].bits) << std::hex << b;
+        }
+    }
+}
+
+}  // namespace ut
+}  // namespace simd
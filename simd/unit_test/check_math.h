@@ -0,0 +1,188 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace simd {
+namespace ut {
+
+/// |got - ref| in units of the last place of ref rounded to T
+template <typename T>
+double ulp_error(long double ref, T got)
+{
+    if (std::isnan(ref) && std::isnan(got)) {
+        return 0;
+    }
+    if (std::isinf(ref) || std::isinf(got)) {
+        return T(ref) == got ? 0 : std::numeric_limits<double>::infinity();
+    }
+    const T r = std::abs(T(ref));
+    const T ulp = r < std::numeric_limits<T>::min()
+        ? std::numeric_limits<T>::denorm_min()
+        : std::nextafter(r, std::numeric_limits<T>::infinity()) - r;
+    return double(std::abs(ref - (long double)got) / ulp);
+}
+
+/// exp, log, sin, cos, sincos, atan2 and hypot of Vec<T, W> in ulp
+/// against the long double std functions, over the fast path ranges
+/// and the std fallback lanes
+template <typename T, size_t W>
+void check_real_math()
+{
+    using V = Vec<T, W>;
+    using L = long double;
+    const bool f32 = std::is_same<T, float>::value;
+    const T exp_max = f32 ? T(88) : T(709);
+    const T big = std::numeric_limits<T>::max();
+    const T inf = std::numeric_limits<T>::infinity();
+    constexpr size_t N = 64 * W;
+    alignas(V::alignment()) T x[N], y[N];
+    auto check = [&](const char* op, double max_ulp, const V& got, size_t base, auto ref) {
+        for (size_t i = 0; i < W; i++) {
+            ASSERT_LE(ulp_error<T>(ref(base + i), got[i]), max_ulp)
+                << op << " x " << x[base + i] << " y " << y[base + i];
+        }
+    };
+
+    /// exp: [-exp_max, exp_max] and beyond, overflow to inf, underflow to 0
+    for (size_t i = 0; i < N; i++) {
+        x[i] = exp_max * (T(2.2) * T(i) / T(N) - T(1.1));
+        y[i] = 0;
+    }
+    x[0] = 0;
+    x[1] = -inf;
+    x[2] = inf;
+    for (size_t i = 0; i < N; i += W) {
+        check("exp", 2, simd::exp(V::load_aligned(x + i)), i, [&](size_t k) { return std::exp(L(x[k])); });
+    }
+
+    /// log: every binade, around 1, the subnormal and special lanes
+    for (size_t i = 0; i < N; i++) {
+        x[i] = std::ldexp(T(1) + T(i % 7) / T(7), int(i) - int(N) / 2);
+    }
+    x[0] = 0;
+    x[1] = inf;
+    x[2] = std::numeric_limits<T>::denorm_min();
+    x[3] = T(1);
+    x[4] = T(1) + std::numeric_limits<T>::epsilon();
+    x[5] = T(1) - std::numeric_limits<T>::epsilon();
+    for (size_t i = 0; i < N; i += W) {
+        check("log", 3, simd::log(V::load_aligned(x + i)), i, [&](size_t k) { return std::log(L(x[k])); });
+    }
+
+    /// sin / cos: small, the exact reduction range and past it
+    for (size_t i = 0; i < N; i++) {
+        x[i] = (i % 3 == 0 ? T(8000) : i % 3 == 1 ? T(10) : T(1e-3)) * (T(2) * T(i) / T(N) - T(1));
+    }
+    x[1] = T(1e6);
+    x[2] = -T(3e7);
+    for (size_t i = 0; i < N; i += W) {
+        const V v = V::load_aligned(x + i);
+        const auto sc = simd::sincos(v);
+        check("sin", 3, simd::sin(v), i, [&](size_t k) { return std::sin(L(x[k])); });
+        check("cos", 3, simd::cos(v), i, [&](size_t k) { return std::cos(L(x[k])); });
+        check("sincos sin", 3, sc.first, i, [&](size_t k) { return std::sin(L(x[k])); });
+        check("sincos cos", 3, sc.second, i, [&](size_t k) { return std::cos(L(x[k])); });
+    }
+
+    /// atan2 / hypot: every octant, signed zeros, huge and tiny operands
+    for (size_t i = 0; i < N; i++) {
+        const T a = T(2) * T(i) / T(N) - T(1);
+        y[i] = std::sin(T(7) * a) * (i % 4 == 0 ? big / 4 : i % 4 == 1 ? T(1e-30) : T(3));
+        x[i] = std::cos(T(5) * a) * (i % 4 == 0 ? big / 4 : T(2));
+    }
+    x[0] = -T(0);
+    y[0] = T(0);
+    x[1] = T(0);
+    y[1] = -T(0);
+    x[2] = -inf;
+    y[2] = T(1);
+    x[3] = T(3) * big / 8;
+    y[3] = T(4) * big / 8;
+    for (size_t i = 0; i < N; i += W) {
+        const V vy = V::load_aligned(y + i), vx = V::load_aligned(x + i);
+        check("atan2", 5, simd::atan2(vy, vx), i, [&](size_t k) { return std::atan2(L(y[k]), L(x[k])); });
+        check("hypot", 3, simd::hypot(vx, vy), i, [&](size_t k) { return std::hypot(L(x[k]), L(y[k])); });
+    }
+}
+
+/// abs, norm, arg, exp, log, sqrt, conj and polar of Vec<std::complex<T>, W>
+/// against std::complex<long double>, relative to the largest part of the
+/// result (log: at least 1, its real part cancels around |z| = 1)
+template <typename T, size_t W>
+void check_complex_math()
+{
+    using C = std::complex<T>;
+    using CL = std::complex<long double>;
+    using V = Vec<C, W>;
+    using R = Vec<T, W>;
+    const T tol = 8 * std::numeric_limits<T>::epsilon();
+    constexpr size_t N = 16 * W;
+    C z[N];
+    for (size_t i = 0; i < N; i++) {
+        const T a = T(2) * T(i) / T(N) - T(1);
+        const T scale = i % 5 == 0 ? T(1e-3) : i % 5 == 1 ? T(30) : T(2);
+        z[i] = C(std::cos(T(9) * a) * scale, std::sin(T(4) * a) * scale);
+    }
+    z[0] = C(0, 0);
+    z[1] = C(-4, 0);
+    z[2] = C(-4, -T(0));
+    z[3] = C(0, -T(2.5));
+    z[4] = C(T(0.6), T(0.8));
+    z[5] = C(std::numeric_limits<T>::max() / 2, std::numeric_limits<T>::max() / 2);
+    z[6] = C(std::numeric_limits<T>::infinity(), 0);
+    z[7] = C(-std::numeric_limits<T>::infinity(), T(1));
+    auto near = [&](CL ref, C got, T floor, const char* op, size_t k) {
+        const long double mag = std::max({std::abs(ref.real()), std::abs(ref.imag()), (long double)floor});
+        if (!std::isfinite(mag)) {
+            ASSERT_EQ(C(ref), got) << op << " z " << z[k];
+            return;
+        }
+        ASSERT_NEAR(ref.real(), got.real(), tol * mag) << op << " z " << z[k];
+        ASSERT_NEAR(ref.imag(), got.imag(), tol * mag) << op << " z " << z[k];
+    };
+    for (size_t i = 0; i < N; i += W) {
+        V v;
+        alignas(R::alignment()) T rho[W], theta[W];
+        for (size_t k = 0; k < W; k++) {
+            v.real()[k] = z[i + k].real();
+            v.imag()[k] = z[i + k].imag();
+            rho[k] = std::abs(z[i + k].real());
+            theta[k] = T(8) * z[i + k].imag();
+        }
+        const R ab = simd::abs(v), nm = simd::norm(v), ag = simd::arg(v);
+        const V ex = simd::exp(v), lg = simd::log(v), sq = simd::sqrt(v), cj = simd::conj(v);
+        const V pl = simd::polar(R::load_aligned(rho), R::load_aligned(theta));
+        for (size_t k = 0; k < W; k++) {
+            const size_t n = i + k;
+            const CL zl(z[n].real(), z[n].imag());
+            if (std::isfinite(z[n].real())) {
+                ASSERT_LE(ulp_error<T>(std::abs(zl), ab[k]), 3) << "abs z " << z[n];
+                ASSERT_LE(ulp_error<T>(std::arg(zl), ag[k]), 5) << "arg z " << z[n];
+                if (n != 5) {
+                    ASSERT_NEAR(std::norm(zl), nm[k], tol * std::norm(zl)) << "norm z " << z[n];
+                }
+                near(std::log(zl), C(lg.real()[k], lg.imag()[k]), T(1), "log", n);
+            }
+            if (n != 5) {
+                if (std::isfinite(rho[k])) {
+                    near(std::polar<long double>(rho[k], theta[k]), C(pl.real()[k], pl.imag()[k]), T(0), "polar", n);
+                }
+                near(std::exp(zl), C(ex.real()[k], ex.imag()[k]), T(0), "exp", n);
+            }
+            near(std::sqrt(zl), C(sq.real()[k], sq.imag()[k]), T(0), "sqrt", n);
+            ASSERT_EQ(std::conj(z[n]), C(cj.real()[k], cj.imag()[k])) << "conj z " << z[n];
+        }
+    }
+    /// branch cut: the sign of a zero imaginary part picks the side
+    const V cut(R(T(-4)), R(-T(0)));
+    EXPECT_TRUE(all_of(simd::sqrt(cut).imag() == R(T(-2))));
+    EXPECT_TRUE(all_of(simd::arg(cut) == R(T(-3.14159265358979323846))));
+}
+
+}  // namespace ut
+}  // namespace simd
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace simd {
+namespace ut {
+
+template <typename V, size_t... Is>
+V make_ramp(detail::index_sequence<Is...>)
+{
+    using T = typename V::scalar_t;
+    return V(T(Is + 1)...);
+}
+
+/// any lane count: W lanes padded up to whole registers; guard values
+/// around the buffers stay untouched by load/store, padding lanes load
+/// as 0 and reductions/mask queries see the W lanes only
+template <typename T, size_t W>
+void check_padded()
+{
+    using V = Vec<T, W>;
+    constexpr size_t P = V::padded_lanes();
+    static_assert(P >= W && P < W + V::reg_lanes(), "padding within the last register");
+    EXPECT_EQ(P, V::n_regs() * V::reg_lanes()) << V::type();
+    EXPECT_EQ(P != W, V::padded()) << V::type();
+    EXPECT_EQ(W, V::size());
+    V v;
+    EXPECT_EQ(W, size_t(std::distance(v.begin(), v.end())));
+
+    const T guard = T(77);
+    alignas(64) T src[P + 2];
+    alignas(64) T dst[P + 2];
+    for (size_t i = 0; i < P + 2; i++) {
+        src[i] = i < W ? T(i % 11 + 1) : guard;
+    }
+    for (int u = 0; u < 2; u++) {
+        const V a = u ? V::load_unaligned(src + 1) : V::load_aligned(src);
+        for (size_t i = 0; i < P; i++) {
+            ASSERT_EQ(i < W ? src[i + u] : T(0), a[i]) << V::type() << " load lane " << i;
+        }
+        /// padding lanes of a + 1 are 1, they must not reach dst
+        const V b = a + V(T(1));
+        std::fill(dst, dst + P + 2, guard);
+        if (u) {
+            b.store_unaligned(dst + 1);
+        } else {
+            b.store_aligned(dst);
+        }
+        for (size_t i = 0; i < P + 2; i++) {
+            T ref = i >= size_t(u) && i < W + u ? T(src[i] + 1) : guard;
+            ASSERT_EQ(ref, dst[i]) << V::type() << " store at " << i;
+        }
+    }
+
+    const V a = V::load_aligned(src);
+    const V c = a + a - V(T(1));
+    T sum = 0;
+    for (size_t i = 0; i < W; i++) {
+        ASSERT_EQ(T(src[i] + src[i] - 1), c[i]) << "lane " << i;
+        sum += T(a[i] + 1);
+    }
+    EXPECT_EQ(sum, reduce_sum(a + V(T(1))));
+    EXPECT_EQ(T(W * (W + 1) / 2), reduce_sum(make_ramp<V>(detail::make_index_sequence<W>())));
+    EXPECT_EQ(T(W * (W - 1) / 2), reduce_sum(V([](int i) { return T(i); })));
+    EXPECT_EQ(T(W), reduce_sum(V(T(1))));
+
+    /// padding lanes of a are 0: false for a > 0, true for a == 0
+    EXPECT_TRUE(all_of(a > V(T(0))));
+    EXPECT_FALSE(any_of(a == V(T(0))));
+    EXPECT_TRUE(none_of(a == V(T(0))));
+    EXPECT_FALSE(some_of(a > V(T(0))));
+    EXPECT_EQ(int(W), popcount(a == a));
+    EXPECT_EQ(0, popcount(a == V(T(0))));
+    V r = make_ramp<V>(detail::make_index_sequence<W>());
+    SIMD_IF_CONSTEXPR(V::padded()) {
+        EXPECT_EQ(0, find_first_set(r == V(T(1))));
+        EXPECT_EQ(int(W) - 1, find_first_set(r == V(T(W))));
+        EXPECT_EQ(int(W) - 1, find_last_set(a > V(T(0))));
+        EXPECT_EQ(-1, find_first_set(r == V(T(0))));
+        EXPECT_EQ(-1, find_last_set(a == V(T(0))));
+    }
+    SIMD_IF_CONSTEXPR(W <= 64) {
+        EXPECT_EQ(~0ull >> (64 - W), (r > V(T(0))).to_mask());
+    }
+
+    SIMD_IF_CONSTEXPR(std::is_floating_point<T>::value) {
+        /// padding lanes 0 above every lane / below every lane
+        const V n = V(T(0)) - a;
+        EXPECT_EQ(T(-1), reduce_max(n));
+        EXPECT_EQ(T(1), reduce_min(a));
+        SIMD_IF_CONSTEXPR(V::padded()) {
+            EXPECT_EQ(T(-1), reduce([](T x, T y) { return std::max(x, y); }, n));
+        }
+        const V f = fmadd(a, a, c) / a;
+        for (size_t i = 0; i < W; i++) {
+            ASSERT_NEAR((a[i] * a[i] + c[i]) / a[i], f[i], 1e-5 * f[i]) << "lane " << i;
+        }
+    }
+}
+
+}  // namespace ut
+}  // namespace simd
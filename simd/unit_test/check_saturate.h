@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace simd {
+namespace ut {
+
+/// min, max and their neighbours, zero, +-1 and a few mid-range values of T
+template <typename T>
+std::array<T, 12> saturate_edges()
+{
+    using L = std::numeric_limits<T>;
+    return {{ L::min(), T(L::min() + 1), T(L::min() / 2), T(L::min() / 3 * 2),
+              T(-1), T(0), T(1), T(7),
+              T(L::max() / 3 * 2), T(L::max() / 2), T(L::max() - 1), L::max() }};
+}
+
+template <typename T>
+T saturate_ref(__int128 x)
+{
+    using L = std::numeric_limits<T>;
+    return x < __int128(L::min()) ? L::min() : x > __int128(L::max()) ? L::max() : static_cast<T>(x);
+}
+
+/// add_sat / sub_sat (and mul_sat for signed T) on every pair of edge values
+template <typename T, size_t W>
+void check_saturate()
+{
+    auto e = saturate_edges<T>();
+    constexpr size_t P = e.size();
+    for (size_t s = 0; s * W < P * P; s++) {
+        Vec<T, W> x, y;
+        for (size_t i = 0; i < W; i++) {
+            size_t k = s * W + i;
+            x[i] = e[k % P];
+            y[i] = e[(k / P) % P];
+        }
+        auto a = simd::add_sat(x, y);
+        auto b = simd::sub_sat(x, y);
+        for (size_t i = 0; i < W; i++) {
+            ASSERT_EQ(saturate_ref<T>(__int128(x[i]) + y[i]), a[i])
+                << Vec<T, W>::type() << " add_sat " << int64_t(x[i]) << ", " << int64_t(y[i]);
+            ASSERT_EQ(saturate_ref<T>(__int128(x[i]) - y[i]), b[i])
+                << Vec<T, W>::type() << " sub_sat " << int64_t(x[i]) << ", " << int64_t(y[i]);
+        }
+        SIMD_IF_CONSTEXPR(std::is_signed<T>::value) {
+            constexpr int Q = sizeof(T) * 8 - 1;
+            auto c = simd::mul_sat(x, y);
+            for (size_t i = 0; i < W; i++) {
+                __int128 p = (__int128(x[i]) * y[i] + (__int128(1) << (Q - 1))) >> Q;
+                ASSERT_EQ(saturate_ref<T>(p), c[i])
+                    << Vec<T, W>::type() << " mul_sat " << int64_t(x[i]) << ", " << int64_t(y[i]);
+            }
+        }
+    }
+}
+
+}  // namespace ut
+}  // namespace simd
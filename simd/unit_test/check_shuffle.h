@@ -0,0 +1,198 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace simd {
+namespace ut {
+
+/// shuffle patterns as index functions of (lane i, width W, lanes per
+/// 128-bit block G); Unary patterns only read the first source
+namespace pattern {
+struct identity { static constexpr bool unary = true;
+    static constexpr size_t at(size_t i, size_t, size_t) { return i; } };
+struct reverse { static constexpr bool unary = true;
+    static constexpr size_t at(size_t i, size_t W, size_t) { return W - 1 - i; } };
+struct rotate { static constexpr bool unary = true;
+    static constexpr size_t at(size_t i, size_t W, size_t) { return (i + 1) % W; } };
+struct broadcast { static constexpr bool unary = true;
+    static constexpr size_t at(size_t, size_t, size_t) { return 1; } };
+struct swap_pairs { static constexpr bool unary = true;
+    static constexpr size_t at(size_t i, size_t, size_t) { return i ^ 1; } };
+struct swap_halves { static constexpr bool unary = true;
+    static constexpr size_t at(size_t i, size_t W, size_t) { return i ^ (W / 2); } };
+struct block_reverse { static constexpr bool unary = true;
+    static constexpr size_t at(size_t i, size_t, size_t G) { return i / G * G + G - 1 - i % G; } };
+struct scramble { static constexpr bool unary = true;
+    static constexpr size_t at(size_t i, size_t W, size_t) { return (i * 7 + 3) % W; } };
+struct gather { static constexpr bool unary = true;
+    static constexpr size_t at(size_t i, size_t W, size_t) { return (i * i * 5 + 1) % W; } };
+struct blend { static constexpr bool unary = false;
+    static constexpr size_t at(size_t i, size_t W, size_t) { return i % 2 ? W + i : i; } };
+struct unpack_lo { static constexpr bool unary = false;
+    static constexpr size_t at(size_t i, size_t W, size_t G) { return i / G * G + i % G / 2 + i % 2 * W; } };
+struct unpack_hi { static constexpr bool unary = false;
+    static constexpr size_t at(size_t i, size_t W, size_t G) { return i / G * G + G / 2 + i % G / 2 + i % 2 * W; } };
+struct unpack_ba { static constexpr bool unary = false;
+    static constexpr size_t at(size_t i, size_t W, size_t G) { return i / G * G + i % G / 2 + (1 - i % 2) * W; } };
+struct shift { static constexpr bool unary = false;
+    static constexpr size_t at(size_t i, size_t, size_t) { return i + 1; } };
+struct shift_half { static constexpr bool unary = false;
+    static constexpr size_t at(size_t i, size_t W, size_t) { return i + W / 2; } };
+struct halves { static constexpr bool unary = false;
+    static constexpr size_t at(size_t i, size_t W, size_t G) { return i / G * G + G - 1 - i % G + (i % G < G / 2 ? 0 : W); } };
+struct insert { static constexpr bool unary = false;
+    static constexpr size_t at(size_t i, size_t W, size_t) { return i == 1 ? W : i; } };
+struct high_halves { static constexpr bool unary = false;
+    static constexpr size_t at(size_t i, size_t W, size_t) { return i < W / 2 ? i + W / 2 : i + W; } };
+struct mix { static constexpr bool unary = false;
+    static constexpr size_t at(size_t i, size_t W, size_t) { return (i * 13 + 5) % (2 * W); } };
+struct mix_gather { static constexpr bool unary = false;
+    static constexpr size_t at(size_t i, size_t W, size_t) { return (i * i * 3 + i + 7) % (2 * W); } };
+}  // namespace pattern
+
+template <typename T, size_t W, size_t... I>
+void check_unary_shuffle(const Vec<T, W>& a, std::true_type)
+{
+    auto r = simd::shuffle<I...>(a);
+    const size_t idx[] = {I...};
+    for (size_t i = 0; i < W; i++) {
+        ASSERT_EQ(a[idx[i]], r[i]) << Vec<T, W>::type() << " one source, lane " << i;
+    }
+}
+
+template <typename T, size_t W, size_t... I>
+void check_unary_shuffle(const Vec<T, W>&, std::false_type)
+{
+}
+
+template <typename T, size_t W, typename F, size_t... X>
+void check_shuffle(simd::detail::index_sequence<X...>)
+{
+    constexpr size_t G = 16 / sizeof(T) < W ? 16 / sizeof(T) : W;
+    Vec<T, W> a, b;
+    for (size_t i = 0; i < W; i++) {
+        a[i] = static_cast<T>(i + 1);
+        b[i] = static_cast<T>(i + 1 + W);
+    }
+    auto r = simd::shuffle<F::at(X, W, G)...>(a, b);
+    const size_t idx[] = {F::at(X, W, G)...};
+    for (size_t i = 0; i < W; i++) {
+        ASSERT_EQ(idx[i] < W ? a[idx[i]] : b[idx[i] - W], r[i]) << Vec<T, W>::type() << " lane " << i;
+    }
+    check_unary_shuffle<T, W, F::at(X, W, G)...>(a, std::integral_constant<bool, F::unary>());
+}
+
+/// every pattern above, one and two sources, against a scalar reference
+template <typename T, size_t W>
+void check_shuffle()
+{
+    using S = simd::detail::make_index_sequence<W>;
+    check_shuffle<T, W, pattern::identity>(S());
+    check_shuffle<T, W, pattern::reverse>(S());
+    check_shuffle<T, W, pattern::rotate>(S());
+    check_shuffle<T, W, pattern::broadcast>(S());
+    check_shuffle<T, W, pattern::swap_pairs>(S());
+    check_shuffle<T, W, pattern::swap_halves>(S());
+    check_shuffle<T, W, pattern::block_reverse>(S());
+    check_shuffle<T, W, pattern::scramble>(S());
+    check_shuffle<T, W, pattern::gather>(S());
+    check_shuffle<T, W, pattern::blend>(S());
+    check_shuffle<T, W, pattern::unpack_lo>(S());
+    check_shuffle<T, W, pattern::unpack_hi>(S());
+    check_shuffle<T, W, pattern::unpack_ba>(S());
+    check_shuffle<T, W, pattern::shift>(S());
+    check_shuffle<T, W, pattern::shift_half>(S());
+    check_shuffle<T, W, pattern::halves>(S());
+    check_shuffle<T, W, pattern::insert>(S());
+    check_shuffle<T, W, pattern::high_halves>(S());
+    check_shuffle<T, W, pattern::mix>(S());
+    check_shuffle<T, W, pattern::mix_gather>(S());
+}
+
+template <typename T, size_t W, size_t K>
+void check_slide_by(const Vec<T, W>& a, const Vec<T, W>& b)
+{
+    auto l = simd::slide_left<K>(a, b);
+    auto r = simd::slide_right<K>(a, b);
+    auto o = simd::rotate<K>(a);
+    for (size_t i = 0; i < W; i++) {
+        ASSERT_EQ(i + K < W ? a[i + K] : b[i + K - W], l[i]) << Vec<T, W>::type() << " slide_left " << K;
+        ASSERT_EQ(i < K ? a[W - K + i] : b[i - K], r[i]) << Vec<T, W>::type() << " slide_right " << K;
+        ASSERT_EQ(a[(i + K) % W], o[i]) << Vec<T, W>::type() << " rotate " << K;
+    }
+}
+
+template <typename T, size_t W, size_t... K>
+void check_slide(simd::detail::index_sequence<K...>)
+{
+    Vec<T, W> a, b;
+    for (size_t i = 0; i < W; i++) {
+        a[i] = static_cast<T>(i + 1);
+        b[i] = static_cast<T>(i + 1 + W);
+    }
+    int expand[] = {0, (check_slide_by<T, W, K>(a, b), 0)...};
+    (void)expand;
+}
+
+/// slide_left / slide_right / rotate by every K in 0 .. W
+template <typename T, size_t W>
+void check_slide()
+{
+    check_slide<T, W>(simd::detail::make_index_sequence<W + 1>());
+}
+
+/// runtime permute by hashed indices, in and out of range, against x[idx % W]
+template <typename T, size_t W>
+void check_permute()
+{
+    using I = typename std::conditional<sizeof(T) == 1, uint8_t,
+              typename std::conditional<sizeof(T) == 2, uint16_t,
+              typename std::conditional<sizeof(T) == 4, int32_t, int64_t>::type>::type>::type;
+    Vec<T, W> x;
+    for (size_t i = 0; i < W; i++) {
+        x[i] = static_cast<T>(i + 1);
+    }
+    for (uint32_t seed = 0; seed < 8; seed++) {
+        Vec<I, W> idx;
+        for (size_t i = 0; i < W; i++) {
+            idx[i] = static_cast<I>(uint32_t((i + seed * W) * 2654435761u) >> (seed % 2 ? 24 : 28));
+        }
+        auto r = simd::permute(x, idx);
+        for (size_t i = 0; i < W; i++) {
+            ASSERT_EQ(x[static_cast<size_t>(idx[i]) % W], r[i]) << Vec<T, W>::type() << " lane " << i;
+        }
+    }
+}
+
+/// 16 / 32 / 64-entry byte tables, every index value 0 .. 255
+template <size_t W>
+void check_lookup()
+{
+    Vec<uint8_t, 16> t16;
+    Vec<uint8_t, 32> t32;
+    Vec<uint8_t, 64> t64;
+    for (size_t i = 0; i < 64; i++) {
+        if (i < 16) t16[i] = static_cast<uint8_t>(i * 7 + 1);
+        if (i < 32) t32[i] = static_cast<uint8_t>(i * 5 + 3);
+        t64[i] = static_cast<uint8_t>(i * 3 + 11);
+    }
+    for (size_t base = 0; base < 256; base += W) {
+        Vec<uint8_t, W> idx;
+        for (size_t i = 0; i < W; i++) {
+            idx[i] = static_cast<uint8_t>(base + i);
+        }
+        auto r16 = simd::lookup16(t16, idx);
+        auto r32 = simd::lookup32(t32, idx);
+        auto r64 = simd::lookup64(t64, idx);
+        for (size_t i = 0; i < W; i++) {
+            ASSERT_EQ(t16[idx[i] % 16], r16[i]) << "lookup16 index " << int(idx[i]);
+            ASSERT_EQ(t32[idx[i] % 32], r32[i]) << "lookup32 index " << int(idx[i]);
+            ASSERT_EQ(t64[idx[i] % 64], r64[i]) << "lookup64 index " << int(idx[i]);
+        }
+    }
+}
+
+}  // namespace ut
+}  // namespace simd
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace simd {
+namespace ut {
+
+/// lane bits of a Vec<T, W> as unsigned integers of the lane size
+template <typename T>
+using lane_bits_t = typename std::conditional<sizeof(T) == 1, uint8_t,
+                    typename std::conditional<sizeof(T) == 2, uint16_t,
+                    typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type>::type>::type;
+
+template <typename T>
+lane_bits_t<T> lane_bits(T x)
+{
+    lane_bits_t<T> u;
+    std::memcpy(&u, &x, sizeof(T));
+    return u;
+}
+
+/// bitwise_ternlog<IMM> against the truth table, bit by bit
+template <typename T, size_t W, uint8_t IMM>
+void check_ternlog_imm(const Vec<T, W>& a, const Vec<T, W>& b, const Vec<T, W>& c)
+{
+    const Vec<T, W> r = bitwise_ternlog<IMM>(a, b, c);
+    for (size_t i = 0; i < W; i++) {
+        const auto x = lane_bits(a[i]), y = lane_bits(b[i]), z = lane_bits(c[i]);
+        lane_bits_t<T> ref = 0;
+        for (size_t bit = 0; bit < 8 * sizeof(T); bit++) {
+            const unsigned k = unsigned((x >> bit) & 1) << 2 | unsigned((y >> bit) & 1) << 1 | unsigned((z >> bit) & 1);
+            ref |= lane_bits_t<T>((IMM >> k) & 1) << bit;
+        }
+        ASSERT_EQ(ref, lane_bits(r[i])) << "imm " << int(IMM) << " lane " << i;
+    }
+}
+
+template <typename T, size_t W, size_t... I>
+void check_ternlog_all(const Vec<T, W>& a, const Vec<T, W>& b, const Vec<T, W>& c, detail::index_sequence<I...>)
+{
+    (void)std::initializer_list<int>{(check_ternlog_imm<T, W, uint8_t(I)>(a, b, c), 0)...};
+}
+
+/// every immediate of bitwise_ternlog on lanes mixing all bit patterns
+template <typename T, size_t W>
+void check_ternlog()
+{
+    alignas(Vec<T, W>::alignment()) T a[W], b[W], c[W];
+    for (size_t i = 0; i < W; i++) {
+        const uint64_t x = 0x9E3779B97F4A7C15ull * (i + 1);
+        const lane_bits_t<T> u = lane_bits_t<T>(x), v = lane_bits_t<T>(x >> 17), w = lane_bits_t<T>(x >> 31);
+        std::memcpy(&a[i], &u, sizeof(T));
+        std::memcpy(&b[i], &v, sizeof(T));
+        std::memcpy(&c[i], &w, sizeof(T));
+    }
+    check_ternlog_all(Vec<T, W>::load_aligned(a), Vec<T, W>::load_aligned(b), Vec<T, W>::load_aligned(c),
+                      detail::make_index_sequence<256>());
+}
+
+}  // namespace ut
+}  // namespace simd
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace simd {
+namespace ut {
+
+/// transpose a W x W matrix of hashed values and compare element-wise
+template <typename T, size_t W>
+void check_transpose()
+{
+    auto value = [](size_t i, size_t j) {
+        return static_cast<T>(uint32_t((i * W + j) * 2654435761u) >> 24);
+    };
+    std::array<Vec<T, W>, W> rows;
+    for (size_t i = 0; i < W; i++) {
+        for (size_t j = 0; j < W; j++) {
+            rows[i][j] = value(i, j);
+        }
+    }
+    simd::transpose(rows);
+    for (size_t i = 0; i < W; i++) {
+        for (size_t j = 0; j < W; j++) {
+            ASSERT_EQ(value(j, i), rows[i][j]) << Vec<T, W>::type() << " at (" << i << ", " << j << ")";
+        }
+    }
+}
+
+}  // namespace ut
+}  // namespace simd
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "simd/types/vec_expr.h"
+
+namespace simd {
+namespace ut {
+
+/// expr::lazy trees: values against the plain Vec operators and the
+/// number of kernel ops each lowers to (fma forms fused on floating
+/// point lanes, bitwise trees of up to 3 operands one ternlog on AVX512)
+template <typename T, size_t W>
+void check_vec_expr()
+{
+    using V = Vec<T, W>;
+    using expr::lazy;
+    using expr::lowered_ops;
+    constexpr bool fused = std::is_floating_point<T>::value;
+    alignas(V::alignment()) T pa[W], pb[W], pc[W], pd[W];
+    for (size_t i = 0; i < W; i++) {
+        pa[i] = T(int(i % 5) + 1);
+        pb[i] = T(int(i % 3) - 1);
+        pc[i] = T(int(i * 7 % 11));
+        pd[i] = T(2);
+    }
+    const V a = V::load_aligned(pa), b = V::load_aligned(pb), c = V::load_aligned(pc), d = V::load_aligned(pd);
+    auto same = [](const V& ref, const V& got, const char* what) {
+        for (size_t i = 0; i < W; i++) {
+            ASSERT_EQ(ref[i], got[i]) << what << " lane " << i;
+        }
+    };
+
+    auto e0 = lazy(a) * b + c;
+    auto e1 = c + lazy(a) * b;
+    auto e2 = lazy(a) * b - c;
+    auto e3 = c - lazy(a) * b;
+    auto e4 = -(lazy(a) * b) - c;
+    auto e5 = lazy(a) * b + lazy(c) * d;
+    auto e6 = (lazy(a) * b + c) * d - a;
+    same(a * b + c, e0, "a * b + c");
+    same(a * b + c, e1, "c + a * b");
+    same(a * b - c, e2, "a * b - c");
+    same(c - a * b, e3, "c - a * b");
+    same(-(a * b) - c, e4, "-(a * b) - c");
+    same(a * b + c * d, e5, "a * b + c * d");
+    same((a * b + c) * d - a, e6, "(a * b + c) * d - a");
+    EXPECT_EQ(fused ? 1u : 2u, lowered_ops(e0));
+    EXPECT_EQ(fused ? 1u : 2u, lowered_ops(e1));
+    EXPECT_EQ(fused ? 1u : 2u, lowered_ops(e2));
+    EXPECT_EQ(fused ? 1u : 2u, lowered_ops(e3));
+    EXPECT_EQ(fused ? 1u : 3u, lowered_ops(e4));
+    EXPECT_EQ(fused ? 2u : 3u, lowered_ops(e5));
+    EXPECT_EQ(fused ? 2u : 4u, lowered_ops(e6));
+    EXPECT_EQ(2u, lowered_ops(lazy(a) / b + c));
+}
+
+/// bitwise trees need integral lanes
+template <typename T, size_t W>
+void check_vec_expr_bitwise()
+{
+    using V = Vec<T, W>;
+    using expr::lazy;
+    using expr::lowered_ops;
+    constexpr bool ternlog = std::is_base_of<AVX512, typename V::arch_t>::value;
+    alignas(V::alignment()) T pa[W], pb[W], pc[W], pd[W];
+    for (size_t i = 0; i < W; i++) {
+        pa[i] = T(0x5A + 37 * i);
+        pb[i] = T(0x0F0F + 11 * i);
+        pc[i] = T(0x3C + i);
+        pd[i] = T(0x71 * i);
+    }
+    const V a = V::load_aligned(pa), b = V::load_aligned(pb), c = V::load_aligned(pc), d = V::load_aligned(pd);
+    auto same = [](const V& ref, const V& got, const char* what) {
+        for (size_t i = 0; i < W; i++) {
+            ASSERT_EQ(ref[i], got[i]) << what << " lane " << i;
+        }
+    };
+
+    auto t0 = (lazy(a) & b) | ~lazy(c);
+    auto t1 = lazy(a) ^ b ^ c;
+    auto t2 = ~(lazy(a) & b);
+    auto t3 = lazy(a) ^ b ^ c ^ d;
+    auto t4 = ((lazy(a) & b) | ~lazy(c)) ^ (lazy(a) + b);
+    auto t5 = (lazy(a) & b) | (~lazy(a) & c);
+    same((a & b) | ~c, t0, "(a & b) | ~c");
+    same(a ^ b ^ c, t1, "a ^ b ^ c");
+    same(~(a & b), t2, "~(a & b)");
+    same(a ^ b ^ c ^ d, t3, "a ^ b ^ c ^ d");
+    same(((a & b) | ~c) ^ (a + b), t4, "((a & b) | ~c) ^ (a + b)");
+    same((a & b) | (~a & c), t5, "(a & b) | (~a & c)");
+    EXPECT_EQ(ternlog ? 1u : 3u, lowered_ops(t0));
+    EXPECT_EQ(ternlog ? 1u : 2u, lowered_ops(t1));
+    EXPECT_EQ(ternlog ? 1u : 2u, lowered_ops(t2));
+    EXPECT_EQ(ternlog ? 2u : 3u, lowered_ops(t3));
+    EXPECT_EQ(ternlog ? 3u : 5u, lowered_ops(t4));
+    /// operands are not deduplicated: a twice makes 4, only ~a & c fuses
+    EXPECT_EQ(ternlog ? 3u : 4u, lowered_ops(t5));
+    EXPECT_EQ(1u, lowered_ops(~lazy(a)));
+}
+
+}  // namespace ut
+}  // namespace simd
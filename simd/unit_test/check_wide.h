@@ -0,0 +1,59 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace simd {
+namespace ut {
+
+/// logical vectors beyond 512 bits: every op runs register by register,
+/// reductions fold the registers first
+template <typename T, size_t W>
+void check_wide()
+{
+    using V = Vec<T, W>;
+    V a, b;
+    T sum = 0, hi = std::numeric_limits<T>::lowest(), lo = std::numeric_limits<T>::max();
+    for (size_t i = 0; i < W; i++) {
+        a[i] = T(i % 7 + 1);
+        b[i] = T(i % 5 + 2);
+        sum += a[i];
+        hi = std::max(hi, T(a[i] * (i % 3 ? 1 : 2)));
+        lo = std::min(lo, T(a[i] * (i % 3 ? 1 : 2)));
+    }
+    const V c = a + b;
+    const V d = a - b;
+    const V s = select(a < b, a, b);
+    for (size_t i = 0; i < W; i++) {
+        ASSERT_EQ(T(a[i] + b[i]), c[i]) << "lane " << i;
+        ASSERT_EQ(T(a[i] - b[i]), d[i]) << "lane " << i;
+        ASSERT_EQ(std::min(a[i], b[i]), s[i]) << "lane " << i;
+    }
+    EXPECT_EQ(sum, reduce_sum(a));
+    EXPECT_TRUE(all_of(a > V(T(0))));
+    EXPECT_FALSE(any_of(a > V(T(100))));
+
+    alignas(64) T buf[W];
+    c.store_aligned(buf);
+    EXPECT_TRUE(all_of(V::load_aligned(buf) == c));
+
+    SIMD_IF_CONSTEXPR(std::is_floating_point<T>::value) {
+        V x = a;
+        for (size_t i = 0; i < W; i += 3) {
+            x[i] = x[i] * 2;
+        }
+        EXPECT_EQ(hi, reduce_max(x));
+        EXPECT_EQ(lo, reduce_min(x));
+        const V f = fmadd(a, b, c) / b;
+        const V m = simd::max(a, b);
+        for (size_t i = 0; i < W; i++) {
+            ASSERT_EQ(std::max(a[i], b[i]), m[i]) << "lane " << i;
+            ASSERT_NEAR((a[i] * b[i] + c[i]) / b[i], f[i], 1e-5 * f[i]) << "lane " << i;
+        }
+    }
+}
+
+}  // namespace ut
+}  // namespace simd
@@ -0,0 +1,49 @@
+# cmake -DASM=<file.s> -P check_asm.cmake
+# each rule: function, instruction regex, expected count in the function body
+set(RULES
+    "codegen_fmadd|vfmadd[0-9]+ps|1"
+    "codegen_fmadd|vmulps|vaddps|0"
+    "codegen_fmadd_plain|vfmadd[0-9]+ps|0"
+    "codegen_fmadd_plain|vmulps|vaddps|2"
+    "codegen_fmsub|vfmsub[0-9]+pd|1"
+    "codegen_fmsub|vmulpd|vsubpd|0"
+    "codegen_fmsub_plain|vfmsub[0-9]+pd|0"
+    "codegen_fmsub_plain|vmulpd|vsubpd|2"
+    "codegen_fnmadd|vfnmadd[0-9]+ps|1"
+    "codegen_fnmadd|vmulps|vsubps|0"
+    "codegen_fnmadd_plain|vfnmadd[0-9]+ps|0"
+    "codegen_fnmadd_plain|vmulps|vsubps|2"
+    "codegen_ternlog|vpternlog[dq]|1"
+    "codegen_ternlog|vpand|vpor|vpxor|0"
+    "codegen_ternlog_plain|vpternlog[dq]|vpand|vpor|vpxor|2"
+    "codegen_andnot_xor|vpternlog[dq]|1"
+    "codegen_andnot_xor|vpand|vpor|vpxor|0"
+    "codegen_andnot_xor_plain|vpternlog[dq]|vpand|vpor|vpxor|2"
+)
+
+file(READ "${ASM}" text)
+set(failed 0)
+foreach(rule IN LISTS RULES)
+    string(REPLACE "|" ";" parts "${rule}")
+    list(POP_FRONT parts fn)
+    list(POP_BACK parts expected)
+    list(JOIN parts "|" pattern)
+    string(FIND "${text}" "\n${fn}:" begin)
+    if(begin EQUAL -1)
+        message(SEND_ERROR "${fn}: not found in ${ASM}")
+        set(failed 1)
+        continue()
+    endif()
+    string(SUBSTRING "${text}" ${begin} -1 body)
+    string(FIND "${body}" ".cfi_endproc" end)
+    string(SUBSTRING "${body}" 0 ${end} body)
+    string(REGEX MATCHALL "\t(${pattern})[a-z]*\t" hits "${body}")
+    list(LENGTH hits count)
+    if(NOT count EQUAL expected)
+        message(SEND_ERROR "${fn}: ${count} x (${pattern}), expected ${expected}")
+        set(failed 1)
+    endif()
+endforeach()
+if(failed)
+    message(FATAL_ERROR "vec_expr codegen check failed, see ${ASM}")
+endif()
@@ -0,0 +1,74 @@
+#include "simd/simd.h"
+#include "simd/types/vec_expr.h"
+
+/// each function lowers one expression on one AVX512 register, check_asm.cmake
+/// counts the instructions of its body in the -S output; every *_plain
+/// control spells the same expression with plain Vec operators and must
+/// stay unfused, so a rule passes only through the lowering (built with
+/// -ffp-contract=off, and over bitwise trees gcc does not merge itself)
+using vf = simd::Vec<float, 16>;
+using vd = simd::Vec<double, 8>;
+using vi = simd::Vec<int32_t, 16>;
+using simd::expr::lazy;
+
+extern "C" {
+void codegen_fmadd(const float* a, const float* b, const float* c, float* r)
+{
+    vf x = lazy(vf::load_aligned(a)) * vf::load_aligned(b) + vf::load_aligned(c);
+    x.store_aligned(r);
+}
+
+void codegen_fmadd_plain(const float* a, const float* b, const float* c, float* r)
+{
+    vf x = vf::load_aligned(a) * vf::load_aligned(b) + vf::load_aligned(c);
+    x.store_aligned(r);
+}
+
+void codegen_fmsub(const double* a, const double* b, const double* c, double* r)
+{
+    vd x = lazy(vd::load_aligned(a)) * vd::load_aligned(b) - vd::load_aligned(c);
+    x.store_aligned(r);
+}
+
+void codegen_fmsub_plain(const double* a, const double* b, const double* c, double* r)
+{
+    vd x = vd::load_aligned(a) * vd::load_aligned(b) - vd::load_aligned(c);
+    x.store_aligned(r);
+}
+
+void codegen_fnmadd(const float* a, const float* b, const float* c, float* r)
+{
+    vf x = vf::load_aligned(c) - lazy(vf::load_aligned(a)) * vf::load_aligned(b);
+    x.store_aligned(r);
+}
+
+void codegen_fnmadd_plain(const float* a, const float* b, const float* c, float* r)
+{
+    vf x = vf::load_aligned(c) - vf::load_aligned(a) * vf::load_aligned(b);
+    x.store_aligned(r);
+}
+
+void codegen_ternlog(const int32_t* a, const int32_t* b, const int32_t* c, int32_t* r)
+{
+    vi x = (lazy(vi::load_aligned(a)) & vi::load_aligned(b)) | ~lazy(vi::load_aligned(c));
+    x.store_aligned(r);
+}
+
+void codegen_ternlog_plain(const int32_t* a, const int32_t* b, const int32_t* c, int32_t* r)
+{
+    vi x = (vi::load_aligned(a) & vi::load_aligned(b)) | ~vi::load_aligned(c);
+    x.store_aligned(r);
+}
+
+void codegen_andnot_xor(const int32_t* a, const int32_t* b, const int32_t* c, int32_t* r)
+{
+    vi x = (lazy(vi::load_aligned(a)) & ~lazy(vi::load_aligned(b))) ^ vi::load_aligned(c);
+    x.store_aligned(r);
+}
+
+void codegen_andnot_xor_plain(const int32_t* a, const int32_t* b, const int32_t* c, int32_t* r)
+{
+    vi x = (vi::load_aligned(a) & ~vi::load_aligned(b)) ^ vi::load_aligned(c);
+    x.store_aligned(r);
+}
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "simd/filter/conv2d.h"
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+using simd::filter::border;
+
+/// direct definition, borders through border_index for every tap
+template <typename T>
+std::vector<double> conv_ref(const std::vector<T>& src, size_t h, size_t w,
+                             const std::vector<float>& k, size_t kh, size_t kw, border b)
+{
+    using simd::filter::detail::border_index;
+    std::vector<double> out(h * w);
+    for (size_t y = 0; y < h; y++) {
+        for (size_t x = 0; x < w; x++) {
+            double acc = 0;
+            for (size_t i = 0; i < kh; i++) {
+                for (size_t j = 0; j < kw; j++) {
+                    ptrdiff_t sy = border_index(ptrdiff_t(y + i) - ptrdiff_t(kh / 2), h, b);
+                    ptrdiff_t sx = border_index(ptrdiff_t(x + j) - ptrdiff_t(kw / 2), w, b);
+                    if (sy >= 0 && sx >= 0) {
+                        acc += double(k[i * kw + j]) * double(src[sy * w + sx]);
+                    }
+                }
+            }
+            out[y * w + x] = acc;
+        }
+    }
+    return out;
+}
+
+std::vector<float> random_kernel(size_t kh, size_t kw, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<float> k(kh * kw);
+    for (auto& v : k) {
+        v = dist(rng) / (kh * kw);
+    }
+    return k;
+}
+
+std::vector<float> gaussian_kernel(size_t kh, size_t kw)
+{
+    std::vector<float> k(kh * kw);
+    float sum = 0;
+    for (size_t i = 0; i < kh; i++) {
+        for (size_t j = 0; j < kw; j++) {
+            float di = float(i) - kh / 2, dj = float(j) - kw / 2;
+            k[i * kw + j] = std::exp(-0.1f * (di * di + dj * dj));
+            sum += k[i * kw + j];
+        }
+    }
+    for (auto& v : k) {
+        v /= sum;
+    }
+    return k;
+}
+
+template <typename T>
+std::vector<T> random_image(size_t h, size_t w, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<T> img(h * w);
+    for (auto& v : img) {
+        v = static_cast<T>(dist(rng));
+    }
+    return img;
+}
+
+void check_float(size_t h, size_t w, const std::vector<float>& k, size_t kh, size_t kw, bool separable)
+{
+    simd::conv2d conv(k, kh, kw);
+    EXPECT_EQ(separable, conv.separable());
+    auto src = random_image<float>(h, w, 7);
+    for (auto b : {border::zero, border::clamp, border::mirror}) {
+        std::vector<float> dst(h * w);
+        conv.apply(src.data(), h, w, dst.data(), b);
+        auto ref = conv_ref(src, h, w, k, kh, kw, b);
+        for (size_t i = 0; i < h * w; i++) {
+            ASSERT_NEAR(ref[i], dst[i], 1e-3) << kh << "x" << kw << " border " << int(b) << " at " << i;
+        }
+    }
+}
+}  // namespace
+
+TEST(conv2d, test_border_index)
+{
+    using simd::filter::detail::border_index;
+    EXPECT_EQ(-1, border_index(-1, 4, border::zero));
+    EXPECT_EQ(0, border_index(-2, 4, border::clamp));
+    EXPECT_EQ(3, border_index(5, 4, border::clamp));
+    EXPECT_EQ(2, border_index(-2, 4, border::mirror));
+    EXPECT_EQ(1, border_index(5, 4, border::mirror));
+    EXPECT_EQ(0, border_index(-3, 1, border::mirror));
+    /// radius wider than the image reflects back and forth
+    EXPECT_EQ(1, border_index(-3, 3, border::mirror));
+    EXPECT_EQ(0, border_index(-4, 3, border::mirror));
+}
+
+TEST(conv2d, test_full_kernel)
+{
+    check_float(37, 53, random_kernel(3, 3, 1), 3, 3, false);
+    check_float(20, 200, random_kernel(5, 7, 2), 5, 7, false);
+    check_float(9, 11, random_kernel(15, 15, 3), 15, 15, false);
+    check_float(4, 3, random_kernel(1, 5, 4), 1, 5, true);
+}
+
+TEST(conv2d, test_separable_kernel)
+{
+    check_float(37, 53, gaussian_kernel(3, 3), 3, 3, true);
+    check_float(64, 130, gaussian_kernel(9, 5), 9, 5, true);
+    check_float(6, 5, gaussian_kernel(15, 15), 15, 15, true);
+}
+
+TEST(conv2d, test_u8_strided)
+{
+    const size_t h = 31, w = 45, stride = 64;
+    auto k = gaussian_kernel(5, 5);
+    k[0] += 0.01f;  /// no longer rank 1
+    auto packed = random_image<uint8_t>(h, w, 9);
+    std::vector<uint8_t> src(h * stride, 0), dst(h * stride, 0xAB);
+    for (size_t y = 0; y < h; y++) {
+        std::copy(packed.begin() + y * w, packed.begin() + (y + 1) * w, src.begin() + y * stride);
+    }
+    for (auto scale : {1.f, 4.f}) {
+        auto ks = k;
+        for (auto& v : ks) {
+            v *= scale;
+        }
+        simd::conv2d conv(ks, 5, 5);
+        conv.apply(src.data(), h, w, stride, dst.data(), stride, border::mirror);
+        auto ref = conv_ref(packed, h, w, ks, 5, 5, border::mirror);
+        for (size_t y = 0; y < h; y++) {
+            for (size_t x = 0; x < w; x++) {
+                double r = std::min(255.0, std::max(0.0, ref[y * w + x]));
+                ASSERT_NEAR(r, dst[y * stride + x], 0.5 + 1e-3) << y << "," << x;
+            }
+            for (size_t x = w; x < stride; x++) {
+                ASSERT_EQ(0xAB, dst[y * stride + x]) << "padding written";
+            }
+        }
+    }
+}
+
+TEST(conv2d, test_even_kernel)
+{
+    std::vector<float> k(12, 1.f);
+    EXPECT_THROW(simd::conv2d(k, 3, 4), std::invalid_argument);
+    EXPECT_THROW(simd::conv2d(k, 4, 3), std::invalid_argument);
+    EXPECT_THROW(simd::conv2d(k.data(), 0, 1), std::invalid_argument);
+}
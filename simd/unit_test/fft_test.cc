@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "simd/fft/fft.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace {
+template <typename T>
+std::vector<std::complex<T>> signal(size_t n, size_t seed)
+{
+    std::vector<std::complex<T>> x(n);
+    for (size_t i = 0; i < n; i++) {
+        x[i] = std::complex<T>(T(int((i * 37 + seed * 11) % 101) - 50) / 25,
+                               T(int((i * 53 + seed * 7) % 97) - 48) / 24);
+    }
+    return x;
+}
+
+/// X[k] = sum_j x[j] exp(-2 pi i jk / n), in long double
+template <typename T>
+std::vector<std::complex<long double>> dft(const std::vector<std::complex<T>>& x, int sign)
+{
+    const size_t n = x.size();
+    const long double pi = 3.141592653589793238462643383279502884L;
+    std::vector<std::complex<long double>> w(n), y(n);
+    for (size_t j = 0; j < n; j++) {
+        const long double a = sign * 2 * pi * (long double)j / n;
+        w[j] = std::complex<long double>(std::cos(a), std::sin(a));
+    }
+    for (size_t k = 0; k < n; k++) {
+        std::complex<long double> s = 0;
+        for (size_t j = 0; j < n; j++) {
+            s += std::complex<long double>(x[j].real(), x[j].imag()) * w[j * k % n];
+        }
+        y[k] = s;
+    }
+    return y;
+}
+
+/// absolute tolerance for inputs of magnitude ~2, grows with sqrt(n) log2(n)
+template <typename T>
+long double tolerance(size_t n)
+{
+    const long double eps = std::is_same<T, float>::value ? 1e-6L : 1e-15L;
+    return 8 * eps * (1 + std::log2((long double)n)) * std::sqrt((long double)n) * 2;
+}
+
+template <typename T>
+void check_complex(size_t n)
+{
+    simd::fft::plan<T> p(n);
+    EXPECT_EQ(n, p.size());
+    const auto x = signal<T>(n, n);
+    std::vector<std::complex<T>> y(n), z(n);
+    p.forward(x.data(), y.data());
+    const auto ref = dft(x, -1);
+    for (size_t k = 0; k < n; k++) {
+        ASSERT_NEAR(ref[k].real(), y[k].real(), tolerance<T>(n)) << "n " << n << " k " << k;
+        ASSERT_NEAR(ref[k].imag(), y[k].imag(), tolerance<T>(n)) << "n " << n << " k " << k;
+    }
+    p.inverse(y.data(), z.data());
+    for (size_t k = 0; k < n; k++) {
+        ASSERT_NEAR(x[k].real(), z[k].real(), tolerance<T>(n)) << "n " << n << " k " << k;
+        ASSERT_NEAR(x[k].imag(), z[k].imag(), tolerance<T>(n)) << "n " << n << " k " << k;
+    }
+    /// in place
+    z = x;
+    p.forward(z.data(), z.data());
+    for (size_t k = 0; k < n; k++) {
+        ASSERT_EQ(y[k], z[k]) << "n " << n << " k " << k;
+    }
+}
+
+template <typename T>
+void check_real(size_t n)
+{
+    simd::fft::plan<T> p(n);
+    std::vector<T> x(n), z(n);
+    std::vector<std::complex<T>> xc(n), y(n / 2 + 1);
+    for (size_t i = 0; i < n; i++) {
+        x[i] = T(int((i * 29 + n) % 89) - 44) / 22;
+        xc[i] = x[i];
+    }
+    p.forward_real(x.data(), y.data());
+    const auto ref = dft(xc, -1);
+    for (size_t k = 0; k <= n / 2; k++) {
+        ASSERT_NEAR(ref[k].real(), y[k].real(), tolerance<T>(n)) << "n " << n << " k " << k;
+        ASSERT_NEAR(ref[k].imag(), y[k].imag(), tolerance<T>(n)) << "n " << n << " k " << k;
+    }
+    p.inverse_real(y.data(), z.data());
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_NEAR(x[i], z[i], tolerance<T>(n)) << "n " << n << " i " << i;
+    }
+}
+
+template <typename T>
+void check_batched(size_t n, size_t count)
+{
+    simd::fft::plan<T> p(n);
+    const size_t dist = n + 3;
+    std::vector<std::complex<T>> x(count * dist), y(count * dist), one(n);
+    for (size_t b = 0; b < count; b++) {
+        const auto s = signal<T>(n, b);
+        std::copy(s.begin(), s.end(), x.begin() + b * dist);
+    }
+    p.forward(x.data(), y.data(), count, dist);
+    for (size_t b = 0; b < count; b++) {
+        p.forward(x.data() + b * dist, one.data());
+        for (size_t k = 0; k < n; k++) {
+            ASSERT_EQ(one[k], y[b * dist + k]) << "signal " << b << " k " << k;
+        }
+    }
+
+    std::vector<T> r(count * n), rr(count * n);
+    std::vector<std::complex<T>> c(count * (n / 2 + 1)), c1(n / 2 + 1);
+    for (size_t i = 0; i < r.size(); i++) {
+        r[i] = T(int(i * 13 % 41) - 20);
+    }
+    p.forward_real(r.data(), c.data(), count, n, n / 2 + 1);
+    p.inverse_real(c.data(), rr.data(), count, n / 2 + 1, n);
+    for (size_t b = 0; b < count; b++) {
+        p.forward_real(r.data() + b * n, c1.data());
+        for (size_t k = 0; k <= n / 2; k++) {
+            ASSERT_EQ(c1[k], c[b * (n / 2 + 1) + k]) << "signal " << b << " k " << k;
+        }
+    }
+    for (size_t i = 0; i < r.size(); i++) {
+        ASSERT_NEAR(r[i], rr[i], 20 * tolerance<T>(n)) << "i " << i;
+    }
+}
+}  // namespace
+
+/// every size up to 2^12: scalar stages, odd powers (final radix-2) and
+/// both twiddle layouts of the vector stages
+TEST(fft, test_complex)
+{
+    for (size_t n = 1; n <= 4096; n *= 2) {
+        check_complex<float>(n);
+        check_complex<double>(n);
+    }
+}
+
+TEST(fft, test_real)
+{
+    for (size_t n = 2; n <= 4096; n *= 2) {
+        check_real<float>(n);
+        check_real<double>(n);
+    }
+}
+
+TEST(fft, test_batched)
+{
+    check_batched<float>(8, 5);
+    check_batched<float>(512, 3);
+    check_batched<double>(256, 4);
+}
+
+TEST(fft, test_copy)
+{
+    simd::fft::plan<float> p(64);
+    simd::fft::plan<float> q(p);
+    const auto x = signal<float>(64, 1);
+    std::vector<std::complex<float>> a(64), b(64);
+    p.forward(x.data(), a.data());
+    q.forward(x.data(), b.data());
+    EXPECT_EQ(a, b);
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "simd/filter/fir.h"
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+template <typename T>
+std::vector<T> make_signal(size_t n, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<T> x(n);
+    for (auto& v : x) {
+        v = static_cast<T>(dist(rng));
+    }
+    return x;
+}
+
+/// y[n] = sum_k h[k] * x[n - k], zero history, double accumulation
+template <typename T>
+std::vector<double> convolve_ref(const std::vector<T>& h, const std::vector<T>& x)
+{
+    std::vector<double> y(x.size());
+    for (size_t n = 0; n < x.size(); n++) {
+        double acc = 0;
+        for (size_t k = 0; k < h.size() && k <= n; k++) {
+            acc += double(h[k]) * double(x[n - k]);
+        }
+        y[n] = acc;
+    }
+    return y;
+}
+
+template <typename T>
+void check_against_ref(size_t taps, size_t n, double tol)
+{
+    auto h = make_signal<T>(taps, 1);
+    auto x = make_signal<T>(n, 2);
+    simd::fir<T> f(h);
+    EXPECT_EQ(taps, f.taps());
+    auto y = f.process(x);
+    auto ref = convolve_ref(h, x);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_NEAR(ref[i], y[i], tol * std::sqrt(double(taps))) << "taps " << taps << " at " << i;
+    }
+}
+}  // namespace
+
+TEST(fir, test_matches_convolution)
+{
+    for (size_t taps : {1, 3, 16, 64, 129, 512}) {
+        check_against_ref<float>(taps, 3000, 1e-5);
+        check_against_ref<double>(taps, 3000, 1e-13);
+    }
+}
+
+TEST(fir, test_streaming_chunks)
+{
+    auto h = make_signal<float>(100, 3);
+    auto x = make_signal<float>(5000, 4);
+    simd::fir<float> whole(h);
+    auto y = whole.process(x);
+
+    /// odd chunk sizes, some shorter than the filter, some longer than a block
+    simd::fir<float> chunked(h);
+    std::vector<float> z(x.size());
+    const size_t chunks[] = {1, 7, 99, 100, 101, 1500, 3};
+    size_t pos = 0;
+    for (size_t c = 0; pos < x.size(); c++) {
+        size_t len = std::min(chunks[c % 7], x.size() - pos);
+        chunked.process(x.data() + pos, z.data() + pos, len);
+        pos += len;
+    }
+    EXPECT_EQ(y, z);
+}
+
+TEST(fir, test_reset_in_place)
+{
+    auto h = make_signal<double>(33, 5);
+    auto x = make_signal<double>(777, 6);
+    simd::fir<double> f(h);
+    auto y = f.process(x);
+    f.process(x);
+    f.reset();
+    f.process(x.data(), x.data(), x.size());
+    EXPECT_EQ(y, x);
+}
+
+TEST(fir, test_no_taps)
+{
+    EXPECT_THROW(simd::fir<float>(std::vector<float>()), std::invalid_argument);
+}
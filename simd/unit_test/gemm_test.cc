@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "simd/gemm/gemm.h"
+#include "simd/gemm/gemv.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+template <typename T>
+std::vector<T> make_matrix(size_t rows, size_t cols, size_t ld, int seed)
+{
+    std::vector<T> m(rows * ld, T(-1000));
+    for (size_t i = 0; i < rows; i++) {
+        for (size_t j = 0; j < cols; j++) {
+            m[i * ld + j] = T(int((i * 7 + j * 3 + seed) % 11) - 5) * T(0.25);
+        }
+    }
+    return m;
+}
+
+/// C = alpha * op(A) * op(B) + beta * C, naive triple loop
+template <typename T>
+void gemm_ref(bool ta, bool tb, size_t M, size_t N, size_t K,
+              T alpha, const T* A, size_t lda, const T* B, size_t ldb,
+              T beta, T* C, size_t ldc)
+{
+    for (size_t i = 0; i < M; i++) {
+        for (size_t j = 0; j < N; j++) {
+            T s = 0;
+            for (size_t k = 0; k < K; k++) {
+                T a = ta ? A[k * lda + i] : A[i * lda + k];
+                T b = tb ? B[j * ldb + k] : B[k * ldb + j];
+                s += a * b;
+            }
+            C[i * ldc + j] = alpha * s + (beta != T(0) ? beta * C[i * ldc + j] : T(0));
+        }
+    }
+}
+
+template <typename T>
+void check_gemm(bool ta, bool tb, size_t M, size_t N, size_t K, T alpha, T beta)
+{
+    using simd::gemm::trans;
+    /// padded leading dimensions catch stride mistakes
+    size_t lda = (ta ? M : K) + 3, ldb = (tb ? K : N) + 1, ldc = N + 2;
+    auto a = make_matrix<T>(ta ? K : M, ta ? M : K, lda, 1);
+    auto b = make_matrix<T>(tb ? N : K, tb ? K : N, ldb, 2);
+    auto c0 = make_matrix<T>(M, N, ldc, 3);
+    if (beta == T(0)) {
+        /// beta == 0 must not read C
+        for (size_t i = 0; i < M; i++) {
+            std::fill_n(&c0[i * ldc], N, std::nan(""));
+        }
+    }
+    auto c1 = c0;
+    gemm_ref(ta, tb, M, N, K, alpha, a.data(), lda, b.data(), ldb, beta, c0.data(), ldc);
+    simd::gemm::gemm(ta ? trans::yes : trans::no, tb ? trans::yes : trans::no, M, N, K,
+                     alpha, a.data(), lda, b.data(), ldb, beta, c1.data(), ldc);
+    for (size_t i = 0; i < M; i++) {
+        for (size_t j = 0; j < N; j++) {
+            /// quarter-integer inputs: exact for these sizes
+            ASSERT_EQ(c0[i * ldc + j], c1[i * ldc + j]) << M << "x" << N << "x" << K
+                << " at (" << i << ", " << j << ")";
+        }
+        /// padding between rows untouched
+        for (size_t j = N; j < ldc; j++) {
+            ASSERT_EQ(T(-1000), c1[i * ldc + j]);
+        }
+    }
+}
+}  // namespace
+
+TEST(gemm, test_sgemm_sizes)
+{
+    for (size_t M : {1, 5, 17, 64}) {
+        for (size_t N : {1, 9, 33, 70}) {
+            for (size_t K : {1, 13, 40}) {
+                check_gemm<float>(false, false, M, N, K, 1.f, 0.f);
+            }
+        }
+    }
+}
+
+TEST(gemm, test_dgemm_trans_alpha_beta)
+{
+    for (bool ta : {false, true}) {
+        for (bool tb : {false, true}) {
+            check_gemm<double>(ta, tb, 19, 23, 29, 2.0, 0.0);
+            check_gemm<double>(ta, tb, 19, 23, 29, 0.5, -1.0);
+            check_gemm<float>(ta, tb, 31, 18, 11, -1.f, 0.5f);
+        }
+    }
+}
+
+TEST(gemm, test_gemm_blocked)
+{
+    /// spans several KC/MC blocks and edge tiles in every direction
+    using blk = simd::gemm::blocking<double>;
+    check_gemm<double>(false, false, blk::MC + 5, 2 * blk::NR + 3, blk::KC * 2 + 7, 1.0, 1.0);
+    check_gemm<double>(true, false, blk::MC + 5, 2 * blk::NR + 3, blk::KC + 1, 1.0, 0.0);
+}
+
+TEST(gemm, test_gemm_degenerate)
+{
+    std::vector<float> c{1, 2, 3, 4};
+    simd::gemm::gemm(simd::gemm::trans::no, simd::gemm::trans::no, 2, 2, 0,
+                     1.f, (const float*)nullptr, 1, (const float*)nullptr, 2, 3.f, c.data(), 2);
+    EXPECT_EQ((std::vector<float>{3, 6, 9, 12}), c);
+
+    /// dense convenience overload
+    std::vector<float> a{1, 2, 3, 4, 5, 6}, b{1, 0, 0, 1, 1, 1}, d(4);
+    simd::gemm::gemm(2, 2, 3, a.data(), b.data(), d.data());
+    EXPECT_EQ((std::vector<float>{4, 5, 10, 11}), d);
+}
+
+TEST(gemm, test_gemv_bf16)
+{
+    /// make_matrix values are quarter-integers: exact in bfloat16, sums exact in float
+    for (size_t M : {1, 4, 7, 33}) {
+        for (size_t K : {1, 16, 31, 100}) {
+            const size_t lda = K + 3;
+            auto af = make_matrix<float>(M, K, lda, 1);
+            auto xf = make_matrix<float>(1, K, K, 2);
+            std::vector<simd::bfloat16> a(af.size()), x(xf.size());
+            std::transform(af.begin(), af.end(), a.begin(), [](float v) { return simd::bfloat16(v); });
+            std::transform(xf.begin(), xf.end(), x.begin(), [](float v) { return simd::bfloat16(v); });
+            std::vector<float> y(M, 2.f), ref(M, 2.f);
+            gemm_ref(false, false, M, 1, K, 0.5f, af.data(), lda, xf.data(), 1, -1.f, ref.data(), 1);
+            simd::gemm::gemv(M, K, 0.5f, a.data(), lda, x.data(), -1.f, y.data());
+            EXPECT_EQ(ref, y) << M << " x " << K;
+            std::fill(y.begin(), y.end(), std::nanf(""));
+            gemm_ref(false, false, M, 1, K, 1.f, af.data(), lda, xf.data(), 1, 0.f, ref.data(), 1);
+            simd::gemm::gemv(M, K, 1.f, a.data(), lda, x.data(), 0.f, y.data());
+            EXPECT_EQ(ref, y) << M << " x " << K;
+        }
+    }
+}
+
+TEST(gemm, test_gemv_u8i8)
+{
+    /// |A| <= 64 keeps the pmaddubsw pair sums exact
+    for (size_t M : {1, 4, 9}) {
+        for (size_t K : {3, 64, 129}) {
+            const size_t lda = K + 5;
+            std::vector<int8_t> a(M * lda, 127);
+            std::vector<uint8_t> x(K);
+            for (size_t k = 0; k < K; k++) {
+                x[k] = static_cast<uint8_t>(k * 97 + 3);
+            }
+            for (size_t i = 0; i < M; i++) {
+                for (size_t k = 0; k < K; k++) {
+                    a[i * lda + k] = static_cast<int8_t>(int((i * 13 + k * 7) % 129) - 64);
+                }
+            }
+            std::vector<int32_t> y(M), ref(M, 0);
+            for (size_t i = 0; i < M; i++) {
+                for (size_t k = 0; k < K; k++) {
+                    ref[i] += int32_t(a[i * lda + k]) * int32_t(x[k]);
+                }
+            }
+            simd::gemm::gemv(M, K, a.data(), lda, x.data(), y.data());
+            EXPECT_EQ(ref, y) << M << " x " << K;
+        }
+    }
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "simd/image/gray.h"
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+using simd::image::luma;
+
+template <typename T>
+std::vector<T> random_pixels(size_t n, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<T> v(n);
+    for (auto& x : v) {
+        x = static_cast<T>(dist(rng));
+    }
+    return v;
+}
+
+/// h x w image with C channels in rows of `stride` elements,
+/// gray rows of `dst_stride`; checks the padding is left alone
+template <size_t C>
+void check_u8(size_t h, size_t w, size_t stride, size_t dst_stride, luma l,
+              const simd::parallel::options& opt = simd::parallel::options())
+{
+    const auto k = simd::image::detail::weights(l);
+    auto src = random_pixels<uint8_t>(h * stride, 3 * unsigned(w) + C);
+    std::vector<uint8_t> dst(h * dst_stride, 0xAB);
+    if (C == 3) {
+        simd::image::rgb_to_gray(src.data(), h, w, stride, dst.data(), dst_stride, l, opt);
+    } else {
+        simd::image::rgba_to_gray(src.data(), h, w, stride, dst.data(), dst_stride, l, opt);
+    }
+    for (size_t y = 0; y < h; y++) {
+        for (size_t x = 0; x < w; x++) {
+            const uint8_t* p = &src[y * stride + C * x];
+            const uint8_t g = dst[y * dst_stride + x];
+            ASSERT_EQ(simd::image::detail::gray_q7(p[0], p[1], p[2], k), g) << w << " at " << y << "," << x;
+            double ref = k.r * p[0] + k.g * p[1] + k.b * p[2];
+            ASSERT_LE(std::fabs(std::round(ref) - g), 1.0) << w << " at " << y << "," << x;
+        }
+        for (size_t x = w; x < dst_stride; x++) {
+            ASSERT_EQ(0xAB, dst[y * dst_stride + x]) << "padding written";
+        }
+    }
+}
+}  // namespace
+
+TEST(gray, test_fixed_point_weights)
+{
+    /// every color within one level of the float formula, white stays white
+    for (auto l : {luma::bt601, luma::bt709}) {
+        const auto k = simd::image::detail::weights(l);
+        EXPECT_EQ(128, k.qr + k.qg + k.qb);
+        EXPECT_EQ(255, simd::image::detail::gray_q7(255, 255, 255, k));
+        int worst = 0;
+        for (int r = 0; r < 256; r += 3) {
+            for (int g = 0; g < 256; g++) {
+                for (int b = 0; b < 256; b += 5) {
+                    int q = simd::image::detail::gray_q7(r, g, b, k);
+                    int f = int(std::lround(k.r * r + k.g * g + k.b * b));
+                    worst = std::max(worst, std::abs(q - f));
+                }
+            }
+        }
+        EXPECT_LE(worst, 1);
+    }
+}
+
+TEST(gray, test_u8)
+{
+    for (size_t w : {1, 15, 16, 17, 18, 33, 64, 65, 130, 257}) {
+        check_u8<3>(3, w, 3 * w, w, luma::bt601);
+        check_u8<4>(3, w, 4 * w, w, luma::bt709);
+        /// padded rows on both sides
+        check_u8<3>(5, w, 3 * w + 7, w + 3, luma::bt709);
+        check_u8<4>(5, w, 4 * w + 12, w + 1, luma::bt601);
+    }
+}
+
+TEST(gray, test_u8_pool)
+{
+    simd::parallel::thread_pool pool(3);
+    simd::parallel::options opt;
+    opt.pool = &pool;
+    check_u8<3>(101, 200, 600, 200, luma::bt601, opt);
+    opt.chunk = 7;
+    check_u8<4>(101, 77, 320, 80, luma::bt709, opt);
+}
+
+TEST(gray, test_float)
+{
+    for (size_t w : {1, 3, 4, 5, 8, 9, 31}) {
+        const size_t h = 4;
+        for (size_t c : {3, 4}) {
+            auto src = random_pixels<float>(h * c * w, unsigned(w));
+            for (auto& v : src) {
+                v /= 255.f;
+            }
+            std::vector<float> dst(h * w);
+            for (auto l : {luma::bt601, luma::bt709}) {
+                const auto k = simd::image::detail::weights(l);
+                if (c == 3) {
+                    simd::image::rgb_to_gray(src.data(), h, w, dst.data(), l);
+                } else {
+                    simd::image::rgba_to_gray(src.data(), h, w, dst.data(), l);
+                }
+                for (size_t i = 0; i < h * w; i++) {
+                    const float* p = &src[c * i];
+                    ASSERT_NEAR(k.r * p[0] + k.g * p[1] + k.b * p[2], dst[i], 1e-6) << w << " at " << i;
+                }
+            }
+        }
+    }
+}
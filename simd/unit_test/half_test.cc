@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+TEST(half, test_round_trip)
+{
+    /// every non-NaN half survives half -> float -> half
+    for (uint32_t b = 0; b < 0x10000u; b++) {
+        auto h = simd::half::from_bits(static_cast<uint16_t>(b));
+        float f = h;
+        if (std::isnan(f)) {
+            EXPECT_EQ(0x7C00u, b & 0x7C00u);
+            EXPECT_NE(0u, b & 0x3FFu);
+            continue;
+        }
+        EXPECT_EQ(b, simd::half(f).bits) << std::hex << b;
+    }
+}
+
+TEST(half, test_rounding)
+{
+    EXPECT_EQ(0x3C00u, simd::half(1.f).bits);
+    EXPECT_EQ(0xC000u, simd::half(-2.f).bits);
+    EXPECT_EQ(0x8000u, simd::half(-0.f).bits);
+    EXPECT_EQ(0x7BFFu, simd::half(65504.f).bits);
+    EXPECT_EQ(0x7BFFu, simd::half(65519.f).bits);
+    EXPECT_EQ(0x7C00u, simd::half(65520.f).bits);
+    EXPECT_EQ(0xFC00u, simd::half(-std::numeric_limits<float>::infinity()).bits);
+    /// ties to even: 1 + 2^-11 sits halfway between 1 and 1 + 2^-10
+    EXPECT_EQ(0x3C00u, simd::half(1.f + std::ldexp(1.f, -11)).bits);
+    EXPECT_EQ(0x3C02u, simd::half(1.f + 3 * std::ldexp(1.f, -11)).bits);
+    /// subnormals: 2^-24 is the smallest, 2^-25 ties down to zero
+    EXPECT_EQ(0x0001u, simd::half(std::ldexp(1.f, -24)).bits);
+    EXPECT_EQ(0x0000u, simd::half(std::ldexp(1.f, -25)).bits);
+    EXPECT_EQ(0x0001u, simd::half(std::ldexp(1.5f, -25)).bits);
+    EXPECT_EQ(0x0400u, simd::half(std::ldexp(1.f, -14)).bits);
+    EXPECT_EQ(0x0400u, simd::half(std::ldexp(1.f, -14) - std::ldexp(1.f, -26)).bits);
+    EXPECT_TRUE(std::isnan(float(simd::half(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+TEST(bfloat16, test_rounding)
+{
+    EXPECT_EQ(0x3F80u, simd::bfloat16(1.f).bits);
+    EXPECT_EQ(0xC000u, simd::bfloat16(-2.f).bits);
+    EXPECT_EQ(1.f, float(simd::bfloat16::from_bits(0x3F80)));
+    /// ties to even: 1 + 2^-8 sits halfway between 1 and 1 + 2^-7
+    EXPECT_EQ(0x3F80u, simd::bfloat16(1.f + std::ldexp(1.f, -8)).bits);
+    EXPECT_EQ(0x3F82u, simd::bfloat16(1.f + 3 * std::ldexp(1.f, -8)).bits);
+    EXPECT_EQ(0x7F80u, simd::bfloat16(std::numeric_limits<float>::max()).bits);
+    EXPECT_EQ(0x7F78u, simd::bfloat16(3.3e38f).bits);
+    EXPECT_EQ(0x0001u, simd::bfloat16(std::numeric_limits<float>::denorm_min() * 65536).bits);
+    EXPECT_TRUE(std::isnan(float(simd::bfloat16(std::numeric_limits<float>::quiet_NaN()))));
+    /// a NaN whose payload sits in the low half must not round to inf
+    float snan;
+    uint32_t b = 0x7F800001u;
+    std::memcpy(&snan, &b, sizeof(snan));
+    EXPECT_EQ(0x7FC0u, simd::bfloat16(snan).bits);
+}
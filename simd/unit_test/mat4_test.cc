@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "simd/matrix/mat4.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+/// well conditioned: diagonally dominant
+template <typename T>
+simd::Mat4<T> make_mat(int seed)
+{
+    T v[16];
+    for (int i = 0; i < 16; i++) {
+        v[i] = T((i * 7 + seed * 5) % 11 - 5) * T(0.125);
+    }
+    for (int i = 0; i < 4; i++) {
+        v[i * 5] += T(4 + seed % 3);
+    }
+    return simd::Mat4<T>::load(v);
+}
+
+template <typename T>
+simd::Mat4<T> mul_ref(const simd::Mat4<T>& a, const simd::Mat4<T>& b)
+{
+    T r[16];
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            T s = 0;
+            for (int k = 0; k < 4; k++) {
+                s += a(i, k) * b(k, j);
+            }
+            r[i * 4 + j] = s;
+        }
+    }
+    return simd::Mat4<T>::load(r);
+}
+
+template <typename T>
+void expect_near(const simd::Mat4<T>& a, const simd::Mat4<T>& b, T eps)
+{
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            EXPECT_NEAR(a(i, j), b(i, j), eps) << "(" << i << ", " << j << ")";
+        }
+    }
+}
+
+template <typename T>
+void check_mat4(T eps)
+{
+    auto a = make_mat<T>(1), b = make_mat<T>(2);
+    expect_near(mul_ref(a, b), a * b, eps);
+    expect_near(simd::Mat4<T>::identity(), a * simd::inverse(a), eps);
+    expect_near(simd::Mat4<T>::identity(), simd::inverse(b) * b, eps);
+
+    for (int i = 0; i < 16; i++) {
+        EXPECT_EQ(a(i / 4, i % 4), a.data()[i]);
+    }
+
+    auto t = simd::transpose(a);
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            EXPECT_EQ(a(i, j), t(j, i));
+        }
+    }
+
+    /// |diag(2, 3, 4, 5) with one row swap| = -120
+    simd::Mat4<T> p(simd::Vec<T, 4>(0, 3, 0, 0), simd::Vec<T, 4>(2, 0, 0, 0),
+                    simd::Vec<T, 4>(0, 0, 4, 0), simd::Vec<T, 4>(0, 0, 0, 5));
+    EXPECT_NEAR(T(-120), simd::determinant(p), eps);
+    EXPECT_NEAR(simd::determinant(a) * simd::determinant(b), simd::determinant(a * b), eps * 1000);
+
+    auto v = a * simd::Vec<T, 4>(1, 2, 3, 4);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_NEAR(a(i, 0) + 2 * a(i, 1) + 3 * a(i, 2) + 4 * a(i, 3), v[i], eps);
+    }
+}
+
+template <typename T>
+void check_batch(T eps)
+{
+    /// odd count exercises the scalar tail after full packs
+    const size_t n = 11;
+    std::vector<simd::Mat4<T>> a(n), b(n), c(n), inv(n);
+    for (size_t i = 0; i < n; i++) {
+        a[i] = make_mat<T>(int(i));
+        b[i] = make_mat<T>(int(i) + 3);
+    }
+    simd::matrix::mul(n, a.data(), b.data(), c.data());
+    simd::matrix::inverse(n, a.data(), inv.data());
+    for (size_t i = 0; i < n; i++) {
+        expect_near(mul_ref(a[i], b[i]), c[i], eps);
+        expect_near(simd::Mat4<T>::identity(), mul_ref(a[i], inv[i]), eps);
+    }
+
+    std::vector<T> p(4 * n), q(4 * n), p3(3 * n), q3(3 * n);
+    for (size_t i = 0; i < 4 * n; i++) {
+        p[i] = T(int(i % 9) - 4);
+    }
+    for (size_t i = 0; i < n; i++) {
+        std::copy_n(&p[4 * i], 3, &p3[3 * i]);
+        p[4 * i + 3] = 1;
+    }
+    simd::matrix::transform(a[0], n, p.data(), q.data());
+    simd::matrix::transform_points(a[0], n, p3.data(), q3.data());
+    for (size_t i = 0; i < n; i++) {
+        auto r = a[0] * simd::Vec<T, 4>::load_unaligned(&p[4 * i]);
+        for (size_t j = 0; j < 4; j++) {
+            EXPECT_NEAR(r[j], q[4 * i + j], eps);
+        }
+        for (size_t j = 0; j < 3; j++) {
+            EXPECT_NEAR(r[j], q3[3 * i + j], eps);
+        }
+    }
+    /// in place
+    simd::matrix::transform(a[0], n, p.data(), p.data());
+    EXPECT_EQ(q, p);
+}
+}  // namespace
+
+TEST(mat4, test_mat4f)
+{
+    check_mat4<float>(1e-5f);
+}
+
+TEST(mat4, test_mat4d)
+{
+    check_mat4<double>(1e-12);
+}
+
+TEST(mat4, test_batch)
+{
+    check_batch<float>(1e-4f);
+    check_batch<double>(1e-12);
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "simd/parallel/parallel.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace {
+struct max_op {
+    int32_t operator()(int32_t a, int32_t b) const { return std::max(a, b); }
+    template <typename V>
+    V operator()(const V& a, const V& b) const { return simd::max(a, b); }
+};
+}  // namespace
+
+TEST(parallel, test_thread_pool)
+{
+    simd::parallel::thread_pool pool(4);
+    EXPECT_EQ(4u, pool.size());
+    EXPECT_EQ(4u, pool.current_index());
+
+    std::atomic<int> count{0};
+    for (int i = 0; i < 1000; i++) {
+        pool.submit([&count] { count++; }, i);
+    }
+    while (count.load() < 1000) {
+        pool.try_run_one();
+    }
+    EXPECT_EQ(1000, count.load());
+}
+
+TEST(parallel, test_for_each_range)
+{
+    simd::parallel::thread_pool pool(3);
+    simd::parallel::options opt;
+    opt.pool = &pool;
+    for (size_t chunk : {0, 1, 7}) {
+        opt.chunk = chunk;
+        for (size_t n : {0, 1, 5, 100}) {
+            std::vector<std::atomic<int>> hits(n);
+            simd::parallel::for_each_range(n, [&](size_t b, size_t e) {
+                EXPECT_LT(b, e);
+                for (size_t i = b; i < e; i++) {
+                    hits[i]++;
+                }
+            }, opt);
+            for (size_t i = 0; i < n; i++) {
+                EXPECT_EQ(1, hits[i].load()) << "n " << n << " chunk " << chunk;
+            }
+        }
+    }
+}
+
+TEST(parallel, test_transform)
+{
+    simd::parallel::thread_pool pool(3);
+    simd::parallel::options opt;
+    opt.pool = &pool;
+    opt.chunk = 100;  /// rounded up to whole cache lines
+
+    for (size_t n : {0, 1, 7, 16, 1000, 12345}) {
+        std::vector<float> x(n + 1), y(n + 1, -1.f);
+        std::iota(x.begin(), x.end(), 0.f);
+        /// unaligned output exercises the head chunk
+        simd::parallel::transform(x.data(), y.data() + 1, n,
+            [](auto v) { return v * 2.f + 1.f; }, opt);
+        EXPECT_EQ(-1.f, y[0]);
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_EQ(2.f * x[i] + 1.f, y[i + 1]);
+        }
+    }
+    {
+        size_t n = 5000;
+        std::vector<double> a(n), b(n), c(n);
+        std::iota(a.begin(), a.end(), 0.0);
+        std::iota(b.begin(), b.end(), 1.0);
+        simd::parallel::transform(a.data(), b.data(), c.data(), n,
+            [](auto u, auto v) { return u * v; }, opt);
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_EQ(a[i] * b[i], c[i]);
+        }
+    }
+}
+
+TEST(parallel, test_reduce)
+{
+    simd::parallel::thread_pool pool(4);
+    simd::parallel::options opt;
+    opt.pool = &pool;
+    opt.chunk = 256;
+
+    std::vector<int32_t> x(100003);
+    std::iota(x.begin(), x.end(), -50000);
+    auto plus = [](auto a, auto b) { return a + b; };
+    int64_t expected = std::accumulate(x.begin(), x.end(), int64_t(7));
+    EXPECT_EQ(expected, simd::parallel::reduce(x.data(), x.size(), int32_t(7), plus, opt));
+
+    EXPECT_EQ(50002, simd::parallel::reduce(x.data() + 1, x.size() - 1, x[0], max_op(), opt));
+    EXPECT_EQ(3, simd::parallel::reduce(x.data(), 0, int32_t(3), plus, opt));
+}
+
+TEST(parallel, test_reduce_deterministic)
+{
+    std::vector<float> x(1 << 20);
+    for (size_t i = 0; i < x.size(); i++) {
+        x[i] = 1.f / float(i % 977 + 1);
+    }
+    auto plus = [](auto a, auto b) { return a + b; };
+    simd::parallel::options opt;
+    opt.deterministic = true;
+
+    float ref = 0;
+    for (size_t nthreads : {1, 2, 3, 5}) {
+        simd::parallel::thread_pool pool(nthreads);
+        opt.pool = &pool;
+        float s = simd::parallel::reduce(x.data(), x.size(), 0.f, plus, opt);
+        if (nthreads == 1) {
+            ref = s;
+        }
+        EXPECT_EQ(ref, s);
+    }
+}
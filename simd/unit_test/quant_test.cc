@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "simd/quant/quant.h"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace {
+/// values a quarter step off the quantization grid, well clear of the
+/// rounding boundary, spanning past both ends of the range of Q
+template <typename Q>
+void check_round_trip(simd::quant::params p)
+{
+    for (size_t n : {0, 5, 64, 301}) {
+        std::vector<float> x(n), y(n);
+        std::vector<Q> q(n);
+        std::vector<int32_t> ref(n);
+        for (size_t i = 0; i < n; i++) {
+            int32_t k = int32_t(i * 37 % 331) - 165;
+            float frac = i & 1 ? 0.25f : -0.25f;
+            x[i] = (float(k) + frac) * p.scale;
+            int32_t lo = std::numeric_limits<Q>::min(), hi = std::numeric_limits<Q>::max();
+            ref[i] = std::min(std::max(k + p.zero_point, lo), hi);
+        }
+        simd::quant::quantize(n, x.data(), p, q.data());
+        simd::quant::dequantize(n, q.data(), p, y.data());
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_EQ(ref[i], int32_t(q[i])) << "n " << n << " i " << i << " x " << x[i];
+            ASSERT_EQ((float(ref[i]) - float(p.zero_point)) * p.scale, y[i]);
+        }
+    }
+}
+}  // namespace
+
+TEST(quant, test_quantize_dequantize)
+{
+    check_round_trip<uint8_t>({0.05f, 128});
+    check_round_trip<uint8_t>({0.5f, 3});
+    check_round_trip<int8_t>({0.02f, 0});
+    check_round_trip<int8_t>({1.5f, -20});
+}
+
+TEST(quant, test_quantize_nan)
+{
+    /// 5 leaves every element in the scalar tail, 301 puts the last ones there
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    for (size_t n : {5, 301}) {
+        std::vector<float> x(n, nan);
+        std::vector<uint8_t> qu(n, 0xff);
+        std::vector<int8_t> qi(n, 0);
+        simd::quant::quantize(n, x.data(), {0.05f, 128}, qu.data());
+        simd::quant::quantize(n, x.data(), {0.02f, 0}, qi.data());
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_EQ(0, qu[i]) << "n " << n << " i " << i;
+            ASSERT_EQ(-128, qi[i]) << "n " << n << " i " << i;
+        }
+    }
+}
+
+TEST(quant, test_choose_params)
+{
+    auto p = simd::quant::choose_params<uint8_t>(-1.f, 3.f);
+    EXPECT_FLOAT_EQ(4.f / 255, p.scale);
+    EXPECT_EQ(64, p.zero_point);
+    p = simd::quant::choose_params<int8_t>(0.5f, 2.f);  /// widened to [0, 2]
+    EXPECT_FLOAT_EQ(2.f / 255, p.scale);
+    EXPECT_EQ(-128, p.zero_point);
+    p = simd::quant::choose_params<uint8_t>(0.f, 0.f);
+    EXPECT_EQ(1.f, p.scale);
+    EXPECT_EQ(0, p.zero_point);
+}
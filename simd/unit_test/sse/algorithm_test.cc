@@ -230,3 +230,17 @@ TEST(vec_op_sse, test_algo_reduce_sum)
         EXPECT_EQ(10, c);
     }
 }
+
+TEST(vec_op_sse, test_algo_reduce_max_min)
+{
+    {
+        simd::Vec<float, 8> a(1, -2, 3, 4, -5, 6, 7, 0.5f);
+        EXPECT_EQ(7, simd::reduce_max(a));
+        EXPECT_EQ(-5, simd::reduce_min(a));
+    }
+    {
+        simd::Vec<double, 4> a(1, -2, 3, 0.5);
+        EXPECT_EQ(3, simd::reduce_max(a));
+        EXPECT_EQ(-2, simd::reduce_min(a));
+    }
+}
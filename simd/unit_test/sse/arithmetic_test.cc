@@ -2,6 +2,9 @@
 
 #include "simd/simd.h"
 #include "check_arch.h"
+#include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_saturate.h"
+#include "simd/unit_test/check_dot.h"
 
 using namespace simd;
 
@@ -311,3 +314,70 @@ TEST(vec_op_sse, test_arith_neg)
         EXPECT_TRUE(simd::all_of(p == c));
     }
 }
+
+TEST(vec_op_sse, test_arith_add_sat)
+{
+    {
+        simd::Vec<int8_t, 16> a(100), b(100), p(127);
+        auto c = simd::add_sat(a, b);
+        EXPECT_TRUE(simd::all_of(p == c));
+        auto d = simd::add_sat(a, int8_t(-100));
+        EXPECT_TRUE(simd::all_of(d == 0));
+    }
+    {
+        simd::Vec<uint16_t, 8> a(60000), b(10000), p(65535);
+        auto c = simd::add_sat(a, b);
+        EXPECT_TRUE(simd::all_of(p == c));
+    }
+    {
+        simd::Vec<int32_t, 4> a(INT32_MIN + 1), b(-2), p(INT32_MIN);
+        auto c = simd::add_sat(a, b);
+        EXPECT_TRUE(simd::all_of(p == c));
+    }
+    using simd::ut::check_saturate;
+    TEST_CHECK(check_saturate<int8_t, 16>());
+    TEST_CHECK(check_saturate<uint8_t, 16>());
+    TEST_CHECK(check_saturate<int16_t, 8>());
+    TEST_CHECK(check_saturate<uint16_t, 8>());
+    TEST_CHECK(check_saturate<int32_t, 4>());
+    TEST_CHECK(check_saturate<uint32_t, 4>());
+    TEST_CHECK(check_saturate<int64_t, 2>());
+    TEST_CHECK(check_saturate<uint64_t, 2>());
+    TEST_CHECK(check_saturate<int16_t, 16>());
+}
+
+TEST(vec_op_sse, test_arith_sub_sat)
+{
+    {
+        simd::Vec<uint8_t, 16> a(10), b(20), p(0);
+        auto c = simd::sub_sat(a, b);
+        EXPECT_TRUE(simd::all_of(p == c));
+    }
+    {
+        simd::Vec<int64_t, 2> a(INT64_MAX - 1), b(-2), p(INT64_MAX);
+        auto c = simd::sub_sat(a, b);
+        EXPECT_TRUE(simd::all_of(p == c));
+    }
+}
+
+TEST(vec_op_sse, test_arith_mul_sat)
+{
+    {
+        /// 0.5 * 0.5 in Q15
+        simd::Vec<int16_t, 8> a(1 << 14), p(1 << 13);
+        auto c = simd::mul_sat(a, a);
+        EXPECT_TRUE(simd::all_of(p == c));
+    }
+    {
+        /// -1 * -1 in Q31
+        simd::Vec<int32_t, 4> a(INT32_MIN), p(INT32_MAX);
+        auto c = simd::mul_sat(a, a);
+        EXPECT_TRUE(simd::all_of(p == c));
+    }
+}
+
+TEST(vec_op_sse, test_arith_dot_u8i8)
+{
+    TEST_CHECK(simd::ut::check_dot_u8i8<4>());
+    TEST_CHECK(simd::ut::check_dot_u8i8<8>());
+}
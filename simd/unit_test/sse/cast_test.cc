@@ -2,6 +2,12 @@
 
 #include "simd/simd.h"
 #include "check_arch.h"
+#include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_cast.h"
+#include "simd/unit_test/check_half.h"
+#include "simd/unit_test/check_dot.h"
+
+#include <algorithm>
 
 TEST(vec_sse, test_vec_cast)
 {
@@ -29,4 +35,99 @@ TEST(vec_sse, test_vec_cast)
         auto b = simd::cast<double>(a);
         EXPECT_TRUE(simd::all_of(p == b));
     }
+    {
+        simd::Vec<float, 4> a(1.5f,-2,3,4);
+        simd::Vec<double, 4> p(1.5,-2,3,4);
+        auto b = simd::cast<double>(a);
+        EXPECT_TRUE(simd::all_of(p == b));
+        auto c = simd::cast<float>(b);
+        EXPECT_TRUE(simd::all_of(a == c));
+    }
+}
+
+TEST(vec_sse, test_vec_cast_u8)
+{
+    simd::Vec<uint8_t, 16> a([](size_t i) { return uint8_t(i * 17); });
+    auto f = simd::cast<float>(a);
+    for (size_t i = 0; i < 16; i++) {
+        EXPECT_EQ(float(i * 17), f[i]);
+    }
+    simd::Vec<float, 16> g([](size_t i) { return float(i) * 20.5f - 30.f; });
+    auto b = simd::cast<uint8_t>(g);
+    for (size_t i = 0; i < 16; i++) {
+        EXPECT_EQ(uint8_t(std::min(255.f, std::max(0.f, g[i]))), b[i]) << i;
+    }
+}
+
+TEST(vec_sse, test_pack_sat)
+{
+    {
+        simd::Vec<int16_t, 8> a(300), b(-300);
+        auto c = simd::pack_sat<int8_t>(a, b);
+        for (size_t i = 0; i < 16; i++) {
+            EXPECT_EQ(i < 8 ? 127 : -128, c[i]) << i;
+        }
+    }
+    using simd::ut::check_pack_sat;
+    TEST_CHECK(check_pack_sat<int8_t, int16_t, 8>());
+    TEST_CHECK(check_pack_sat<uint8_t, int16_t, 8>());
+    TEST_CHECK(check_pack_sat<uint8_t, uint16_t, 8>());
+    TEST_CHECK(check_pack_sat<int8_t, uint16_t, 8>());
+    TEST_CHECK(check_pack_sat<int16_t, int32_t, 4>());
+    TEST_CHECK(check_pack_sat<uint16_t, int32_t, 4>());
+    TEST_CHECK(check_pack_sat<uint16_t, uint32_t, 4>());
+    TEST_CHECK(check_pack_sat<int16_t, uint32_t, 4>());
+    TEST_CHECK(check_pack_sat<int32_t, int64_t, 2>());
+    TEST_CHECK(check_pack_sat<uint32_t, int64_t, 2>());
+    TEST_CHECK(check_pack_sat<uint32_t, uint64_t, 2>());
+    TEST_CHECK(check_pack_sat<int32_t, uint64_t, 2>());
+    TEST_CHECK(check_pack_sat<int8_t, int16_t, 16>());
+    TEST_CHECK(check_pack_sat<uint16_t, int32_t, 16>());
+}
+
+TEST(vec_sse, test_widen)
+{
+    using simd::ut::check_widen;
+    TEST_CHECK(check_widen<int16_t, uint8_t, 16>());
+    TEST_CHECK(check_widen<float, uint8_t, 16>());
+    TEST_CHECK(check_widen<float, int16_t, 8>());
+    TEST_CHECK(check_widen<double, int8_t, 16>());
+    TEST_CHECK(check_widen<double, int32_t, 4>());
+    TEST_CHECK(check_widen<double, uint32_t, 4>());
+    TEST_CHECK(check_widen<double, float, 4>());
+    TEST_CHECK(check_widen<int64_t, int16_t, 8>());
+    TEST_CHECK(check_widen<uint32_t, uint16_t, 8>());
+    TEST_CHECK(check_widen<float, uint8_t, 32>());
+}
+
+TEST(vec_sse, test_narrow)
+{
+    using simd::ut::check_narrow;
+    TEST_CHECK(check_narrow<uint8_t, int16_t, 8>());
+    TEST_CHECK(check_narrow<int8_t, uint16_t, 8>());
+    TEST_CHECK(check_narrow<uint8_t, float, 4>());
+    TEST_CHECK(check_narrow<int16_t, float, 4>());
+    TEST_CHECK(check_narrow<uint8_t, int32_t, 4>());
+    TEST_CHECK(check_narrow<int8_t, int64_t, 2>());
+    TEST_CHECK(check_narrow<uint32_t, int64_t, 2>());
+    TEST_CHECK(check_narrow<float, double, 2>());
+    TEST_CHECK(check_narrow<int32_t, double, 2>());
+    TEST_CHECK(check_narrow<uint8_t, float, 8>());
+}
+
+TEST(vec_sse, test_half)
+{
+    TEST_CHECK(simd::ut::check_half<4>());
+    TEST_CHECK(simd::ut::check_half<8>());
+    TEST_CHECK(simd::ut::check_half<16>());
+}
+
+TEST(vec_sse, test_bf16)
+{
+    TEST_CHECK(simd::ut::check_bf16<4>());
+    TEST_CHECK(simd::ut::check_bf16<8>());
+    TEST_CHECK(simd::ut::check_bf16<16>());
+    TEST_CHECK(simd::ut::check_dot_bf16<4>());
+    TEST_CHECK(simd::ut::check_dot_bf16<8>());
+    TEST_CHECK(simd::ut::check_dot_bf16<16>());
 }
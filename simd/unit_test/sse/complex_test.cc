@@ -2,6 +2,9 @@
 
 #include "simd/simd.h"
 #include "check_arch.h"
+#include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_complex.h"
+#include "simd/unit_test/check_math.h"
 
 #include <algorithm>
 
@@ -180,6 +183,30 @@ TEST(vec_complex_sse, test_arith_div)
     }
 }
 
+/// fused mul, mul_conj, fmadd and Smith's division on split vectors
+TEST(vec_complex_sse, test_arith_fused)
+{
+    TEST_CHECK(simd::ut::check_complex_arith<float, 4>());
+    TEST_CHECK(simd::ut::check_complex_arith<double, 2>());
+    TEST_CHECK(simd::ut::check_complex_arith<double, 4>());
+}
+
+/// abs, norm, arg, exp, log, sqrt, conj, polar against std::complex
+TEST(vec_complex_sse, test_complex_math)
+{
+    TEST_CHECK(simd::ut::check_complex_math<float, 4>());
+    TEST_CHECK(simd::ut::check_complex_math<double, 2>());
+    TEST_CHECK(simd::ut::check_complex_math<double, 4>());
+}
+
+/// VecInterleaved: permute + fmaddsub multiply, Smith division, plain I/O
+TEST(vec_complex_sse, test_complex_interleaved)
+{
+    TEST_CHECK(simd::ut::check_interleaved_complex<float, 4>());
+    TEST_CHECK(simd::ut::check_interleaved_complex<double, 2>());
+    TEST_CHECK(simd::ut::check_interleaved_complex<double, 4>());
+}
+
 TEST(vec_complex_sse, test_memory_load_aligned)
 {
     {
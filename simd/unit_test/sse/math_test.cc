@@ -2,6 +2,8 @@
 
 #include "simd/simd.h"
 #include "check_arch.h"
+#include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_math.h"
 
 TEST(vec_op_sse, test_math_abs)
 {
@@ -114,3 +116,11 @@ TEST(vec_op_sse, test_math_log)
         }
     }
 }
+
+/// exp, log, sin, cos, sincos, atan2, hypot in ulp against std
+TEST(vec_op_sse, test_math_transcendental)
+{
+    TEST_CHECK(simd::ut::check_real_math<float, 4>());
+    TEST_CHECK(simd::ut::check_real_math<double, 2>());
+    TEST_CHECK(simd::ut::check_real_math<float, 8>());
+}
@@ -3,6 +3,8 @@
 #include "simd/simd.h"
 
 #include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_wide.h"
+#include "simd/unit_test/check_padded.h"
 #include "check_arch.h"
 
 using namespace simd;
@@ -65,6 +67,54 @@ TEST(vec_sse, test_types)
     TEST_VEC_TYPE(simd::vcf64x8_t, 8, 4, 2, simd::Generic);
 }
 
+TEST(vec_sse, test_wide)
+{
+    TEST_VEC_TYPE(simd::vf32x32_t,  32,  8,  4, simd::SSE);
+    TEST_VEC_TYPE(simd::vf32x128_t, 128, 32, 4, simd::SSE);
+    TEST_VEC_TYPE(simd::vf64x16_t,  16,  8,  2, simd::SSE);
+    TEST_VEC_TYPE(simd::vf64x64_t,  64,  32, 2, simd::SSE);
+
+    TEST_CHECK(ut::check_wide<float, 32>());
+    TEST_CHECK(ut::check_wide<float, 64>());
+    TEST_CHECK(ut::check_wide<float, 128>());
+    TEST_CHECK(ut::check_wide<double, 16>());
+    TEST_CHECK(ut::check_wide<double, 32>());
+    TEST_CHECK(ut::check_wide<double, 64>());
+    TEST_CHECK(ut::check_wide<int32_t, 32>());
+    TEST_CHECK(ut::check_wide<int32_t, 128>());
+    TEST_CHECK(ut::check_wide<uint8_t, 256>());
+    TEST_CHECK(ut::check_wide<int64_t, 64>());
+}
+
+TEST(vec_sse, test_padded)
+{
+    using vf32x3_t = simd::Vec<float, 3>;
+    EXPECT_EQ(true, (std::is_same<simd::SSE, vf32x3_t::arch_t>::value));
+    EXPECT_EQ(1, vf32x3_t::n_regs());
+    EXPECT_EQ(4, vf32x3_t::padded_lanes());
+    using vf64x5_t = simd::Vec<double, 5>;
+    EXPECT_EQ(true, (std::is_same<simd::SSE, vf64x5_t::arch_t>::value));
+    EXPECT_EQ(3, vf64x5_t::n_regs());
+    EXPECT_EQ(6, vf64x5_t::padded_lanes());
+
+    TEST_CHECK(ut::check_padded<float, 3>());
+    TEST_CHECK(ut::check_padded<float, 5>());
+    TEST_CHECK(ut::check_padded<float, 12>());
+    TEST_CHECK(ut::check_padded<float, 20>());
+    TEST_CHECK(ut::check_padded<double, 3>());
+    TEST_CHECK(ut::check_padded<double, 5>());
+    TEST_CHECK(ut::check_padded<int32_t, 5>());
+    TEST_CHECK(ut::check_padded<int32_t, 7>());
+    TEST_CHECK(ut::check_padded<int64_t, 3>());
+    TEST_CHECK(ut::check_padded<int8_t, 20>());
+    TEST_CHECK(ut::check_padded<int16_t, 12>());
+    TEST_CHECK(ut::check_padded<uint8_t, 7>());
+    /// mask queries past 64 lanes, 8-bit lanes past 128
+    TEST_CHECK(ut::check_padded<int8_t, 100>());
+    TEST_CHECK(ut::check_padded<int8_t, 200>());
+    TEST_CHECK(ut::check_padded<uint8_t, 200>());
+}
+
 TEST(vec_sse, test_vec_ctor_generator)
 {
     {
@@ -0,0 +1,22 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "check_arch.h"
+#include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_transpose.h"
+
+TEST(vec_op_sse, test_transpose)
+{
+    using simd::ut::check_transpose;
+    /// one register per row
+    TEST_CHECK(check_transpose<int8_t, 16>());
+    TEST_CHECK(check_transpose<uint16_t, 8>());
+    TEST_CHECK(check_transpose<int32_t, 4>());
+    TEST_CHECK(check_transpose<uint64_t, 2>());
+    TEST_CHECK(check_transpose<float, 4>());
+    TEST_CHECK(check_transpose<double, 2>());
+    /// several registers per row
+    TEST_CHECK(check_transpose<uint8_t, 32>());
+    TEST_CHECK(check_transpose<float, 8>());
+    TEST_CHECK(check_transpose<double, 8>());
+}
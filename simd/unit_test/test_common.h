@@ -1,5 +1,7 @@
 #pragma once
 
+#include <type_traits>
+
 namespace simd {
 namespace ut {
 
@@ -17,5 +19,14 @@ namespace ut {
 } \
 ///###
 
+/// the check_* templates in check_*.h report failures at their own file/line,
+/// wrap each call in TEST_CHECK to add a trace of the calling line
+#define TEST_CHECK(...) \
+{ \
+    SCOPED_TRACE(#__VA_ARGS__); \
+    __VA_ARGS__; \
+} \
+///###
+
 }  // namespace ut
 }  // namespace simd
@@ -0,0 +1,28 @@
+#include <gtest/gtest.h>
+
+#include "simd/simd.h"
+#include "simd/unit_test/test_common.h"
+#include "simd/unit_test/check_ternlog.h"
+#include "simd/unit_test/check_vec_expr.h"
+
+TEST(vec_expr, test_fused)
+{
+    TEST_CHECK(simd::ut::check_vec_expr<float, 4>());
+    TEST_CHECK(simd::ut::check_vec_expr<double, 2>());
+    TEST_CHECK(simd::ut::check_vec_expr<float, 8>());
+}
+
+TEST(vec_expr, test_bitwise)
+{
+    TEST_CHECK(simd::ut::check_vec_expr_bitwise<int32_t, 4>());
+    TEST_CHECK(simd::ut::check_vec_expr_bitwise<uint8_t, 16>());
+    TEST_CHECK(simd::ut::check_vec_expr_bitwise<int64_t, 4>());
+}
+
+TEST(vec_expr, test_ternlog)
+{
+    TEST_CHECK(simd::ut::check_ternlog<int32_t, 4>());
+    TEST_CHECK(simd::ut::check_ternlog<uint16_t, 8>());
+    TEST_CHECK(simd::ut::check_ternlog<float, 4>());
+    TEST_CHECK(simd::ut::check_ternlog<double, 2>());
+}
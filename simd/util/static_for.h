@@ -0,0 +1,29 @@
+#pragma once
+
+#include "simd/config/inline.h"
+#include "simd/types/traits.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace simd {
+namespace detail {
+/// compile-time unrolled loop, f(std::integral_constant<size_t, I>) for I in [0, N)
+/// keeps accumulator indices constant so they map onto named registers
+template <typename F, size_t... Is>
+SIMD_INLINE
+void static_for(F&& f, index_sequence<Is...>) noexcept
+{
+    int expand[] = {0, (f(std::integral_constant<size_t, Is>()), 0)...};
+    (void)expand;
+}
+
+template <size_t N, typename F>
+SIMD_INLINE
+void static_for(F&& f) noexcept
+{
+    static_for(std::forward<F>(f), make_index_sequence<N>());
+}
+}  // namespace detail
+}  // namespace simd